@@ -34,6 +34,7 @@
 #include <Nazara/Audio/AudioBuffer.hpp>
 #include <Nazara/Audio/AudioDevice.hpp>
 #include <Nazara/Audio/AudioSource.hpp>
+#include <Nazara/Audio/AudioStreamer.hpp>
 #include <Nazara/Audio/Config.hpp>
 #include <Nazara/Audio/DummyAudioBuffer.hpp>
 #include <Nazara/Audio/DummyAudioDevice.hpp>
@@ -45,6 +46,9 @@
 #include <Nazara/Audio/OpenALDevice.hpp>
 #include <Nazara/Audio/OpenALLibrary.hpp>
 #include <Nazara/Audio/OpenALSource.hpp>
+#include <Nazara/Audio/SoftwareAudioBuffer.hpp>
+#include <Nazara/Audio/SoftwareAudioDevice.hpp>
+#include <Nazara/Audio/SoftwareAudioSource.hpp>
 #include <Nazara/Audio/Sound.hpp>
 #include <Nazara/Audio/SoundBuffer.hpp>
 #include <Nazara/Audio/SoundEmitter.hpp>
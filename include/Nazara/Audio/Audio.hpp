@@ -8,6 +8,7 @@
 #define NAZARA_AUDIO_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Audio/AudioStreamer.hpp>
 #include <Nazara/Audio/Config.hpp>
 #include <Nazara/Audio/Enums.hpp>
 #include <Nazara/Audio/SoundBuffer.hpp>
@@ -30,6 +31,7 @@ namespace Nz
 			Audio(Audio&&) = delete;
 			~Audio();
 
+			AudioStreamer& GetAudioStreamer();
 			const std::shared_ptr<AudioDevice>& GetDefaultDevice() const;
 
 			SoundBufferLoader& GetSoundBufferLoader();
@@ -47,11 +49,13 @@ namespace Nz
 
 			struct Config
 			{
+				std::size_t streamingThreadCount = 1;
 				bool allowDummyDevice = true;
 				bool noAudio = false;
 			};
 
 		private:
+			AudioStreamer m_audioStreamer; //< first to be constructed, last to be destroyed
 			std::shared_ptr<AudioDevice> m_defaultDevice;
 			SoundBufferLoader m_soundBufferLoader;
 			SoundStreamLoader m_soundStreamLoader;
@@ -0,0 +1,88 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_AUDIO_AUDIOSTREAMER_HPP
+#define NAZARA_AUDIO_AUDIOSTREAMER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Audio/Config.hpp>
+#include <Nazara/Core/Time.hpp>
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Nz
+{
+	// Small pool of threads decoding every sound stream, instead of one thread per stream
+	class NAZARA_AUDIO_API AudioStreamer
+	{
+		public:
+			using StreamId = std::size_t;
+			using UpdateCallback = std::function<bool()>; //< returns false once streaming is over
+
+			AudioStreamer(std::size_t threadCount = 1, Time updateInterval = Time::Milliseconds(10));
+			AudioStreamer(const AudioStreamer&) = delete;
+			AudioStreamer(AudioStreamer&&) = delete;
+			~AudioStreamer();
+
+			inline std::size_t GetThreadCount() const;
+			inline Time GetUpdateInterval() const;
+
+			StreamId RegisterStream(UpdateCallback updateCallback);
+
+			void UnregisterStream(StreamId streamId);
+
+			AudioStreamer& operator=(const AudioStreamer&) = delete;
+			AudioStreamer& operator=(AudioStreamer&&) = delete;
+
+		private:
+			struct Command
+			{
+				enum class Type
+				{
+					Register,
+					Unregister
+				};
+
+				Type type;
+				Command* next;
+				StreamId streamId;
+				UpdateCallback updateCallback;
+				std::promise<void> unregistered;
+			};
+
+			struct Stream
+			{
+				StreamId streamId;
+				UpdateCallback updateCallback;
+			};
+
+			struct Worker
+			{
+				std::atomic<Command*> pendingCommands; //< lock-free multiple producers/single consumer list, in reverse order (closed once the worker stopped)
+				std::thread thread;
+				std::vector<Stream> streams;
+			};
+
+			void ProcessCommands(Worker& worker, bool closeQueue = false);
+			bool PushCommand(Worker& worker, std::unique_ptr<Command> command);
+			void WorkerThread(Worker& worker);
+
+			static Command* GetClosedQueueMarker(Worker& worker);
+
+			std::atomic_bool m_running;
+			std::atomic<StreamId> m_nextStreamId;
+			std::vector<std::unique_ptr<Worker>> m_workers;
+			Time m_updateInterval;
+	};
+}
+
+#include <Nazara/Audio/AudioStreamer.inl>
+
+#endif // NAZARA_AUDIO_AUDIOSTREAMER_HPP
@@ -0,0 +1,21 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/AudioStreamer.hpp>
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+	inline std::size_t AudioStreamer::GetThreadCount() const
+	{
+		return m_workers.size();
+	}
+
+	inline Time AudioStreamer::GetUpdateInterval() const
+	{
+		return m_updateInterval;
+	}
+}
+
+#include <Nazara/Audio/DebugOff.hpp>
@@ -8,14 +8,13 @@
 #define NAZARA_AUDIO_MUSIC_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Audio/AudioStreamer.hpp>
 #include <Nazara/Audio/Enums.hpp>
 #include <Nazara/Audio/SoundEmitter.hpp>
 #include <Nazara/Audio/SoundStream.hpp>
 #include <atomic>
-#include <condition_variable>
 #include <memory>
 #include <mutex>
-#include <thread>
 #include <vector>
 
 namespace Nz
@@ -27,6 +26,7 @@ namespace Nz
 		public:
 			Music();
 			Music(AudioDevice& device);
+			Music(AudioDevice& device, AudioStreamer& streamer);
 			Music(const Music&) = delete;
 			Music(Music&&) = delete;
 			~Music();
@@ -62,21 +62,23 @@ namespace Nz
 
 		private:
 			AudioFormat m_audioFormat;
+			AudioStreamer& m_streamer;
+			AudioStreamer::StreamId m_streamId;
 			std::atomic_bool m_streaming;
 			std::atomic<UInt64> m_processedSamples;
 			mutable std::recursive_mutex m_sourceLock;
 			std::size_t m_bufferCount;
 			std::shared_ptr<SoundStream> m_stream;
-			std::thread m_thread;
 			std::vector<Int16> m_chunkSamples;
 			UInt32 m_sampleRate;
 			UInt64 m_streamOffset;
+			bool m_isStreamRegistered;
 			bool m_looping;
 
 			bool FillAndQueueBuffer(std::shared_ptr<AudioBuffer> buffer);
-			void MusicThread(std::condition_variable& cv, std::mutex& m, std::exception_ptr& err, bool startPaused);
-			void StartThread(bool startPaused);
-			void StopThread();
+			void StartStreaming(bool startPaused);
+			void StopStreaming();
+			bool UpdateStream();
 	};
 }
 
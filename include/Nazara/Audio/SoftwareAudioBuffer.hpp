@@ -0,0 +1,55 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_AUDIO_SOFTWAREAUDIOBUFFER_HPP
+#define NAZARA_AUDIO_SOFTWAREAUDIOBUFFER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Audio/AudioBuffer.hpp>
+#include <Nazara/Audio/Config.hpp>
+#include <Nazara/Audio/Enums.hpp>
+#include <Nazara/Core/Time.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_AUDIO_API SoftwareAudioBuffer final : public AudioBuffer
+	{
+		public:
+			using AudioBuffer::AudioBuffer;
+			SoftwareAudioBuffer(const SoftwareAudioBuffer&) = delete;
+			SoftwareAudioBuffer(SoftwareAudioBuffer&&) = delete;
+			~SoftwareAudioBuffer() = default;
+
+			inline AudioFormat GetAudioFormat() const;
+			inline UInt32 GetChannelCount() const;
+			Time GetDuration() const;
+			inline UInt64 GetFrameCount() const;
+			UInt64 GetSampleCount() const override;
+			inline const float* GetSamples() const;
+			UInt64 GetSize() const override;
+			UInt32 GetSampleRate() const override;
+
+			bool IsCompatibleWith(const AudioDevice& device) const override;
+
+			bool Reset(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, const void* samples) override;
+
+			SoftwareAudioBuffer& operator=(const SoftwareAudioBuffer&) = delete;
+			SoftwareAudioBuffer& operator=(SoftwareAudioBuffer&&) = delete;
+
+		private:
+			std::vector<float> m_samples; //< normalized mono or interleaved stereo samples
+			AudioFormat m_format = AudioFormat::Unknown;
+			UInt32 m_channelCount = 0;
+			UInt32 m_sampleRate = 0;
+			UInt64 m_frameCount = 0;
+			UInt64 m_sampleCount = 0;
+	};
+}
+
+#include <Nazara/Audio/SoftwareAudioBuffer.inl>
+
+#endif // NAZARA_AUDIO_SOFTWAREAUDIOBUFFER_HPP
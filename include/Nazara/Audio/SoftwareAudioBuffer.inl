@@ -0,0 +1,31 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/SoftwareAudioBuffer.hpp>
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+	inline AudioFormat SoftwareAudioBuffer::GetAudioFormat() const
+	{
+		return m_format;
+	}
+
+	inline UInt32 SoftwareAudioBuffer::GetChannelCount() const
+	{
+		return m_channelCount;
+	}
+
+	inline UInt64 SoftwareAudioBuffer::GetFrameCount() const
+	{
+		return m_frameCount;
+	}
+
+	inline const float* SoftwareAudioBuffer::GetSamples() const
+	{
+		return m_samples.data();
+	}
+}
+
+#include <Nazara/Audio/DebugOff.hpp>
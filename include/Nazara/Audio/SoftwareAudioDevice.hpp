@@ -0,0 +1,96 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_AUDIO_SOFTWAREAUDIODEVICE_HPP
+#define NAZARA_AUDIO_SOFTWAREAUDIODEVICE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Audio/AudioDevice.hpp>
+#include <Nazara/Audio/Config.hpp>
+#include <Nazara/Audio/Enums.hpp>
+#include <mutex>
+#include <vector>
+
+namespace Nz
+{
+	class SoftwareAudioSource;
+
+	class NAZARA_AUDIO_API SoftwareAudioDevice : public AudioDevice
+	{
+		friend SoftwareAudioSource;
+
+		public:
+			SoftwareAudioDevice(UInt32 sampleRate = 44100, std::size_t maxVoiceCount = 64);
+			SoftwareAudioDevice(const SoftwareAudioDevice&) = delete;
+			SoftwareAudioDevice(SoftwareAudioDevice&&) = delete;
+			~SoftwareAudioDevice() = default;
+
+			std::shared_ptr<AudioBuffer> CreateBuffer() override;
+			std::shared_ptr<AudioSource> CreateSource() override;
+
+			float GetDopplerFactor() const override;
+			float GetGlobalVolume() const override;
+			Vector3f GetListenerDirection(Vector3f* up = nullptr) const override;
+			Vector3f GetListenerPosition() const override;
+			Quaternionf GetListenerRotation() const override;
+			Vector3f GetListenerVelocity() const override;
+			std::size_t GetMaxVoiceCount() const;
+			std::size_t GetMixedVoiceCount() const;
+			inline UInt32 GetSampleRate() const;
+			float GetSpeedOfSound() const override;
+			const void* GetSubSystemIdentifier() const override;
+
+			bool IsFormatSupported(AudioFormat format) const override;
+
+			void Render(float* output, UInt32 frameCount);
+			void Render(Int16* output, UInt32 frameCount);
+
+			void SetDopplerFactor(float dopplerFactor) override;
+			void SetGlobalVolume(float volume) override;
+			void SetListenerDirection(const Vector3f& direction, const Vector3f& up = Vector3f::Up()) override;
+			void SetListenerPosition(const Vector3f& position) override;
+			void SetListenerVelocity(const Vector3f& velocity) override;
+			void SetMaxVoiceCount(std::size_t maxVoiceCount);
+			void SetSpeedOfSound(float speed) override;
+
+			SoftwareAudioDevice& operator=(const SoftwareAudioDevice&) = delete;
+			SoftwareAudioDevice& operator=(SoftwareAudioDevice&&) = delete;
+
+		private:
+			struct Voice
+			{
+				SoftwareAudioSource* source;
+				float leftGain;
+				float rightGain;
+				double step;
+			};
+
+			void ComputeVoice(SoftwareAudioSource& source, Voice& voice) const;
+			void RegisterSource(SoftwareAudioSource* source);
+			void RenderInternal(float* output, UInt32 frameCount);
+			void RenderVoice(const Voice& voice, float* output, UInt32 frameCount, bool mix);
+			void UnregisterSource(SoftwareAudioSource* source);
+
+			mutable std::mutex m_mutex;
+			std::size_t m_maxVoiceCount;
+			std::size_t m_mixedVoiceCount;
+			std::vector<float> m_floatBuffer;
+			std::vector<float> m_resampleBuffer;
+			std::vector<SoftwareAudioSource*> m_sources;
+			std::vector<Voice> m_voices;
+			Quaternionf m_listenerRotation;
+			Vector3f m_listenerVelocity;
+			Vector3f m_listenerPosition;
+			UInt32 m_sampleRate;
+			float m_dopplerFactor;
+			float m_globalVolume;
+			float m_speedOfSound;
+	};
+}
+
+#include <Nazara/Audio/SoftwareAudioDevice.inl>
+
+#endif // NAZARA_AUDIO_SOFTWAREAUDIODEVICE_HPP
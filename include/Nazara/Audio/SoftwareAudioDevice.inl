@@ -0,0 +1,16 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/SoftwareAudioDevice.hpp>
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+	inline UInt32 SoftwareAudioDevice::GetSampleRate() const
+	{
+		return m_sampleRate;
+	}
+}
+
+#include <Nazara/Audio/DebugOff.hpp>
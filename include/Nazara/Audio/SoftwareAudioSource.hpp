@@ -0,0 +1,96 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_AUDIO_SOFTWAREAUDIOSOURCE_HPP
+#define NAZARA_AUDIO_SOFTWAREAUDIOSOURCE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Audio/AudioSource.hpp>
+#include <Nazara/Audio/Config.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class SoftwareAudioBuffer;
+	class SoftwareAudioDevice;
+
+	class NAZARA_AUDIO_API SoftwareAudioSource final : public AudioSource
+	{
+		friend SoftwareAudioDevice;
+
+		public:
+			SoftwareAudioSource(std::shared_ptr<SoftwareAudioDevice> device);
+			SoftwareAudioSource(const SoftwareAudioSource&) = delete;
+			SoftwareAudioSource(SoftwareAudioSource&&) = delete;
+			~SoftwareAudioSource();
+
+			void EnableLooping(bool loop) override;
+			void EnableSpatialization(bool spatialization) override;
+
+			float GetAttenuation() const override;
+			float GetMinDistance() const override;
+			float GetPitch() const override;
+			Time GetPlayingOffset() const override;
+			Vector3f GetPosition() const override;
+			UInt32 GetSampleOffset() const override;
+			OffsetWithLatency GetSampleOffsetAndLatency() const override;
+			Vector3f GetVelocity() const override;
+			SoundStatus GetStatus() const override;
+			float GetVolume() const override;
+
+			bool IsLooping() const override;
+			bool IsSpatializationEnabled() const override;
+
+			void QueueBuffer(std::shared_ptr<AudioBuffer> audioBuffer) override;
+
+			void Pause() override;
+			void Play() override;
+
+			void SetAttenuation(float attenuation) override;
+			void SetBuffer(std::shared_ptr<AudioBuffer> audioBuffer) override;
+			void SetMinDistance(float minDistance) override;
+			void SetPitch(float pitch) override;
+			void SetPlayingOffset(Time offset) override;
+			void SetPosition(const Vector3f& position) override;
+			void SetSampleOffset(UInt32 offset) override;
+			void SetVelocity(const Vector3f& velocity) override;
+			void SetVolume(float volume) override;
+
+			void Stop() override;
+
+			std::shared_ptr<AudioBuffer> TryUnqueueProcessedBuffer() override;
+
+			void UnqueueAllBuffers() override;
+
+			SoftwareAudioSource& operator=(const SoftwareAudioSource&) = delete;
+			SoftwareAudioSource& operator=(SoftwareAudioSource&&) = delete;
+
+		private:
+			SoftwareAudioDevice& GetDevice() const;
+			UInt32 GetSampleOffsetInternal() const;
+			void RequeueBuffers();
+			void SetSampleOffsetInternal(UInt32 offset);
+			void StopInternal();
+
+			// Accessed by the device while rendering, under the device mutex
+			std::vector<std::shared_ptr<SoftwareAudioBuffer>> m_queuedBuffers;
+			std::vector<std::shared_ptr<SoftwareAudioBuffer>> m_processedBuffers;
+			SoundStatus m_status;
+			Vector3f m_position;
+			Vector3f m_velocity;
+			bool m_isLooping;
+			bool m_isSpatialized;
+			double m_frameOffset; //< position in the front queued buffer, in frames
+			float m_attenuation;
+			float m_minDistance;
+			float m_pitch;
+			float m_volume;
+	};
+}
+
+#include <Nazara/Audio/SoftwareAudioSource.inl>
+
+#endif // NAZARA_AUDIO_SOFTWAREAUDIOSOURCE_HPP
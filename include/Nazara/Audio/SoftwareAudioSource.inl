@@ -0,0 +1,12 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/SoftwareAudioSource.hpp>
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+}
+
+#include <Nazara/Audio/DebugOff.hpp>
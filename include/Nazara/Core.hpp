@@ -32,6 +32,7 @@
 #include <Nazara/Core/AbstractHash.hpp>
 #include <Nazara/Core/AbstractLogger.hpp>
 #include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/AsyncLogger.hpp>
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/ByteArrayPool.hpp>
 #include <Nazara/Core/ByteStream.hpp>
@@ -59,6 +60,7 @@
 #include <Nazara/Core/ObjectHandle.hpp>
 #include <Nazara/Core/ObjectLibrary.hpp>
 #include <Nazara/Core/ObjectRef.hpp>
+#include <Nazara/Core/ParallelFor.hpp>
 #include <Nazara/Core/ParameterList.hpp>
 #include <Nazara/Core/Plugin.hpp>
 #include <Nazara/Core/PluginInterface.hpp>
@@ -28,6 +28,9 @@ namespace Nz
 
 	inline bool HashAppend(AbstractHash* hash, const std::string_view& v);
 
+	template<typename T> T ReadRawValue(const UInt8*& ptr);
+	template<typename T> void ReadRawValues(const UInt8*& ptr, T* values, std::size_t count);
+
 	template<typename T>
 	bool Serialize(SerializationContext& context, T&& value);
 
@@ -45,6 +48,9 @@ namespace Nz
 
 	template<typename T>
 	std::enable_if_t<std::is_arithmetic<T>::value, bool> Unserialize(SerializationContext& context, T* value, TypeTag<T>);
+
+	template<typename T> void WriteRawValue(UInt8*& ptr, const T& value);
+	template<typename T> void WriteRawValues(UInt8*& ptr, const T* values, std::size_t count);
 }
 
 #include <Nazara/Core/Algorithm.inl>
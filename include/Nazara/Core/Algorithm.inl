@@ -11,6 +11,7 @@
 #include <cassert>
 #include <climits>
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <utility>
 #include <Nazara/Core/Debug.hpp>
@@ -64,6 +65,48 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \ingroup core
+	* \brief Reads a value stored in native representation and advances the pointer
+	* \return Value read
+	*
+	* \param ptr Pointer to the value, moved past it
+	*
+	* \remark No endianness conversion is done, this is meant for data which never leaves the process (such as saved states)
+	*
+	* \see WriteRawValue
+	*/
+	template<typename T>
+	T ReadRawValue(const UInt8*& ptr)
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+
+		T value;
+		std::memcpy(&value, ptr, sizeof(T));
+		ptr += sizeof(T);
+
+		return value;
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Reads values stored in native representation and advances the pointer
+	*
+	* \param ptr Pointer to the values, moved past them
+	* \param values Output values
+	* \param count Number of values to read
+	*
+	* \see WriteRawValues
+	*/
+	template<typename T>
+	void ReadRawValues(const UInt8*& ptr, T* values, std::size_t count)
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+
+		std::memcpy(values, ptr, count * sizeof(T));
+		ptr += count * sizeof(T);
+	}
+
 	template<typename T>
 	bool Serialize(SerializationContext& context, T&& value)
 	{
@@ -216,6 +259,43 @@ namespace Nz
 		else
 			return false;
 	}
+
+	/*!
+	* \ingroup core
+	* \brief Writes a value in native representation and advances the pointer
+	*
+	* \param ptr Destination pointer, moved past the written value
+	* \param value Value to write
+	*
+	* \see ReadRawValue
+	*/
+	template<typename T>
+	void WriteRawValue(UInt8*& ptr, const T& value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+
+		std::memcpy(ptr, &value, sizeof(T));
+		ptr += sizeof(T);
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Writes values in native representation and advances the pointer
+	*
+	* \param ptr Destination pointer, moved past the written values
+	* \param values Values to write
+	* \param count Number of values to write
+	*
+	* \see ReadRawValues
+	*/
+	template<typename T>
+	void WriteRawValues(UInt8*& ptr, const T* values, std::size_t count)
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+
+		std::memcpy(ptr, values, count * sizeof(T));
+		ptr += count * sizeof(T);
+	}
 }
 
 #include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,123 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_ASYNCLOGGER_HPP
+#define NAZARA_CORE_ASYNCLOGGER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/AbstractLogger.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <Nazara/Core/StdLogger.hpp>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace Nz
+{
+	class NAZARA_CORE_API AsyncLogger : public AbstractLogger
+	{
+		public:
+			struct Statistics;
+
+			AsyncLogger(std::filesystem::path logPath = "NazaraLog.log", std::size_t recordCapacity = 1024, LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Block);
+			AsyncLogger(const AsyncLogger&) = delete;
+			AsyncLogger(AsyncLogger&&) = delete;
+			~AsyncLogger();
+
+			void EnableStdReplication(bool enable) override;
+			void EnableTimeLogging(bool enable);
+
+			void Flush();
+
+			inline std::size_t GetCapacity() const;
+			inline LogOverflowPolicy GetOverflowPolicy() const;
+			Statistics GetStatistics() const;
+
+			bool IsStdReplicationEnabled() const override;
+			bool IsTimeLoggingEnabled() const;
+
+			inline void SetOverflowPolicy(LogOverflowPolicy overflowPolicy);
+
+			void Write(const std::string_view& string) override;
+			void WriteError(ErrorType type, const std::string_view& error, unsigned int line = 0, const char* file = nullptr, const char* function = nullptr) override;
+
+			AsyncLogger& operator=(const AsyncLogger&) = delete;
+			AsyncLogger& operator=(AsyncLogger&&) = delete;
+
+			static constexpr std::size_t InlineRecordSize = 480;
+			static constexpr std::size_t MaxBatchSize = 256;
+
+			struct Statistics
+			{
+				UInt64 batchCount;
+				UInt64 droppedRecords;
+				UInt64 queuedRecords;
+				UInt64 writtenRecords;
+			};
+
+		private:
+			struct Record
+			{
+				std::array<char, InlineRecordSize> inlineData;
+				std::string overflowData;
+				std::time_t time;
+				std::size_t size;
+			};
+
+			struct Slot
+			{
+				std::atomic<std::size_t> sequence;
+				Record record;
+			};
+
+			template<std::size_t N> bool Enqueue(const std::array<std::string_view, N>& parts);
+			void FormatTimestamp(std::time_t time);
+			bool HasPendingRecord() const;
+			void OpenOutputFile();
+			bool ProcessRecords();
+			void WakeWriterThread();
+			void WriterThread();
+
+			std::atomic_bool m_running;
+			std::atomic_bool m_stdReplicationEnabled;
+			std::atomic_bool m_timeLoggingEnabled;
+			std::atomic_bool m_writerSleeping;
+			std::atomic<LogOverflowPolicy> m_overflowPolicy;
+			std::atomic<UInt64> m_batchCount;
+			std::atomic<UInt64> m_droppedRecords;
+			std::atomic<UInt64> m_writtenRecords;
+			std::atomic<std::size_t> m_enqueuePosition;
+			std::atomic<std::size_t> m_flushedPosition;
+			std::atomic_uint m_pendingFlushes;
+			std::array<char, 24> m_timestampBuffer;
+			std::condition_variable m_flushCondition;
+			std::condition_variable m_wakeCondition;
+			std::filesystem::path m_outputPath;
+			std::fstream m_outputFile;
+			std::mutex m_flushMutex;
+			std::mutex m_wakeMutex;
+			std::size_t m_dequeuePosition;
+			std::size_t m_slotMask;
+			std::size_t m_timestampLength;
+			std::string m_batchBuffer;
+			std::thread m_writerThread;
+			std::time_t m_cachedTimestamp;
+			std::unique_ptr<Slot[]> m_slots;
+			StdLogger m_stdLogger;
+			bool m_outputFileFailed;
+	};
+}
+
+#include <Nazara/Core/AsyncLogger.inl>
+
+#endif // NAZARA_CORE_ASYNCLOGGER_HPP
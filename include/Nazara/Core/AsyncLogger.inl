@@ -0,0 +1,26 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/AsyncLogger.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	inline std::size_t AsyncLogger::GetCapacity() const
+	{
+		return m_slotMask + 1;
+	}
+
+	inline LogOverflowPolicy AsyncLogger::GetOverflowPolicy() const
+	{
+		return m_overflowPolicy.load(std::memory_order_relaxed);
+	}
+
+	inline void AsyncLogger::SetOverflowPolicy(LogOverflowPolicy overflowPolicy)
+	{
+		m_overflowPolicy.store(overflowPolicy, std::memory_order_relaxed);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
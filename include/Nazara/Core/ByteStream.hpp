@@ -38,6 +38,7 @@ namespace Nz
 			inline bool FlushBits();
 
 			inline std::size_t Read(void* ptr, std::size_t size);
+			inline UInt64 ReadBits(UInt8 bitCount);
 
 			inline void SetDataEndianness(Endianness endiannes);
 			inline void SetStream(Stream* stream);
@@ -46,6 +47,7 @@ namespace Nz
 			void SetStream(const void* ptr, Nz::UInt64 size);
 
 			inline std::size_t Write(const void* data, std::size_t size);
+			inline void WriteBits(UInt64 value, UInt8 bitCount);
 
 			template<typename T>
 			ByteStream& operator>>(T& value);
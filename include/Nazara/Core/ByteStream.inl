@@ -4,6 +4,7 @@
 
 #include <Nazara/Core/ByteStream.hpp>
 #include <Nazara/Core/Algorithm.hpp>
+#include <algorithm>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -114,6 +115,50 @@ namespace Nz
 		return m_context.stream->Read(ptr, size);
 	}
 
+	/*!
+	* \brief Reads an unsigned integer packed on a number of bits
+	* \return Value read (zero-extended)
+	*
+	* \param bitCount Number of bits to read (up to 64)
+	*
+	* \remark Bits are read in the same order as booleans are, so both can be interleaved
+	* \remark Produces a NazaraError if the stream has no more data
+	*
+	* \see WriteBits
+	*/
+	inline UInt64 ByteStream::ReadBits(UInt8 bitCount)
+	{
+		NazaraAssert(bitCount <= 64, "Bit count out of range");
+
+		if (!m_context.stream)
+			OnEmptyStream();
+
+		UInt64 value = 0;
+		UInt8 offset = 0;
+		while (offset < bitCount)
+		{
+			if (m_context.readBitPos == 8)
+			{
+				if (!Unserialize(m_context, &m_context.readByte, TypeTag<UInt8>()))
+				{
+					NazaraError("Failed to read bits");
+					return 0;
+				}
+
+				m_context.readBitPos = 0;
+			}
+
+			UInt8 chunkSize = std::min<UInt8>(bitCount - offset, 8 - m_context.readBitPos);
+			UInt64 chunk = (m_context.readByte >> m_context.readBitPos) & ((1U << chunkSize) - 1);
+
+			value |= chunk << offset;
+			offset += chunkSize;
+			m_context.readBitPos += chunkSize;
+		}
+
+		return value;
+	}
+
 	/*!
 	* \brief Sets the stream endianness
 	*
@@ -156,6 +201,54 @@ namespace Nz
 		return m_context.stream->Write(data, size);
 	}
 
+	/*!
+	* \brief Writes an unsigned integer packed on a number of bits
+	*
+	* \param value Value to write, only its lowest bitCount bits are written
+	* \param bitCount Number of bits to write (up to 64)
+	*
+	* \remark Bits are written in the same order as booleans are, so both can be interleaved
+	* \remark Pending bits are written to the stream when a whole byte is complete or when FlushBits is called
+	* \remark Produces a NazaraError if writing failed
+	*
+	* \see ReadBits
+	*/
+	inline void ByteStream::WriteBits(UInt64 value, UInt8 bitCount)
+	{
+		NazaraAssert(bitCount <= 64, "Bit count out of range");
+
+		if (!m_context.stream)
+			OnEmptyStream();
+
+		while (bitCount > 0)
+		{
+			if (m_context.writeBitPos == 8)
+			{
+				m_context.writeBitPos = 0;
+				m_context.writeByte = 0;
+			}
+
+			UInt8 chunkSize = std::min<UInt8>(bitCount, 8 - m_context.writeBitPos);
+			UInt8 chunk = static_cast<UInt8>(value & ((1U << chunkSize) - 1));
+
+			m_context.writeByte |= chunk << m_context.writeBitPos;
+			m_context.writeBitPos += chunkSize;
+
+			value >>= chunkSize;
+			bitCount -= chunkSize;
+
+			if (m_context.writeBitPos >= 8)
+			{
+				// writeBitPos is 8 so Serialize won't try to flush bits itself
+				if (!Serialize(m_context, m_context.writeByte, TypeTag<UInt8>()))
+				{
+					NazaraError("Failed to write bits");
+					return;
+				}
+			}
+		}
+	}
+
 	/*!
 	* \brief Outputs a data from the stream
 	* \return A reference to this
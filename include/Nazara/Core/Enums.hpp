@@ -92,6 +92,14 @@ namespace Nz
 
 	constexpr std::size_t HashTypeCount = static_cast<std::size_t>(HashType::Max) + 1;
 
+	enum class LogOverflowPolicy
+	{
+		Block,      // Wait for the writing thread to free a record slot
+		DropNewest, // Discard the record that couldn't be queued
+
+		Max = DropNewest
+	};
+
 	enum class OpenMode
 	{
 		NotOpen,    // Use the current mod of opening
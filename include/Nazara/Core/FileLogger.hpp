@@ -10,6 +10,8 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/AbstractLogger.hpp>
 #include <Nazara/Core/StdLogger.hpp>
+#include <array>
+#include <ctime>
 #include <filesystem>
 #include <fstream>
 
@@ -36,8 +38,11 @@ namespace Nz
 			FileLogger& operator=(FileLogger&&) = default;
 
 		private:
+			std::array<char, 24> m_timestampBuffer;
 			std::fstream m_outputFile;
 			std::filesystem::path m_outputPath;
+			std::size_t m_timestampLength;
+			std::time_t m_cachedTimestamp;
 			StdLogger m_stdLogger;
 			bool m_forceStdOutput;
 			bool m_stdReplicationEnabled;
@@ -0,0 +1,31 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_PARALLELFOR_HPP
+#define NAZARA_CORE_PARALLELFOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <cstddef>
+
+namespace Nz
+{
+	template<typename F> void ParallelFor(std::size_t count, std::size_t grainSize, F&& func);
+	template<typename F> void ParallelFor(std::size_t count, std::size_t grainSize, unsigned int maxThreadCount, F&& func);
+
+	NAZARA_CORE_API unsigned int GetParallelForThreadCount();
+
+	namespace Detail
+	{
+		using ParallelForCallback = void(*)(void* userdata, std::size_t begin, std::size_t end, unsigned int workerIndex);
+
+		NAZARA_CORE_API void ParallelFor(std::size_t count, std::size_t grainSize, unsigned int maxThreadCount, ParallelForCallback callback, void* userdata);
+	}
+}
+
+#include <Nazara/Core/ParallelFor.inl>
+
+#endif // NAZARA_CORE_PARALLELFOR_HPP
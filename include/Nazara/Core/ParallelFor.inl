@@ -0,0 +1,62 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ParallelFor.hpp>
+#include <memory>
+#include <type_traits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \brief Splits the [0, count) range in chunks and processes them on the shared worker threads
+	*
+	* \param count Number of elements to process
+	* \param grainSize Minimum number of elements per chunk, small workloads are processed on the calling thread
+	* \param func Callable taking a [begin, end) range of elements and optionally the index of the worker running it, may be called concurrently
+	*
+	* \remark The calling thread takes part in the work and the function only returns once every chunk is processed
+	* \remark An exception thrown by func is rethrown on the calling thread, remaining chunks are skipped
+	*/
+	template<typename F>
+	void ParallelFor(std::size_t count, std::size_t grainSize, F&& func)
+	{
+		return ParallelFor(count, grainSize, 0, std::forward<F>(func));
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Splits the [0, count) range in chunks and processes them on at most maxThreadCount threads
+	*
+	* Chunks are processed by a pool of threads living as long as the program, so calling this every frame doesn't create any thread.
+	*
+	* \param count Number of elements to process
+	* \param grainSize Minimum number of elements per chunk, small workloads are processed on the calling thread
+	* \param maxThreadCount Maximum number of threads to use (including the calling thread), 0 means every pool thread
+	* \param func Callable taking a [begin, end) range of elements and optionally the index of the worker running it, may be called concurrently
+	*
+	* \remark Worker indices are lesser than maxThreadCount (and GetParallelForThreadCount()), the calling thread is always worker 0
+	*         and two chunks running at the same time never share a worker index
+	*/
+	template<typename F>
+	void ParallelFor(std::size_t count, std::size_t grainSize, unsigned int maxThreadCount, F&& func)
+	{
+		using Func = std::remove_reference_t<F>;
+
+		Detail::ParallelFor(count, grainSize, maxThreadCount, [](void* userdata, std::size_t begin, std::size_t end, unsigned int workerIndex)
+		{
+			Func& callable = *static_cast<Func*>(userdata);
+			if constexpr (std::is_invocable_v<Func&, std::size_t, std::size_t, unsigned int>)
+				callable(begin, end, workerIndex);
+			else
+			{
+				NazaraUnused(workerIndex);
+				callable(begin, end);
+			}
+		}, const_cast<void*>(static_cast<const void*>(std::addressof(func))));
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
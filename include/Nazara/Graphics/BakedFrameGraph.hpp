@@ -28,28 +28,44 @@ namespace Nz
 		friend class FrameGraph;
 
 		public:
+			struct Statistics;
+
 			BakedFrameGraph() = default;
 			BakedFrameGraph(const BakedFrameGraph&) = delete;
 			BakedFrameGraph(BakedFrameGraph&&) noexcept = default;
 			~BakedFrameGraph() = default;
 
+			UInt64 ComputeMemoryUsage(unsigned int frameWidth, unsigned int frameHeight) const;
+
 			void Execute(RenderFrame& renderFrame);
 
 			const std::shared_ptr<Texture>& GetAttachmentTexture(std::size_t attachmentIndex) const;
 			const std::shared_ptr<RenderPass>& GetRenderPass(std::size_t passIndex) const;
+			inline const Statistics& GetStatistics() const;
 
 			bool Resize(RenderFrame& renderFrame);
 
 			BakedFrameGraph& operator=(const BakedFrameGraph&) = delete;
 			BakedFrameGraph& operator=(BakedFrameGraph&&) noexcept = default;
 
+			struct Statistics
+			{
+				std::size_t aliasedAttachmentCount = 0; //< attachments sharing their texture with a previous attachment
+				std::size_t barrierCount = 0;
+				std::size_t culledPassCount = 0; //< passes not contributing to the backbuffer outputs
+				std::size_t layoutTransitionCount = 0;
+				std::size_t physicalPassCount = 0;
+				std::size_t textureCount = 0; //< textures allocated by the graph (excluding views)
+				std::vector<std::size_t> passOrder; //< pass indices in execution order
+			};
+
 		private:
 			struct PassData;
 			struct TextureData;
 			using AttachmentIdToTextureId = std::unordered_map<std::size_t /*attachmentId*/, std::size_t /*textureId*/>;
 			using PassIdToPhysicalPassIndex = std::unordered_map<std::size_t /*passId*/, std::size_t /*physicalPassId*/>;
 
-			BakedFrameGraph(std::vector<PassData> passes, std::vector<TextureData> textures, AttachmentIdToTextureId attachmentIdToTextureMapping, PassIdToPhysicalPassIndex passIdToPhysicalPassMapping);
+			BakedFrameGraph(std::vector<PassData> passes, std::vector<TextureData> textures, AttachmentIdToTextureId attachmentIdToTextureMapping, PassIdToPhysicalPassIndex passIdToPhysicalPassMapping, Statistics statistics);
 
 			struct TextureBarrier
 			{
@@ -92,6 +108,7 @@ namespace Nz
 			std::vector<TextureData> m_textures;
 			AttachmentIdToTextureId m_attachmentToTextureMapping;
 			PassIdToPhysicalPassIndex m_passIdToPhysicalPassMapping;
+			Statistics m_statistics;
 			unsigned int m_height;
 			unsigned int m_width;
 	};
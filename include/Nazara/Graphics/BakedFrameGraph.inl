@@ -7,6 +7,10 @@
 
 namespace Nz
 {
+	inline auto BakedFrameGraph::GetStatistics() const -> const Statistics&
+	{
+		return m_statistics;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
@@ -40,15 +40,17 @@ namespace Nz
 
 			void Prepare(RenderFrame& renderFrame, const Frustumf& frustum, const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, std::size_t visibilityHash);
 
-			void RegisterMaterialInstance(const MaterialInstance& materialInstance);
+			void RegisterMaterialInstance(const MaterialInstance& materialInstance, std::size_t count = 1);
 			FramePass& RegisterToFrameGraph(FrameGraph& frameGraph, std::size_t outputAttachment);
 
-			void UnregisterMaterialInstance(const MaterialInstance& materialInstance);
+			void UnregisterMaterialInstance(const MaterialInstance& materialInstance, std::size_t count = 1);
 
 			DepthPipelinePass& operator=(const DepthPipelinePass&) = delete;
 			DepthPipelinePass& operator=(DepthPipelinePass&&) = delete;
 
 		private:
+			bool HasPendingShaders() const;
+
 			struct MaterialPassEntry
 			{
 				std::size_t usedCount = 1;
@@ -69,6 +71,7 @@ namespace Nz
 			AbstractViewer* m_viewer;
 			ElementRendererRegistry& m_elementRegistry;
 			FramePipeline& m_pipeline;
+			bool m_hasPendingShaders;
 			bool m_rebuildCommandBuffer;
 			bool m_rebuildElements;
 	};
@@ -53,6 +53,7 @@ namespace Nz
 
 			std::size_t RegisterLight(const Light* light, UInt32 renderMask) override;
 			std::size_t RegisterRenderable(std::size_t worldInstanceIndex, std::size_t skeletonInstanceIndex, const InstancedRenderable* instancedRenderable, UInt32 renderMask, const Recti& scissorBox) override;
+			void RegisterRenderables(std::size_t renderableCount, const RenderableRegistration* registrations, std::size_t* renderableIndices) override;
 			std::size_t RegisterSkeleton(SkeletonInstancePtr skeletonInstance) override;
 			std::size_t RegisterViewer(AbstractViewer* viewerInstance, Int32 renderOrder) override;
 			std::size_t RegisterWorldInstance(WorldInstancePtr worldInstance) override;
@@ -64,6 +65,7 @@ namespace Nz
 
 			void UnregisterLight(std::size_t lightIndex) override;
 			void UnregisterRenderable(std::size_t renderableIndex) override;
+			void UnregisterRenderables(std::size_t renderableCount, const std::size_t* renderableIndices) override;
 			void UnregisterSkeleton(std::size_t skeletonIndex) override;
 			void UnregisterViewer(std::size_t viewerIndex) override;
 			void UnregisterWorldInstance(std::size_t worldInstance) override;
@@ -71,6 +73,7 @@ namespace Nz
 			void UpdateLightRenderMask(std::size_t lightIndex, UInt32 renderMask) override;
 			void UpdateRenderableRenderMask(std::size_t renderableIndex, UInt32 renderMask) override;
 			void UpdateRenderableScissorBox(std::size_t renderableIndex, const Recti& scissorBox) override;
+			void UpdateRenderableScissorBoxes(std::size_t renderableCount, const std::size_t* renderableIndices, const Recti& scissorBox) override;
 			void UpdateViewerRenderMask(std::size_t viewerIndex, Int32 renderOrder) override;
 
 			ForwardFramePipeline& operator=(const ForwardFramePipeline&) = delete;
@@ -79,8 +82,9 @@ namespace Nz
 		private:
 			BakedFrameGraph BuildFrameGraph();
 
-			void RegisterMaterialInstance(MaterialInstance* materialPass);
-			void UnregisterMaterialInstance(MaterialInstance* material);
+			void RegisterMaterialInstance(MaterialInstance* materialPass, std::size_t count = 1);
+			std::size_t RegisterRenderableData(std::size_t worldInstanceIndex, std::size_t skeletonInstanceIndex, const InstancedRenderable* instancedRenderable, UInt32 renderMask, const Recti& scissorBox);
+			void UnregisterMaterialInstance(MaterialInstance* material, std::size_t count = 1);
 
 			struct ViewerData;
 
@@ -156,6 +160,7 @@ namespace Nz
 			std::vector<ElementRenderer::RenderStates> m_renderStates;
 			mutable std::vector<FramePipelinePass::VisibleRenderable> m_visibleRenderables;
 			std::vector<std::size_t> m_visibleLights;
+			robin_hood::unordered_map<MaterialInstance*, std::size_t> m_batchMaterialInstances; //< material use count of the current register/unregister batch
 			robin_hood::unordered_set<TransferInterface*> m_transferSet;
 			BakedFrameGraph m_bakedFrameGraph;
 			Bitset<UInt64> m_shadowCastingLights;
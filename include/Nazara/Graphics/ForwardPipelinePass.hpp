@@ -43,10 +43,10 @@ namespace Nz
 
 			void Prepare(RenderFrame& renderFrame, const Frustumf& frustum, const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, const std::vector<std::size_t>& visibleLights, std::size_t visibilityHash);
 
-			void RegisterMaterialInstance(const MaterialInstance& material);
+			void RegisterMaterialInstance(const MaterialInstance& material, std::size_t count = 1);
 			FramePass& RegisterToFrameGraph(FrameGraph& frameGraph, std::size_t colorBufferIndex, std::size_t depthBufferIndex, bool hasDepthPrepass);
 
-			void UnregisterMaterialInstance(const MaterialInstance& material);
+			void UnregisterMaterialInstance(const MaterialInstance& material, std::size_t count = 1);
 
 			ForwardPipelinePass& operator=(const ForwardPipelinePass&) = delete;
 			ForwardPipelinePass& operator=(ForwardPipelinePass&&) = delete;
@@ -54,6 +54,8 @@ namespace Nz
 			static constexpr std::size_t MaxLightCountPerDraw = 3;
 
 		private:
+			bool HasPendingShaders() const;
+
 			struct MaterialPassEntry
 			{
 				std::size_t usedCount = 1;
@@ -111,6 +113,7 @@ namespace Nz
 			AbstractViewer* m_viewer;
 			ElementRendererRegistry& m_elementRegistry;
 			FramePipeline& m_pipeline;
+			bool m_hasPendingShaders;
 			bool m_rebuildCommandBuffer;
 			bool m_rebuildElements;
 	};
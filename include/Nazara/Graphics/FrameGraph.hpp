@@ -45,12 +45,13 @@ namespace Nz
 			FrameGraph& operator=(FrameGraph&&) noexcept = default;
 
 		private:
+			struct AttachmentLifetime;
 			struct PassBarriers;
 
 			using BarrierList = std::vector<PassBarriers>;
 			using PassList = std::vector<std::size_t /*PassIndex*/>;
+			using AttachmentIdToLifetime = std::unordered_map<std::size_t /*attachmentId*/, AttachmentLifetime>;
 			using AttachmentIdToPassMap = std::unordered_map<std::size_t /*resourceIndex*/, PassList /*passIndexes*/>;
-			using AttachmentIdToPassId = std::unordered_map<std::size_t /*attachmentId*/, std::size_t /*passId*/>;
 			using AttachmentIdToTextureId = std::unordered_map<std::size_t /*attachmentId*/, std::size_t /*textureId*/>;
 			using PassIdToPhysicalPassIndex = std::unordered_map<std::size_t /*passId*/, std::size_t /*physicalPassId*/>;
 			using TextureBarrier = BakedFrameGraph::TextureBarrier;
@@ -59,6 +60,12 @@ namespace Nz
 			{
 			};
 
+			struct AttachmentLifetime
+			{
+				std::size_t firstUse; //< index in the pass list
+				std::size_t lastUse;  //< index in the pass list
+			};
+
 			struct AttachmentLayer
 			{
 				std::size_t attachmentId;
@@ -104,7 +111,7 @@ namespace Nz
 				std::vector<FrameGraphTextureData> textures;
 				std::vector<std::size_t> texture2DPool;
 				std::vector<std::size_t> textureCubePool;
-				AttachmentIdToPassId attachmentLastUse;
+				AttachmentIdToLifetime attachmentLifetimes;
 				AttachmentIdToPassMap attachmentReadList;
 				AttachmentIdToPassMap attachmentWriteList;
 				AttachmentIdToTextureId attachmentToTextures;
@@ -123,6 +130,7 @@ namespace Nz
 			bool HasAttachment(const std::vector<FramePass::Input>& inputs, std::size_t attachmentIndex) const;
 			void RemoveDuplicatePasses();
 			std::size_t ResolveAttachmentIndex(std::size_t attachmentIndex) const;
+			std::size_t ResolveResourceIndex(std::size_t attachmentIndex) const;
 			void RegisterPassInput(std::size_t passIndex, std::size_t attachmentIndex);
 			std::size_t RegisterTexture(std::size_t attachmentIndex);
 			void ReorderPasses();
@@ -29,6 +29,8 @@ namespace Nz
 	class NAZARA_GRAPHICS_API FramePipeline
 	{
 		public:
+			struct RenderableRegistration;
+
 			FramePipeline();
 			FramePipeline(const FramePipeline&) = delete;
 			FramePipeline(FramePipeline&&) noexcept = default;
@@ -45,6 +47,7 @@ namespace Nz
 
 			virtual std::size_t RegisterLight(const Light* light, UInt32 renderMask) = 0;
 			virtual std::size_t RegisterRenderable(std::size_t worldInstanceIndex, std::size_t skeletonInstanceIndex, const InstancedRenderable* instancedRenderable, UInt32 renderMask, const Recti& scissorBox) = 0;
+			virtual void RegisterRenderables(std::size_t renderableCount, const RenderableRegistration* registrations, std::size_t* renderableIndices);
 			virtual std::size_t RegisterSkeleton(SkeletonInstancePtr skeletonInstance) = 0;
 			virtual std::size_t RegisterViewer(AbstractViewer* viewerInstance, Int32 renderOrder) = 0;
 			virtual std::size_t RegisterWorldInstance(WorldInstancePtr worldInstance) = 0;
@@ -56,6 +59,7 @@ namespace Nz
 
 			virtual void UnregisterLight(std::size_t lightIndex) = 0;
 			virtual void UnregisterRenderable(std::size_t renderableIndex) = 0;
+			virtual void UnregisterRenderables(std::size_t renderableCount, const std::size_t* renderableIndices);
 			virtual void UnregisterSkeleton(std::size_t skeletonIndex) = 0;
 			virtual void UnregisterViewer(std::size_t viewerIndex) = 0;
 			virtual void UnregisterWorldInstance(std::size_t worldInstance) = 0;
@@ -63,6 +67,7 @@ namespace Nz
 			virtual void UpdateLightRenderMask(std::size_t lightIndex, UInt32 renderMask) = 0;
 			virtual void UpdateRenderableRenderMask(std::size_t renderableIndex, UInt32 renderMask) = 0;
 			virtual void UpdateRenderableScissorBox(std::size_t renderableIndex, const Recti& scissorBox) = 0;
+			virtual void UpdateRenderableScissorBoxes(std::size_t renderableCount, const std::size_t* renderableIndices, const Recti& scissorBox);
 			virtual void UpdateViewerRenderMask(std::size_t viewerIndex, Int32 renderOrder) = 0;
 
 			FramePipeline& operator=(const FramePipeline&) = delete;
@@ -72,6 +77,15 @@ namespace Nz
 
 			static constexpr std::size_t NoSkeletonInstance = std::numeric_limits<std::size_t>::max();
 
+			struct RenderableRegistration
+			{
+				std::size_t skeletonInstanceIndex;
+				std::size_t worldInstanceIndex;
+				const InstancedRenderable* renderable;
+				Recti scissorBox;
+				UInt32 renderMask;
+			};
+
 		private:
 			DebugDrawer m_debugDrawer;
 	};
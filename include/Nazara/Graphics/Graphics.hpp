@@ -17,7 +17,9 @@
 #include <Nazara/Renderer/RenderPassCache.hpp>
 #include <Nazara/Renderer/RenderPipelineLayout.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
+#include <Nazara/Renderer/ShaderCache.hpp>
 #include <NZSL/FilesystemModuleResolver.hpp>
+#include <filesystem>
 #include <optional>
 
 namespace Nz
@@ -53,11 +55,14 @@ namespace Nz
 			inline const std::shared_ptr<RenderDevice>& GetRenderDevice() const;
 			inline const RenderPassCache& GetRenderPassCache() const;
 			inline TextureSamplerCache& GetSamplerCache();
+			inline ShaderCache& GetShaderCache();
+			inline const ShaderCache& GetShaderCache() const;
 			inline const std::shared_ptr<nzsl::FilesystemModuleResolver>& GetShaderModuleResolver() const;
 
 			struct Config
 			{
 				RenderDeviceFeatures forceDisableFeatures;
+				std::filesystem::path shaderCachePath; //< compiled shaders and pipeline binaries are loaded from and saved to this file, if set
 				bool useDedicatedRenderDevice = true;
 			};
 
@@ -68,6 +73,7 @@ namespace Nz
 				std::shared_ptr<Material> pbrMaterial;
 
 				std::shared_ptr<MaterialInstance> basicDefault;
+				std::shared_ptr<MaterialInstance> basicDistanceField;
 				std::shared_ptr<MaterialInstance> basicNoDepth;
 				std::shared_ptr<MaterialInstance> basicTransparent;
 			};
@@ -82,9 +88,11 @@ namespace Nz
 			void BuildBlitPipeline();
 			void BuildDefaultMaterials();
 			void BuildDefaultTextures();
+			void LoadShaderCache();
 			void RegisterMaterialPasses();
 			void RegisterShaderModules();
 			template<std::size_t N> void RegisterEmbedShaderModule(const UInt8(&content)[N]);
+			void SaveShaderCache();
 			void SelectDepthStencilFormats();
 
 			std::optional<RenderPassCache> m_renderPassCache;
@@ -94,6 +102,7 @@ namespace Nz
 			std::shared_ptr<RenderPipeline> m_blitPipeline;
 			std::shared_ptr<RenderPipeline> m_blitPipelineTransparent;
 			std::shared_ptr<RenderPipelineLayout> m_blitPipelineLayout;
+			std::filesystem::path m_shaderCachePath;
 			DefaultMaterials m_defaultMaterials;
 			DefaultTextures m_defaultTextures;
 			MaterialInstanceLoader m_materialInstanceLoader;
@@ -101,6 +110,8 @@ namespace Nz
 			MaterialPassRegistry m_materialPassRegistry;
 			PixelFormat m_preferredDepthFormat;
 			PixelFormat m_preferredDepthStencilFormat;
+			ShaderCache m_shaderCache;
+			UInt64 m_pipelineCacheKey;
 
 			static Graphics* s_instance;
 	};
@@ -83,6 +83,16 @@ namespace Nz
 		return *m_samplerCache;
 	}
 
+	inline ShaderCache& Graphics::GetShaderCache()
+	{
+		return m_shaderCache;
+	}
+
+	inline const ShaderCache& Graphics::GetShaderCache() const
+	{
+		return m_shaderCache;
+	}
+
 	inline const std::shared_ptr<nzsl::FilesystemModuleResolver>& Graphics::GetShaderModuleResolver() const
 	{
 		return m_shaderModuleResolver;
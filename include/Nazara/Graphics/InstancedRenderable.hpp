@@ -11,6 +11,7 @@
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/RenderElementOwner.hpp>
 #include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Utils/Signal.hpp>
 #include <memory>
 
@@ -35,6 +36,8 @@ namespace Nz
 
 			virtual void BuildElement(ElementRendererRegistry& registry, const ElementData& elementData, std::size_t passIndex, std::vector<RenderElementOwner>& elements) const = 0;
 
+			virtual std::size_t ComputeVisibilityHash(const Frustumf& frustum, const Matrix4f& worldMatrix) const;
+
 			inline const Boxf& GetAABB() const;
 			virtual const std::shared_ptr<MaterialInstance>& GetMaterial(std::size_t i) const = 0;
 			virtual std::size_t GetMaterialCount() const = 0;
@@ -51,6 +54,7 @@ namespace Nz
 
 			struct ElementData
 			{
+				const Frustumf* frustum = nullptr; //< if set, renderables may skip parts outside of it
 				const Recti* scissorBox;
 				const SkeletonInstance* skeletonInstance;
 				const WorldInstance* worldInstance;
@@ -13,6 +13,7 @@
 #include <Nazara/Graphics/MaterialSettings.hpp>
 #include <Nazara/Graphics/TransferInterface.hpp>
 #include <Nazara/Renderer/RenderBufferView.hpp>
+#include <Nazara/Renderer/RenderPipeline.hpp>
 #include <Nazara/Renderer/ShaderBinding.hpp>
 #include <Nazara/Utils/FunctionRef.hpp>
 #include <NZSL/Ast/ConstantValue.hpp>
@@ -82,6 +83,8 @@ namespace Nz
 
 			void OnTransfer(RenderFrame& renderFrame, CommandBufferBuilder& builder) override;
 
+			std::size_t PrecompileShaders(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount) const;
+
 			inline void SetTextureProperty(std::string_view propertyName, std::shared_ptr<Texture> texture);
 			inline void SetTextureProperty(std::string_view propertyName, std::shared_ptr<Texture> texture, const TextureSamplerInfo& samplerInfo);
 			void SetTextureProperty(std::size_t textureIndex, std::shared_ptr<Texture> texture);
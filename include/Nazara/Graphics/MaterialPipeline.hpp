@@ -60,9 +60,19 @@ namespace Nz
 			inline const MaterialPipelineInfo& GetInfo() const;
 			const std::shared_ptr<RenderPipeline>& GetRenderPipeline(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount) const;
 
+			bool HasPendingShaders() const;
+
+			std::size_t PrecompileShaders(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount, const std::vector<UberShader::OptionVariations>& optionVariations = {}, unsigned int maxThreadCount = 0) const;
+
+			const std::shared_ptr<RenderPipeline>& TryGetRenderPipeline(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount, bool* isFallback = nullptr) const;
+
 			static const std::shared_ptr<MaterialPipeline>& Get(const MaterialPipelineInfo& pipelineInfo);
 
 		private:
+			RenderPipelineInfo BuildRenderPipelineInfo(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount) const;
+			UberShader::Config BuildShaderConfig(UberShader& uberShader, const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers) const;
+
+			static const std::shared_ptr<RenderPipeline>* FindRenderPipeline(const std::vector<std::shared_ptr<RenderPipeline>>& renderPipelines, const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount);
 			static bool Initialize();
 			static void Uninitialize();
 
@@ -71,6 +81,7 @@ namespace Nz
 				NazaraSlot(UberShader, OnShaderUpdated, onShaderUpdated);
 			};
 
+			mutable std::vector<std::shared_ptr<RenderPipeline>> m_fallbackRenderPipelines;
 			mutable std::vector<std::shared_ptr<RenderPipeline>> m_renderPipelines;
 			std::vector<UberShaderEntry> m_uberShaderEntries;
 			MaterialPipelineInfo m_pipelineInfo;
@@ -18,6 +18,7 @@ namespace Nz
 			m_uberShaderEntries[i].onShaderUpdated.Connect(m_pipelineInfo.shaders[i].uberShader->OnShaderUpdated, [this](UberShader*)
 			{
 				// Clear cache
+				m_fallbackRenderPipelines.clear();
 				m_renderPipelines.clear();
 			});
 		}
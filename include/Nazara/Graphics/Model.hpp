@@ -44,6 +44,8 @@ namespace Nz
 			Model& operator=(Model&&) noexcept = default;
 
 		private:
+			void PrecompileShaders(std::size_t subMeshIndex) const;
+
 			struct SubMeshData
 			{
 				std::shared_ptr<MaterialInstance> material;
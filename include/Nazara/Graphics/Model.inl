@@ -22,6 +22,7 @@ namespace Nz
 		{
 			OnMaterialInvalidated(this, subMeshIndex, material);
 			m_submeshes[subMeshIndex].material = std::move(material);
+			PrecompileShaders(subMeshIndex);
 
 			OnElementInvalidated(this);
 		}
@@ -21,6 +21,7 @@ namespace Nz
 			~PredefinedMaterials() = delete;
 
 			static void AddBasicSettings(MaterialSettings& settings);
+			static void AddDistanceFieldSettings(MaterialSettings& settings);
 			static void AddPbrSettings(MaterialSettings& settings);
 			static void AddPhongSettings(MaterialSettings& settings);
 	};
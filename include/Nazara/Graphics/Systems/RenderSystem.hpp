@@ -10,22 +10,22 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Time.hpp>
 #include <Nazara/Graphics/ElementRendererRegistry.hpp>
+#include <Nazara/Graphics/FramePipeline.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/Components/GraphicsComponent.hpp>
 #include <Nazara/Graphics/Components/LightComponent.hpp>
 #include <Nazara/Utility/Node.hpp>
 #include <Nazara/Utility/Skeleton.hpp>
-#include <Nazara/Utils/MemoryPool.hpp>
+#include <Nazara/Utility/Systems/TransformSystem.hpp>
 #include <entt/entt.hpp>
 #include <array>
 #include <memory>
-#include <set>
 #include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
 	class CommandBufferBuilder;
-	class FramePipeline;
 	class RenderFrame;
 	class RenderWindow;
 	class UploadPool;
@@ -58,26 +58,21 @@ namespace Nz
 			void OnNodeDestroy(entt::registry& registry, entt::entity entity);
 			void OnSharedSkeletonDestroy(entt::registry& registry, entt::entity entity);
 			void OnSkeletonDestroy(entt::registry& registry, entt::entity entity);
-			void UpdateInstances();
+			void UpdateInstances(const TransformSystem& transformSystem);
 			void UpdateObservers();
 			void UpdateVisibility();
 
 			static constexpr std::size_t NoInstance = std::numeric_limits<std::size_t>::max();
 
+			// Entity data is stored densely in entt storages, renderable and light indices are NoInstance while not registered in the pipeline
 			struct CameraEntity
 			{
-				entt::entity entity;
-				std::size_t poolIndex;
 				std::size_t viewerIndex;
-
-				NazaraSlot(Node, OnNodeInvalidation, onNodeInvalidation);
 			};
 
 			struct GraphicsEntity
 			{
-				entt::entity entity;
 				std::array<std::size_t, GraphicsComponent::MaxRenderableCount> renderableIndices;
-				std::size_t poolIndex;
 				std::size_t skeletonInstanceIndex;
 				std::size_t worldInstanceIndex;
 
@@ -85,20 +80,16 @@ namespace Nz
 				NazaraSlot(GraphicsComponent, OnRenderableDetach, onRenderableDetach);
 				NazaraSlot(GraphicsComponent, OnScissorBoxUpdate, onScissorBoxUpdate);
 				NazaraSlot(GraphicsComponent, OnVisibilityUpdate, onVisibilityUpdate);
-				NazaraSlot(Node, OnNodeInvalidation, onNodeInvalidation);
 				NazaraSlot(Skeleton, OnSkeletonJointsInvalidated, onSkeletonJointsInvalidated); //< only connected for owned skeleton
 			};
 
 			struct LightEntity
 			{
-				entt::entity entity;
 				std::array<std::size_t, LightComponent::MaxLightCount> lightIndices;
-				std::size_t poolIndex;
 
 				NazaraSlot(LightComponent, OnLightAttached, onLightAttached);
 				NazaraSlot(LightComponent, OnLightDetach, onLightDetach);
 				NazaraSlot(LightComponent, OnVisibilityUpdate, onVisibilityUpdate);
-				NazaraSlot(Node, OnNodeInvalidation, onNodeInvalidation);
 			};
 
 			struct SharedSkeleton
@@ -121,23 +112,26 @@ namespace Nz
 			entt::scoped_connection m_nodeDestroyConnection;
 			entt::scoped_connection m_sharedSkeletonDestroyConnection;
 			entt::scoped_connection m_skeletonDestroyConnection;
-			std::set<CameraEntity*> m_invalidatedCameraNode;
-			std::set<GraphicsEntity*> m_invalidatedGfxWorldNode;
-			std::set<LightEntity*> m_invalidatedLightWorldNode;
+			entt::sparse_set m_invalidatedCameraNode; //< newly registered entities, others are handled through transform system ranges
+			entt::sparse_set m_invalidatedGfxWorldNode;
+			entt::sparse_set m_invalidatedLightWorldNode;
+			entt::sparse_set m_newlyHiddenGfxEntities;
+			entt::sparse_set m_newlyHiddenLightEntities;
+			entt::sparse_set m_newlyVisibleGfxEntities;
+			entt::sparse_set m_newlyVisibleLightEntities;
+			entt::storage<CameraEntity> m_cameraEntities;
+			entt::storage<GraphicsEntity> m_graphicsEntities;
+			entt::storage<LightEntity> m_lightEntities;
 			std::unique_ptr<FramePipeline> m_pipeline;
-			std::unordered_map<entt::entity, CameraEntity*> m_cameraEntities;
-			std::unordered_map<entt::entity, GraphicsEntity*> m_graphicsEntities;
-			std::unordered_map<entt::entity, LightEntity*> m_lightEntities;
+			std::unique_ptr<TransformSystem> m_ownedTransformSystem;
 			std::unordered_map<Skeleton*, SharedSkeleton> m_sharedSkeletonInstances;
-			std::unordered_set<GraphicsEntity*> m_newlyHiddenGfxEntities;
-			std::unordered_set<GraphicsEntity*> m_newlyVisibleGfxEntities;
-			std::unordered_set<LightEntity*> m_newlyHiddenLightEntities;
-			std::unordered_set<LightEntity*> m_newlyVisibleLightEntities;
+			std::vector<FramePipeline::RenderableRegistration> m_renderableRegistrations;
+			std::vector<std::shared_ptr<InstancedRenderable>> m_removedRenderables; //< kept alive until their unregistration
+			std::vector<std::size_t> m_renderableIndices;
+			std::vector<std::size_t*> m_renderableRegistrationTargets;
+			std::vector<std::size_t> m_removedRenderableIndices;
 			std::vector<std::unique_ptr<RenderWindow>> m_renderWindows;
 			ElementRendererRegistry m_elementRegistry;
-			MemoryPool<CameraEntity> m_cameraEntityPool;
-			MemoryPool<GraphicsEntity> m_graphicsEntityPool;
-			MemoryPool<LightEntity> m_lightEntityPool;
 	};
 }
 
@@ -12,6 +12,7 @@
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Renderer/RenderPipeline.hpp>
 #include <Nazara/Utility/AbstractAtlas.hpp>
+#include <Nazara/Utility/Enums.hpp>
 #include <Nazara/Utility/VertexDeclaration.hpp>
 #include <Nazara/Utility/VertexStruct.hpp>
 #include <array>
@@ -39,6 +40,8 @@ namespace Nz
 
 			void Update(const AbstractTextDrawer& drawer, float scale = 1.f);
 
+			static const std::shared_ptr<MaterialInstance>& GetDefaultMaterial(GlyphRenderMode renderMode);
+
 			TextSprite& operator=(const TextSprite&) = delete;
 			TextSprite& operator=(TextSprite&&) noexcept = default;
 
@@ -89,6 +92,8 @@ namespace Nz
 			mutable std::unordered_map<RenderKey, RenderIndices, HashRenderKey> m_renderInfos;
 			std::shared_ptr<MaterialInstance> m_material;
 			std::vector<VertexStruct_XYZ_Color_UV> m_vertices;
+			bool m_hasDefaultMaterial;
+			bool m_hasDistanceFieldMaterial;
 	};
 }
 
@@ -23,6 +23,7 @@ namespace Nz
 		{
 			OnMaterialInvalidated(this, 0, material);
 			m_material = std::move(material);
+			m_hasDefaultMaterial = false;
 
 			OnElementInvalidated(this);
 		}
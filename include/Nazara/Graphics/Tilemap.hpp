@@ -12,8 +12,8 @@
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Utility/VertexStruct.hpp>
-#include <Nazara/Utils/Bitset.hpp>
 #include <memory>
+#include <vector>
 
 namespace Nz
 {
@@ -31,6 +31,8 @@ namespace Nz
 
 			void BuildElement(ElementRendererRegistry& registry, const ElementData& elementData, std::size_t passIndex, std::vector<RenderElementOwner>& elements) const override;
 
+			std::size_t ComputeVisibilityHash(const Frustumf& frustum, const Matrix4f& worldMatrix) const override;
+
 			inline void DisableTile(const Vector2ui& tilePos);
 			inline void DisableTiles();
 			inline void DisableTiles(const Vector2ui* tilesPos, std::size_t tileCount);
@@ -44,6 +46,7 @@ namespace Nz
 			inline void EnableTiles(const Vector2ui* tilesPos, std::size_t tileCount, const Rectf& coords, const Color& color = Color::White(), std::size_t materialIndex = 0U);
 			inline void EnableTiles(const Vector2ui* tilesPos, std::size_t tileCount, const Rectui& rect, const Color& color = Color::White(), std::size_t materialIndex = 0U);
 
+			inline const Vector2ui& GetChunkCount() const;
 			inline const Vector2ui& GetMapSize() const;
 			const std::shared_ptr<MaterialInstance>& GetMaterial(std::size_t i) const override;
 			std::size_t GetMaterialCount() const override;
@@ -68,27 +71,43 @@ namespace Nz
 			Tilemap& operator=(const Tilemap&) = delete;
 			Tilemap& operator=(Tilemap&&) noexcept = default;
 
+			static constexpr unsigned int ChunkSize = 32; //< tiles are grouped in ChunkSize x ChunkSize chunks, culled and updated independently
+
 		private:
+			struct Chunk;
+
+			inline Chunk& GetChunk(const Vector2ui& tilePos);
 			Vector3ui GetTextureSize(std::size_t matIndex) const;
+			inline void InvalidateTile(const Vector2ui& tilePos);
 			inline void InvalidateVertices();
+			bool IsChunkVisible(const Chunk& chunk, const Frustumf& frustum, const Matrix4f& worldMatrix) const;
 			void UpdateAABB();
-			void UpdateVertices() const;
+			void UpdateChunkVertices(std::size_t chunkIndex) const;
+
+			struct Chunk
+			{
+				std::vector<std::size_t> layerSpriteOffsets; //< index of the first sprite of each layer, followed by the sprite count
+				std::vector<VertexStruct_XYZ_Color_UV> vertices;
+				Boxf aabb;
+				std::size_t enabledTileCount = 0;
+				bool shouldRebuildVertices = true;
+			};
 
 			struct Layer
 			{
 				std::shared_ptr<MaterialInstance> material;
-				Bitset<UInt64> enabledTiles;
-				std::size_t enabledTileCount = 0; //< cached bitset popcount
 			};
 
-			mutable std::vector<VertexStruct_XYZ_Color_UV> m_vertices;
+			mutable std::vector<Chunk> m_chunks;
+			mutable std::vector<std::size_t> m_layerSpriteIndices; //< scratch buffers kept between calls to avoid per-frame allocations
+			mutable std::vector<std::size_t> m_visibleChunks;
 			std::vector<Tile> m_tiles;
 			std::vector<Layer> m_layers;
+			Vector2ui m_chunkCount;
 			Vector2ui m_mapSize;
 			Vector2f m_origin;
 			Vector2f m_tileSize;
 			bool m_isometricModeEnabled;
-			mutable bool m_shouldRebuildVertices;
 	};
 }
 
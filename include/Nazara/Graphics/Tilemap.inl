@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/Tilemap.hpp>
+#include <algorithm>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -18,18 +19,15 @@ namespace Nz
 	{
 		NazaraAssert(tilePos.x < m_mapSize.x&& tilePos.y < m_mapSize.y, "Tile position is out of bounds");
 
-		std::size_t tileIndex = tilePos.y * m_mapSize.x + tilePos.x;
-		Tile& tile = m_tiles[tileIndex];
+		Tile& tile = m_tiles[tilePos.y * m_mapSize.x + tilePos.x];
 		if (tile.enabled)
 		{
 			tile.enabled = false;
+			GetChunk(tilePos).enabledTileCount--;
 
-			Layer& layer = m_layers[tile.layerIndex];
-			layer.enabledTiles.Reset(tileIndex);
-			layer.enabledTileCount = layer.enabledTiles.Count();
+			InvalidateTile(tilePos);
+			OnElementInvalidated(this);
 		}
-
-		InvalidateVertices();
 	}
 
 	/*!
@@ -40,11 +38,8 @@ namespace Nz
 		for (Tile& tile : m_tiles)
 			tile.enabled = false;
 
-		for (Layer& layer : m_layers)
-		{
-			layer.enabledTiles.Reset();
-			layer.enabledTileCount = 0;
-		}
+		for (Chunk& chunk : m_chunks)
+			chunk.enabledTileCount = 0;
 
 		InvalidateVertices();
 	}
@@ -65,29 +60,26 @@ namespace Nz
 	{
 		NazaraAssert(tilesPos || tileCount == 0, "Invalid tile position array with a non-zero tileCount");
 
+		bool invalidated = false;
 		for (std::size_t i = 0; i < tileCount; ++i)
 		{
 			NazaraAssert(tilesPos->x < m_mapSize.x&& tilesPos->y < m_mapSize.y, "Tile position is out of bounds");
 
-			std::size_t tileIndex = tilesPos->y * m_mapSize.x + tilesPos->x;
-			Tile& tile = m_tiles[tileIndex];
-
+			Tile& tile = m_tiles[tilesPos->y * m_mapSize.x + tilesPos->x];
 			if (tile.enabled)
 			{
 				tile.enabled = false;
+				GetChunk(*tilesPos).enabledTileCount--;
 
-				Layer& layer = m_layers[tile.layerIndex];
-				layer.enabledTiles.Reset(tileIndex);
+				InvalidateTile(*tilesPos);
+				invalidated = true;
 			}
 
 			tilesPos++;
 		}
 
-		for (Layer& layer : m_layers)
-			layer.enabledTileCount = layer.enabledTiles.Count();
-
-		if (tileCount > 0)
-			InvalidateVertices();
+		if (invalidated)
+			OnElementInvalidated(this);
 	}
 
 	/*!
@@ -104,6 +96,7 @@ namespace Nz
 		m_isometricModeEnabled = isometric;
 
 		InvalidateVertices();
+		UpdateAABB();
 	}
 
 	/*!
@@ -123,33 +116,17 @@ namespace Nz
 		NazaraAssert(tilePos.x < m_mapSize.x&& tilePos.y < m_mapSize.y, "Tile position is out of bounds");
 		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
 
-		std::size_t tileIndex = tilePos.y * m_mapSize.x + tilePos.x;
 		Tile& tile = m_tiles[tilePos.y * m_mapSize.x + tilePos.x];
-
 		if (!tile.enabled)
-		{
-			Layer& layer = m_layers[materialIndex];
-			layer.enabledTiles.UnboundedSet(tileIndex);
-			layer.enabledTileCount = layer.enabledTiles.Count();
-		}
-		else if (materialIndex != tile.layerIndex)
-		{
-			Layer& oldLayer = m_layers[tile.layerIndex];
-			Layer& newLayer = m_layers[tile.layerIndex];
-
-			oldLayer.enabledTiles.Reset(tileIndex);
-			oldLayer.enabledTileCount = oldLayer.enabledTiles.Count();
-
-			newLayer.enabledTiles.UnboundedSet(tileIndex);
-			newLayer.enabledTileCount = newLayer.enabledTiles.Count();
-		}
+			GetChunk(tilePos).enabledTileCount++;
 
 		tile.enabled = true;
 		tile.color = color;
 		tile.textureCoords = coords;
 		tile.layerIndex = materialIndex;
 
-		InvalidateVertices();
+		InvalidateTile(tilePos);
+		OnElementInvalidated(this);
 	}
 
 	/*!
@@ -197,21 +174,25 @@ namespace Nz
 	{
 		NazaraAssert(materialIndex < m_layers.size(), "Material out of bounds");
 
-		for (Layer& layer : m_layers)
-			layer.enabledTiles.Reset();
-
-		std::size_t tileIndex = 0;
 		for (Tile& tile : m_tiles)
 		{
 			tile.enabled = true;
 			tile.color = color;
 			tile.textureCoords = coords;
 			tile.layerIndex = materialIndex;
-
-			m_layers[materialIndex].enabledTiles.UnboundedSet(tileIndex++);
 		}
 
-		m_layers[materialIndex].enabledTileCount = m_layers[materialIndex].enabledTiles.Count();
+		// Every chunk is full, except on the right and bottom borders of the map
+		for (unsigned int chunkY = 0; chunkY < m_chunkCount.y; ++chunkY)
+		{
+			for (unsigned int chunkX = 0; chunkX < m_chunkCount.x; ++chunkX)
+			{
+				std::size_t chunkWidth = std::min(ChunkSize, m_mapSize.x - chunkX * ChunkSize);
+				std::size_t chunkHeight = std::min(ChunkSize, m_mapSize.y - chunkY * ChunkSize);
+
+				m_chunks[chunkY * m_chunkCount.x + chunkX].enabledTileCount = chunkWidth * chunkHeight;
+			}
+		}
 
 		InvalidateVertices();
 	}
@@ -264,39 +245,21 @@ namespace Nz
 		{
 			NazaraAssert(tilesPos->x < m_mapSize.x&& tilesPos->y < m_mapSize.y, "Tile position is out of bounds");
 
-			std::size_t tileIndex = tilesPos->y * m_mapSize.x + tilesPos->x;
-			Tile& tile = m_tiles[tileIndex];
-
+			Tile& tile = m_tiles[tilesPos->y * m_mapSize.x + tilesPos->x];
 			if (!tile.enabled)
-			{
-				Layer& layer = m_layers[materialIndex];
-				layer.enabledTiles.UnboundedSet(tileIndex);
-				layer.enabledTileCount = layer.enabledTiles.Count();
-			}
-			else if (materialIndex != tile.layerIndex)
-			{
-				Layer& oldLayer = m_layers[tile.layerIndex];
-				Layer& newLayer = m_layers[tile.layerIndex];
-
-				oldLayer.enabledTiles.Reset(tileIndex);
-				oldLayer.enabledTileCount = oldLayer.enabledTiles.Count();
-
-				newLayer.enabledTiles.UnboundedSet(tileIndex);
-				newLayer.enabledTileCount = newLayer.enabledTiles.Count();
-			}
+				GetChunk(*tilesPos).enabledTileCount++;
 
 			tile.enabled = true;
 			tile.color = color;
 			tile.textureCoords = coords;
 			tile.layerIndex = materialIndex;
+
+			InvalidateTile(*tilesPos);
 			tilesPos++;
 		}
 
-		for (Layer& layer : m_layers)
-			layer.enabledTileCount = layer.enabledTiles.Count();
-
 		if (tileCount > 0)
-			InvalidateVertices();
+			OnElementInvalidated(this);
 	}
 
 	/*!
@@ -327,6 +290,17 @@ namespace Nz
 		EnableTiles(tilesPos, tileCount, unnormalizedCoords, color, materialIndex);
 	}
 
+	/*!
+	* \brief Gets the number of chunks in each dimension
+	* \return Number of chunks in each dimension
+	*
+	* \see ChunkSize
+	*/
+	inline const Vector2ui& Tilemap::GetChunkCount() const
+	{
+		return m_chunkCount;
+	}
+
 	/*!
 	* \brief Gets the tilemap size (i.e. number of tiles in each dimension)
 	* \return Number of tiles in each dimension
@@ -405,16 +379,22 @@ namespace Nz
 		UpdateAABB();
 	}
 
-	inline void Tilemap::InvalidateVertices()
+	inline auto Tilemap::GetChunk(const Vector2ui& tilePos) -> Chunk&
 	{
-		m_shouldRebuildVertices = true;
-		OnElementInvalidated(this);
+		return m_chunks[(tilePos.y / ChunkSize) * m_chunkCount.x + tilePos.x / ChunkSize];
 	}
 
-	inline void Tilemap::UpdateAABB()
+	inline void Tilemap::InvalidateTile(const Vector2ui& tilePos)
 	{
-		Vector2f size = GetSize();
-		InstancedRenderable::UpdateAABB(Rectf(-m_origin * size, size));
+		GetChunk(tilePos).shouldRebuildVertices = true;
+	}
+
+	inline void Tilemap::InvalidateVertices()
+	{
+		for (Chunk& chunk : m_chunks)
+			chunk.shouldRebuildVertices = true;
+
+		OnElementInvalidated(this);
 	}
 }
 
@@ -14,7 +14,13 @@
 #include <Nazara/Utils/Signal.hpp>
 #include <NZSL/ModuleResolver.hpp>
 #include <NZSL/Ast/Module.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -25,22 +31,41 @@ namespace Nz
 		public:
 			struct Config;
 			struct Option;
+			struct OptionVariations;
+			using CompileCallback = std::function<std::shared_ptr<ShaderModule>(const UberShader& uberShader, const Config& config)>;
 			using ConfigCallback = std::function<void(Config& config, const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers)>;
 
 			UberShader(nzsl::ShaderStageTypeFlags shaderStages, std::string moduleName);
 			UberShader(nzsl::ShaderStageTypeFlags shaderStages, nzsl::ModuleResolver& moduleResolver, std::string moduleName);
 			UberShader(nzsl::ShaderStageTypeFlags shaderStages, nzsl::Ast::ModulePtr shaderModule);
-			~UberShader() = default;
+			UberShader(const UberShader&) = delete;
+			UberShader(UberShader&&) = delete;
+			~UberShader();
 
+			inline std::size_t GetCompiledCount() const;
+			inline std::size_t GetPendingCount() const;
+			inline const nzsl::Ast::ModulePtr& GetShaderModule() const;
 			inline nzsl::ShaderStageTypeFlags GetSupportedStages() const;
 
-			const std::shared_ptr<ShaderModule>& Get(const Config& config);
+			std::shared_ptr<ShaderModule> Get(const Config& config);
 
 			inline bool HasOption(const std::string& optionName, Pointer<const Option>* option = nullptr) const;
 
+			std::size_t Precompile(const std::vector<Config>& configs, unsigned int maxThreadCount = 0);
+
+			std::shared_ptr<ShaderModule> TryGet(const Config& config);
+
+			inline void UpdateCompileCallback(CompileCallback callback);
 			inline void UpdateConfig(Config& config, const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers);
 			inline void UpdateConfigCallback(ConfigCallback callback);
 
+			void WaitForPrecompilation();
+
+			UberShader& operator=(const UberShader&) = delete;
+			UberShader& operator=(UberShader&&) = delete;
+
+			static std::vector<Config> EnumerateConfigs(const Config& baseConfig, const std::vector<OptionVariations>& optionVariations);
+
 			struct Config
 			{
 				std::unordered_map<UInt32, nzsl::Ast::ConstantSingleValue> optionValues;
@@ -61,18 +86,42 @@ namespace Nz
 				UInt32 hash;
 			};
 
+			struct OptionVariations
+			{
+				UInt32 hash;
+				std::vector<nzsl::Ast::ConstantSingleValue> values;
+			};
+
 			NazaraSignal(OnShaderUpdated, UberShader* /*uberShader*/);
 
 		private:
+			struct Combination
+			{
+				std::shared_ptr<ShaderModule> shaderModule;
+				bool isPending = false;
+			};
+
+			std::shared_ptr<ShaderModule> Compile(const Config& config) const;
+			void RunPrecompilation();
 			nzsl::Ast::ModulePtr Validate(const nzsl::Ast::Module& module, std::unordered_map<std::string, Option>* options);
 
 			NazaraSlot(nzsl::ModuleResolver, OnModuleUpdated, m_onShaderModuleUpdated);
 
-			std::unordered_map<Config, std::shared_ptr<ShaderModule>, ConfigHasher, ConfigEqual> m_combinations;
+			std::atomic_size_t m_compiledCount;
+			std::atomic_size_t m_pendingCount;
+			std::condition_variable m_combinationCondition;
+			std::mutex m_combinationMutex;
+			std::thread m_precompilationThread;
+			std::unordered_map<Config, Combination, ConfigHasher, ConfigEqual> m_combinations;
 			std::unordered_map<std::string, Option> m_optionIndexByName;
+			std::vector<Config> m_precompilationQueue;
 			nzsl::Ast::ModulePtr m_shaderModule;
+			CompileCallback m_compileCallback;
 			ConfigCallback m_configCallback;
 			nzsl::ShaderStageTypeFlags m_shaderStages;
+			UInt64 m_shaderModuleKey;
+			unsigned int m_precompilationThreadCount;
+			bool m_isPrecompiling;
 	};
 }
 
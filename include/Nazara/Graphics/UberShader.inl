@@ -7,6 +7,21 @@
 
 namespace Nz
 {
+	inline std::size_t UberShader::GetCompiledCount() const
+	{
+		return m_compiledCount.load(std::memory_order_relaxed);
+	}
+
+	inline std::size_t UberShader::GetPendingCount() const
+	{
+		return m_pendingCount.load(std::memory_order_relaxed);
+	}
+
+	inline const nzsl::Ast::ModulePtr& UberShader::GetShaderModule() const
+	{
+		return m_shaderModule;
+	}
+
 	inline nzsl::ShaderStageTypeFlags UberShader::GetSupportedStages() const
 	{
 		return m_shaderStages;
@@ -24,6 +39,11 @@ namespace Nz
 		return true;
 	}
 
+	inline void UberShader::UpdateCompileCallback(CompileCallback callback)
+	{
+		m_compileCallback = std::move(callback);
+	}
+
 	inline void UberShader::UpdateConfig(Config& config, const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers)
 	{
 		if (m_configCallback)
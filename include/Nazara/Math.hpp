@@ -37,6 +37,7 @@
 #include <Nazara/Math/Config.hpp>
 #include <Nazara/Math/Enums.hpp>
 #include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Math/Fixed.hpp>
 #include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Math/Matrix4.hpp>
 #include <Nazara/Math/OrientedBox.hpp>
@@ -0,0 +1,117 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Math module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_MATH_FIXED_HPP
+#define NAZARA_MATH_FIXED_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <Nazara/Utils/TypeTag.hpp>
+#include <functional>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+namespace Nz
+{
+	struct SerializationContext;
+
+	// Fixed-point number, every operation is done on integers to give the same results on every platform and compiler
+	template<typename T, unsigned int FractionalBits>
+	class Fixed
+	{
+		static_assert(std::is_integral_v<T> && std::is_signed_v<T>, "fixed-point numbers must be based on signed integers");
+		static_assert(sizeof(T) == 4 || sizeof(T) == 8, "only 32 and 64 bits integers are supported");
+		static_assert(FractionalBits > 0 && FractionalBits < sizeof(T) * 8 - 1, "invalid fractional bit count");
+		static_assert(FractionalBits % 2 == 0, "fractional bit count must be even");
+
+		public:
+			using RawType = T;
+
+			constexpr Fixed() = default;
+			template<typename U, std::enable_if_t<std::is_integral_v<U>, int> = 0> constexpr Fixed(U value);
+			template<typename U, std::enable_if_t<std::is_floating_point_v<U>, int> = 0> constexpr explicit Fixed(U value);
+			constexpr Fixed(const Fixed&) = default;
+			constexpr Fixed(Fixed&&) noexcept = default;
+			~Fixed() = default;
+
+			constexpr T GetRaw() const;
+
+			constexpr Fixed& SetRaw(T raw);
+
+			constexpr T ToInteger() const;
+			std::string ToString() const;
+
+			template<typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0> constexpr explicit operator U() const;
+
+			constexpr Fixed& operator=(const Fixed&) = default;
+			constexpr Fixed& operator=(Fixed&&) noexcept = default;
+
+			constexpr Fixed operator+() const;
+			constexpr Fixed operator-() const;
+
+			constexpr Fixed operator+(Fixed other) const;
+			constexpr Fixed operator-(Fixed other) const;
+			constexpr Fixed operator*(Fixed other) const;
+			constexpr Fixed operator/(Fixed other) const;
+
+			constexpr Fixed& operator+=(Fixed other);
+			constexpr Fixed& operator-=(Fixed other);
+			constexpr Fixed& operator*=(Fixed other);
+			constexpr Fixed& operator/=(Fixed other);
+
+			constexpr bool operator==(Fixed other) const;
+			constexpr bool operator!=(Fixed other) const;
+			constexpr bool operator<(Fixed other) const;
+			constexpr bool operator<=(Fixed other) const;
+			constexpr bool operator>(Fixed other) const;
+			constexpr bool operator>=(Fixed other) const;
+
+			static constexpr Fixed Epsilon();
+			static constexpr Fixed FromRaw(T raw);
+			static constexpr Fixed HalfPi();
+			static constexpr Fixed Max();
+			static constexpr Fixed Min();
+			static constexpr Fixed One();
+			static constexpr Fixed Pi();
+			static constexpr Fixed Zero();
+
+			static constexpr unsigned int FractionalBitCount = FractionalBits;
+
+		private:
+			T m_raw;
+	};
+
+	using Fixed16 = Fixed<Int32, 16>; //< Q16.16
+	using Fixed32 = Fixed<Int64, 32>; //< Q32.32
+
+	template<typename T, unsigned int F> constexpr Fixed<T, F> Abs(Fixed<T, F> value);
+	template<typename T, unsigned int F> constexpr Fixed<T, F> Cos(Fixed<T, F> radians);
+	template<typename T, unsigned int F> constexpr bool NumberEquals(Fixed<T, F> a, Fixed<T, F> b);
+	template<typename T, unsigned int F> constexpr bool NumberEquals(Fixed<T, F> a, Fixed<T, F> b, Fixed<T, F> maxDifference);
+	template<typename T, unsigned int F> constexpr Fixed<T, F> Sin(Fixed<T, F> radians);
+	template<typename T, unsigned int F> constexpr Fixed<T, F> Sqrt(Fixed<T, F> value);
+
+	template<typename T, unsigned int F> void BatchAdd(const Fixed<T, F>* lhs, const Fixed<T, F>* rhs, Fixed<T, F>* results, std::size_t count);
+	template<typename T, unsigned int F> void BatchMultiply(const Fixed<T, F>* lhs, const Fixed<T, F>* rhs, Fixed<T, F>* results, std::size_t count);
+	template<typename T, unsigned int F> void BatchMultiply(const Fixed<T, F>* values, Fixed<T, F> scale, Fixed<T, F>* results, std::size_t count);
+
+	template<typename T, unsigned int F> std::ostream& operator<<(std::ostream& out, Fixed<T, F> value);
+
+	template<typename T, unsigned int F> bool Serialize(SerializationContext& context, Fixed<T, F> value, TypeTag<Fixed<T, F>>);
+	template<typename T, unsigned int F> bool Unserialize(SerializationContext& context, Fixed<T, F>* value, TypeTag<Fixed<T, F>>);
+}
+
+namespace std
+{
+	template<typename T, unsigned int F> struct hash<Nz::Fixed<T, F>>;
+	template<typename T, unsigned int F> class numeric_limits<Nz::Fixed<T, F>>;
+}
+
+#include <Nazara/Math/Fixed.inl>
+
+#endif // NAZARA_MATH_FIXED_HPP
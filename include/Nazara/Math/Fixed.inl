@@ -0,0 +1,860 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Math module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Math/Fixed.hpp>
+#include <sstream>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NAZARA_MATH_FIXED_SSE2
+	#include <emmintrin.h>
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		// sin(i * pi/512) for a quarter of a turn, as Q2.30 values (generated offline so every platform uses the same values)
+		inline constexpr Int32 FixedSinTable[257] = {
+			0, 6588356, 13176464, 19764076, 26350943, 32936819, 39521455, 46104602,
+			52686014, 59265442, 65842639, 72417357, 78989349, 85558366, 92124163, 98686491,
+			105245103, 111799753, 118350194, 124896179, 131437462, 137973796, 144504935, 151030634,
+			157550647, 164064728, 170572633, 177074115, 183568930, 190056834, 196537583, 203010932,
+			209476638, 215934457, 222384147, 228825464, 235258165, 241682010, 248096755, 254502159,
+			260897982, 267283981, 273659918, 280025552, 286380643, 292724951, 299058239, 305380268,
+			311690799, 317989595, 324276419, 330551034, 336813204, 343062693, 349299266, 355522689,
+			361732726, 367929144, 374111709, 380280190, 386434353, 392573967, 398698801, 404808624,
+			410903207, 416982319, 423045732, 429093217, 435124548, 441139496, 447137835, 453119340,
+			459083786, 465030947, 470960600, 476872522, 482766489, 488642281, 494499676, 500338453,
+			506158392, 511959275, 517740883, 523502998, 529245404, 534967884, 540670223, 546352205,
+			552013618, 557654248, 563273883, 568872310, 574449320, 580004702, 585538248, 591049748,
+			596538995, 602005783, 607449906, 612871159, 618269338, 623644239, 628995660, 634323400,
+			639627258, 644907034, 650162530, 655393548, 660599890, 665781362, 670937767, 676068911,
+			681174602, 686254647, 691308855, 696337036, 701339000, 706314559, 711263525, 716185713,
+			721080937, 725949013, 730789757, 735602987, 740388522, 745146182, 749875788, 754577161,
+			759250125, 763894504, 768510122, 773096806, 777654384, 782182683, 786681534, 791150767,
+			795590213, 799999706, 804379079, 808728167, 813046808, 817334838, 821592095, 825818421,
+			830013654, 834177638, 838310216, 842411232, 846480531, 850517961, 854523370, 858496606,
+			862437520, 866345964, 870221790, 874064853, 877875009, 881652112, 885396022, 889106597,
+			892783698, 896427186, 900036924, 903612776, 907154608, 910662286, 914135678, 917574653,
+			920979082, 924348837, 927683790, 930983817, 934248793, 937478595, 940673101, 943832191,
+			946955747, 950043650, 953095785, 956112036, 959092290, 962036435, 964944360, 967815955,
+			970651112, 973449725, 976211688, 978936898, 981625251, 984276646, 986890984, 989468165,
+			992008094, 994510675, 996975812, 999403415, 1001793390, 1004145648, 1006460100, 1008736660,
+			1010975242, 1013175761, 1015338134, 1017462281, 1019548121, 1021595575, 1023604567, 1025575020,
+			1027506862, 1029400018, 1031254418, 1033069992, 1034846671, 1036584389, 1038283080, 1039942680,
+			1041563127, 1043144360, 1044686319, 1046188946, 1047652185, 1049075980, 1050460278, 1051805027,
+			1053110176, 1054375676, 1055601479, 1056787540, 1057933813, 1059040255, 1060106826, 1061133483,
+			1062120190, 1063066909, 1063973603, 1064840240, 1065666786, 1066453210, 1067199483, 1067905576,
+			1068571464, 1069197120, 1069782521, 1070327646, 1070832474, 1071296985, 1071721163, 1072104991,
+			1072448455, 1072751542, 1073014240, 1073236540, 1073418433, 1073559913, 1073660973, 1073721611,
+			1073741824
+		};
+
+		inline constexpr Int64 FixedPiQ61 = 7244019458077122842LL;       //< round(pi * 2^61)
+		inline constexpr UInt64 FixedInvTwoPiQ64 = 2935890503282001226ULL; //< round(2^64 / (2 * pi))
+
+#ifdef __SIZEOF_INT128__
+		__extension__ typedef __int128 FixedInt128;
+#endif
+
+		// Returns floor(a * b / 2^shift) truncated to 64 bits, for 0 < shift < 64
+		constexpr Int64 FixedMultiplyShift(Int64 a, Int64 b, unsigned int shift)
+		{
+#ifdef __SIZEOF_INT128__
+			return static_cast<Int64>((static_cast<FixedInt128>(a) * b) >> shift);
+#else
+			UInt64 ua = static_cast<UInt64>(a);
+			UInt64 ub = static_cast<UInt64>(b);
+
+			UInt64 aLow = ua & 0xFFFFFFFF;
+			UInt64 aHigh = ua >> 32;
+			UInt64 bLow = ub & 0xFFFFFFFF;
+			UInt64 bHigh = ub >> 32;
+
+			UInt64 lowLow = aLow * bLow;
+			UInt64 lowHigh = aLow * bHigh;
+			UInt64 highLow = aHigh * bLow;
+			UInt64 highHigh = aHigh * bHigh;
+
+			UInt64 middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+			UInt64 low = (middle << 32) | (lowLow & 0xFFFFFFFF);
+			UInt64 high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+
+			// Two's complement correction of the unsigned product
+			if (a < 0)
+				high -= ub;
+
+			if (b < 0)
+				high -= ua;
+
+			return static_cast<Int64>((high << (64 - shift)) | (low >> shift));
+#endif
+		}
+
+		// Returns a * 2^shift / b rounded toward zero and truncated to 64 bits, for 0 < shift < 64
+		constexpr Int64 FixedShiftDivide(Int64 a, Int64 b, unsigned int shift)
+		{
+#ifdef __SIZEOF_INT128__
+			return static_cast<Int64>((static_cast<FixedInt128>(a) * (static_cast<FixedInt128>(1) << shift)) / b);
+#else
+			bool negative = (a < 0) != (b < 0);
+			UInt64 ua = (a < 0) ? UInt64(0) - static_cast<UInt64>(a) : static_cast<UInt64>(a);
+			UInt64 ub = (b < 0) ? UInt64(0) - static_cast<UInt64>(b) : static_cast<UInt64>(b);
+
+			UInt64 high = ua >> (64 - shift);
+			UInt64 low = ua << shift;
+
+			// Restoring long division of the 128 bits numerator
+			UInt64 remainder = 0;
+			UInt64 quotient = 0;
+			for (unsigned int i = 64 + shift; i-- > 0;)
+			{
+				UInt64 bit = (i >= 64) ? (high >> (i - 64)) & 1 : (low >> i) & 1;
+				bool carry = (remainder >> 63) != 0;
+
+				remainder = (remainder << 1) | bit;
+				quotient <<= 1;
+				if (carry || remainder >= ub)
+				{
+					remainder -= ub;
+					quotient |= 1;
+				}
+			}
+
+			return static_cast<Int64>((negative) ? UInt64(0) - quotient : quotient);
+#endif
+		}
+
+		// Returns sin(phase * 2pi / 2^32) as a raw fixed-point value with F fractional bits
+		template<unsigned int F>
+		constexpr Int64 FixedSin(UInt32 phase)
+		{
+			UInt32 quadrant = phase >> 30;
+			UInt32 offset = phase & 0x3FFFFFFF;
+			if (quadrant & 1)
+				offset = 0x40000000 - offset;
+
+			UInt32 index = offset >> 22;
+			UInt32 fraction = offset & 0x3FFFFF;
+
+			Int64 value = FixedSinTable[index];
+			if (fraction != 0)
+				value += ((FixedSinTable[index + 1] - value) * fraction) >> 22;
+
+			// Convert the magnitude so that sin(-x) == -sin(x)
+			if constexpr (F >= 30)
+				value <<= F - 30;
+			else
+				value = (value + (Int64(1) << (29 - F))) >> (30 - F);
+
+			return (quadrant & 2) ? -value : value;
+		}
+
+		// Converts radians to a fraction of turn where 2^32 is a whole turn
+		template<typename T, unsigned int F>
+		constexpr UInt32 FixedToTurnPhase(Fixed<T, F> radians)
+		{
+			constexpr Int64 factor = static_cast<Int64>((FixedInvTwoPiQ64 + (UInt64(1) << (F - 1))) >> F);
+
+			return static_cast<UInt32>(static_cast<UInt64>(FixedMultiplyShift(radians.GetRaw(), factor, 32)));
+		}
+	}
+
+	/*!
+	* \ingroup math
+	* \class Nz::Fixed
+	* \brief Math class that represents a fixed-point number
+	*
+	* Every operation is done using integer arithmetic, which makes results bit-identical across platforms, compilers and optimization levels.
+	* This is what lockstep and rollback simulations require, and floating-point numbers can't guarantee it.
+	*
+	* Fixed numbers can be used with math templates such as Vector2, Vector3, Vector4 or Matrix4 for their arithmetic, comparisons, dot and cross products.
+	* Methods relying on the standard library (such as GetLength or Normalize) are not deterministic and should be replaced by Sqrt, Sin and Cos.
+	*
+	* \remark Overflow wraps around, and division by zero is undefined like with integers
+	* \remark Multiplication rounds toward negative infinity while division rounds toward zero
+	*/
+
+	/*!
+	* \brief Constructs a Fixed object from an integer
+	*
+	* \param value Integer value, it must fit in the integral part
+	*/
+	template<typename T, unsigned int FractionalBits>
+	template<typename U, std::enable_if_t<std::is_integral_v<U>, int>>
+	constexpr Fixed<T, FractionalBits>::Fixed(U value) :
+	m_raw(static_cast<T>(static_cast<std::make_unsigned_t<T>>(value) << FractionalBits))
+	{
+	}
+
+	/*!
+	* \brief Constructs a Fixed object from a floating-point value, rounding to the nearest representable value
+	*
+	* \param value Floating-point value, it must fit in the integral part
+	*
+	* \remark Only conversions from values computed deterministically (such as constants) give deterministic results
+	*/
+	template<typename T, unsigned int FractionalBits>
+	template<typename U, std::enable_if_t<std::is_floating_point_v<U>, int>>
+	constexpr Fixed<T, FractionalBits>::Fixed(U value) :
+	m_raw(0)
+	{
+		double scaled = static_cast<double>(value) * static_cast<double>(T(1) << FractionalBits);
+		m_raw = static_cast<T>((scaled < 0.0) ? scaled - 0.5 : scaled + 0.5);
+	}
+
+	/*!
+	* \brief Gets the raw integer value of the number
+	* \return Raw value, which is the number multiplied by 2^FractionalBits
+	*
+	* \see FromRaw
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr T Fixed<T, FractionalBits>::GetRaw() const
+	{
+		return m_raw;
+	}
+
+	/*!
+	* \brief Sets the raw integer value of the number
+	* \return A reference to this number
+	*
+	* \param raw Raw value, which is the number multiplied by 2^FractionalBits
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits>& Fixed<T, FractionalBits>::SetRaw(T raw)
+	{
+		m_raw = raw;
+		return *this;
+	}
+
+	/*!
+	* \brief Converts the number to an integer, rounding toward negative infinity
+	* \return Integral part of the number
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr T Fixed<T, FractionalBits>::ToInteger() const
+	{
+		return m_raw >> FractionalBits;
+	}
+
+	/*!
+	* \brief Gives a string representation
+	* \return A string representation of the number: "Fixed(value)"
+	*/
+	template<typename T, unsigned int FractionalBits>
+	std::string Fixed<T, FractionalBits>::ToString() const
+	{
+		std::ostringstream ss;
+		ss << *this;
+
+		return ss.str();
+	}
+
+	/*!
+	* \brief Converts the number to an arithmetic type
+	* \return Integral part of the number (rounded toward negative infinity) for integers, closest value for floating-point types
+	*/
+	template<typename T, unsigned int FractionalBits>
+	template<typename U, std::enable_if_t<std::is_arithmetic_v<U>, int>>
+	constexpr Fixed<T, FractionalBits>::operator U() const
+	{
+		if constexpr (std::is_floating_point_v<U>)
+			return static_cast<U>(m_raw) / static_cast<U>(T(1) << FractionalBits);
+		else
+			return static_cast<U>(ToInteger());
+	}
+
+	/*!
+	* \brief Helps to represent the sign of the number
+	* \return A constant reference to this number
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::operator+() const
+	{
+		return *this;
+	}
+
+	/*!
+	* \brief Negates the number
+	* \return Negated number
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::operator-() const
+	{
+		using UnsignedType = std::make_unsigned_t<T>;
+		return FromRaw(static_cast<T>(UnsignedType(0) - static_cast<UnsignedType>(m_raw)));
+	}
+
+	/*!
+	* \brief Adds two numbers
+	* \return Sum of the two numbers
+	*
+	* \param other Number to add
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::operator+(Fixed other) const
+	{
+		using UnsignedType = std::make_unsigned_t<T>;
+		return FromRaw(static_cast<T>(static_cast<UnsignedType>(m_raw) + static_cast<UnsignedType>(other.m_raw)));
+	}
+
+	/*!
+	* \brief Substracts two numbers
+	* \return Difference of the two numbers
+	*
+	* \param other Number to substract
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::operator-(Fixed other) const
+	{
+		using UnsignedType = std::make_unsigned_t<T>;
+		return FromRaw(static_cast<T>(static_cast<UnsignedType>(m_raw) - static_cast<UnsignedType>(other.m_raw)));
+	}
+
+	/*!
+	* \brief Multiplies two numbers
+	* \return Product of the two numbers, rounded toward negative infinity
+	*
+	* \param other Number to multiply with
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::operator*(Fixed other) const
+	{
+		if constexpr (sizeof(T) <= sizeof(Int32))
+			return FromRaw(static_cast<T>((static_cast<Int64>(m_raw) * other.m_raw) >> FractionalBits));
+		else
+			return FromRaw(static_cast<T>(Detail::FixedMultiplyShift(m_raw, other.m_raw, FractionalBits)));
+	}
+
+	/*!
+	* \brief Divides two numbers
+	* \return Quotient of the two numbers, rounded toward zero
+	*
+	* \param other Number to divide with, must not be zero
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::operator/(Fixed other) const
+	{
+		if constexpr (sizeof(T) <= sizeof(Int32))
+			return FromRaw(static_cast<T>((static_cast<Int64>(m_raw) * (Int64(1) << FractionalBits)) / other.m_raw));
+		else
+			return FromRaw(static_cast<T>(Detail::FixedShiftDivide(m_raw, other.m_raw, FractionalBits)));
+	}
+
+	/*!
+	* \brief Adds a number to this one
+	* \return A reference to this number
+	*
+	* \param other Number to add
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits>& Fixed<T, FractionalBits>::operator+=(Fixed other)
+	{
+		return *this = *this + other;
+	}
+
+	/*!
+	* \brief Substracts a number to this one
+	* \return A reference to this number
+	*
+	* \param other Number to substract
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits>& Fixed<T, FractionalBits>::operator-=(Fixed other)
+	{
+		return *this = *this - other;
+	}
+
+	/*!
+	* \brief Multiplies this number by another one
+	* \return A reference to this number
+	*
+	* \param other Number to multiply with
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits>& Fixed<T, FractionalBits>::operator*=(Fixed other)
+	{
+		return *this = *this * other;
+	}
+
+	/*!
+	* \brief Divides this number by another one
+	* \return A reference to this number
+	*
+	* \param other Number to divide with, must not be zero
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits>& Fixed<T, FractionalBits>::operator/=(Fixed other)
+	{
+		return *this = *this / other;
+	}
+
+	/*!
+	* \brief Compares the number to other one
+	* \return true if the numbers are the same
+	*
+	* \param other Other number to compare with
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr bool Fixed<T, FractionalBits>::operator==(Fixed other) const
+	{
+		return m_raw == other.m_raw;
+	}
+
+	/*!
+	* \brief Compares the number to other one
+	* \return false if the numbers are the same
+	*
+	* \param other Other number to compare with
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr bool Fixed<T, FractionalBits>::operator!=(Fixed other) const
+	{
+		return m_raw != other.m_raw;
+	}
+
+	/*!
+	* \brief Compares the number to other one
+	* \return true if this number is less than the other one
+	*
+	* \param other Other number to compare with
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr bool Fixed<T, FractionalBits>::operator<(Fixed other) const
+	{
+		return m_raw < other.m_raw;
+	}
+
+	/*!
+	* \brief Compares the number to other one
+	* \return true if this number is less than or equal to the other one
+	*
+	* \param other Other number to compare with
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr bool Fixed<T, FractionalBits>::operator<=(Fixed other) const
+	{
+		return m_raw <= other.m_raw;
+	}
+
+	/*!
+	* \brief Compares the number to other one
+	* \return true if this number is greater than the other one
+	*
+	* \param other Other number to compare with
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr bool Fixed<T, FractionalBits>::operator>(Fixed other) const
+	{
+		return m_raw > other.m_raw;
+	}
+
+	/*!
+	* \brief Compares the number to other one
+	* \return true if this number is greater than or equal to the other one
+	*
+	* \param other Other number to compare with
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr bool Fixed<T, FractionalBits>::operator>=(Fixed other) const
+	{
+		return m_raw >= other.m_raw;
+	}
+
+	/*!
+	* \brief Returns the smallest positive number
+	* \return Number with a raw value of one
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::Epsilon()
+	{
+		return FromRaw(1);
+	}
+
+	/*!
+	* \brief Builds a number from its raw integer value
+	* \return Number
+	*
+	* \param raw Raw value, which is the number multiplied by 2^FractionalBits
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::FromRaw(T raw)
+	{
+		Fixed number(0);
+		number.m_raw = raw;
+
+		return number;
+	}
+
+	/*!
+	* \brief Returns pi/2
+	* \return Closest number to pi/2
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::HalfPi()
+	{
+		return FromRaw(static_cast<T>((Detail::FixedPiQ61 + (Int64(1) << (61 - FractionalBits))) >> (62 - FractionalBits)));
+	}
+
+	/*!
+	* \brief Returns the greatest number
+	* \return Greatest representable number
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::Max()
+	{
+		return FromRaw(std::numeric_limits<T>::max());
+	}
+
+	/*!
+	* \brief Returns the lowest number
+	* \return Lowest representable number
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::Min()
+	{
+		return FromRaw(std::numeric_limits<T>::lowest());
+	}
+
+	/*!
+	* \brief Returns one
+	* \return Number one
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::One()
+	{
+		return FromRaw(T(1) << FractionalBits);
+	}
+
+	/*!
+	* \brief Returns pi
+	* \return Closest number to pi
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::Pi()
+	{
+		return FromRaw(static_cast<T>((Detail::FixedPiQ61 + (Int64(1) << (60 - FractionalBits))) >> (61 - FractionalBits)));
+	}
+
+	/*!
+	* \brief Returns zero
+	* \return Number zero
+	*/
+	template<typename T, unsigned int FractionalBits>
+	constexpr Fixed<T, FractionalBits> Fixed<T, FractionalBits>::Zero()
+	{
+		return FromRaw(0);
+	}
+
+	/*!
+	* \brief Computes the absolute value of a fixed-point number
+	* \return Absolute value
+	*
+	* \param value Number
+	*/
+	template<typename T, unsigned int F>
+	constexpr Fixed<T, F> Abs(Fixed<T, F> value)
+	{
+		return (value.GetRaw() < 0) ? -value : value;
+	}
+
+	/*!
+	* \brief Computes the cosine of a fixed-point angle, using a lookup table
+	* \return Cosine of the angle, with an error lesser than 1e-5
+	*
+	* \param radians Angle in radians
+	*/
+	template<typename T, unsigned int F>
+	constexpr Fixed<T, F> Cos(Fixed<T, F> radians)
+	{
+		UInt32 phase = Detail::FixedToTurnPhase(radians) + 0x40000000; //< cos(x) = sin(x + pi/2)
+		return Fixed<T, F>::FromRaw(static_cast<T>(Detail::FixedSin<F>(phase)));
+	}
+
+	/*!
+	* \brief Checks whether two fixed-point numbers are equal, with a tolerance of the smallest representable difference
+	* \return true if they are equal
+	*
+	* \param a First number
+	* \param b Second number
+	*/
+	template<typename T, unsigned int F>
+	constexpr bool NumberEquals(Fixed<T, F> a, Fixed<T, F> b)
+	{
+		return NumberEquals(a, b, Fixed<T, F>::Epsilon());
+	}
+
+	/*!
+	* \brief Checks whether two fixed-point numbers are equal within a tolerance
+	* \return true if the difference between them is less than or equal to maxDifference
+	*
+	* \param a First number
+	* \param b Second number
+	* \param maxDifference Tolerance
+	*/
+	template<typename T, unsigned int F>
+	constexpr bool NumberEquals(Fixed<T, F> a, Fixed<T, F> b, Fixed<T, F> maxDifference)
+	{
+		return ((a > b) ? a - b : b - a) <= maxDifference;
+	}
+
+	/*!
+	* \brief Computes the sine of a fixed-point angle, using a lookup table
+	* \return Sine of the angle, with an error lesser than 1e-5
+	*
+	* \param radians Angle in radians
+	*/
+	template<typename T, unsigned int F>
+	constexpr Fixed<T, F> Sin(Fixed<T, F> radians)
+	{
+		return Fixed<T, F>::FromRaw(static_cast<T>(Detail::FixedSin<F>(Detail::FixedToTurnPhase(radians))));
+	}
+
+	/*!
+	* \brief Computes the square root of a fixed-point number, bit by bit
+	* \return Square root of the number rounded toward zero, zero if the number is negative
+	*
+	* \param value Number
+	*/
+	template<typename T, unsigned int F>
+	constexpr Fixed<T, F> Sqrt(Fixed<T, F> value)
+	{
+		if (value.GetRaw() <= 0)
+			return Fixed<T, F>::Zero();
+
+		// sqrt(raw / 2^F) * 2^F == sqrt(raw * 2^F), computed two bits at a time
+		constexpr unsigned int bitCount = sizeof(T) * 8 + F;
+
+		UInt64 raw = static_cast<UInt64>(value.GetRaw());
+		UInt64 remainder = 0;
+		UInt64 root = 0;
+		for (unsigned int i = bitCount; i > 0; i -= 2)
+		{
+			unsigned int position = i - 2; //< position of the two bits in raw * 2^F
+			UInt64 bits = (position >= F) ? (raw >> (position - F)) & 3 : 0;
+
+			remainder = (remainder << 2) | bits;
+			root <<= 1;
+
+			UInt64 test = (root << 1) | 1;
+			if (remainder >= test)
+			{
+				remainder -= test;
+				root |= 1;
+			}
+		}
+
+		return Fixed<T, F>::FromRaw(static_cast<T>(root));
+	}
+
+	/*!
+	* \brief Adds fixed-point numbers two by two
+	*
+	* \param lhs First numbers
+	* \param rhs Second numbers
+	* \param results Output numbers, may alias the inputs
+	* \param count Number of elements in each array
+	*
+	* \remark Results are the same as with operator+
+	*/
+	template<typename T, unsigned int F>
+	void BatchAdd(const Fixed<T, F>* lhs, const Fixed<T, F>* rhs, Fixed<T, F>* results, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#ifdef NAZARA_MATH_FIXED_SSE2
+		if constexpr (sizeof(T) == sizeof(Int32))
+		{
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+				__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(results + i), _mm_add_epi32(a, b));
+			}
+		}
+		else
+		{
+			for (; i + 2 <= count; i += 2)
+			{
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+				__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(results + i), _mm_add_epi64(a, b));
+			}
+		}
+#endif
+
+		for (; i < count; ++i)
+			results[i] = lhs[i] + rhs[i];
+	}
+
+#ifdef NAZARA_MATH_FIXED_SSE2
+	namespace Detail
+	{
+		// Multiplies four Q(32-F).F numbers, SSE2 only has an unsigned 32x32 -> 64 multiplication so the signed product is rebuilt from it
+		template<unsigned int F>
+		__m128i FixedMultiplySSE2(__m128i a, __m128i b)
+		{
+			const __m128i lowMask = _mm_set_epi32(0, -1, 0, -1);
+			const __m128i highMask = _mm_set_epi32(-1, 0, -1, 0);
+
+			__m128i evenProducts = _mm_mul_epu32(a, b);
+			__m128i oddProducts = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+
+			// signed(a) * signed(b) == unsigned(a) * unsigned(b) - ((a < 0) ? b : 0) * 2^32 - ((b < 0) ? a : 0) * 2^32
+			__m128i correction = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b), _mm_and_si128(_mm_srai_epi32(b, 31), a));
+			evenProducts = _mm_sub_epi64(evenProducts, _mm_slli_epi64(correction, 32));
+			oddProducts = _mm_sub_epi64(oddProducts, _mm_and_si128(correction, highMask));
+
+			__m128i evenResults = _mm_and_si128(_mm_srli_epi64(evenProducts, F), lowMask);
+			__m128i oddResults = _mm_slli_epi64(_mm_srli_epi64(oddProducts, F), 32);
+
+			return _mm_or_si128(evenResults, oddResults);
+		}
+	}
+#endif
+
+	/*!
+	* \brief Multiplies fixed-point numbers two by two
+	*
+	* \param lhs First numbers
+	* \param rhs Second numbers
+	* \param results Output numbers, may alias the inputs
+	* \param count Number of elements in each array
+	*
+	* \remark Results are the same as with operator*
+	*/
+	template<typename T, unsigned int F>
+	void BatchMultiply(const Fixed<T, F>* lhs, const Fixed<T, F>* rhs, Fixed<T, F>* results, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#ifdef NAZARA_MATH_FIXED_SSE2
+		if constexpr (sizeof(T) == sizeof(Int32))
+		{
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+				__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(results + i), Detail::FixedMultiplySSE2<F>(a, b));
+			}
+		}
+#endif
+
+		for (; i < count; ++i)
+			results[i] = lhs[i] * rhs[i];
+	}
+
+	/*!
+	* \brief Multiplies fixed-point numbers by a scale
+	*
+	* \param values Numbers to scale
+	* \param scale Scale
+	* \param results Output numbers, may alias the inputs
+	* \param count Number of elements in each array
+	*
+	* \remark Results are the same as with operator*
+	*/
+	template<typename T, unsigned int F>
+	void BatchMultiply(const Fixed<T, F>* values, Fixed<T, F> scale, Fixed<T, F>* results, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#ifdef NAZARA_MATH_FIXED_SSE2
+		if constexpr (sizeof(T) == sizeof(Int32))
+		{
+			__m128i b = _mm_set1_epi32(scale.GetRaw());
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(results + i), Detail::FixedMultiplySSE2<F>(a, b));
+			}
+		}
+#endif
+
+		for (; i < count; ++i)
+			results[i] = values[i] * scale;
+	}
+
+	/*!
+	* \brief Output operator
+	* \return The stream
+	*
+	* \param out The stream
+	* \param value The number to output
+	*/
+	template<typename T, unsigned int F>
+	std::ostream& operator<<(std::ostream& out, Fixed<T, F> value)
+	{
+		return out << "Fixed(" << static_cast<double>(value) << ')';
+	}
+
+	/*!
+	* \brief Serializes a Fixed
+	* \return true if successfully serialized
+	*
+	* \param context Serialization context
+	* \param value Input number
+	*/
+	template<typename T, unsigned int F>
+	bool Serialize(SerializationContext& context, Fixed<T, F> value, TypeTag<Fixed<T, F>>)
+	{
+		if (!Serialize(context, value.GetRaw()))
+			return false;
+
+		return true;
+	}
+
+	/*!
+	* \brief Unserializes a Fixed
+	* \return true if successfully unserialized
+	*
+	* \param context Serialization context
+	* \param value Output number
+	*/
+	template<typename T, unsigned int F>
+	bool Unserialize(SerializationContext& context, Fixed<T, F>* value, TypeTag<Fixed<T, F>>)
+	{
+		T raw;
+		if (!Unserialize(context, &raw))
+			return false;
+
+		value->SetRaw(raw);
+
+		return true;
+	}
+}
+
+namespace std
+{
+	template<typename T, unsigned int F>
+	struct hash<Nz::Fixed<T, F>>
+	{
+		std::size_t operator()(Nz::Fixed<T, F> value) const
+		{
+			return std::hash<T>()(value.GetRaw());
+		}
+	};
+
+	template<typename T, unsigned int F>
+	class numeric_limits<Nz::Fixed<T, F>>
+	{
+		public:
+			static constexpr bool is_specialized = true;
+			static constexpr bool is_signed = true;
+			static constexpr bool is_integer = false;
+			static constexpr bool is_exact = true;
+			static constexpr bool is_bounded = true;
+			static constexpr bool is_modulo = true;
+
+			static constexpr Nz::Fixed<T, F> epsilon() { return Nz::Fixed<T, F>::Epsilon(); }
+			static constexpr Nz::Fixed<T, F> lowest() { return Nz::Fixed<T, F>::Min(); }
+			static constexpr Nz::Fixed<T, F> max() { return Nz::Fixed<T, F>::Max(); }
+			static constexpr Nz::Fixed<T, F> min() { return Nz::Fixed<T, F>::Min(); }
+	};
+}
+
+#include <Nazara/Core/DebugOff.hpp>
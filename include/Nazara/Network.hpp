@@ -32,16 +32,26 @@
 #include <Nazara/Network/AbstractSocket.hpp>
 #include <Nazara/Network/Algorithm.hpp>
 #include <Nazara/Network/Config.hpp>
+#include <Nazara/Network/ENetCommandList.hpp>
 #include <Nazara/Network/ENetCompressor.hpp>
 #include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetLZCompressor.hpp>
 #include <Nazara/Network/ENetPacket.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <Nazara/Network/ENetShardedHost.hpp>
 #include <Nazara/Network/Enums.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 #include <Nazara/Network/Network.hpp>
+#include <Nazara/Network/Quantization.hpp>
+#include <Nazara/Network/SnapshotReceiver.hpp>
+#include <Nazara/Network/SnapshotReplicator.hpp>
+#include <Nazara/Network/SnapshotSchema.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
 #include <Nazara/Network/SocketHandle.hpp>
 #include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/TcpClient.hpp>
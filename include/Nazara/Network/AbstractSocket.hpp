@@ -11,12 +11,17 @@
 #include <Nazara/Network/Config.hpp>
 #include <Nazara/Network/Enums.hpp>
 #include <Nazara/Network/SocketHandle.hpp>
+#include <Nazara/Utils/MovablePtr.hpp>
 #include <Nazara/Utils/Signal.hpp>
 
 namespace Nz
 {
+	class SocketCompletionQueue;
+
 	class NAZARA_NETWORK_API AbstractSocket
 	{
+		friend SocketCompletionQueue;
+
 		public:
 			AbstractSocket(const AbstractSocket&) = delete;
 			AbstractSocket(AbstractSocket&& abstractSocket) noexcept;
@@ -57,6 +62,7 @@ namespace Nz
 
 			inline void UpdateState(SocketState newState);
 
+			MovablePtr<SocketCompletionQueue> m_completionQueue;
 			NetProtocol m_protocol;
 			SocketError m_lastError;
 			SocketHandle m_handle;
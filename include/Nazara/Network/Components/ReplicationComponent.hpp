@@ -0,0 +1,37 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_COMPONENTS_REPLICATIONCOMPONENT_HPP
+#define NAZARA_NETWORK_COMPONENTS_REPLICATIONCOMPONENT_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/Config.hpp>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ReplicationComponent
+	{
+		public:
+			inline ReplicationComponent(float priority = 1.f);
+			ReplicationComponent(const ReplicationComponent&) = default;
+			ReplicationComponent(ReplicationComponent&&) = default;
+			~ReplicationComponent() = default;
+
+			inline float GetPriority() const;
+
+			inline void UpdatePriority(float priority);
+
+			ReplicationComponent& operator=(const ReplicationComponent&) = default;
+			ReplicationComponent& operator=(ReplicationComponent&&) = default;
+
+		private:
+			float m_priority;
+	};
+}
+
+#include <Nazara/Network/Components/ReplicationComponent.inl>
+
+#endif // NAZARA_NETWORK_COMPONENTS_REPLICATIONCOMPONENT_HPP
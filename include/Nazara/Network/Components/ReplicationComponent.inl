@@ -0,0 +1,36 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Components/ReplicationComponent.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::ReplicationComponent
+	* \brief Component marking an entity to be replicated by a SnapshotReplicator
+	*
+	* The priority is accumulated every time the entity could not fit in a snapshot, entities with the highest accumulated priority are sent first.
+	*/
+	inline ReplicationComponent::ReplicationComponent(float priority) :
+	m_priority(priority)
+	{
+		NazaraAssert(priority > 0.f, "Priority must be positive");
+	}
+
+	inline float ReplicationComponent::GetPriority() const
+	{
+		return m_priority;
+	}
+
+	inline void ReplicationComponent::UpdatePriority(float priority)
+	{
+		NazaraAssert(priority > 0.f, "Priority must be positive");
+		m_priority = priority;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
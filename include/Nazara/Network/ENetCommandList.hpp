@@ -0,0 +1,149 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETCOMMANDLIST_HPP
+#define NAZARA_NETWORK_ENETCOMMANDLIST_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Utils/MemoryPool.hpp>
+#include <Nazara/Utils/MovablePtr.hpp>
+#include <iterator>
+
+namespace Nz
+{
+	struct ENetCommandLink
+	{
+		ENetCommandLink* next;
+		ENetCommandLink* previous;
+	};
+
+	template<typename T>
+	struct ENetCommandNode : ENetCommandLink
+	{
+		T value;
+	};
+
+	struct ENetCommandPoolStatistics
+	{
+		std::size_t allocatedNodeCount; //< Number of nodes allocated by the pool, used or not
+		std::size_t usedNodeCount;      //< Number of nodes currently held by a command list
+		UInt64 acquireCount;            //< Number of nodes handed to command lists since the pool creation
+	};
+
+	template<typename T>
+	class ENetCommandPool
+	{
+		public:
+			using Node = ENetCommandNode<T>;
+
+			inline ENetCommandPool(std::size_t blockSize);
+			ENetCommandPool(const ENetCommandPool&) = delete;
+			ENetCommandPool(ENetCommandPool&&) noexcept = default;
+			~ENetCommandPool() = default;
+
+			inline Node* Acquire();
+
+			inline ENetCommandPoolStatistics GetStatistics() const;
+
+			inline void Release(Node* node);
+
+			ENetCommandPool& operator=(const ENetCommandPool&) = delete;
+			ENetCommandPool& operator=(ENetCommandPool&&) noexcept = default;
+
+		private:
+			MemoryPool<Node> m_pool;
+			MovablePtr<Node> m_freeNodes;
+			std::size_t m_allocatedNodeCount;
+			std::size_t m_usedNodeCount;
+			UInt64 m_acquireCount;
+	};
+
+	template<typename T>
+	class ENetCommandList
+	{
+		public:
+			class iterator;
+			using reverse_iterator = std::reverse_iterator<iterator>;
+
+			inline ENetCommandList(ENetCommandPool<T>& pool);
+			ENetCommandList(const ENetCommandList&) = delete;
+			inline ENetCommandList(ENetCommandList&& list) noexcept;
+			inline ~ENetCommandList();
+
+			inline iterator begin();
+
+			inline void clear();
+
+			template<typename... Args> T& emplace_back(Args&&... args);
+			template<typename... Args> iterator emplace(iterator pos, Args&&... args);
+			inline bool empty() const;
+			inline iterator end();
+			inline iterator erase(iterator pos);
+			inline iterator erase(iterator first, iterator last);
+
+			inline T& front();
+
+			inline void pop_front();
+
+			inline reverse_iterator rbegin();
+			inline reverse_iterator rend();
+
+			inline std::size_t size() const;
+			inline void splice(iterator pos, ENetCommandList& other, iterator it);
+			inline void splice(iterator pos, ENetCommandList& other, iterator first, iterator last);
+
+			ENetCommandList& operator=(const ENetCommandList&) = delete;
+			inline ENetCommandList& operator=(ENetCommandList&& list) noexcept;
+
+			class iterator
+			{
+				friend ENetCommandList;
+
+				public:
+					using difference_type = std::ptrdiff_t;
+					using iterator_category = std::bidirectional_iterator_tag;
+					using pointer = T*;
+					using reference = T&;
+					using value_type = T;
+
+					iterator() = default;
+					iterator(const iterator&) = default;
+					iterator(iterator&&) noexcept = default;
+
+					inline T& operator*() const;
+					inline T* operator->() const;
+
+					inline iterator& operator++();
+					inline iterator operator++(int);
+					inline iterator& operator--();
+					inline iterator operator--(int);
+
+					inline bool operator==(const iterator& rhs) const;
+					inline bool operator!=(const iterator& rhs) const;
+
+					iterator& operator=(const iterator&) = default;
+					iterator& operator=(iterator&&) noexcept = default;
+
+				private:
+					inline explicit iterator(ENetCommandLink* link);
+
+					ENetCommandLink* m_link;
+			};
+
+		private:
+			inline void Link(ENetCommandLink* pos, ENetCommandLink* first, ENetCommandLink* last);
+			inline void Unlink(ENetCommandLink* first, ENetCommandLink* last);
+			inline void TakeLinks(ENetCommandList& list);
+
+			ENetCommandLink m_sentinel;
+			MovablePtr<ENetCommandPool<T>> m_pool;
+			std::size_t m_size;
+	};
+}
+
+#include <Nazara/Network/ENetCommandList.inl>
+
+#endif // NAZARA_NETWORK_ENETCOMMANDLIST_HPP
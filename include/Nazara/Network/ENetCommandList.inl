@@ -0,0 +1,371 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetCommandList.hpp>
+#include <cassert>
+#include <utility>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	template<typename T>
+	ENetCommandPool<T>::ENetCommandPool(std::size_t blockSize) :
+	m_pool(blockSize),
+	m_freeNodes(nullptr),
+	m_allocatedNodeCount(0),
+	m_usedNodeCount(0),
+	m_acquireCount(0)
+	{
+	}
+
+	/*!
+	* \brief Retrieves an unlinked node from the pool, allocating a new one only if no released node is available
+	*
+	* \remark Released nodes keep their value alive (but reset), which allows them to keep their internal storage
+	*/
+	template<typename T>
+	auto ENetCommandPool<T>::Acquire() -> Node*
+	{
+		Node* node;
+		if (m_freeNodes)
+		{
+			node = m_freeNodes;
+			m_freeNodes = static_cast<Node*>(node->next);
+		}
+		else
+		{
+			std::size_t poolIndex;
+			node = m_pool.Allocate(poolIndex);
+			m_allocatedNodeCount++;
+		}
+
+		m_acquireCount++;
+		m_usedNodeCount++;
+
+		return node;
+	}
+
+	template<typename T>
+	ENetCommandPoolStatistics ENetCommandPool<T>::GetStatistics() const
+	{
+		ENetCommandPoolStatistics statistics;
+		statistics.acquireCount = m_acquireCount;
+		statistics.allocatedNodeCount = m_allocatedNodeCount;
+		statistics.usedNodeCount = m_usedNodeCount;
+
+		return statistics;
+	}
+
+	template<typename T>
+	void ENetCommandPool<T>::Release(Node* node)
+	{
+		assert(m_usedNodeCount > 0);
+
+		node->value.Reset();
+		node->next = m_freeNodes;
+		node->previous = nullptr;
+		m_freeNodes = node;
+
+		m_usedNodeCount--;
+	}
+
+
+	template<typename T>
+	ENetCommandList<T>::ENetCommandList(ENetCommandPool<T>& pool) :
+	m_pool(&pool),
+	m_size(0)
+	{
+		m_sentinel.next = &m_sentinel;
+		m_sentinel.previous = &m_sentinel;
+	}
+
+	template<typename T>
+	ENetCommandList<T>::ENetCommandList(ENetCommandList&& list) noexcept :
+	m_pool(std::move(list.m_pool))
+	{
+		TakeLinks(list);
+	}
+
+	template<typename T>
+	ENetCommandList<T>::~ENetCommandList()
+	{
+		if (m_pool)
+			clear();
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::begin() -> iterator
+	{
+		return iterator(m_sentinel.next);
+	}
+
+	/*!
+	* \brief Gives back every node of the list to the pool
+	*/
+	template<typename T>
+	void ENetCommandList<T>::clear()
+	{
+		erase(begin(), end());
+	}
+
+	template<typename T>
+	template<typename... Args>
+	T& ENetCommandList<T>::emplace_back(Args&&... args)
+	{
+		return *emplace(end(), std::forward<Args>(args)...);
+	}
+
+	/*!
+	* \brief Inserts a pooled node before pos
+	* \return Iterator to the inserted node
+	*
+	* \param pos Iterator before which the node is inserted
+	* \param args Value assigned to the node (if any), a recycled node otherwise keeps its reset value
+	*/
+	template<typename T>
+	template<typename... Args>
+	auto ENetCommandList<T>::emplace(iterator pos, Args&&... args) -> iterator
+	{
+		typename ENetCommandPool<T>::Node* node = m_pool->Acquire();
+		if constexpr (sizeof...(Args) > 0)
+			node->value = T(std::forward<Args>(args)...);
+
+		Link(pos.m_link, node, node);
+		m_size++;
+
+		return iterator(node);
+	}
+
+	template<typename T>
+	bool ENetCommandList<T>::empty() const
+	{
+		return m_size == 0;
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::end() -> iterator
+	{
+		return iterator(&m_sentinel);
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::erase(iterator pos) -> iterator
+	{
+		assert(pos.m_link != &m_sentinel);
+
+		ENetCommandLink* next = pos.m_link->next;
+		Unlink(pos.m_link, pos.m_link);
+		m_size--;
+
+		m_pool->Release(static_cast<typename ENetCommandPool<T>::Node*>(pos.m_link));
+
+		return iterator(next);
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::erase(iterator first, iterator last) -> iterator
+	{
+		while (first != last)
+			first = erase(first);
+
+		return last;
+	}
+
+	template<typename T>
+	T& ENetCommandList<T>::front()
+	{
+		assert(!empty());
+		return *begin();
+	}
+
+	template<typename T>
+	void ENetCommandList<T>::pop_front()
+	{
+		erase(begin());
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::rbegin() -> reverse_iterator
+	{
+		return reverse_iterator(end());
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::rend() -> reverse_iterator
+	{
+		return reverse_iterator(begin());
+	}
+
+	template<typename T>
+	std::size_t ENetCommandList<T>::size() const
+	{
+		return m_size;
+	}
+
+	/*!
+	* \brief Moves a node from another list (or this one) before pos, without touching the pool
+	*
+	* \param pos Iterator before which the node is moved
+	* \param other List owning the node
+	* \param it Iterator to the node to move, which stays valid
+	*/
+	template<typename T>
+	void ENetCommandList<T>::splice(iterator pos, ENetCommandList& other, iterator it)
+	{
+		iterator last = it;
+		splice(pos, other, it, ++last);
+	}
+
+	/*!
+	* \brief Moves a range of nodes from another list (or this one) before pos, without touching the pool
+	*
+	* \param pos Iterator before which the nodes are moved
+	* \param other List owning the nodes
+	* \param first Iterator to the first node to move
+	* \param last Iterator past the last node to move
+	*/
+	template<typename T>
+	void ENetCommandList<T>::splice(iterator pos, ENetCommandList& other, iterator first, iterator last)
+	{
+		assert(m_pool == other.m_pool);
+
+		if (first == last || pos == last)
+			return;
+
+		std::size_t nodeCount = 0;
+		if (&other != this)
+		{
+			for (iterator it = first; it != last; ++it)
+				nodeCount++;
+		}
+
+		ENetCommandLink* firstLink = first.m_link;
+		ENetCommandLink* lastLink = last.m_link->previous;
+
+		other.Unlink(firstLink, lastLink);
+		other.m_size -= nodeCount;
+
+		Link(pos.m_link, firstLink, lastLink);
+		m_size += nodeCount;
+	}
+
+	template<typename T>
+	ENetCommandList<T>& ENetCommandList<T>::operator=(ENetCommandList&& list) noexcept
+	{
+		if (this == &list)
+			return *this;
+
+		if (m_pool)
+			clear();
+
+		m_pool = std::move(list.m_pool);
+		TakeLinks(list);
+
+		return *this;
+	}
+
+	template<typename T>
+	void ENetCommandList<T>::Link(ENetCommandLink* pos, ENetCommandLink* first, ENetCommandLink* last)
+	{
+		ENetCommandLink* previous = pos->previous;
+
+		first->previous = previous;
+		last->next = pos;
+		previous->next = first;
+		pos->previous = last;
+	}
+
+	template<typename T>
+	void ENetCommandList<T>::Unlink(ENetCommandLink* first, ENetCommandLink* last)
+	{
+		first->previous->next = last->next;
+		last->next->previous = first->previous;
+	}
+
+	template<typename T>
+	void ENetCommandList<T>::TakeLinks(ENetCommandList& list)
+	{
+		m_size = list.m_size;
+		if (m_size > 0)
+		{
+			// Nodes point to the sentinel, which is stored by value and must be patched
+			m_sentinel.next = list.m_sentinel.next;
+			m_sentinel.previous = list.m_sentinel.previous;
+			m_sentinel.next->previous = &m_sentinel;
+			m_sentinel.previous->next = &m_sentinel;
+		}
+		else
+		{
+			m_sentinel.next = &m_sentinel;
+			m_sentinel.previous = &m_sentinel;
+		}
+
+		list.m_sentinel.next = &list.m_sentinel;
+		list.m_sentinel.previous = &list.m_sentinel;
+		list.m_size = 0;
+	}
+
+
+	template<typename T>
+	ENetCommandList<T>::iterator::iterator(ENetCommandLink* link) :
+	m_link(link)
+	{
+	}
+
+	template<typename T>
+	T& ENetCommandList<T>::iterator::operator*() const
+	{
+		return static_cast<typename ENetCommandPool<T>::Node*>(m_link)->value;
+	}
+
+	template<typename T>
+	T* ENetCommandList<T>::iterator::operator->() const
+	{
+		return &static_cast<typename ENetCommandPool<T>::Node*>(m_link)->value;
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::iterator::operator++() -> iterator&
+	{
+		m_link = m_link->next;
+		return *this;
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::iterator::operator++(int) -> iterator
+	{
+		iterator it(*this);
+		operator++();
+		return it;
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::iterator::operator--() -> iterator&
+	{
+		m_link = m_link->previous;
+		return *this;
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::iterator::operator--(int) -> iterator
+	{
+		iterator it(*this);
+		operator--();
+		return it;
+	}
+
+	template<typename T>
+	bool ENetCommandList<T>::iterator::operator==(const iterator& rhs) const
+	{
+		return m_link == rhs.m_link;
+	}
+
+	template<typename T>
+	bool ENetCommandList<T>::iterator::operator!=(const iterator& rhs) const
+	{
+		return m_link != rhs.m_link;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
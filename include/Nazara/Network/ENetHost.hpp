@@ -19,11 +19,13 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/ENetCommandList.hpp>
 #include <Nazara/Network/ENetCompressor.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 #include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/UdpSocket.hpp>
@@ -63,15 +65,23 @@ namespace Nz
 
 			inline bool DoesAllowIncomingConnections() const;
 
+			inline void EnableReusePort(bool reusePort = true);
+
 			void Flush();
 
 			inline IpAddress GetBoundAddress() const;
+			inline ENetCommandPoolStatistics GetIncomingCommandPoolStatistics() const;
+			inline ENetCommandPoolStatistics GetOutgoingCommandPoolStatistics() const;
+			inline ENetPeer* GetPeer(UInt16 peerId);
+			inline std::size_t GetPeerCount() const;
 			inline UInt32 GetServiceTime() const;
 			inline UInt32 GetTotalReceivedPackets() const;
 			inline UInt64 GetTotalReceivedData() const;
 			inline UInt64 GetTotalSentData() const;
 			inline UInt32 GetTotalSentPackets() const;
 
+			inline bool IsReusePortEnabled() const;
+
 			int Service(ENetEvent* event, UInt32 timeout);
 
 			inline void SetCompressor(std::unique_ptr<ENetCompressor>&& compressor);
@@ -89,6 +99,8 @@ namespace Nz
 
 			bool DispatchIncomingCommands(ENetEvent* event);
 
+			int FlushOutgoingDatagrams(ENetEvent* event);
+
 			ENetPeer* HandleConnect(ENetProtocolHeader* header, ENetProtocol* command);
 			bool HandleIncomingCommands(ENetEvent* event);
 
@@ -110,6 +122,16 @@ namespace Nz
 			static bool Initialize();
 			static void Uninitialize();
 
+			struct DatagramBatch
+			{
+				std::vector<std::array<UInt8, ENetConstants::ENetProtocol_MaximumMTU>> data;
+				std::vector<ENetPeer*> peers;
+				std::vector<NetBuffer> buffers;
+				std::vector<NetDatagram> datagrams;
+				std::size_t count;
+				std::size_t index;
+			};
+
 			struct PendingIncomingPacket
 			{
 				IpAddress from;
@@ -140,11 +162,15 @@ namespace Nz
 			std::size_t m_receivedDataLength;
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
 			std::unique_ptr<ENetCompressor> m_compressor;
+			ENetCommandPool<ENetPeer::IncomingCommmand> m_incomingCommandPool; //< must outlive m_peers
+			ENetCommandPool<ENetPeer::OutgoingCommand> m_outgoingCommandPool;  //< must outlive m_peers
 			std::vector<ENetPeer> m_peers;
 			std::vector<PendingIncomingPacket> m_pendingIncomingPackets;
 			std::vector<PendingOutgoingPacket> m_pendingOutgoingPackets;
 			MovablePtr<UInt8> m_receivedData;
 			Bitset<UInt64> m_dispatchQueue;
+			DatagramBatch m_incomingBatch;
+			DatagramBatch m_outgoingBatch;
 			MemoryPool<ENetPacket> m_packetPool;
 			IpAddress m_address;
 			IpAddress m_receivedAddress;
@@ -164,6 +190,7 @@ namespace Nz
 			UInt64 m_totalReceivedData;
 			bool m_allowsIncomingConnections;
 			bool m_continueSending;
+			bool m_isReusePortEnabled;
 			bool m_isUsingDualStack;
 			bool m_isSimulationEnabled;
 			bool m_recalculateBandwidthLimits;
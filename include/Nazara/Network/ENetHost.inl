@@ -9,7 +9,10 @@
 namespace Nz
 {
 	inline ENetHost::ENetHost() :
+	m_incomingCommandPool(ENetConstants::ENetHost_CommandPoolBlockSize),
+	m_outgoingCommandPool(ENetConstants::ENetHost_CommandPoolBlockSize),
 	m_packetPool(sizeof(ENetPacket)),
+	m_isReusePortEnabled(false),
 	m_isUsingDualStack(false),
 	m_isSimulationEnabled(false)
 	{
@@ -74,11 +77,46 @@ namespace Nz
 		return m_allowsIncomingConnections;
 	}
 
+	/*!
+	* \brief Allows other hosts to listen on the same port (see UdpSocket::EnableReusePort)
+	*
+	* \param reusePort Should the listening port be shared
+	*
+	* \remark This must be called before Create and is only supported on POSIX systems
+	*/
+	inline void ENetHost::EnableReusePort(bool reusePort)
+	{
+		m_isReusePortEnabled = reusePort;
+	}
+
 	inline IpAddress ENetHost::GetBoundAddress() const
 	{
 		return m_address;
 	}
 
+	inline ENetCommandPoolStatistics ENetHost::GetIncomingCommandPoolStatistics() const
+	{
+		return m_incomingCommandPool.GetStatistics();
+	}
+
+	inline ENetCommandPoolStatistics ENetHost::GetOutgoingCommandPoolStatistics() const
+	{
+		return m_outgoingCommandPool.GetStatistics();
+	}
+
+	inline ENetPeer* ENetHost::GetPeer(UInt16 peerId)
+	{
+		if (peerId >= m_peers.size())
+			return nullptr;
+
+		return &m_peers[peerId];
+	}
+
+	inline std::size_t ENetHost::GetPeerCount() const
+	{
+		return m_peers.size();
+	}
+
 	inline UInt32 ENetHost::GetServiceTime() const
 	{
 		return m_serviceTime;
@@ -104,6 +142,11 @@ namespace Nz
 		return m_totalSentPackets;
 	}
 
+	inline bool ENetHost::IsReusePortEnabled() const
+	{
+		return m_isReusePortEnabled;
+	}
+
 	inline void ENetHost::SetCompressor(std::unique_ptr<ENetCompressor>&& compressor)
 	{
 		m_compressor = std::move(compressor);
@@ -0,0 +1,51 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETLZCOMPRESSOR_HPP
+#define NAZARA_NETWORK_ENETLZCOMPRESSOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <array>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetLZCompressor final : public ENetCompressor
+	{
+		public:
+			ENetLZCompressor();
+			explicit ENetLZCompressor(ByteArray dictionary);
+			~ENetLZCompressor() = default;
+
+			std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) override;
+			std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) override;
+
+			inline const ByteArray& GetDictionary() const;
+
+			void SetDictionary(ByteArray dictionary);
+
+			static ByteArray TrainDictionary(const ByteArray* samples, std::size_t sampleCount, std::size_t dictionarySize = DefaultDictionarySize);
+
+			static constexpr std::size_t DefaultDictionarySize = 4 * 1024;
+			static constexpr std::size_t MaxDictionarySize = 32 * 1024;
+			static constexpr std::size_t MaxInputSize = 32 * 1024 - 1;
+
+		private:
+			static constexpr unsigned int HashLog = 12;
+
+			std::array<UInt32, 1 << HashLog> m_dictionaryTable;
+			std::array<UInt32, 1 << HashLog> m_hashTable;
+			std::vector<UInt8> m_window;
+			ByteArray m_dictionary;
+			UInt16 m_generation;
+	};
+}
+
+#include <Nazara/Network/ENetLZCompressor.inl>
+
+#endif // NAZARA_NETWORK_ENETLZCOMPRESSOR_HPP
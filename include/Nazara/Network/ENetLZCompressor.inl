@@ -0,0 +1,16 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetLZCompressor.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	inline const ByteArray& ENetLZCompressor::GetDictionary() const
+	{
+		return m_dictionary;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
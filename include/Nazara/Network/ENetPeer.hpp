@@ -18,13 +18,13 @@
 #define NAZARA_NETWORK_ENETPEER_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/ENetCommandList.hpp>
 #include <Nazara/Network/ENetPacket.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Utils/Flags.hpp>
 #include <Nazara/Utils/MovablePtr.hpp>
 #include <array>
-#include <list>
 #include <random>
 #include <vector>
 
@@ -38,7 +38,7 @@ namespace Nz
 		friend struct PacketRef;
 
 		public:
-			inline ENetPeer(ENetHost* host, UInt16 peerId);
+			ENetPeer(ENetHost* host, UInt16 peerId);
 			ENetPeer(const ENetPeer&) = delete;
 			ENetPeer(ENetPeer&&) = default;
 			~ENetPeer() = default;
@@ -48,6 +48,7 @@ namespace Nz
 			void DisconnectNow(UInt32 data);
 
 			inline const IpAddress& GetAddress() const;
+			inline UInt32 GetConnectId() const;
 			inline UInt32 GetLastReceiveTime() const;
 			inline UInt32 GetMtu() const;
 			inline UInt32 GetPacketThrottleAcceleration() const;
@@ -118,6 +119,7 @@ namespace Nz
 			void RemoveSentUnreliableCommands();
 
 			void ResetQueues();
+			void ResizeChannels(std::size_t channelCount);
 
 			bool QueueAcknowledgement(ENetProtocol* command, UInt16 sentTime);
 			IncomingCommmand* QueueIncomingCommand(const ENetProtocol& command, const void* data, std::size_t dataLength, UInt32 flags, UInt32 fragmentCount);
@@ -136,7 +138,9 @@ namespace Nz
 
 			struct Channel
 			{
-				Channel()
+				Channel(ENetCommandPool<IncomingCommmand>& commandPool) :
+				incomingReliableCommands(commandPool),
+				incomingUnreliableCommands(commandPool)
 				{
 					incomingReliableSequenceNumber = 0;
 					incomingUnreliableSequenceNumber = 0;
@@ -147,8 +151,8 @@ namespace Nz
 				}
 
 				std::array<UInt16, ENetPeer_ReliableWindows> reliableWindows;
-				std::list<IncomingCommmand>                  incomingReliableCommands;
-				std::list<IncomingCommmand>                  incomingUnreliableCommands;
+				ENetCommandList<IncomingCommmand>            incomingReliableCommands;
+				ENetCommandList<IncomingCommmand>            incomingUnreliableCommands;
 				UInt16                                       incomingReliableSequenceNumber;
 				UInt16                                       incomingUnreliableSequenceNumber;
 				UInt16                                       outgoingReliableSequenceNumber;
@@ -164,6 +168,12 @@ namespace Nz
 				UInt16        reliableSequenceNumber;
 				UInt16        unreliableSequenceNumber;
 				UInt32        fragmentsRemaining;
+
+				void Reset()
+				{
+					fragments.Clear(); //< Keeps the bitset memory for the next command using this node
+					packet.Reset();
+				}
 			};
 
 			struct OutgoingCommand
@@ -178,6 +188,11 @@ namespace Nz
 				UInt32        roundTripTimeout;
 				UInt32        roundTripTimeoutLimit;
 				UInt32        sentTime;
+
+				void Reset()
+				{
+					packet.Reset();
+				}
 			};
 
 			static constexpr std::size_t unsequencedWindow = ENetPeer_ReliableWindowSize / 32;
@@ -186,11 +201,11 @@ namespace Nz
 			IpAddress                             m_address; //< Internet address of the peer
 			std::array<UInt32, unsequencedWindow> m_unsequencedWindow;
 			std::bernoulli_distribution           m_packetLossProbability;
-			std::list<IncomingCommmand>           m_dispatchedCommands;
-			std::list<OutgoingCommand>            m_outgoingReliableCommands;
-			std::list<OutgoingCommand>            m_outgoingUnreliableCommands;
-			std::list<OutgoingCommand>            m_sentReliableCommands;
-			std::list<OutgoingCommand>            m_sentUnreliableCommands;
+			ENetCommandList<IncomingCommmand>     m_dispatchedCommands;
+			ENetCommandList<OutgoingCommand>      m_outgoingReliableCommands;
+			ENetCommandList<OutgoingCommand>      m_outgoingUnreliableCommands;
+			ENetCommandList<OutgoingCommand>      m_sentReliableCommands;
+			ENetCommandList<OutgoingCommand>      m_sentUnreliableCommands;
 			std::size_t                           m_totalWaitingData;
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
 			std::vector<Acknowledgement>          m_acknowledgements;
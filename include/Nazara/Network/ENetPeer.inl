@@ -7,20 +7,14 @@
 
 namespace Nz
 {
-	inline ENetPeer::ENetPeer(ENetHost* host, UInt16 peerId) :
-	m_host(host),
-	m_state(ENetPeerState::Disconnected),
-	m_incomingSessionID(0xFF),
-	m_outgoingSessionID(0xFF),
-	m_incomingPeerID(peerId),
-	m_isSimulationEnabled(false)
+	inline const IpAddress& ENetPeer::GetAddress() const
 	{
-		Reset();
+		return m_address;
 	}
 
-	inline const IpAddress& ENetPeer::GetAddress() const
+	inline UInt32 ENetPeer::GetConnectId() const
 	{
-		return m_address;
+		return m_connectID;
 	}
 
 	inline UInt32 ENetPeer::GetLastReceiveTime() const
@@ -0,0 +1,16 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	inline std::size_t ENetRangeCoderCompressor::GetSymbolIndex(const Symbol* symbol) const
+	{
+		return static_cast<std::size_t>(symbol - m_symbols.data());
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
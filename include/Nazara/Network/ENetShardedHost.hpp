@@ -0,0 +1,111 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETSHARDEDHOST_HPP
+#define NAZARA_NETWORK_ENETSHARDEDHOST_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Nz
+{
+	struct ENetShardedPeer
+	{
+		std::size_t shardIndex;
+		UInt32 connectId;
+		UInt16 peerId;
+	};
+
+	class NAZARA_NETWORK_API ENetShardedHost
+	{
+		public:
+			using EventCallback = std::function<void(std::size_t shardIndex, ENetHost& host, ENetEvent& event)>;
+			using ShardTask = std::function<void(std::size_t shardIndex, ENetHost& host)>;
+
+			ENetShardedHost();
+			ENetShardedHost(const ENetShardedHost&) = delete;
+			ENetShardedHost(ENetShardedHost&&) = delete;
+			~ENetShardedHost();
+
+			void Broadcast(UInt8 channelId, ENetPacketFlags flags, const NetPacket& packet);
+
+			bool Create(NetProtocol protocol, UInt16 port, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount = 0);
+			bool Create(const IpAddress& listenAddress, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount = 0);
+			void Destroy();
+
+			void Disconnect(const ENetShardedPeer& peer, UInt32 data = 0);
+
+			inline IpAddress GetBoundAddress() const;
+			inline ENetHost& GetShard(std::size_t shardIndex);
+			inline std::size_t GetShardCount() const;
+
+			inline bool IsRunning() const;
+
+			void Post(std::size_t shardIndex, ShardTask task);
+
+			void Send(const ENetShardedPeer& peer, UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet);
+
+			void Start(EventCallback callback, UInt32 serviceTimeout = 1);
+			void Stop();
+
+			ENetShardedHost& operator=(const ENetShardedHost&) = delete;
+			ENetShardedHost& operator=(ENetShardedHost&&) = delete;
+
+			static inline ENetShardedPeer GetPeerHandle(std::size_t shardIndex, const ENetPeer& peer);
+
+		private:
+			enum class MessageType
+			{
+				Broadcast,
+				Disconnect,
+				Send,
+				Task
+			};
+
+			struct Message
+			{
+				MessageType type;
+				ENetPacketFlags flags;
+				NetPacket packet;
+				ShardTask task;
+				UInt8 channelId;
+				UInt16 peerId;
+				UInt32 connectId;
+				UInt32 data;
+			};
+
+			struct Shard
+			{
+				std::atomic_bool hasPendingMessages{ false };
+				std::mutex messageMutex;
+				std::thread thread;
+				std::vector<Message> pendingMessages;
+				std::vector<Message> processedMessages;
+				ENetHost host;
+			};
+
+			bool CreateShards(std::size_t shardCount, const std::function<bool(ENetHost& host, UInt16 port)>& createHost);
+			void PushMessage(std::size_t shardIndex, Message&& message);
+			void ProcessMessages(std::size_t shardIndex, Shard& shard);
+			void ShardThread(std::size_t shardIndex, UInt32 serviceTimeout);
+
+			static ENetPeer* ResolvePeer(ENetHost& host, UInt16 peerId, UInt32 connectId);
+
+			std::atomic_bool m_running;
+			std::vector<std::unique_ptr<Shard>> m_shards;
+			EventCallback m_eventCallback;
+	};
+}
+
+#include <Nazara/Network/ENetShardedHost.inl>
+
+#endif // NAZARA_NETWORK_ENETSHARDEDHOST_HPP
@@ -0,0 +1,60 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	inline IpAddress ENetShardedHost::GetBoundAddress() const
+	{
+		if (m_shards.empty())
+			return IpAddress::Invalid;
+
+		return m_shards.front()->host.GetBoundAddress();
+	}
+
+	/*!
+	* \brief Gets the host of a shard
+	* \return Host servicing the shard
+	*
+	* \param shardIndex Index of the shard
+	*
+	* \remark The host belongs to its shard thread while the sharded host is running, use Post to access it from another thread
+	*/
+	inline ENetHost& ENetShardedHost::GetShard(std::size_t shardIndex)
+	{
+		NazaraAssert(shardIndex < m_shards.size(), "Shard index out of range");
+		return m_shards[shardIndex]->host;
+	}
+
+	inline std::size_t ENetShardedHost::GetShardCount() const
+	{
+		return m_shards.size();
+	}
+
+	inline bool ENetShardedHost::IsRunning() const
+	{
+		return m_running.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Builds a handle to a peer, which can be used from any thread
+	* \return Peer handle
+	*
+	* \param shardIndex Index of the shard the peer belongs to (as given to the event callback)
+	* \param peer Peer
+	*/
+	inline ENetShardedPeer ENetShardedHost::GetPeerHandle(std::size_t shardIndex, const ENetPeer& peer)
+	{
+		ENetShardedPeer handle;
+		handle.shardIndex = shardIndex;
+		handle.connectId = peer.GetConnectId();
+		handle.peerId = peer.GetPeerId();
+
+		return handle;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -95,6 +95,16 @@ namespace Nz
 
 	using SocketPollEventFlags = Flags<SocketPollEvent>;
 
+	enum class SocketPollMode
+	{
+		EdgeTriggered,  //< A socket is only reported when it becomes ready, it has to be used until it would block before being reported again
+		LevelTriggered, //< A socket is reported as long as it is ready
+
+		Max = LevelTriggered
+	};
+
+	constexpr std::size_t SocketPollModeCount = static_cast<std::size_t>(SocketPollMode::Max) + 1;
+
 	enum class SocketState
 	{
 		Bound,        //< The socket is currently bound
@@ -0,0 +1,25 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_NETDATAGRAM_HPP
+#define NAZARA_NETWORK_NETDATAGRAM_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/NetBuffer.hpp>
+
+namespace Nz
+{
+	struct NetDatagram
+	{
+		IpAddress address;       //< Sender when receiving, recipient when sending
+		NetBuffer* buffers;      //< Scatter/gather buffers of this datagram
+		std::size_t bufferCount;
+		std::size_t dataLength;  //< Received byte count (set by receiving functions)
+	};
+}
+
+#endif // NAZARA_NETWORK_NETDATAGRAM_HPP
@@ -11,7 +11,7 @@
 #include <Nazara/Core/ByteStream.hpp>
 #include <Nazara/Core/MemoryStream.hpp>
 #include <Nazara/Network/Config.hpp>
-#include <mutex>
+#include <memory>
 
 namespace Nz
 {
@@ -20,6 +20,8 @@ namespace Nz
 		friend class Network;
 
 		public:
+			struct BufferCacheStatistics;
+
 			inline NetPacket();
 			inline NetPacket(UInt16 netCode, std::size_t minCapacity = 0);
 			inline NetPacket(UInt16 netCode, const void* ptr, std::size_t size);
@@ -49,8 +51,21 @@ namespace Nz
 			static bool DecodeHeader(const void* data, UInt32* packetSize, UInt16* netCode);
 			static bool EncodeHeader(void* data, UInt32 packetSize, UInt16 netCode);
 
+			static BufferCacheStatistics GetBufferCacheStatistics();
+
 			static constexpr std::size_t HeaderSize = sizeof(UInt32) + sizeof(UInt16); //< PacketSize + NetCode
 
+			struct BufferCacheStatistics
+			{
+				UInt64 allocatedBufferCount;   //< Buffers allocated because no cached buffer was available (all threads)
+				UInt64 discardedBufferCount;   //< Buffers freed because they were too big or caches were full (all threads)
+				UInt64 globalTransferCount;    //< Batches of buffers moved between thread caches and the global list (all threads)
+				UInt64 threadAcquireCount;     //< Buffers requested by the calling thread
+				UInt64 threadReuseCount;       //< Requests of the calling thread served by a cached buffer
+				std::size_t globalBufferCount; //< Buffers currently in the global list
+				std::size_t threadBufferCount; //< Buffers currently in the calling thread cache
+			};
+
 		private:
 			void OnEmptyStream() override;
 
@@ -63,9 +78,6 @@ namespace Nz
 			std::unique_ptr<ByteArray> m_buffer;
 			MemoryStream m_memoryStream;
 			UInt16 m_netCode;
-
-			static std::mutex s_availableBuffersMutex;
-			static std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> s_availableBuffers;
 	};
 }
 
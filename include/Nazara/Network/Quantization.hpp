@@ -0,0 +1,35 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_QUANTIZATION_HPP
+#define NAZARA_NETWORK_QUANTIZATION_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Network/Config.hpp>
+
+namespace Nz
+{
+	inline float DequantizeFloat(UInt32 value, float min, float max, UInt8 bitCount);
+	inline UInt32 QuantizeFloat(float value, float min, float max, UInt8 bitCount);
+
+	constexpr UInt32 GetQuantizedQuaternionBitCount(UInt8 bitsPerComponent);
+	constexpr UInt32 GetQuantizedVector3BitCount(UInt8 bitsPerComponent);
+
+	inline float ReadQuantizedFloat(ByteStream& stream, float min, float max, UInt8 bitCount);
+	inline Quaternionf ReadQuantizedQuaternion(ByteStream& stream, UInt8 bitsPerComponent);
+	inline Vector3f ReadQuantizedVector3(ByteStream& stream, float min, float max, UInt8 bitsPerComponent);
+
+	inline void WriteQuantizedFloat(ByteStream& stream, float value, float min, float max, UInt8 bitCount);
+	inline void WriteQuantizedQuaternion(ByteStream& stream, const Quaternionf& quaternion, UInt8 bitsPerComponent);
+	inline void WriteQuantizedVector3(ByteStream& stream, const Vector3f& vec, float min, float max, UInt8 bitsPerComponent);
+}
+
+#include <Nazara/Network/Quantization.inl>
+
+#endif // NAZARA_NETWORK_QUANTIZATION_HPP
@@ -0,0 +1,193 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Quantization.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cmath>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		// Smallest-three components are in [-1/sqrt(2), 1/sqrt(2)]
+		constexpr float QuaternionComponentRange = 0.70710678118654752440f;
+
+		constexpr UInt64 GetQuantizationMax(UInt8 bitCount)
+		{
+			return (UInt64(1) << bitCount) - 1;
+		}
+	}
+
+	/*!
+	* \ingroup network
+	* \brief Converts back a quantized value to a float
+	* \return Value in [min, max]
+	*
+	* \param value Quantized value
+	* \param min Lower bound of the range
+	* \param max Upper bound of the range
+	* \param bitCount Number of bits the value was quantized on (between 1 and 32)
+	*
+	* \see QuantizeFloat
+	*/
+	inline float DequantizeFloat(UInt32 value, float min, float max, UInt8 bitCount)
+	{
+		NazaraAssert(bitCount >= 1 && bitCount <= 32, "Bit count out of range");
+		NazaraAssert(min < max, "Invalid range");
+
+		double normalized = double(value) / double(Detail::GetQuantizationMax(bitCount));
+		return float(min + normalized * (double(max) - double(min)));
+	}
+
+	/*!
+	* \ingroup network
+	* \brief Quantizes a float on a fixed number of bits
+	* \return Quantized value, between 0 and 2^bitCount - 1
+	*
+	* \param value Value to quantize, clamped to [min, max]
+	* \param min Lower bound of the range
+	* \param max Upper bound of the range
+	* \param bitCount Number of bits to quantize on (between 1 and 32)
+	*
+	* \remark The rounding error is at most (max - min) / (2^(bitCount+1) - 2), min and max are represented exactly
+	* \remark Quantizing a dequantized value gives back the same quantized value
+	*
+	* \see DequantizeFloat
+	*/
+	inline UInt32 QuantizeFloat(float value, float min, float max, UInt8 bitCount)
+	{
+		NazaraAssert(bitCount >= 1 && bitCount <= 32, "Bit count out of range");
+		NazaraAssert(min < max, "Invalid range");
+
+		double normalized = (double(std::clamp(value, min, max)) - double(min)) / (double(max) - double(min));
+		return UInt32(std::llround(normalized * double(Detail::GetQuantizationMax(bitCount))));
+	}
+
+	/*!
+	* \ingroup network
+	* \brief Gets the number of bits written by WriteQuantizedQuaternion
+	*/
+	constexpr UInt32 GetQuantizedQuaternionBitCount(UInt8 bitsPerComponent)
+	{
+		return 2 + 3 * UInt32(bitsPerComponent);
+	}
+
+	/*!
+	* \ingroup network
+	* \brief Gets the number of bits written by WriteQuantizedVector3
+	*/
+	constexpr UInt32 GetQuantizedVector3BitCount(UInt8 bitsPerComponent)
+	{
+		return 3 * UInt32(bitsPerComponent);
+	}
+
+	inline float ReadQuantizedFloat(ByteStream& stream, float min, float max, UInt8 bitCount)
+	{
+		return DequantizeFloat(UInt32(stream.ReadBits(bitCount)), min, max, bitCount);
+	}
+
+	/*!
+	* \ingroup network
+	* \brief Reads a quaternion written by WriteQuantizedQuaternion
+	* \return Normalized quaternion
+	*
+	* \param stream Stream to read from
+	* \param bitsPerComponent Number of bits per component, as given to WriteQuantizedQuaternion
+	*/
+	inline Quaternionf ReadQuantizedQuaternion(ByteStream& stream, UInt8 bitsPerComponent)
+	{
+		std::size_t largestIndex = std::size_t(stream.ReadBits(2));
+
+		float components[4];
+		float sqSum = 0.f;
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			if (i == largestIndex)
+				continue;
+
+			float component = ReadQuantizedFloat(stream, -Detail::QuaternionComponentRange, Detail::QuaternionComponentRange, bitsPerComponent);
+			components[i] = component;
+			sqSum += component * component;
+		}
+
+		components[largestIndex] = std::sqrt(std::max(1.f - sqSum, 0.f));
+
+		Quaternionf quaternion(components[0], components[1], components[2], components[3]);
+		quaternion.Normalize();
+
+		return quaternion;
+	}
+
+	inline Vector3f ReadQuantizedVector3(ByteStream& stream, float min, float max, UInt8 bitsPerComponent)
+	{
+		Vector3f vec;
+		vec.x = ReadQuantizedFloat(stream, min, max, bitsPerComponent);
+		vec.y = ReadQuantizedFloat(stream, min, max, bitsPerComponent);
+		vec.z = ReadQuantizedFloat(stream, min, max, bitsPerComponent);
+
+		return vec;
+	}
+
+	/*!
+	* \ingroup network
+	* \brief Writes a quantized float to a stream, using bitCount bits
+	*
+	* \param stream Stream to write to
+	* \param value Value to write, clamped to [min, max]
+	* \param min Lower bound of the range
+	* \param max Upper bound of the range
+	* \param bitCount Number of bits to quantize on (between 1 and 32)
+	*
+	* \see QuantizeFloat, ReadQuantizedFloat
+	*/
+	inline void WriteQuantizedFloat(ByteStream& stream, float value, float min, float max, UInt8 bitCount)
+	{
+		stream.WriteBits(QuantizeFloat(value, min, max, bitCount), bitCount);
+	}
+
+	/*!
+	* \ingroup network
+	* \brief Writes a rotation quaternion to a stream using the "smallest three" encoding
+	*
+	* As a rotation quaternion is normalized, its largest component can be deduced from the three others, only its index (on two bits) and the three smallest components are written.
+	* The sign of the quaternion is chosen so the largest component is positive (q and -q represent the same rotation).
+	*
+	* \param stream Stream to write to
+	* \param quaternion Quaternion to write, has to be normalized
+	* \param bitsPerComponent Number of bits to quantize each of the three smallest components on
+	*
+	* \see GetQuantizedQuaternionBitCount, ReadQuantizedQuaternion
+	*/
+	inline void WriteQuantizedQuaternion(ByteStream& stream, const Quaternionf& quaternion, UInt8 bitsPerComponent)
+	{
+		float components[4] = { quaternion.w, quaternion.x, quaternion.y, quaternion.z };
+
+		std::size_t largestIndex = 0;
+		for (std::size_t i = 1; i < 4; ++i)
+		{
+			if (std::abs(components[i]) > std::abs(components[largestIndex]))
+				largestIndex = i;
+		}
+
+		float sign = (components[largestIndex] < 0.f) ? -1.f : 1.f;
+
+		stream.WriteBits(largestIndex, 2);
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			if (i != largestIndex)
+				WriteQuantizedFloat(stream, sign * components[i], -Detail::QuaternionComponentRange, Detail::QuaternionComponentRange, bitsPerComponent);
+		}
+	}
+
+	inline void WriteQuantizedVector3(ByteStream& stream, const Vector3f& vec, float min, float max, UInt8 bitsPerComponent)
+	{
+		WriteQuantizedFloat(stream, vec.x, min, max, bitsPerComponent);
+		WriteQuantizedFloat(stream, vec.y, min, max, bitsPerComponent);
+		WriteQuantizedFloat(stream, vec.z, min, max, bitsPerComponent);
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -0,0 +1,84 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_SNAPSHOTRECEIVER_HPP
+#define NAZARA_NETWORK_SNAPSHOTRECEIVER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Network/Config.hpp>
+#include <Nazara/Network/SnapshotSchema.hpp>
+#include <entt/entt.hpp>
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API SnapshotReceiver
+	{
+		public:
+			SnapshotReceiver(entt::registry& registry, SnapshotSchema schema);
+			SnapshotReceiver(const SnapshotReceiver&) = delete;
+			SnapshotReceiver(SnapshotReceiver&&) = delete;
+			~SnapshotReceiver() = default;
+
+			void Clear();
+
+			bool Decode(ByteStream& stream, UInt16* snapshotId = nullptr);
+
+			entt::entity GetEntity(UInt32 remoteEntityId) const;
+			inline std::size_t GetEntityCount() const;
+			inline const SnapshotSchema& GetSchema() const;
+
+			SnapshotReceiver& operator=(const SnapshotReceiver&) = delete;
+			SnapshotReceiver& operator=(SnapshotReceiver&&) = delete;
+
+			static constexpr UInt16 RemovedEntityLifetime = 256;
+
+		private:
+			struct EntityState
+			{
+				std::vector<UInt8> data;
+				UInt32 componentMask = 0;
+				UInt16 snapshotId = 0;
+				bool isValid = false;
+			};
+
+			struct ReplicatedEntity
+			{
+				std::array<EntityState, SnapshotSchema::HistorySize> history;
+				entt::entity entity = entt::null;
+				UInt32 appliedComponentMask = 0;
+				UInt16 lastSnapshotId = 0;
+				bool hasAppliedState = false;
+				bool isRemoved = false;
+			};
+
+			struct RemovedEntity
+			{
+				UInt32 entityId;
+				UInt16 snapshotId;
+			};
+
+			void ApplyState(ReplicatedEntity& replicatedEntity, const EntityState& state);
+			void PruneRemovedEntities();
+
+			std::size_t m_entityCount;
+			std::unordered_map<UInt32, std::unique_ptr<ReplicatedEntity>> m_entities;
+			std::vector<RemovedEntity> m_removedEntities;
+			entt::registry& m_registry;
+			EntityState m_decodedState;
+			SnapshotSchema m_schema;
+			UInt16 m_lastSnapshotId;
+			bool m_hasReceivedSnapshot;
+	};
+}
+
+#include <Nazara/Network/SnapshotReceiver.inl>
+
+#endif // NAZARA_NETWORK_SNAPSHOTRECEIVER_HPP
@@ -0,0 +1,24 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/SnapshotReceiver.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the number of replicated entities currently existing locally
+	*/
+	inline std::size_t SnapshotReceiver::GetEntityCount() const
+	{
+		return m_entityCount;
+	}
+
+	inline const SnapshotSchema& SnapshotReceiver::GetSchema() const
+	{
+		return m_schema;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -0,0 +1,149 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_SNAPSHOTREPLICATOR_HPP
+#define NAZARA_NETWORK_SNAPSHOTREPLICATOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Time.hpp>
+#include <Nazara/Network/Config.hpp>
+#include <Nazara/Network/SnapshotSchema.hpp>
+#include <entt/entt.hpp>
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API SnapshotReplicator
+	{
+		public:
+			struct Statistics;
+
+			SnapshotReplicator(entt::registry& registry, SnapshotSchema schema);
+			SnapshotReplicator(const SnapshotReplicator&) = delete;
+			SnapshotReplicator(SnapshotReplicator&&) = delete;
+			~SnapshotReplicator() = default;
+
+			void Acknowledge(std::size_t peerIndex, UInt16 snapshotId);
+
+			std::size_t AddPeer(std::size_t bandwidthBudget);
+
+			void CaptureSnapshot();
+
+			std::size_t EncodeSnapshot(std::size_t peerIndex, ByteStream& stream);
+
+			inline std::size_t GetBandwidthBudget(std::size_t peerIndex) const;
+			inline const SnapshotSchema& GetSchema() const;
+			inline UInt16 GetSnapshotId() const;
+			inline const Statistics& GetStatistics() const;
+
+			void RemovePeer(std::size_t peerIndex);
+
+			inline void ResetStatistics();
+
+			inline void UpdateBandwidthBudget(std::size_t peerIndex, std::size_t bandwidthBudget);
+
+			SnapshotReplicator& operator=(const SnapshotReplicator&) = delete;
+			SnapshotReplicator& operator=(SnapshotReplicator&&) = delete;
+
+			struct Statistics
+			{
+				Time captureTime = Time::Zero();
+				Time encodeTime = Time::Zero();
+				UInt64 capturedEntityCount = 0;
+				UInt64 deferredEntityCount = 0;
+				UInt64 encodedByteCount = 0;
+				UInt64 encodedSnapshotCount = 0;
+				UInt64 removedEntityCount = 0;
+				UInt64 sentComponentCount = 0;
+				UInt64 sentEntityCount = 0;
+				UInt64 unchangedComponentCount = 0;
+			};
+
+		private:
+			struct EntityState
+			{
+				std::vector<UInt8> data;
+				UInt32 componentMask;
+			};
+
+			struct CaptureEntry
+			{
+				UInt32 componentMask;
+				UInt32 entityId;
+				UInt32 offset;
+				float priority;
+			};
+
+			struct CapturedEntity
+			{
+				std::shared_ptr<const EntityState> state;
+				float priority;
+				UInt16 snapshotId;
+			};
+
+			struct PeerEntity
+			{
+				std::shared_ptr<const EntityState> ackedState;
+				std::shared_ptr<const EntityState> sentState;
+				float priority = 0.f;
+				UInt16 ackedSnapshotId = 0;
+			};
+
+			struct SentEntity
+			{
+				std::shared_ptr<const EntityState> state; //< null for removals
+				UInt32 entityId;
+			};
+
+			struct SentSnapshot
+			{
+				std::vector<SentEntity> entities;
+				UInt16 snapshotId = 0;
+				bool isValid = false;
+			};
+
+			struct Peer
+			{
+				std::array<SentSnapshot, SnapshotSchema::HistorySize> sentSnapshots;
+				std::unordered_map<UInt32, PeerEntity> entities;
+				std::size_t bandwidthBudget;
+			};
+
+			struct Candidate
+			{
+				std::shared_ptr<const EntityState> state; //< null for removals
+				const EntityState* baseline;
+				PeerEntity* peerEntity;
+				UInt32 bitCount;
+				UInt32 entityId;
+				UInt16 baselineSnapshotId;
+				float priority;
+			};
+
+			UInt32 ComputeRecordSize(const EntityState& state, const EntityState* baseline) const;
+			static bool IsSameState(const EntityState& lhs, const EntityState& rhs);
+			void WriteRecord(ByteStream& stream, UInt32 entityId, const EntityState& state, const EntityState* baseline, UInt16 baselineSnapshotId);
+
+			std::unordered_map<UInt32, CapturedEntity> m_capturedEntities;
+			std::vector<std::unique_ptr<Peer>> m_peers;
+			std::vector<Candidate> m_candidates;
+			std::vector<CaptureEntry> m_captureEntries;
+			entt::registry& m_registry;
+			ByteArray m_captureBuffer;
+			SnapshotSchema m_schema;
+			Statistics m_statistics;
+			UInt16 m_snapshotId;
+	};
+}
+
+#include <Nazara/Network/SnapshotReplicator.inl>
+
+#endif // NAZARA_NETWORK_SNAPSHOTREPLICATOR_HPP
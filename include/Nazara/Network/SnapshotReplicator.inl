@@ -0,0 +1,58 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/SnapshotReplicator.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	inline std::size_t SnapshotReplicator::GetBandwidthBudget(std::size_t peerIndex) const
+	{
+		NazaraAssert(peerIndex < m_peers.size() && m_peers[peerIndex], "Invalid peer index");
+		return m_peers[peerIndex]->bandwidthBudget;
+	}
+
+	inline const SnapshotSchema& SnapshotReplicator::GetSchema() const
+	{
+		return m_schema;
+	}
+
+	/*!
+	* \brief Gets the id of the last captured snapshot
+	*/
+	inline UInt16 SnapshotReplicator::GetSnapshotId() const
+	{
+		return m_snapshotId;
+	}
+
+	/*!
+	* \brief Gets the replication statistics
+	*
+	* Times and counts are accumulated since the replicator creation or the last call to ResetStatistics
+	*/
+	inline auto SnapshotReplicator::GetStatistics() const -> const Statistics&
+	{
+		return m_statistics;
+	}
+
+	inline void SnapshotReplicator::ResetStatistics()
+	{
+		m_statistics = Statistics{};
+	}
+
+	/*!
+	* \brief Changes the maximum size of the snapshots sent to a peer
+	*
+	* \param peerIndex Index of the peer
+	* \param bandwidthBudget Maximum size of a snapshot, in bytes
+	*/
+	inline void SnapshotReplicator::UpdateBandwidthBudget(std::size_t peerIndex, std::size_t bandwidthBudget)
+	{
+		NazaraAssert(peerIndex < m_peers.size() && m_peers[peerIndex], "Invalid peer index");
+		m_peers[peerIndex]->bandwidthBudget = bandwidthBudget;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -0,0 +1,64 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_SNAPSHOTSCHEMA_HPP
+#define NAZARA_NETWORK_SNAPSHOTSCHEMA_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Network/Config.hpp>
+#include <entt/entt.hpp>
+#include <functional>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API SnapshotSchema
+	{
+		public:
+			struct Component;
+			template<typename T> using Decoder = std::function<void(ByteStream& stream, T& component)>;
+			template<typename T> using Encoder = std::function<void(ByteStream& stream, const T& component)>;
+
+			SnapshotSchema() = default;
+			SnapshotSchema(const SnapshotSchema&) = default;
+			SnapshotSchema(SnapshotSchema&&) noexcept = default;
+			~SnapshotSchema() = default;
+
+			inline const Component& GetComponent(std::size_t componentIndex) const;
+			inline std::size_t GetComponentCount() const;
+
+			inline std::size_t RegisterComponent(Component component);
+			template<typename T> std::size_t RegisterComponent(UInt32 bitCount, Encoder<T> encoder, Decoder<T> decoder);
+
+			SnapshotSchema& operator=(const SnapshotSchema&) = default;
+			SnapshotSchema& operator=(SnapshotSchema&&) noexcept = default;
+
+			static constexpr std::size_t GetEncodedSize(UInt32 bitCount);
+			static constexpr bool IsMoreRecent(UInt16 snapshotId, UInt16 referenceId);
+			static inline void ReadEncodedComponent(ByteStream& stream, UInt8* data, UInt32 bitCount);
+			static inline void WriteEncodedComponent(ByteStream& stream, const UInt8* data, UInt32 bitCount);
+
+			static constexpr std::size_t HistorySize = 64;
+			static constexpr UInt8 HistorySizeBitCount = 6;
+			static constexpr std::size_t MaxComponentCount = 32;
+
+			struct Component
+			{
+				std::function<bool(const entt::registry& registry, entt::entity entity, ByteStream& stream)> encode; //< returns false if the entity doesn't have the component
+				std::function<void(entt::registry& registry, entt::entity entity, ByteStream& stream)> decode;
+				std::function<void(entt::registry& registry, entt::entity entity)> remove;
+				UInt32 bitCount;
+			};
+
+		private:
+			std::vector<Component> m_components;
+	};
+}
+
+#include <Nazara/Network/SnapshotSchema.inl>
+
+#endif // NAZARA_NETWORK_SNAPSHOTSCHEMA_HPP
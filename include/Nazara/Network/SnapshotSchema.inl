@@ -0,0 +1,134 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/SnapshotSchema.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::SnapshotSchema
+	* \brief Describes how the replicated components of an entity are written to and read from snapshots
+	*
+	* Every component is encoded on a fixed number of bits (using ByteStream::WriteBits and the quantization functions), which allows the replication to compare and copy encoded states without knowing their types.
+	* The server and the clients have to register the same components in the same order.
+	*
+	* \see SnapshotReceiver, SnapshotReplicator
+	*/
+
+	inline auto SnapshotSchema::GetComponent(std::size_t componentIndex) const -> const Component&
+	{
+		NazaraAssert(componentIndex < m_components.size(), "Component index out of range");
+		return m_components[componentIndex];
+	}
+
+	inline std::size_t SnapshotSchema::GetComponentCount() const
+	{
+		return m_components.size();
+	}
+
+	/*!
+	* \brief Registers a component from its type-erased functions
+	* \return Index of the component
+	*
+	* \param component Component functions, encode must write exactly bitCount bits
+	*/
+	inline std::size_t SnapshotSchema::RegisterComponent(Component component)
+	{
+		NazaraAssert(m_components.size() < MaxComponentCount, "Too many components");
+		NazaraAssert(component.bitCount > 0, "Component must have a size");
+		NazaraAssert(component.encode && component.decode && component.remove, "Invalid component functions");
+
+		m_components.push_back(std::move(component));
+		return m_components.size() - 1;
+	}
+
+	/*!
+	* \brief Registers a component type
+	* \return Index of the component
+	*
+	* \param bitCount Number of bits written by the encoder
+	* \param encoder Function writing the component state to a stream, it must write exactly bitCount bits
+	* \param decoder Function reading the component state from a stream, the component is default-constructed if the entity doesn't have it yet
+	*/
+	template<typename T>
+	std::size_t SnapshotSchema::RegisterComponent(UInt32 bitCount, Encoder<T> encoder, Decoder<T> decoder)
+	{
+		Component component;
+		component.bitCount = bitCount;
+		component.encode = [encoder = std::move(encoder)](const entt::registry& registry, entt::entity entity, ByteStream& stream)
+		{
+			const T* componentData = registry.try_get<T>(entity);
+			if (!componentData)
+				return false;
+
+			encoder(stream, *componentData);
+			return true;
+		};
+
+		component.decode = [decoder = std::move(decoder)](entt::registry& registry, entt::entity entity, ByteStream& stream)
+		{
+			decoder(stream, registry.get_or_emplace<T>(entity));
+		};
+
+		component.remove = [](entt::registry& registry, entt::entity entity)
+		{
+			registry.remove<T>(entity);
+		};
+
+		return RegisterComponent(std::move(component));
+	}
+
+	/*!
+	* \brief Gets the number of bytes an encoded component takes in memory (components are stored byte-aligned)
+	*/
+	constexpr std::size_t SnapshotSchema::GetEncodedSize(UInt32 bitCount)
+	{
+		return (bitCount + 7) / 8;
+	}
+
+	/*!
+	* \brief Checks if a snapshot is more recent than another, handling wrap-around of snapshot ids
+	*/
+	constexpr bool SnapshotSchema::IsMoreRecent(UInt16 snapshotId, UInt16 referenceId)
+	{
+		return snapshotId != referenceId && UInt16(snapshotId - referenceId) < 0x8000;
+	}
+
+	/*!
+	* \brief Reads the bits of an encoded component from a snapshot
+	*
+	* \param stream Stream to read the bits from
+	* \param data Buffer receiving the component, of GetEncodedSize(bitCount) bytes (padding bits are set to zero)
+	* \param bitCount Number of bits of the component
+	*/
+	inline void SnapshotSchema::ReadEncodedComponent(ByteStream& stream, UInt8* data, UInt32 bitCount)
+	{
+		for (; bitCount >= 8; bitCount -= 8)
+			*data++ = UInt8(stream.ReadBits(8));
+
+		if (bitCount > 0)
+			*data = UInt8(stream.ReadBits(UInt8(bitCount)));
+	}
+
+	/*!
+	* \brief Writes the bits of an encoded component to a snapshot
+	*
+	* \param stream Stream to write the bits to
+	* \param data Encoded component, of GetEncodedSize(bitCount) bytes
+	* \param bitCount Number of bits of the component
+	*/
+	inline void SnapshotSchema::WriteEncodedComponent(ByteStream& stream, const UInt8* data, UInt32 bitCount)
+	{
+		for (; bitCount >= 8; bitCount -= 8)
+			stream.WriteBits(*data++, 8);
+
+		if (bitCount > 0)
+			stream.WriteBits(*data, UInt8(bitCount));
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -0,0 +1,80 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_SOCKETCOMPLETIONQUEUE_HPP
+#define NAZARA_NETWORK_SOCKETCOMPLETIONQUEUE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/AbstractSocket.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <functional>
+#include <memory>
+
+namespace Nz
+{
+	class SocketCompletionQueueImpl;
+
+	class NAZARA_NETWORK_API SocketCompletionQueue
+	{
+		friend AbstractSocket;
+		friend class TcpClient;
+		friend class TcpServer;
+		friend class UdpSocket;
+
+		public:
+			using AcceptCallback = std::function<void(SocketError error, SocketHandle handle, const IpAddress& peerAddress)>;
+			using ReceiveCallback = std::function<void(SocketError error, const void* data, std::size_t size)>;
+			using ReceiveFromCallback = std::function<void(SocketError error, const IpAddress& from, const void* data, std::size_t size)>;
+			using SendCallback = std::function<void(SocketError error, std::size_t sent)>;
+
+			struct Statistics;
+
+			SocketCompletionQueue();
+			SocketCompletionQueue(const SocketCompletionQueue&) = delete;
+			SocketCompletionQueue(SocketCompletionQueue&&) = delete;
+			~SocketCompletionQueue();
+
+			bool Create(std::size_t entryCount = 256, std::size_t bufferCount = 256, std::size_t bufferSize = 4096);
+			void Destroy();
+
+			inline const Statistics& GetStatistics() const;
+
+			inline bool IsValid() const;
+
+			unsigned int Poll(int msTimeout, SocketError* error = nullptr);
+
+			inline void ResetStatistics();
+
+			SocketCompletionQueue& operator=(const SocketCompletionQueue&) = delete;
+			SocketCompletionQueue& operator=(SocketCompletionQueue&&) = delete;
+
+			static bool IsSupported();
+
+			struct Statistics
+			{
+				UInt64 bufferExhaustionCount = 0;
+				UInt64 completionCount = 0;
+				UInt64 submissionCount = 0;
+				UInt64 syscallCount = 0;
+			};
+
+		private:
+			bool Accept(AbstractSocket& socket, AcceptCallback callback);
+			void Cancel(SocketHandle handle);
+			bool Receive(AbstractSocket& socket, ReceiveCallback callback);
+			bool ReceiveFrom(AbstractSocket& socket, ReceiveFromCallback callback);
+			bool Register(AbstractSocket& socket);
+			bool Send(AbstractSocket& socket, const void* buffer, std::size_t size, SendCallback callback);
+			bool SendTo(AbstractSocket& socket, const IpAddress& to, const void* buffer, std::size_t size, SendCallback callback);
+
+			std::unique_ptr<SocketCompletionQueueImpl> m_impl;
+			Statistics m_statistics;
+	};
+}
+
+#include <Nazara/Network/SocketCompletionQueue.inl>
+
+#endif // NAZARA_NETWORK_SOCKETCOMPLETIONQUEUE_HPP
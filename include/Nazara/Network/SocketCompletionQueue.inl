@@ -0,0 +1,34 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the statistics of the queue since its creation or the last call to ResetStatistics
+	* \return Statistics of the queue
+	*/
+	inline auto SocketCompletionQueue::GetStatistics() const -> const Statistics&
+	{
+		return m_statistics;
+	}
+
+	/*!
+	* \brief Checks whether the queue has been created
+	* \return true If Create succeeded and Destroy wasn't called since
+	*/
+	inline bool SocketCompletionQueue::IsValid() const
+	{
+		return m_impl != nullptr;
+	}
+
+	inline void SocketCompletionQueue::ResetStatistics()
+	{
+		m_statistics = Statistics{};
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
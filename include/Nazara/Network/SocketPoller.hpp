@@ -10,6 +10,7 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Network/AbstractSocket.hpp>
 #include <Nazara/Utils/MovablePtr.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -18,6 +19,8 @@ namespace Nz
 	class NAZARA_NETWORK_API SocketPoller
 	{
 		public:
+			struct ReadySocket;
+
 			SocketPoller();
 			SocketPoller(const SocketPoller&) = delete;
 			SocketPoller(SocketPoller&&) noexcept = default;
@@ -25,11 +28,13 @@ namespace Nz
 
 			void Clear();
 
+			const std::vector<ReadySocket>& GetReadySockets() const;
+
 			bool IsReadyToRead(const AbstractSocket& socket) const;
 			bool IsReadyToWrite(const AbstractSocket& socket) const;
 			bool IsRegistered(const AbstractSocket& socket) const;
 
-			bool RegisterSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags);
+			bool RegisterSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags, void* userdata = nullptr, SocketPollMode mode = SocketPollMode::LevelTriggered);
 			void UnregisterSocket(AbstractSocket& socket);
 
 			unsigned int Wait(int msTimeout, SocketError* error = nullptr);
@@ -37,6 +42,13 @@ namespace Nz
 			SocketPoller& operator=(const SocketPoller&) = delete;
 			SocketPoller& operator=(SocketPoller&&) noexcept = default;
 
+			struct ReadySocket
+			{
+				SocketHandle handle;
+				SocketPollEventFlags events;
+				void* userdata;
+			};
+
 		private:
 			MovablePtr<SocketPollerImpl> m_impl;
 	};
@@ -12,6 +12,7 @@
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Network/AbstractSocket.hpp>
 #include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
 #include <string>
 
 namespace Nz
@@ -46,9 +47,11 @@ namespace Nz
 			SocketState PollForConnected(UInt64 waitDuration = 0);
 
 			bool Receive(void* buffer, std::size_t size, std::size_t* received);
+			bool ReceiveAsync(SocketCompletionQueue& queue, SocketCompletionQueue::ReceiveCallback callback);
 			bool ReceivePacket(NetPacket* packet);
 
 			bool Send(const void* buffer, std::size_t size, std::size_t* sent);
+			bool SendAsync(SocketCompletionQueue& queue, const void* buffer, std::size_t size, SocketCompletionQueue::SendCallback callback = nullptr);
 			bool SendMultiple(const NetBuffer* buffers, std::size_t bufferCount, std::size_t* sent);
 			bool SendPacket(const NetPacket& packet);
 
@@ -10,18 +10,23 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Network/AbstractSocket.hpp>
 #include <Nazara/Network/IpAddress.hpp>
+#include <functional>
 
 namespace Nz
 {
+	class SocketCompletionQueue;
 	class TcpClient;
 
 	class NAZARA_NETWORK_API TcpServer : public AbstractSocket
 	{
 		public:
+			using AcceptCallback = std::function<void(SocketError error, TcpClient&& client)>;
+
 			inline TcpServer();
 			inline TcpServer(TcpServer&& tcpServer);
 			~TcpServer() = default;
 
+			bool AcceptAsync(SocketCompletionQueue& queue, AcceptCallback callback);
 			bool AcceptClient(TcpClient* newClient);
 
 			inline IpAddress GetBoundAddress() const;
@@ -10,10 +10,12 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Network/AbstractSocket.hpp>
 #include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
 
 namespace Nz
 {
 	struct NetBuffer;
+	struct NetDatagram;
 	class NetPacket;
 
 	class NAZARA_NETWORK_API UdpSocket : public AbstractSocket
@@ -30,21 +32,27 @@ namespace Nz
 			inline bool Create(NetProtocol protocol);
 
 			void EnableBroadcasting(bool broadcasting);
+			bool EnableReusePort(bool reusePort);
 
 			inline IpAddress GetBoundAddress() const;
 			inline UInt16 GetBoundPort() const;
 
 			inline bool IsBroadcastingEnabled() const;
+			inline bool IsReusePortEnabled() const;
 
 			std::size_t QueryMaxDatagramSize();
 
 			bool Receive(void* buffer, std::size_t size, IpAddress* from, std::size_t* received);
+			bool ReceiveDatagrams(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* receivedCount);
+			bool ReceiveFromAsync(SocketCompletionQueue& queue, SocketCompletionQueue::ReceiveFromCallback callback);
 			bool ReceiveMultiple(NetBuffer* buffers, std::size_t bufferCount, IpAddress* from, std::size_t* received);
 			bool ReceivePacket(NetPacket* packet, IpAddress* from);
 
 			bool Send(const IpAddress& to, const void* buffer, std::size_t size, std::size_t* sent);
+			bool SendDatagrams(const NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sentCount);
 			bool SendMultiple(const IpAddress& to, const NetBuffer* buffers, std::size_t bufferCount, std::size_t* sent);
 			bool SendPacket(const IpAddress& to, const NetPacket& packet);
+			bool SendToAsync(SocketCompletionQueue& queue, const IpAddress& to, const void* buffer, std::size_t size, SocketCompletionQueue::SendCallback callback = nullptr);
 
 			UdpSocket& operator=(const UdpSocket& udpSocket) = delete;
 			UdpSocket& operator=(UdpSocket && udpSocket) noexcept = default;
@@ -55,6 +63,7 @@ namespace Nz
 
 			IpAddress m_boundAddress;
 			bool m_isBroadCastingEnabled;
+			bool m_isReusePortEnabled;
 	};
 }
 
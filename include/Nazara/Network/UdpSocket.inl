@@ -36,7 +36,8 @@ namespace Nz
 
 	inline UdpSocket::UdpSocket(UdpSocket&& udpSocket) noexcept :
 	AbstractSocket(std::move(udpSocket)),
-	m_boundAddress(std::move(udpSocket.m_boundAddress))
+	m_boundAddress(std::move(udpSocket.m_boundAddress)),
+	m_isReusePortEnabled(udpSocket.m_isReusePortEnabled)
 	{
 	}
 
@@ -113,6 +114,16 @@ namespace Nz
 	{
 		return m_isBroadCastingEnabled;
 	}
+
+	/*!
+	* \brief Checks whether the port can be shared with other sockets
+	* \return true If it is the case
+	*/
+
+	inline bool UdpSocket::IsReusePortEnabled() const
+	{
+		return m_isReusePortEnabled;
+	}
 }
 
 #include <Nazara/Network/DebugOff.hpp>
@@ -14,6 +14,7 @@
 #include <Nazara/Renderer/RenderDevice.hpp>
 #include <Nazara/Renderer/RenderDeviceInfo.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -32,8 +33,11 @@ namespace Nz
 			std::unique_ptr<GL::Context> CreateContext(GL::ContextParams params) const;
 			std::unique_ptr<GL::Context> CreateContext(GL::ContextParams params, WindowHandle handle) const;
 
+			bool FindProgramBinary(UInt64 key, GLenum* binaryFormat, std::vector<UInt8>* binary) const;
+
 			const RenderDeviceInfo& GetDeviceInfo() const override;
 			const RenderDeviceFeatures& GetEnabledFeatures() const override;
+			bool GetPipelineCacheData(ByteArray& data) const override;
 			inline const GL::Context& GetReferenceContext() const;
 
 			std::shared_ptr<RenderBuffer> InstantiateBuffer(BufferType type, UInt64 size, BufferUsageFlags usageFlags, const void* initialData = nullptr) override;
@@ -48,23 +52,36 @@ namespace Nz
 			std::shared_ptr<Texture> InstantiateTexture(const TextureInfo& params) override;
 			std::shared_ptr<TextureSampler> InstantiateTextureSampler(const TextureSamplerInfo& params) override;
 
+			inline bool IsProgramBinarySupported() const;
 			bool IsTextureFormatSupported(PixelFormat format, TextureUsage usage) const override;
 
+			bool LoadPipelineCacheData(const void* data, std::size_t size) override;
+
 			inline void NotifyBufferDestruction(GLuint buffer) const;
 			inline void NotifyProgramDestruction(GLuint program) const;
 			inline void NotifySamplerDestruction(GLuint sampler) const;
 			inline void NotifyTextureDestruction(GLuint texture) const;
 
+			void StoreProgramBinary(UInt64 key, GLenum binaryFormat, std::vector<UInt8> binary);
+
 			OpenGLDevice& operator=(const OpenGLDevice&) = delete;
 			OpenGLDevice& operator=(OpenGLDevice&&) = delete; ///TODO?
 
 		private:
 			inline void NotifyContextDestruction(const GL::Context& context) const;
 
+			struct ProgramBinary
+			{
+				GLenum format;
+				std::vector<UInt8> data;
+			};
+
 			std::unique_ptr<GL::Context> m_referenceContext;
+			std::unordered_map<UInt64, ProgramBinary> m_programBinaries;
 			mutable std::unordered_set<const GL::Context*> m_contexts;
 			RenderDeviceInfo m_deviceInfo;
 			GL::Loader& m_loader;
+			bool m_isProgramBinarySupported;
 	};
 }
 
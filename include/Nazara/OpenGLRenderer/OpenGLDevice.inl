@@ -12,6 +12,11 @@ namespace Nz
 		return *m_referenceContext;
 	}
 
+	inline bool OpenGLDevice::IsProgramBinarySupported() const
+	{
+		return m_isProgramBinarySupported;
+	}
+
 	inline void OpenGLDevice::NotifyBufferDestruction(GLuint buffer) const
 	{
 		for (const GL::Context* context : m_contexts)
@@ -24,11 +24,15 @@ namespace Nz
 	{
 		public:
 			struct ExplicitBinding;
+			struct ShaderSource;
 
 			OpenGLShaderModule(OpenGLDevice& device, nzsl::ShaderStageTypeFlags shaderStages, const nzsl::Ast::Module& shaderModule, const nzsl::ShaderWriter::States& states = {});
 			OpenGLShaderModule(OpenGLDevice& device, nzsl::ShaderStageTypeFlags shaderStages, ShaderLanguage lang, const void* source, std::size_t sourceSize, const nzsl::ShaderWriter::States& states = {});
 
 			nzsl::ShaderStageTypeFlags Attach(GL::Program& program, const nzsl::GlslWriter::BindingMapping& bindingMapping, std::vector<ExplicitBinding>* explicitBindings) const;
+			void AttachSources(GL::Program& program, const std::vector<ShaderSource>& sources) const;
+
+			nzsl::ShaderStageTypeFlags GenerateSources(const nzsl::GlslWriter::BindingMapping& bindingMapping, std::vector<ShaderSource>* sources, std::vector<ExplicitBinding>* explicitBindings) const;
 
 			inline const std::vector<ExplicitBinding>& GetExplicitBindings() const;
 
@@ -41,6 +45,12 @@ namespace Nz
 				bool isBlock;
 			};
 
+			struct ShaderSource
+			{
+				nzsl::ShaderStageType stage;
+				std::string code;
+			};
+
 		private:
 			void Create(OpenGLDevice& device, nzsl::ShaderStageTypeFlags shaderStages, const nzsl::Ast::Module& shaderModule, const nzsl::ShaderWriter::States& states);
 
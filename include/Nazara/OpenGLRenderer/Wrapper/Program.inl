@@ -131,6 +131,28 @@ namespace Nz::GL
 		return name;
 	}
 
+	inline bool Program::GetBinary(GLenum* binaryFormat, std::vector<UInt8>* binary) const
+	{
+		assert(m_objectId);
+		assert(binaryFormat);
+		assert(binary);
+
+		const Context& context = EnsureDeviceContext();
+
+		GLint binaryLength = 0;
+		context.glGetProgramiv(m_objectId, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+		if (binaryLength <= 0)
+			return false;
+
+		binary->resize(binaryLength);
+
+		GLsizei length = 0;
+		context.glGetProgramBinary(m_objectId, binaryLength, &length, binaryFormat, binary->data());
+		binary->resize(length);
+
+		return length > 0;
+	}
+
 	inline bool Program::GetLinkStatus(std::string* error) const
 	{
 		assert(m_objectId);
@@ -194,6 +216,22 @@ namespace Nz::GL
 		context.glLinkProgram(m_objectId);
 	}
 
+	inline void Program::SetBinary(GLenum binaryFormat, const void* binary, GLsizei length)
+	{
+		assert(m_objectId);
+
+		const Context& context = EnsureDeviceContext();
+		context.glProgramBinary(m_objectId, binaryFormat, binary, length);
+	}
+
+	inline void Program::SetParameter(GLenum pname, GLint value)
+	{
+		assert(m_objectId);
+
+		const Context& context = EnsureDeviceContext();
+		context.glProgramParameteri(m_objectId, pname, value);
+	}
+
 	inline void Program::Uniform(GLint uniformLocation, float value) const
 	{
 		assert(m_objectId);
@@ -14,17 +14,22 @@
 #include <Nazara/Math/Vector2.hpp>
 #include <Nazara/Physics2D/Config.hpp>
 #include <Nazara/Physics2D/RigidBody2D.hpp>
+#include <Nazara/Utils/Bitset.hpp>
 #include <Nazara/Utils/Signal.hpp>
 #include <functional>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
+struct cpArbiter;
 struct cpCollisionHandler;
+struct cpShape;
 struct cpSpace;
 
 namespace Nz
 {
 	class Arbiter2D;
+	class ByteArray;
 
 	class NAZARA_PHYSICS2D_API PhysWorld2D
 	{
@@ -45,22 +50,40 @@ namespace Nz
 		public:
 			struct Callback;
 			struct DebugDrawOptions;
+			struct NearestBodyRequest;
 			struct NearestQueryResult;
 			struct RaycastHit;
+			struct RaycastRequest;
+			struct RegionRequest;
 
 			PhysWorld2D();
+			explicit PhysWorld2D(unsigned int threadCount);
 			PhysWorld2D(const PhysWorld2D&) = delete;
 			PhysWorld2D(PhysWorld2D&&) = delete; ///TODO
 			~PhysWorld2D();
 
+			std::size_t BatchNearestBodyQuery(const NearestBodyRequest* requests, std::size_t requestCount, NearestQueryResult* results);
+			std::size_t BatchRaycastQueryFirst(const RaycastRequest* requests, std::size_t requestCount, RaycastHit* hitInfos);
+			std::size_t BatchRegionQuery(const RegionRequest* requests, std::size_t requestCount, RigidBody2D** bodies, std::size_t maxBodyPerRequest, std::size_t* bodyCounts);
+
 			void DebugDraw(const DebugDrawOptions& options, bool drawShapes = true, bool drawConstraints = true, bool drawCollisions = true);
 
+			void EnableDeterminism(bool enable = true);
+
+			inline const Bitset<UInt64>& GetActiveBodies() const;
+			float GetCollisionBias() const;
+			float GetCollisionSlop() const;
 			float GetDamping() const;
 			Vector2f GetGravity() const;
 			cpSpace* GetHandle() const;
+			float GetInterpolationFactor() const;
 			std::size_t GetIterationCount() const;
 			std::size_t GetMaxStepCount() const;
 			Time GetStepSize() const;
+			unsigned int GetThreadCount() const;
+
+			inline bool IsDeterminismEnabled() const;
+			bool IsThreaded() const;
 
 			bool NearestBodyQuery(const Vector2f& from, float maxDistance, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, RigidBody2D** nearestBody = nullptr);
 			bool NearestBodyQuery(const Vector2f& from, float maxDistance, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, NearestQueryResult* result);
@@ -75,12 +98,19 @@ namespace Nz
 			void RegisterCallbacks(unsigned int collisionId, Callback callbacks);
 			void RegisterCallbacks(unsigned int collisionIdA, unsigned int collisionIdB, Callback callbacks);
 
+			bool RestoreState(const ByteArray& state);
+
+			void SaveState(ByteArray& state);
+
+			void SetCollisionBias(float collisionBias);
+			void SetCollisionSlop(float collisionSlop);
 			void SetDamping(float dampingValue);
 			void SetGravity(const Vector2f& gravity);
 			void SetIterationCount(std::size_t iterationCount);
 			void SetMaxStepCount(std::size_t maxStepCount);
 			void SetSleepTime(Time sleepTime);
 			void SetStepSize(Time stepSize);
+			void SetThreadCount(unsigned int threadCount);
 
 			void Step(Time timestep);
 
@@ -114,6 +144,15 @@ namespace Nz
 				void* userdata;
 			};
 
+			struct NearestBodyRequest
+			{
+				Nz::Vector2f from;
+				float maxDistance;
+				Nz::UInt32 collisionGroup = 0;
+				Nz::UInt32 categoryMask = 0xFFFFFFFF;
+				Nz::UInt32 collisionMask = 0xFFFFFFFF;
+			};
+
 			struct NearestQueryResult
 			{
 				Nz::RigidBody2D* nearestBody;
@@ -130,10 +169,39 @@ namespace Nz
 				float fraction;
 			};
 
+			struct RaycastRequest
+			{
+				Nz::Vector2f from;
+				Nz::Vector2f to;
+				float radius = 0.f;
+				Nz::UInt32 collisionGroup = 0;
+				Nz::UInt32 categoryMask = 0xFFFFFFFF;
+				Nz::UInt32 collisionMask = 0xFFFFFFFF;
+			};
+
+			struct RegionRequest
+			{
+				Nz::Rectf boundingBox;
+				Nz::UInt32 collisionGroup = 0;
+				Nz::UInt32 categoryMask = 0xFFFFFFFF;
+				Nz::UInt32 collisionMask = 0xFFFFFFFF;
+			};
+
 			NazaraSignal(OnPhysWorld2DPreStep, const PhysWorld2D* /*physWorld*/, float /*invStepCount*/);
 			NazaraSignal(OnPhysWorld2DPostStep, const PhysWorld2D* /*physWorld*/, float /*invStepCount*/);
+			NazaraSignal(OnPhysWorld2DStateRestored, const PhysWorld2D* /*physWorld*/);
 
 		private:
+			struct ContactPair
+			{
+				UInt64 firstShape;
+				UInt64 secondShape;
+				bool isIgnored;
+			};
+
+			void CollectContacts(std::vector<ContactPair>& contacts);
+			bool FindPersistentContact(const cpArbiter* arbiter, bool* isIgnored) const;
+			unsigned int GetQueryThreadCount() const;
 			void InitCallbacks(cpCollisionHandler* handler, Callback callbacks);
 
 			using PostStep = std::function<void(Nz::RigidBody2D* body)>;
@@ -141,7 +209,11 @@ namespace Nz
 			void OnRigidBodyMoved(RigidBody2D* oldPointer, RigidBody2D* newPointer);
 			void OnRigidBodyRelease(RigidBody2D* rigidBody);
 
+			std::size_t RegisterBody(RigidBody2D* rigidBody);
 			void RegisterPostStep(RigidBody2D* rigidBody, PostStep&& func);
+			void ResetCollisionState();
+			void RunPostSteps();
+			void UnregisterBody(std::size_t bodyIndex);
 
 			struct PostStepContainer
 			{
@@ -155,11 +227,24 @@ namespace Nz
 
 			std::size_t m_maxStepCount;
 			std::unordered_map<cpCollisionHandler*, std::unique_ptr<Callback>> m_callbacks;
+			Bitset<UInt64> m_activeBodies;
+			Bitset<UInt64> m_freeBodyIndices;
 			std::unordered_map<RigidBody2D*, PostStepContainer> m_rigidPostSteps;
+			std::vector<ContactPair> m_persistentContacts;
+			std::vector<RigidBody2D*> m_bodies;
+			std::vector<RigidBody2D*> m_postStepBodies;
+			std::vector<cpShape*> m_shapeBuffer;
 			cpSpace* m_handle;
+			Time m_sleepTime;
 			Time m_stepSize;
 			Time m_timestepAccumulator;
+			bool m_isDeterministic;
+			bool m_isResettingCollisionState;
+			bool m_isThreaded;
+			bool m_isUsingSpatialHash;
 	};
 }
 
+#include <Nazara/Physics2D/PhysWorld2D.inl>
+
 #endif // NAZARA_PHYSICS2D_PHYSWORLD2D_HPP
@@ -0,0 +1,21 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Physics2D module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Physics2D/PhysWorld2D.hpp>
+#include <Nazara/Physics2D/Debug.hpp>
+
+namespace Nz
+{
+	inline const Bitset<UInt64>& PhysWorld2D::GetActiveBodies() const
+	{
+		return m_activeBodies;
+	}
+
+	inline bool PhysWorld2D::IsDeterminismEnabled() const
+	{
+		return m_isDeterministic;
+	}
+}
+
+#include <Nazara/Physics2D/DebugOff.hpp>
@@ -51,6 +51,7 @@ namespace Nz
 			Rectf GetAABB() const;
 			inline float GetAngularDamping() const;
 			RadianAnglef GetAngularVelocity() const;
+			inline std::size_t GetBodyIndex() const;
 			NAZARA_DEPRECATED("Name error, please use GetMassCenter")
 			inline Vector2f GetCenterOfGravity(CoordSys coordSys = CoordSys::Local) const;
 			float GetElasticity(std::size_t shapeIndex = 0) const;
@@ -108,6 +109,7 @@ namespace Nz
 			NazaraSignal(OnRigidBody2DMove, RigidBody2D* /*oldPointer*/, RigidBody2D* /*newPointer*/);
 			NazaraSignal(OnRigidBody2DRelease, RigidBody2D* /*rigidBody*/);
 
+			static constexpr std::size_t InvalidBodyIndex = std::numeric_limits<std::size_t>::max();
 			static constexpr std::size_t InvalidShapeIndex = std::numeric_limits<std::size_t>::max();
 
 		protected:
@@ -115,6 +117,7 @@ namespace Nz
 
 		private:
 			cpBody* Create(float mass = 1.f, float moment = 1.f);
+			void DestroyHandle();
 			void RegisterToSpace();
 			void UnregisterFromSpace();
 
@@ -125,6 +128,7 @@ namespace Nz
 			VelocityFunc m_velocityFunc;
 			std::vector<cpShape*> m_shapes;
 			std::shared_ptr<Collider2D> m_geom;
+			std::size_t m_bodyIndex;
 			cpBody* m_handle;
 			void* m_userData;
 			PhysWorld2D* m_world;
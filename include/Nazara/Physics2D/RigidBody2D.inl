@@ -12,6 +12,11 @@ namespace Nz
 		return GetMomentOfInertia();
 	}
 
+	inline std::size_t RigidBody2D::GetBodyIndex() const
+	{
+		return m_bodyIndex;
+	}
+
 	inline Vector2f RigidBody2D::GetCenterOfGravity(CoordSys coordSys) const
 	{
 		return GetMassCenter(coordSys);
@@ -9,10 +9,14 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Time.hpp>
+#include <Nazara/Math/Vector2.hpp>
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
 #include <Nazara/Physics2D/Components/RigidBody2DComponent.hpp>
+#include <Nazara/Utils/Bitset.hpp>
 #include <Nazara/Utils/TypeList.hpp>
 #include <entt/entt.hpp>
+#include <memory>
+#include <vector>
 
 namespace Nz
 {
@@ -23,14 +27,28 @@ namespace Nz
 			using Components = TypeList<RigidBody2DComponent, class NodeComponent>;
 
 			Physics2DSystem(entt::registry& registry);
+			Physics2DSystem(entt::registry& registry, unsigned int solverThreadCount);
 			Physics2DSystem(const Physics2DSystem&) = delete;
 			Physics2DSystem(Physics2DSystem&&) = delete;
 			~Physics2DSystem();
 
+			PhysWorld2D& AddRegion(unsigned int solverThreadCount = 1);
+
 			template<typename... Args> RigidBody2DComponent CreateRigidBody(Args&&... args);
+			template<typename... Args> RigidBody2DComponent CreateRegionRigidBody(std::size_t regionIndex, Args&&... args);
+
+			void EnableInterpolation(bool enable = true);
 
 			inline PhysWorld2D& GetPhysWorld();
 			inline const PhysWorld2D& GetPhysWorld() const;
+			inline PhysWorld2D& GetRegion(std::size_t regionIndex);
+			inline const PhysWorld2D& GetRegion(std::size_t regionIndex) const;
+			inline std::size_t GetRegionCount() const;
+			inline unsigned int GetStepThreadCount() const;
+
+			inline bool IsInterpolationEnabled() const;
+
+			inline void SetStepThreadCount(unsigned int threadCount);
 
 			void Update(Time elapsedTime);
 
@@ -38,11 +56,42 @@ namespace Nz
 			Physics2DSystem& operator=(Physics2DSystem&&) = delete;
 
 		private:
-			static void OnConstruct(entt::registry& registry, entt::entity entity);
+			struct BodyEntry
+			{
+				entt::entity entity = entt::null;
+				Vector2f position;
+				Vector2f previousPosition;
+				float previousRotation;
+				float rotation;
+			};
+
+			struct Region
+			{
+				std::unique_ptr<PhysWorld2D> ownedWorld;
+				std::vector<BodyEntry> bodies;
+				Bitset<UInt64> interpolatedBodies;
+				Bitset<UInt64> movedBodies;
+				PhysWorld2D* world;
+
+				NazaraSlot(PhysWorld2D, OnPhysWorld2DPostStep, onPostStep);
+				NazaraSlot(PhysWorld2D, OnPhysWorld2DStateRestored, onStateRestored);
+			};
+
+			Region* FindRegion(const PhysWorld2D* world);
+			void OnBodyConstruct(entt::registry& registry, entt::entity entity);
+			void OnBodyDestroy(entt::registry& registry, entt::entity entity);
+			void OnPostStep(Region& region);
+			void OnStateRestored(Region& region);
+			Region& RegisterRegion(PhysWorld2D& world);
+			void UpdateNode(const BodyEntry& entry, float interpolation);
 
 			entt::registry& m_registry;
 			entt::scoped_connection m_constructConnection;
+			entt::scoped_connection m_destroyConnection;
 			PhysWorld2D m_physWorld;
+			std::vector<std::unique_ptr<Region>> m_regions;
+			unsigned int m_stepThreadCount;
+			bool m_isInterpolationEnabled;
 	};
 }
 
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Physics2D/Systems/Physics2DSystem.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/Physics2D/Debug.hpp>
 
 namespace Nz
@@ -13,6 +14,12 @@ namespace Nz
 		return RigidBody2DComponent(&m_physWorld, std::forward<Args>(args)...);
 	}
 
+	template<typename... Args>
+	RigidBody2DComponent Physics2DSystem::CreateRegionRigidBody(std::size_t regionIndex, Args&&... args)
+	{
+		return RigidBody2DComponent(&GetRegion(regionIndex), std::forward<Args>(args)...);
+	}
+
 	inline PhysWorld2D& Physics2DSystem::GetPhysWorld()
 	{
 		return m_physWorld;
@@ -22,6 +29,38 @@ namespace Nz
 	{
 		return m_physWorld;
 	}
+
+	inline PhysWorld2D& Physics2DSystem::GetRegion(std::size_t regionIndex)
+	{
+		NazaraAssert(regionIndex < GetRegionCount(), "Region index out of range");
+		return *m_regions[regionIndex]->world;
+	}
+
+	inline const PhysWorld2D& Physics2DSystem::GetRegion(std::size_t regionIndex) const
+	{
+		NazaraAssert(regionIndex < GetRegionCount(), "Region index out of range");
+		return *m_regions[regionIndex]->world;
+	}
+
+	inline std::size_t Physics2DSystem::GetRegionCount() const
+	{
+		return m_regions.size();
+	}
+
+	inline unsigned int Physics2DSystem::GetStepThreadCount() const
+	{
+		return m_stepThreadCount;
+	}
+
+	inline bool Physics2DSystem::IsInterpolationEnabled() const
+	{
+		return m_isInterpolationEnabled;
+	}
+
+	inline void Physics2DSystem::SetStepThreadCount(unsigned int threadCount)
+	{
+		m_stepThreadCount = threadCount;
+	}
 }
 
 #include <Nazara/Physics2D/DebugOff.hpp>
@@ -10,11 +10,15 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Time.hpp>
 #include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Quaternion.hpp>
 #include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Physics3D/Config.hpp>
+#include <Nazara/Utils/Bitset.hpp>
 #include <Nazara/Utils/MovablePtr.hpp>
+#include <Nazara/Utils/Signal.hpp>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 class NewtonBody;
 class NewtonJoint;
@@ -23,31 +27,55 @@ class NewtonWorld;
 
 namespace Nz
 {
+	class ByteArray;
+	class Collider3D;
 	class RigidBody3D;
 
 	class NAZARA_PHYSICS3D_API PhysWorld3D
 	{
+		friend RigidBody3D;
+
 		public:
 			using BodyIterator = std::function<bool(RigidBody3D& body)>;
 			using AABBOverlapCallback = std::function<bool(const RigidBody3D& firstBody, const RigidBody3D& secondBody)>;
 			using CollisionCallback = std::function<bool(const RigidBody3D& firstBody, const RigidBody3D& secondBody)>;
 
+			struct RaycastHit;
+			struct RaycastRequest;
+			struct SweepRequest;
+
 			PhysWorld3D();
 			PhysWorld3D(const PhysWorld3D&) = delete;
 			PhysWorld3D(PhysWorld3D&& ph) noexcept;
 			~PhysWorld3D();
 
+			std::size_t BatchRaycastQueryFirst(const RaycastRequest* requests, std::size_t requestCount, RaycastHit* hitInfos);
+			std::size_t BatchRegionQuery(const Boxf* boxes, std::size_t boxCount, RigidBody3D** bodies, std::size_t maxBodyPerBox, std::size_t* bodyCounts);
+			std::size_t BatchSweepQueryFirst(const SweepRequest* requests, std::size_t requestCount, RaycastHit* hitInfos);
+
 			int CreateMaterial(std::string name = {});
 
+			void EnableDeterminism(bool enable = true);
+
 			void ForEachBodyInAABB(const Boxf& box, const BodyIterator& iterator);
 
+			const Bitset<UInt64>& GetActiveBodies() const;
 			Vector3f GetGravity() const;
 			NewtonWorld* GetHandle() const;
+			float GetInterpolationFactor() const;
 			int GetMaterial(const std::string& name);
 			std::size_t GetMaxStepCount() const;
 			Time GetStepSize() const;
 			unsigned int GetThreadCount() const;
 
+			bool IsDeterminismEnabled() const;
+
+			bool RaycastQueryFirst(const Vector3f& from, const Vector3f& to, RaycastHit* hitInfo = nullptr);
+
+			bool RestoreState(const ByteArray& state);
+
+			void SaveState(ByteArray& state);
+
 			void SetGravity(const Vector3f& gravity);
 			void SetMaxStepCount(std::size_t maxStepCount);
 			void SetStepSize(Time stepSize);
@@ -65,6 +93,31 @@ namespace Nz
 			PhysWorld3D& operator=(const PhysWorld3D&) = delete;
 			PhysWorld3D& operator=(PhysWorld3D&&) noexcept;
 
+			struct RaycastHit
+			{
+				RigidBody3D* hitBody;
+				Vector3f hitNormal;
+				Vector3f hitPosition;
+				float fraction;
+			};
+
+			struct RaycastRequest
+			{
+				Vector3f from;
+				Vector3f to;
+			};
+
+			struct SweepRequest
+			{
+				const Collider3D* collider;
+				Quaternionf rotation = Quaternionf::Identity();
+				Vector3f from;
+				Vector3f to;
+			};
+
+			NazaraSignal(OnPhysWorld3DPostStep, const PhysWorld3D* /*physWorld*/, float /*invStepCount*/);
+			NazaraSignal(OnPhysWorld3DStateRestored, const PhysWorld3D* /*physWorld*/);
+
 		private:
 			struct Callback
 			{
@@ -72,16 +125,25 @@ namespace Nz
 				CollisionCallback collisionCallback;
 			};
 
+			void MarkBodyAsActive(std::size_t bodyIndex, int threadIndex);
+			std::size_t RegisterBody(RigidBody3D* rigidBody);
+			void UnregisterBody(std::size_t bodyIndex);
+
 			static int OnAABBOverlap(const NewtonJoint* const contact, float timestep, int threadIndex);
 			static void ProcessContact(const NewtonJoint* const contact, float timestep, int threadIndex);
 
 			std::unordered_map<Nz::UInt64, std::unique_ptr<Callback>> m_callbacks;
+			std::vector<std::vector<std::size_t>> m_threadActiveBodies;
+			std::vector<RigidBody3D*> m_bodies;
 			std::unordered_map<std::string, int> m_materialIds;
 			std::size_t m_maxStepCount;
+			Bitset<UInt64> m_activeBodies;
+			Bitset<UInt64> m_freeBodyIndices;
 			MovablePtr<NewtonWorld> m_world;
 			Vector3f m_gravity;
 			Time m_stepSize;
 			Time m_timestepAccumulator;
+			bool m_isDeterministic;
 	};
 }
 
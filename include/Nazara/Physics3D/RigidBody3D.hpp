@@ -15,6 +15,7 @@
 #include <Nazara/Physics3D/Collider3D.hpp>
 #include <Nazara/Physics3D/Config.hpp>
 #include <Nazara/Utils/MovablePtr.hpp>
+#include <limits>
 
 class NewtonBody;
 
@@ -24,6 +25,8 @@ namespace Nz
 
 	class NAZARA_PHYSICS3D_API RigidBody3D
 	{
+		friend PhysWorld3D;
+
 		public:
 			RigidBody3D(PhysWorld3D* world, const Matrix4f& mat = Matrix4f::Identity());
 			RigidBody3D(PhysWorld3D* world, std::shared_ptr<Collider3D> geom, const Matrix4f& mat = Matrix4f::Identity());
@@ -41,6 +44,7 @@ namespace Nz
 			Boxf GetAABB() const;
 			Vector3f GetAngularDamping() const;
 			Vector3f GetAngularVelocity() const;
+			std::size_t GetBodyIndex() const;
 			const std::shared_ptr<Collider3D>& GetGeom() const;
 			float GetGravityFactor() const;
 			NewtonBody* GetHandle() const;
@@ -77,14 +81,18 @@ namespace Nz
 			RigidBody3D& operator=(const RigidBody3D& object);
 			RigidBody3D& operator=(RigidBody3D&& object) noexcept;
 
+			static constexpr std::size_t InvalidBodyIndex = std::numeric_limits<std::size_t>::max();
+
 		protected:
 			void Destroy();
 
 		private:
 			void UpdateBody(const Matrix4f& transformMatrix);
 			static void ForceAndTorqueCallback(const NewtonBody* body, float timeStep, int threadIndex);
+			static void TransformCallback(const NewtonBody* body, const float* matrix, int threadIndex);
 
 			std::shared_ptr<Collider3D> m_geom;
+			std::size_t m_bodyIndex;
 			MovablePtr<NewtonBody> m_body;
 			Vector3f m_forceAccumulator;
 			Vector3f m_torqueAccumulator;
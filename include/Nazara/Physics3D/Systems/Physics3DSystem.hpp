@@ -9,10 +9,14 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Time.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Physics3D/PhysWorld3D.hpp>
 #include <Nazara/Physics3D/Components/RigidBody3DComponent.hpp>
+#include <Nazara/Utils/Bitset.hpp>
 #include <Nazara/Utils/TypeList.hpp>
 #include <entt/entt.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -29,20 +33,45 @@ namespace Nz
 
 			template<typename... Args> RigidBody3DComponent CreateRigidBody(Args&&... args);
 
+			void EnableInterpolation(bool enable = true);
+
 			inline PhysWorld3D& GetPhysWorld();
 			inline const PhysWorld3D& GetPhysWorld() const;
 
+			inline bool IsInterpolationEnabled() const;
+
 			void Update(Time elapsedTime);
 
 			Physics3DSystem& operator=(const Physics3DSystem&) = delete;
 			Physics3DSystem& operator=(Physics3DSystem&&) = delete;
 
 		private:
-			static void OnConstruct(entt::registry& registry, entt::entity entity);
+			struct BodyEntry
+			{
+				entt::entity entity = entt::null;
+				Quaternionf previousRotation;
+				Quaternionf rotation;
+				Vector3f position;
+				Vector3f previousPosition;
+			};
 
+			void OnBodyConstruct(entt::registry& registry, entt::entity entity);
+			void OnBodyDestroy(entt::registry& registry, entt::entity entity);
+			void OnPostStep();
+			void OnStateRestored();
+			void UpdateNode(const BodyEntry& entry, float interpolation);
+
+			std::vector<BodyEntry> m_bodies;
 			entt::registry& m_registry;
 			entt::scoped_connection m_constructConnection;
+			entt::scoped_connection m_destroyConnection;
+			Bitset<UInt64> m_interpolatedBodies;
+			Bitset<UInt64> m_movedBodies;
 			PhysWorld3D m_physWorld;
+			bool m_isInterpolationEnabled;
+
+			NazaraSlot(PhysWorld3D, OnPhysWorld3DPostStep, m_onPostStep);
+			NazaraSlot(PhysWorld3D, OnPhysWorld3DStateRestored, m_onStateRestored);
 	};
 }
 
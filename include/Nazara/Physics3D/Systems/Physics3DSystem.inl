@@ -22,6 +22,11 @@ namespace Nz
 	{
 		return m_physWorld;
 	}
+
+	inline bool Physics3DSystem::IsInterpolationEnabled() const
+	{
+		return m_isInterpolationEnabled;
+	}
 }
 
 #include <Nazara/Physics3D/DebugOff.hpp>
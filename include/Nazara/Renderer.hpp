@@ -57,6 +57,7 @@
 #include <Nazara/Renderer/RenderWindowImpl.hpp>
 #include <Nazara/Renderer/RenderWindowParameters.hpp>
 #include <Nazara/Renderer/ShaderBinding.hpp>
+#include <Nazara/Renderer/ShaderCache.hpp>
 #include <Nazara/Renderer/ShaderModule.hpp>
 #include <Nazara/Renderer/Texture.hpp>
 #include <Nazara/Renderer/TextureSampler.hpp>
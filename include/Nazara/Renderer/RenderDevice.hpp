@@ -23,10 +23,12 @@
 #include <NZSL/ShaderWriter.hpp>
 #include <NZSL/Ast/Module.hpp>
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace Nz
 {
+	class ByteArray;
 	class CommandPool;
 	class ShaderModule;
 
@@ -38,6 +40,8 @@ namespace Nz
 
 			virtual const RenderDeviceInfo& GetDeviceInfo() const = 0;
 			virtual const RenderDeviceFeatures& GetEnabledFeatures() const = 0;
+			virtual bool GetPipelineCacheData(ByteArray& data) const;
+			virtual std::optional<ShaderLanguage> GetShaderBinaryLanguage() const;
 
 			virtual std::shared_ptr<RenderBuffer> InstantiateBuffer(BufferType type, UInt64 size, BufferUsageFlags usageFlags, const void* initialData = nullptr) = 0;
 			virtual std::shared_ptr<CommandPool> InstantiateCommandPool(QueueType queueType) = 0;
@@ -54,6 +58,8 @@ namespace Nz
 
 			virtual bool IsTextureFormatSupported(PixelFormat format, TextureUsage usage) const = 0;
 
+			virtual bool LoadPipelineCacheData(const void* data, std::size_t size);
+
 			static void ValidateFeatures(const RenderDeviceFeatures& supportedFeatures, RenderDeviceFeatures& enabledFeatures);
 	};
 }
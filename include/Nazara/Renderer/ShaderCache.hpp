@@ -0,0 +1,64 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RENDERER_SHADERCACHE_HPP
+#define NAZARA_RENDERER_SHADERCACHE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Renderer/Config.hpp>
+#include <Nazara/Renderer/Enums.hpp>
+#include <NZSL/ShaderWriter.hpp>
+#include <NZSL/Ast/Module.hpp>
+#include <filesystem>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace Nz
+{
+	// Content-addressed storage of compiled shaders and backend pipeline binaries, which can be saved to and loaded from disk
+	class NAZARA_RENDERER_API ShaderCache
+	{
+		public:
+			inline ShaderCache();
+			ShaderCache(const ShaderCache&) = delete;
+			ShaderCache(ShaderCache&&) = delete;
+			~ShaderCache() = default;
+
+			void Clear();
+
+			bool Find(UInt64 key, ByteArray* data) const;
+
+			std::size_t GetEntryCount() const;
+
+			void Insert(UInt64 key, ByteArray data);
+			bool IsModified() const;
+
+			bool Load(const std::filesystem::path& filePath);
+			bool Save(const std::filesystem::path& filePath);
+
+			ShaderCache& operator=(const ShaderCache&) = delete;
+			ShaderCache& operator=(ShaderCache&&) = delete;
+
+			static bool CompileShader(nzsl::ShaderStageTypeFlags shaderStages, const nzsl::Ast::Module& shaderModule, const nzsl::ShaderWriter::States& states, ShaderLanguage language, ByteArray* binary);
+			static UInt64 ComputeKey(std::string_view identifier);
+			static UInt64 ComputeModuleKey(const nzsl::Ast::Module& shaderModule);
+			static UInt64 ComputeShaderKey(nzsl::ShaderStageTypeFlags shaderStages, const nzsl::Ast::Module& shaderModule, const nzsl::ShaderWriter::States& states, ShaderLanguage language);
+			static UInt64 ComputeShaderKey(nzsl::ShaderStageTypeFlags shaderStages, UInt64 moduleKey, const nzsl::ShaderWriter::States& states, ShaderLanguage language);
+
+			static constexpr UInt32 FormatVersion = 2;
+
+		private:
+			mutable std::shared_mutex m_mutex;
+			std::unordered_map<UInt64, ByteArray> m_entries;
+			bool m_isModified;
+	};
+}
+
+#include <Nazara/Renderer/ShaderCache.inl>
+
+#endif // NAZARA_RENDERER_SHADERCACHE_HPP
@@ -34,6 +34,7 @@
 #include <Nazara/Utility/AbstractTextDrawer.hpp>
 #include <Nazara/Utility/Algorithm.hpp>
 #include <Nazara/Utility/Animation.hpp>
+#include <Nazara/Utility/BlockCompressor.hpp>
 #include <Nazara/Utility/Buffer.hpp>
 #include <Nazara/Utility/BufferMapper.hpp>
 #include <Nazara/Utility/Config.hpp>
@@ -52,6 +53,7 @@
 #include <Nazara/Utility/MaterialData.hpp>
 #include <Nazara/Utility/Mesh.hpp>
 #include <Nazara/Utility/MeshData.hpp>
+#include <Nazara/Utility/MipmapParams.hpp>
 #include <Nazara/Utility/Node.hpp>
 #include <Nazara/Utility/PixelFormat.hpp>
 #include <Nazara/Utility/RichTextDrawer.hpp>
@@ -0,0 +1,30 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_UTILITY_BLOCKCOMPRESSOR_HPP
+#define NAZARA_UTILITY_BLOCKCOMPRESSOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Utility/Config.hpp>
+#include <Nazara/Utility/Enums.hpp>
+
+namespace Nz
+{
+	class NAZARA_UTILITY_API BlockCompressor
+	{
+		public:
+			BlockCompressor() = delete;
+			~BlockCompressor() = delete;
+
+			static bool Compress(PixelFormat dstFormat, const UInt8* rgba, unsigned int width, unsigned int height, UInt8* dst, BlockCompressionQuality quality = BlockCompressionQuality::Normal);
+
+			static void CompressBlock(PixelFormat dstFormat, const UInt8* block, UInt8* dst, BlockCompressionQuality quality = BlockCompressionQuality::Normal);
+
+			static bool IsSupported(PixelFormat dstFormat);
+	};
+}
+
+#endif // NAZARA_UTILITY_BLOCKCOMPRESSOR_HPP
@@ -13,12 +13,16 @@
 
 namespace Nz
 {
+	class TransformSystem;
+
 	class NAZARA_UTILITY_API NodeComponent : public Node
 	{
+		friend TransformSystem;
+
 		public:
-			NodeComponent() = default;
-			NodeComponent(const NodeComponent&) = default;
-			NodeComponent(NodeComponent&&) noexcept = default;
+			inline NodeComponent();
+			inline NodeComponent(const NodeComponent& nodeComponent);
+			inline NodeComponent(NodeComponent&& nodeComponent) noexcept;
 			~NodeComponent() = default;
 
 			void SetParent(entt::handle entity, bool keepDerived = false);
@@ -26,8 +30,16 @@ namespace Nz
 			void SetParentJoint(entt::handle entity, std::size_t jointIndex, bool keepDerived = false);
 			using Node::SetParent;
 
-			NodeComponent& operator=(const NodeComponent&) = default;
-			NodeComponent& operator=(NodeComponent&&) noexcept = default;
+			inline NodeComponent& operator=(const NodeComponent& nodeComponent);
+			inline NodeComponent& operator=(NodeComponent&& nodeComponent) noexcept;
+
+		protected:
+			void InvalidateNode() override;
+			void OnParenting(const Node* parent) override;
+
+		private:
+			TransformSystem* m_transformSystem;
+			std::size_t m_transformId;
 	};
 }
 
@@ -3,10 +3,49 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Components/NodeComponent.hpp>
+#include <utility>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
 {
+	inline NodeComponent::NodeComponent() :
+	m_transformSystem(nullptr),
+	m_transformId(0)
+	{
+	}
+
+	inline NodeComponent::NodeComponent(const NodeComponent& nodeComponent) :
+	Node(nodeComponent),
+	m_transformSystem(nullptr),
+	m_transformId(0)
+	{
+	}
+
+	inline NodeComponent::NodeComponent(NodeComponent&& nodeComponent) noexcept :
+	Node(std::move(nodeComponent)),
+	m_transformSystem(std::exchange(nodeComponent.m_transformSystem, nullptr)),
+	m_transformId(nodeComponent.m_transformId)
+	{
+	}
+
+	inline NodeComponent& NodeComponent::operator=(const NodeComponent& nodeComponent)
+	{
+		// Keep our own transform slot, only the node data is copied
+		Node::operator=(nodeComponent);
+
+		return *this;
+	}
+
+	inline NodeComponent& NodeComponent::operator=(NodeComponent&& nodeComponent) noexcept
+	{
+		// The transform system identifies nodes by entity, moving a component (as the registry does when compacting its storage) moves its transform slot along
+		m_transformSystem = std::exchange(nodeComponent.m_transformSystem, nullptr);
+		m_transformId = nodeComponent.m_transformId;
+
+		Node::operator=(std::move(nodeComponent));
+
+		return *this;
+	}
 }
 
 #include <Nazara/Utility/DebugOff.hpp>
@@ -46,6 +46,15 @@ namespace Nz
 		Zero
 	};
 
+	enum class BlockCompressionQuality
+	{
+		Fast,   //< Bounding box endpoints only
+		Normal, //< Principal axis endpoints with a least-squares refinement pass
+		High,   //< Normal plus an exhaustive search over alternative block modes
+
+		Max = High
+	};
+
 	enum class BufferAccess
 	{
 		DiscardAndWrite,
@@ -166,6 +175,23 @@ namespace Nz
 		Max = CounterClockwise
 	};
 
+	enum class GlyphRenderMode
+	{
+		Bitmap,              //< One rasterization per character size and outline thickness
+		SignedDistanceField, //< One distance field per style, shared by every size and outline
+
+		Max = SignedDistanceField
+	};
+
+	enum class ImageFilter
+	{
+		Box,      // Area average, fastest
+		Triangle, // Linear interpolation
+		Kaiser,   // Kaiser-windowed sinc, sharpest
+
+		Max = Kaiser
+	};
+
 	enum class IndexType
 	{
 		U8,
@@ -201,6 +227,9 @@ namespace Nz
 		Undefined = -1,
 
 		A8,              // 1*uint8
+		BC4,             // 4x4 blocks, 1 channel
+		BC5,             // 4x4 blocks, 2 channels
+		BC7,             // 4x4 blocks, 4 channels
 		BGR8,            // 3*uint8
 		BGR8_SRGB,       // 3*uint8
 		BGRA8,           // 4*uint8
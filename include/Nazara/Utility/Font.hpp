@@ -17,6 +17,7 @@
 #include <Nazara/Utility/AbstractAtlas.hpp>
 #include <Nazara/Utility/Enums.hpp>
 #include <memory>
+#include <string_view>
 #include <unordered_map>
 
 namespace Nz
@@ -61,10 +62,13 @@ namespace Nz
 			const std::shared_ptr<AbstractAtlas>& GetAtlas() const;
 			std::size_t GetCachedGlyphCount(unsigned int characterSize, TextStyleFlags style, float outlineThickness) const;
 			std::size_t GetCachedGlyphCount() const;
+			unsigned int GetDistanceFieldReferenceSize() const;
+			unsigned int GetDistanceFieldSpread() const;
 			std::string GetFamilyName() const;
 			int GetKerning(unsigned int characterSize, char32_t first, char32_t second) const;
 			const Glyph& GetGlyph(unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const;
 			unsigned int GetGlyphBorder() const;
+			GlyphRenderMode GetGlyphRenderMode() const;
 			unsigned int GetMinimumStepSize() const;
 			const SizeInfo& GetSizeInfo(unsigned int characterSize) const;
 			std::string GetStyleName() const;
@@ -75,7 +79,9 @@ namespace Nz
 			bool Precache(unsigned int characterSize, TextStyleFlags style, float outlineThickness, const std::string& characterSet) const;
 
 			void SetAtlas(std::shared_ptr<AbstractAtlas> atlas);
+			void SetDistanceFieldParameters(unsigned int referenceSize, unsigned int spread);
 			void SetGlyphBorder(unsigned int borderSize);
+			void SetGlyphRenderMode(GlyphRenderMode renderMode);
 			void SetMinimumStepSize(unsigned int minimumStepSize);
 
 			Font& operator=(const Font&) = delete;
@@ -84,6 +90,7 @@ namespace Nz
 			static std::shared_ptr<AbstractAtlas> GetDefaultAtlas();
 			static const std::shared_ptr<Font>& GetDefault();
 			static unsigned int GetDefaultGlyphBorder();
+			static GlyphRenderMode GetDefaultGlyphRenderMode();
 			static unsigned int GetDefaultMinimumStepSize();
 
 			static std::shared_ptr<Font> OpenFromFile(const std::filesystem::path& filePath, const FontParams& params = FontParams());
@@ -92,6 +99,7 @@ namespace Nz
 
 			static void SetDefaultAtlas(std::shared_ptr<AbstractAtlas> atlas);
 			static void SetDefaultGlyphBorder(unsigned int borderSize);
+			static void SetDefaultGlyphRenderMode(GlyphRenderMode renderMode);
 			static void SetDefaultMinimumStepSize(unsigned int minimumStepSize);
 
 			struct Glyph
@@ -127,9 +135,12 @@ namespace Nz
 		private:
 			using GlyphMap = std::unordered_map<char32_t, Glyph>;
 
+			UInt64 ComputeDistanceFieldKey(TextStyleFlags style) const;
 			UInt64 ComputeKey(unsigned int characterSize, TextStyleFlags style, float outlineThickness) const;
+			TextStyleFlags ComputeSupportedStyle(TextStyleFlags style) const;
 			void OnAtlasCleared(const AbstractAtlas* atlas);
 			void OnAtlasLayerChange(const AbstractAtlas* atlas, AbstractImage* oldLayer, AbstractImage* newLayer);
+			void PrecacheDistanceFieldGlyphs(TextStyleFlags style, const std::u32string_view& characters) const;
 			const Glyph& PrecacheGlyph(GlyphMap& glyphMap, unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const;
 
 			static bool Initialize();
@@ -141,13 +152,18 @@ namespace Nz
 			std::shared_ptr<AbstractAtlas> m_atlas;
 			std::unique_ptr<FontData> m_data;
 			mutable std::unordered_map<UInt64, std::unordered_map<UInt64, int>> m_kerningCache;
+			mutable std::unordered_map<UInt64, GlyphMap> m_distanceFieldGlyphes;
 			mutable std::unordered_map<UInt64, GlyphMap> m_glyphes;
 			mutable std::unordered_map<UInt64, SizeInfo> m_sizeInfoCache;
+			GlyphRenderMode m_glyphRenderMode;
+			unsigned int m_distanceFieldReferenceSize;
+			unsigned int m_distanceFieldSpread;
 			unsigned int m_glyphBorder;
 			unsigned int m_minimumStepSize;
 
 			static std::shared_ptr<AbstractAtlas> s_defaultAtlas;
 			static std::shared_ptr<Font> s_defaultFont;
+			static GlyphRenderMode s_defaultGlyphRenderMode;
 			static unsigned int s_defaultGlyphBorder;
 			static unsigned int s_defaultMinimumStepSize;
 	};
@@ -17,12 +17,11 @@
 #include <Nazara/Core/ResourceSaver.hpp>
 #include <Nazara/Utility/AbstractImage.hpp>
 #include <Nazara/Utility/CubemapParams.hpp>
+#include <Nazara/Utility/MipmapParams.hpp>
 #include <Nazara/Utils/MovablePtr.hpp>
 #include <Nazara/Utils/Signal.hpp>
 #include <atomic>
 
-///TODO: Filtres
-
 namespace Nz
 {
 	struct NAZARA_UTILITY_API ImageParams : ResourceParameters
@@ -33,6 +32,10 @@ namespace Nz
 		// Le nombre de niveaux de mipmaps maximum devant être créé
 		UInt8 levelCount = 0;
 
+		// Fill mipmap levels from the loaded image (all levels are allocated if levelCount is zero)
+		bool generateMipmaps = false;
+		MipmapParams mipmapParams;
+
 		bool IsValid() const;
 	};
 
@@ -55,7 +58,7 @@ namespace Nz
 			inline Image(Image&& image) noexcept;
 			~Image();
 
-			bool Convert(PixelFormat format);
+			bool Convert(PixelFormat format, BlockCompressionQuality quality = BlockCompressionQuality::Normal);
 
 			void Copy(const Image& source, const Boxui& srcBox, const Vector3ui& dstPos);
 
@@ -69,6 +72,8 @@ namespace Nz
 			bool FlipHorizontally();
 			bool FlipVertically();
 
+			bool GenerateMipmaps(const MipmapParams& params = MipmapParams());
+
 			const UInt8* GetConstPixels(unsigned int x = 0, unsigned int y = 0, unsigned int z = 0, UInt8 level = 0) const;
 			unsigned int GetDepth(UInt8 level = 0) const;
 			PixelFormat GetFormat() const override;
@@ -92,6 +97,8 @@ namespace Nz
 			bool LoadFaceFromMemory(CubemapFace face, const void* data, std::size_t size, const ImageParams& params = ImageParams());
 			bool LoadFaceFromStream(CubemapFace face, Stream& stream, const ImageParams& params = ImageParams());
 
+			bool Resize(unsigned int width, unsigned int height, ImageFilter filter = ImageFilter::Triangle, bool sRGB = false);
+
 			// Save
 			bool SaveToFile(const std::filesystem::path& filePath, const ImageParams& params = ImageParams());
 			bool SaveToStream(Stream& stream, const std::string& format, const ImageParams& params = ImageParams());
@@ -0,0 +1,27 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_UTILITY_MIPMAPPARAMS_HPP
+#define NAZARA_UTILITY_MIPMAPPARAMS_HPP
+
+#include <Nazara/Utility/Enums.hpp>
+
+namespace Nz
+{
+	struct MipmapParams
+	{
+		// Filter used to compute each level from the previous one
+		ImageFilter filter = ImageFilter::Box;
+
+		// Alpha-test reference value, when greater than zero alpha is rescaled on every level to keep the coverage of the first level
+		float alphaCoverageReference = 0.f;
+
+		// Filter color channels in linear space by considering them as sRGB-encoded (always the case with sRGB pixel formats)
+		bool sRGB = false;
+	};
+}
+
+#endif // NAZARA_UTILITY_MIPMAPPARAMS_HPP
@@ -81,6 +81,7 @@ namespace Nz
 			void SetScale(const Vector3f& scale, CoordSys coordSys = CoordSys::Local);
 			void SetScale(float scale, CoordSys coordSys = CoordSys::Local);
 			void SetScale(float scaleX, float scaleY, float scaleZ = 1.f, CoordSys coordSys = CoordSys::Local);
+			void SetTransform(const Vector3f& position, const Quaternionf& rotation, CoordSys coordSys = CoordSys::Local);
 			void SetTransformMatrix(const Matrix4f& matrix);
 
 			// Local -> global
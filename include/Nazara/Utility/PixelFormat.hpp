@@ -58,6 +58,7 @@ namespace Nz
 
 		public:
 			using ConvertFunction = std::function<UInt8*(const UInt8* start, const UInt8* end, UInt8* dst)>;
+			using DecompressFunction = std::function<bool(const UInt8* src, unsigned int width, unsigned int height, UInt8* dst)>;
 			using FlipFunction = std::function<void(unsigned int width, unsigned int height, unsigned int depth, const UInt8* src, UInt8* dst)>;
 
 			static inline std::size_t ComputeSize(PixelFormat format, unsigned int width, unsigned int height, unsigned int depth);
@@ -65,10 +66,13 @@ namespace Nz
 			static inline bool Convert(PixelFormat srcFormat, PixelFormat dstFormat, const void* src, void* dst);
 			static inline bool Convert(PixelFormat srcFormat, PixelFormat dstFormat, const void* start, const void* end, void* dst);
 
+			static inline bool Decompress(PixelFormat srcFormat, PixelFormat dstFormat, const void* src, unsigned int width, unsigned int height, void* dst);
+
 			static bool Flip(PixelFlipping flipping, PixelFormat format, unsigned int width, unsigned int height, unsigned int depth, const void* src, void* dst);
 
 			static inline UInt8 GetBitsPerPixel(PixelFormat format);
 			static inline PixelFormatContent GetContent(PixelFormat format);
+			static inline const ConvertFunction& GetConvertFunction(PixelFormat srcFormat, PixelFormat dstFormat);
 			static inline UInt8 GetBytesPerPixel(PixelFormat format);
 			static inline const PixelFormatDescription& GetInfo(PixelFormat format);
 			static inline const std::string& GetName(PixelFormat format);
@@ -79,9 +83,11 @@ namespace Nz
 
 			static inline bool IsCompressed(PixelFormat format);
 			static inline bool IsConversionSupported(PixelFormat srcFormat, PixelFormat dstFormat);
+			static inline bool IsDecompressionSupported(PixelFormat srcFormat, PixelFormat dstFormat);
 			static inline bool IsValid(PixelFormat format);
 
 			static inline void SetConvertFunction(PixelFormat srcFormat, PixelFormat dstFormat, ConvertFunction func);
+			static inline void SetDecompressFunction(PixelFormat srcFormat, PixelFormat dstFormat, DecompressFunction func);
 			static inline void SetFlipFunction(PixelFlipping flipping, PixelFormat format, FlipFunction func);
 
 		private:
@@ -89,6 +95,7 @@ namespace Nz
 			static void Uninitialize();
 
 			static std::array<std::array<ConvertFunction, PixelFormatCount>, PixelFormatCount> s_convertFunctions;
+			static std::array<std::array<DecompressFunction, PixelFormatCount>, PixelFormatCount> s_decompressFunctions;
 			static std::array<std::array<PixelFormatInfo::FlipFunction, PixelFlippingCount>, PixelFormatCount> s_flipFunctions;
 			static std::array<PixelFormatDescription, PixelFormatCount> s_pixelFormatInfos;
 	};
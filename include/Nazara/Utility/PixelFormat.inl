@@ -151,10 +151,13 @@ namespace Nz
 		{
 			switch (format)
 			{
+				case PixelFormat::BC4:
+				case PixelFormat::BC5:
+				case PixelFormat::BC7:
 				case PixelFormat::DXT1:
 				case PixelFormat::DXT3:
 				case PixelFormat::DXT5:
-					return (((width + 3) / 4) * ((height + 3) / 4) * ((format == PixelFormat::DXT1) ? 8 : 16)) * depth;
+					return (((width + 3) / 4) * ((height + 3) / 4) * ((format == PixelFormat::DXT1 || format == PixelFormat::BC4) ? 8 : 16)) * depth;
 
 				default:
 					NazaraError("Unsupported format");
@@ -198,6 +201,14 @@ namespace Nz
 			return true;
 		}
 
+		#if NAZARA_UTILITY_SAFE
+		if (IsCompressed(srcFormat) || IsCompressed(dstFormat))
+		{
+			NazaraError("Cannot convert pixels from " + GetName(srcFormat) + " to " + GetName(dstFormat) + ", block-compressed formats need the image size (see Decompress)");
+			return false;
+		}
+		#endif
+
 		ConvertFunction func = s_convertFunctions[UnderlyingCast(srcFormat)][UnderlyingCast(dstFormat)];
 		if (!func)
 		{
@@ -214,6 +225,28 @@ namespace Nz
 		return true;
 	}
 
+	// Unlike Convert, decompression works on a whole image: src holds ComputeSize(srcFormat, width, height, 1) bytes of blocks
+	// and dst receives width * height pixels without padding, even if the size isn't a multiple of the block size
+	inline bool PixelFormatInfo::Decompress(PixelFormat srcFormat, PixelFormat dstFormat, const void* src, unsigned int width, unsigned int height, void* dst)
+	{
+		NazaraAssert(IsCompressed(srcFormat), "source format must be a block-compressed format");
+
+		const DecompressFunction& func = s_decompressFunctions[UnderlyingCast(srcFormat)][UnderlyingCast(dstFormat)];
+		if (!func)
+		{
+			NazaraError("Decompression from " + GetName(srcFormat) + " to " + GetName(dstFormat) + " is not supported");
+			return false;
+		}
+
+		if (!func(static_cast<const UInt8*>(src), width, height, static_cast<UInt8*>(dst)))
+		{
+			NazaraError("Decompression from " + GetName(srcFormat) + " to " + GetName(dstFormat) + " failed");
+			return false;
+		}
+
+		return true;
+	}
+
 	inline UInt8 PixelFormatInfo::GetBitsPerPixel(PixelFormat format)
 	{
 		return s_pixelFormatInfos[UnderlyingCast(format)].bitsPerPixel;
@@ -229,6 +262,11 @@ namespace Nz
 		return s_pixelFormatInfos[UnderlyingCast(format)].content;
 	}
 
+	inline auto PixelFormatInfo::GetConvertFunction(PixelFormat srcFormat, PixelFormat dstFormat) -> const ConvertFunction&
+	{
+		return s_convertFunctions[UnderlyingCast(srcFormat)][UnderlyingCast(dstFormat)];
+	}
+
 	inline const PixelFormatDescription& PixelFormatInfo::GetInfo(PixelFormat format)
 	{
 		return s_pixelFormatInfos[UnderlyingCast(format)];
@@ -257,6 +295,11 @@ namespace Nz
 		return s_convertFunctions[UnderlyingCast(srcFormat)][UnderlyingCast(dstFormat)] != nullptr;
 	}
 
+	inline bool PixelFormatInfo::IsDecompressionSupported(PixelFormat srcFormat, PixelFormat dstFormat)
+	{
+		return s_decompressFunctions[UnderlyingCast(srcFormat)][UnderlyingCast(dstFormat)] != nullptr;
+	}
+
 	inline bool PixelFormatInfo::IsValid(PixelFormat format)
 	{
 		return format != PixelFormat::Undefined;
@@ -267,6 +310,11 @@ namespace Nz
 		s_convertFunctions[UnderlyingCast(srcFormat)][UnderlyingCast(dstFormat)] = func;
 	}
 
+	inline void PixelFormatInfo::SetDecompressFunction(PixelFormat srcFormat, PixelFormat dstFormat, DecompressFunction func)
+	{
+		s_decompressFunctions[UnderlyingCast(srcFormat)][UnderlyingCast(dstFormat)] = func;
+	}
+
 	inline void PixelFormatInfo::SetFlipFunction(PixelFlipping flipping, PixelFormat format, FlipFunction func)
 	{
 		s_flipFunctions[UnderlyingCast(flipping)][UnderlyingCast(format)] = func;
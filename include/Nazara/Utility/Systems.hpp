@@ -30,6 +30,7 @@
 #define NAZARA_UTILITY_SYSTEMS_HPP
 
 #include <Nazara/Utility/Systems/SkeletonSystem.hpp>
+#include <Nazara/Utility/Systems/TransformSystem.hpp>
 #include <Nazara/Utility/Systems/VelocitySystem.hpp>
 
 #endif // NAZARA_UTILITY_SYSTEMS_HPP
@@ -0,0 +1,119 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_UTILITY_SYSTEMS_TRANSFORMSYSTEM_HPP
+#define NAZARA_UTILITY_SYSTEMS_TRANSFORMSYSTEM_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Time.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Utility/Config.hpp>
+#include <Nazara/Utils/Bitset.hpp>
+#include <entt/entt.hpp>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	class NodeComponent;
+
+	class NAZARA_UTILITY_API TransformSystem
+	{
+		friend NodeComponent;
+
+		public:
+			static constexpr bool AllowConcurrent = false;
+			static constexpr Int64 ExecutionOrder = 500; //< after physics, before rendering
+			static constexpr std::size_t InvalidSlot = std::numeric_limits<std::size_t>::max();
+
+			struct TransformRange;
+
+			TransformSystem(entt::registry& registry);
+			TransformSystem(const TransformSystem&) = delete;
+			TransformSystem(TransformSystem&&) = delete;
+			~TransformSystem();
+
+			inline entt::entity GetEntity(std::size_t slot) const;
+			inline const std::vector<TransformRange>& GetInvalidatedRanges() const;
+			inline std::size_t GetSlot(const NodeComponent& node) const;
+			inline std::size_t GetTransformCount() const;
+			inline const Matrix4f& GetWorldMatrix(std::size_t slot) const;
+			inline const Vector3f& GetWorldPosition(std::size_t slot) const;
+			inline const Quaternionf& GetWorldRotation(std::size_t slot) const;
+			inline const Vector3f& GetWorldScale(std::size_t slot) const;
+
+			inline bool IsInvalidated(std::size_t slot) const;
+
+			void Update(Time elapsedTime);
+
+			TransformSystem& operator=(const TransformSystem&) = delete;
+			TransformSystem& operator=(TransformSystem&&) = delete;
+
+			static TransformSystem* Find(entt::registry& registry);
+
+			// Slots [first, first + count) had their world transform updated during the last Update
+			struct TransformRange
+			{
+				std::size_t first;
+				std::size_t count;
+			};
+
+		private:
+			inline void InvalidateHierarchy();
+			inline void InvalidateTransform(std::size_t transformId);
+			void OnNodeConstruct(entt::registry& registry, entt::entity entity);
+			void OnNodeDestroy(entt::registry& registry, entt::entity entity);
+			void RebuildHierarchy();
+			void UpdateLocalTransforms();
+			void UpdateWorldTransforms();
+
+			static constexpr std::size_t ExternalParent = InvalidSlot - 1; //< parent is not a NodeComponent (skeleton joint, ...)
+
+			enum InheritFlags : UInt8
+			{
+				InheritPosition = 1 << 0,
+				InheritRotation = 1 << 1,
+				InheritScale    = 1 << 2
+			};
+
+			struct Level
+			{
+				std::size_t first;
+				std::size_t count;
+			};
+
+			// Transforms are identified by a stable id (stored in NodeComponent), but their data is stored per slot,
+			// slots being sorted by hierarchy depth so that parents are always updated before their children
+			std::vector<std::size_t> m_freeTransformIds;
+			std::vector<std::size_t> m_transformIdToSlot;
+			std::vector<std::size_t> m_slotToTransformId;
+			std::vector<entt::entity> m_entities;
+			std::vector<std::size_t> m_parentSlots;
+			std::vector<UInt8> m_inheritFlags;
+			std::vector<UInt8> m_worldInvalidated; //< one byte per slot, as they're written concurrently
+			std::vector<Level> m_levels;
+			std::vector<Matrix4f> m_worldMatrices;
+			std::vector<Quaternionf> m_localRotations;
+			std::vector<Quaternionf> m_worldRotations;
+			std::vector<TransformRange> m_invalidatedRanges;
+			std::vector<Vector3f> m_localPositions;
+			std::vector<Vector3f> m_localScales;
+			std::vector<Vector3f> m_worldPositions;
+			std::vector<Vector3f> m_worldScales;
+			entt::registry& m_registry;
+			entt::scoped_connection m_nodeConstructConnection;
+			entt::scoped_connection m_nodeDestroyConnection;
+			Bitset<UInt64> m_invalidatedTransforms; //< by transform id
+			bool m_hierarchyInvalidated;
+			bool m_lastLevelIsAppended;
+	};
+}
+
+#include <Nazara/Utility/Systems/TransformSystem.inl>
+
+#endif // NAZARA_UTILITY_SYSTEMS_TRANSFORMSYSTEM_HPP
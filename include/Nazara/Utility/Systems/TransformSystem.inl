@@ -0,0 +1,77 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/Systems/TransformSystem.hpp>
+#include <Nazara/Utility/Components/NodeComponent.hpp>
+#include <cassert>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	inline entt::entity TransformSystem::GetEntity(std::size_t slot) const
+	{
+		assert(slot < m_entities.size());
+		return m_entities[slot];
+	}
+
+	inline auto TransformSystem::GetInvalidatedRanges() const -> const std::vector<TransformRange>&
+	{
+		return m_invalidatedRanges;
+	}
+
+	inline std::size_t TransformSystem::GetSlot(const NodeComponent& node) const
+	{
+		if (node.m_transformSystem != this)
+			return InvalidSlot;
+
+		return m_transformIdToSlot[node.m_transformId];
+	}
+
+	inline std::size_t TransformSystem::GetTransformCount() const
+	{
+		return m_entities.size();
+	}
+
+	inline const Matrix4f& TransformSystem::GetWorldMatrix(std::size_t slot) const
+	{
+		assert(slot < m_worldMatrices.size());
+		return m_worldMatrices[slot];
+	}
+
+	inline const Vector3f& TransformSystem::GetWorldPosition(std::size_t slot) const
+	{
+		assert(slot < m_worldPositions.size());
+		return m_worldPositions[slot];
+	}
+
+	inline const Quaternionf& TransformSystem::GetWorldRotation(std::size_t slot) const
+	{
+		assert(slot < m_worldRotations.size());
+		return m_worldRotations[slot];
+	}
+
+	inline const Vector3f& TransformSystem::GetWorldScale(std::size_t slot) const
+	{
+		assert(slot < m_worldScales.size());
+		return m_worldScales[slot];
+	}
+
+	inline bool TransformSystem::IsInvalidated(std::size_t slot) const
+	{
+		assert(slot < m_worldInvalidated.size());
+		return m_worldInvalidated[slot] != 0;
+	}
+
+	inline void TransformSystem::InvalidateHierarchy()
+	{
+		m_hierarchyInvalidated = true;
+	}
+
+	inline void TransformSystem::InvalidateTransform(std::size_t transformId)
+	{
+		m_invalidatedTransforms.UnboundedSet(transformId);
+	}
+}
+
+#include <Nazara/Utility/DebugOff.hpp>
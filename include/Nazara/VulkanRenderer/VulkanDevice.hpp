@@ -11,6 +11,8 @@
 #include <Nazara/Renderer/RenderDevice.hpp>
 #include <Nazara/VulkanRenderer/VulkanBuffer.hpp>
 #include <Nazara/VulkanRenderer/Wrapper/Device.hpp>
+#include <Nazara/VulkanRenderer/Wrapper/PipelineCache.hpp>
+#include <mutex>
 #include <vector>
 
 namespace Nz
@@ -25,6 +27,9 @@ namespace Nz
 
 			const RenderDeviceInfo& GetDeviceInfo() const override;
 			const RenderDeviceFeatures& GetEnabledFeatures() const override;
+			VkPipelineCache GetPipelineCache();
+			bool GetPipelineCacheData(ByteArray& data) const override;
+			std::optional<ShaderLanguage> GetShaderBinaryLanguage() const override;
 
 			std::shared_ptr<RenderBuffer> InstantiateBuffer(BufferType type, UInt64 size, BufferUsageFlags usageFlags, const void* initialData = nullptr) override;
 			std::shared_ptr<CommandPool> InstantiateCommandPool(QueueType queueType) override;
@@ -40,12 +45,16 @@ namespace Nz
 
 			bool IsTextureFormatSupported(PixelFormat format, TextureUsage usage) const override;
 
+			bool LoadPipelineCacheData(const void* data, std::size_t size) override;
+
 			VulkanDevice& operator=(const VulkanDevice&) = delete;
 			VulkanDevice& operator=(VulkanDevice&&) = delete; ///TODO?
 
 		private:
+			std::once_flag m_pipelineCacheFlag;
 			RenderDeviceFeatures m_enabledFeatures;
 			RenderDeviceInfo m_renderDeviceInfo;
+			Vk::PipelineCache m_pipelineCache;
 	};
 }
 
@@ -98,7 +98,7 @@ namespace Nz
 
 			std::string m_debugName;
 			mutable std::unordered_map<std::pair<VkRenderPass, std::size_t>, PipelineData, PipelineHasher> m_pipelines;
-			MovablePtr<Vk::Device> m_device;
+			MovablePtr<VulkanDevice> m_device;
 			mutable CreateInfo m_pipelineCreateInfo;
 			RenderPipelineInfo m_pipelineInfo;
 	};
@@ -129,6 +129,7 @@ NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkGetFenceStatus)
 NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkGetImageMemoryRequirements)
 NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkGetImageSparseMemoryRequirements)
 NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkGetImageSubresourceLayout)
+NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkGetPipelineCacheData)
 NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkGetRenderAreaGranularity)
 NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkInvalidateMappedMemoryRanges)
 NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkMapMemory)
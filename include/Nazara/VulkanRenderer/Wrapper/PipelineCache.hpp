@@ -9,6 +9,7 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/VulkanRenderer/Wrapper/DeviceObject.hpp>
+#include <vector>
 
 namespace Nz 
 {
@@ -24,6 +25,13 @@ namespace Nz
 				PipelineCache(PipelineCache&&) = default;
 				~PipelineCache() = default;
 
+				using DeviceObject::Create;
+				inline bool Create(Device& device, const void* initialData = nullptr, std::size_t initialDataSize = 0, VkPipelineCacheCreateFlags flags = 0, const VkAllocationCallbacks* allocator = nullptr);
+
+				inline bool GetData(std::vector<UInt8>* data) const;
+
+				inline bool Merge(UInt32 cacheCount, const VkPipelineCache* caches);
+
 				PipelineCache& operator=(const PipelineCache&) = delete;
 				PipelineCache& operator=(PipelineCache&&) = delete;
 
@@ -3,12 +3,66 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/VulkanRenderer/Wrapper/PipelineCache.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/VulkanRenderer/Utils.hpp>
+#include <Nazara/VulkanRenderer/Wrapper/Device.hpp>
+#include <cassert>
 #include <Nazara/VulkanRenderer/Debug.hpp>
 
 namespace Nz
 {
 	namespace Vk
 	{
+		inline bool PipelineCache::Create(Device& device, const void* initialData, std::size_t initialDataSize, VkPipelineCacheCreateFlags flags, const VkAllocationCallbacks* allocator)
+		{
+			VkPipelineCacheCreateInfo createInfo =
+			{
+				VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+				nullptr,
+				flags,
+				initialDataSize,
+				initialData
+			};
+
+			return Create(device, createInfo, allocator);
+		}
+
+		inline bool PipelineCache::GetData(std::vector<UInt8>* data) const
+		{
+			assert(data);
+
+			std::size_t dataSize = 0;
+			m_lastErrorCode = m_device->vkGetPipelineCacheData(*m_device, m_handle, &dataSize, nullptr);
+			if (m_lastErrorCode != VkResult::VK_SUCCESS)
+			{
+				NazaraError("Failed to query pipeline cache data size: " + TranslateVulkanError(m_lastErrorCode));
+				return false;
+			}
+
+			data->resize(dataSize);
+			m_lastErrorCode = m_device->vkGetPipelineCacheData(*m_device, m_handle, &dataSize, data->data());
+			if (m_lastErrorCode != VkResult::VK_SUCCESS && m_lastErrorCode != VkResult::VK_INCOMPLETE)
+			{
+				NazaraError("Failed to query pipeline cache data: " + TranslateVulkanError(m_lastErrorCode));
+				return false;
+			}
+
+			data->resize(dataSize);
+			return true;
+		}
+
+		inline bool PipelineCache::Merge(UInt32 cacheCount, const VkPipelineCache* caches)
+		{
+			m_lastErrorCode = m_device->vkMergePipelineCaches(*m_device, m_handle, cacheCount, caches);
+			if (m_lastErrorCode != VkResult::VK_SUCCESS)
+			{
+				NazaraError("Failed to merge pipeline caches: " + TranslateVulkanError(m_lastErrorCode));
+				return false;
+			}
+
+			return true;
+		}
+
 		inline VkResult PipelineCache::CreateHelper(Device& device, const VkPipelineCacheCreateInfo* createInfo, const VkAllocationCallbacks* allocator, VkPipelineCache* handle)
 		{
 			return device.vkCreatePipelineCache(device, createInfo, allocator, handle);
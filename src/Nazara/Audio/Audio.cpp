@@ -10,6 +10,7 @@
 #include <Nazara/Audio/Enums.hpp>
 #include <Nazara/Audio/OpenALDevice.hpp>
 #include <Nazara/Audio/OpenALLibrary.hpp>
+#include <Nazara/Audio/SoftwareAudioDevice.hpp>
 #include <Nazara/Audio/Formats/drwavLoader.hpp>
 #include <Nazara/Audio/Formats/libflacLoader.hpp>
 #include <Nazara/Audio/Formats/libvorbisLoader.hpp>
@@ -36,6 +37,7 @@ namespace Nz
 
 	Audio::Audio(Config config) :
 	ModuleBase("Audio", this),
+	m_audioStreamer(config.streamingThreadCount),
 	m_hasDummyDevice(config.allowDummyDevice)
 	{
 		// Load OpenAL
@@ -85,6 +87,15 @@ namespace Nz
 		s_openalLibrary.Unload();
 	}
 
+	/*!
+	* \brief Gets the streamer shared by musics to fill their buffers
+	* \return A reference to the audio streamer
+	*/
+	AudioStreamer& Audio::GetAudioStreamer()
+	{
+		return m_audioStreamer;
+	}
+
 	const std::shared_ptr<AudioDevice>& Audio::GetDefaultDevice() const
 	{
 		return m_defaultDevice;
@@ -131,6 +142,9 @@ namespace Nz
 		if (deviceName == "dummy")
 			return std::make_shared<DummyAudioDevice>();
 
+		if (deviceName == "software")
+			return std::make_shared<SoftwareAudioDevice>();
+
 		return s_openalLibrary.OpenDevice(deviceName.c_str());
 	}
 
@@ -151,6 +165,8 @@ namespace Nz
 		if (m_hasDummyDevice)
 			outputDevices.push_back("dummy");
 
+		outputDevices.push_back("software");
+
 		return outputDevices;
 	}
 
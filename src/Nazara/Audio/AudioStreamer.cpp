@@ -0,0 +1,200 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/AudioStreamer.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <chrono>
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup audio
+	* \class Nz::AudioStreamer
+	* \brief Audio class running the update of every sound stream (such as musics) on a shared pool of threads
+	*
+	* Streams are spread over the threads by their id, commands are sent to the threads through a lock-free queue
+	* so registering a stream never blocks the streaming threads.
+	*/
+
+	/*!
+	* \brief Constructs an AudioStreamer and starts its threads
+	*
+	* \param threadCount Number of streaming threads, must be at least one
+	* \param updateInterval Time between two updates of the same stream
+	*/
+	AudioStreamer::AudioStreamer(std::size_t threadCount, Time updateInterval) :
+	m_running(true),
+	m_nextStreamId(0),
+	m_updateInterval(updateInterval)
+	{
+		NazaraAssert(threadCount > 0, "streamer requires at least one thread");
+
+		m_workers.reserve(threadCount);
+		for (std::size_t i = 0; i < threadCount; ++i)
+		{
+			auto& worker = m_workers.emplace_back(std::make_unique<Worker>());
+			worker->pendingCommands = nullptr;
+		}
+
+		// Start threads once every worker exists
+		for (auto& worker : m_workers)
+			worker->thread = std::thread(&AudioStreamer::WorkerThread, this, std::ref(*worker));
+	}
+
+	/*!
+	* \brief Stops every streaming thread, streams still registered are not updated anymore
+	*
+	* \remark Streams can still be unregistered while the threads are stopping, this never blocks once a thread has stopped
+	*/
+	AudioStreamer::~AudioStreamer()
+	{
+		m_running = false;
+		for (auto& worker : m_workers)
+			worker->thread.join();
+	}
+
+	/*!
+	* \brief Registers a stream, its callback will be regularly called from a streaming thread until it returns false or is unregistered
+	* \return Identifier of the stream, used to unregister it
+	*
+	* \param updateCallback Callback filling the stream buffers, returning false once the stream is over
+	*
+	* \remark Streams registered while the streamer is being destroyed are never updated
+	*/
+	auto AudioStreamer::RegisterStream(UpdateCallback updateCallback) -> StreamId
+	{
+		StreamId streamId = m_nextStreamId++;
+
+		auto command = std::make_unique<Command>();
+		command->type = Command::Type::Register;
+		command->streamId = streamId;
+		command->updateCallback = std::move(updateCallback);
+
+		PushCommand(*m_workers[streamId % m_workers.size()], std::move(command));
+
+		return streamId;
+	}
+
+	/*!
+	* \brief Unregisters a stream, blocking until its callback is not running and will never be called again
+	*
+	* \param streamId Identifier of the stream, it's not an error if the stream already ended
+	*
+	* \remark This must not be called from a stream callback
+	*/
+	void AudioStreamer::UnregisterStream(StreamId streamId)
+	{
+		auto command = std::make_unique<Command>();
+		command->type = Command::Type::Unregister;
+		command->streamId = streamId;
+
+		std::future<void> unregistered = command->unregistered.get_future();
+
+		// If the streaming thread already stopped, the stream callback can't be called anymore
+		if (!PushCommand(*m_workers[streamId % m_workers.size()], std::move(command)))
+			return;
+
+		unregistered.wait();
+	}
+
+	void AudioStreamer::ProcessCommands(Worker& worker, bool closeQueue)
+	{
+		// Take all pending commands at once, they were pushed in reverse order
+		Command* command = worker.pendingCommands.exchange((closeQueue) ? GetClosedQueueMarker(worker) : nullptr, std::memory_order_acquire);
+
+		Command* previous = nullptr;
+		while (command)
+		{
+			Command* next = command->next;
+			command->next = previous;
+			previous = command;
+			command = next;
+		}
+
+		command = previous;
+		while (command)
+		{
+			std::unique_ptr<Command> currentCommand(command);
+			command = command->next;
+
+			switch (currentCommand->type)
+			{
+				case Command::Type::Register:
+					worker.streams.push_back({ currentCommand->streamId, std::move(currentCommand->updateCallback) });
+					break;
+
+				case Command::Type::Unregister:
+				{
+					auto it = std::find_if(worker.streams.begin(), worker.streams.end(), [&](const Stream& stream) { return stream.streamId == currentCommand->streamId; });
+					if (it != worker.streams.end())
+						worker.streams.erase(it);
+
+					currentCommand->unregistered.set_value();
+					break;
+				}
+			}
+		}
+	}
+
+	bool AudioStreamer::PushCommand(Worker& worker, std::unique_ptr<Command> command)
+	{
+		Command* closedQueueMarker = GetClosedQueueMarker(worker);
+
+		Command* head = worker.pendingCommands.load(std::memory_order_relaxed);
+		do
+		{
+			// Worker stopped and won't process commands anymore
+			if (head == closedQueueMarker)
+				return false;
+
+			command->next = head;
+		}
+		while (!worker.pendingCommands.compare_exchange_weak(head, command.get(), std::memory_order_release, std::memory_order_relaxed));
+
+		command.release();
+		return true;
+	}
+
+	void AudioStreamer::WorkerThread(Worker& worker)
+	{
+		std::chrono::microseconds updateInterval(m_updateInterval.AsMicroseconds());
+
+		while (m_running)
+		{
+			ProcessCommands(worker);
+
+			for (auto it = worker.streams.begin(); it != worker.streams.end();)
+			{
+				bool keepStreaming;
+				try
+				{
+					keepStreaming = it->updateCallback();
+				}
+				catch (const std::exception& e)
+				{
+					NazaraError("audio stream update failed: " + std::string(e.what()));
+					keepStreaming = false;
+				}
+
+				if (keepStreaming)
+					++it;
+				else
+					it = worker.streams.erase(it);
+			}
+
+			std::this_thread::sleep_for(updateInterval);
+		}
+
+		// Release threads waiting on unregistration and reject the next commands, atomically so none of them can be left unprocessed
+		ProcessCommands(worker, true);
+	}
+
+	auto AudioStreamer::GetClosedQueueMarker(Worker& worker) -> Command*
+	{
+		// Any address which can't be a command works, the worker one is unique and stays valid as long as the queue
+		return reinterpret_cast<Command*>(&worker);
+	}
+}
@@ -11,8 +11,6 @@
 #include <Nazara/Audio/SoundStream.hpp>
 #include <Nazara/Utils/CallOnExit.hpp>
 #include <array>
-#include <chrono>
-#include <optional>
 #include <Nazara/Audio/Debug.hpp>
 
 namespace Nz
@@ -23,17 +21,26 @@ namespace Nz
 	* \brief Audio class that represents a music
 	*
 	* \remark Module Audio needs to be initialized to use this class
+	*
+	* Musics are not streamed by their own thread but by an AudioStreamer, shared by default between all musics
 	*/
 
 	Music::Music() :
 	Music(*Audio::Instance()->GetDefaultDevice())
 	{
 	}
-	
+
 	Music::Music(AudioDevice& device) :
+	Music(device, Audio::Instance()->GetAudioStreamer())
+	{
+	}
+
+	Music::Music(AudioDevice& device, AudioStreamer& streamer) :
 	SoundEmitter(device),
+	m_streamer(streamer),
 	m_streaming(false),
 	m_bufferCount(2),
+	m_isStreamRegistered(false),
 	m_looping(false)
 	{
 	}
@@ -79,7 +86,7 @@ namespace Nz
 	*/
 	void Music::Destroy()
 	{
-		StopThread();
+		StopStreaming();
 	}
 
 	/*!
@@ -133,7 +140,7 @@ namespace Nz
 		if (!m_streaming)
 			return Time::Zero();
 
-		// Prevent music thread from enqueuing new buffers while we're getting the count
+		// Prevent streaming thread from enqueuing new buffers while we're getting the count
 		std::lock_guard<std::recursive_mutex> lock(m_sourceLock);
 
 		Time playingOffset = m_source->GetPlayingOffset();
@@ -176,7 +183,7 @@ namespace Nz
 		if (!m_streaming)
 			return 0;
 
-		// Prevent music thread from enqueuing new buffers while we're getting the count
+		// Prevent streaming thread from enqueuing new buffers while we're getting the count
 		std::lock_guard<std::recursive_mutex> lock(m_sourceLock);
 
 		UInt64 sampleOffset = m_processedSamples + m_source->GetSampleOffset();
@@ -318,8 +325,7 @@ namespace Nz
 		// Maybe we are already playing
 		if (m_streaming)
 		{
-			std::lock_guard<std::recursive_mutex> lock(m_sourceLock);
-
+			// Don't hold the source lock while seeking, as it waits for the streaming thread
 			switch (GetStatus())
 			{
 				case SoundStatus::Playing:
@@ -327,8 +333,11 @@ namespace Nz
 					break;
 
 				case SoundStatus::Paused:
+				{
+					std::lock_guard<std::recursive_mutex> lock(m_sourceLock);
 					m_source->Play();
 					break;
+				}
 
 				default:
 					break; // We shouldn't be stopped
@@ -337,13 +346,13 @@ namespace Nz
 		else
 		{
 			// Ensure we're restarting
-			StopThread();
+			StopStreaming();
 
 			// Special case of SetPlayingOffset(end) before Play(), restart from beginning
 			if (m_streamOffset >= m_stream->GetSampleCount())
 				m_streamOffset = 0;
 
-			StartThread(false);
+			StartStreaming(false);
 		}
 	}
 
@@ -364,7 +373,7 @@ namespace Nz
 		bool isPaused = GetStatus() == SoundStatus::Paused;
 
 		if (isPlaying)
-			StopThread();
+			StopStreaming();
 
 		UInt64 sampleOffset = offset * GetChannelCount(m_stream->GetFormat());
 
@@ -372,7 +381,7 @@ namespace Nz
 		m_streamOffset = sampleOffset;
 
 		if (isPlaying)
-			StartThread(isPaused);
+			StartStreaming(isPaused);
 	}
 
 	/*!
@@ -382,7 +391,7 @@ namespace Nz
 	*/
 	void Music::Stop()
 	{
-		StopThread();
+		StopStreaming();
 		SeekToSampleOffset(0);
 	}
 
@@ -423,18 +432,17 @@ namespace Nz
 		return sampleRead != sampleCount; // End of stream (Does not happen when looping)
 	}
 
-	void Music::MusicThread(std::condition_variable& cv, std::mutex& m, std::exception_ptr& err, bool startPaused)
+	void Music::StartStreaming(bool startPaused)
 	{
-		std::optional<std::lock_guard<std::recursive_mutex>> exitLock;
-
-		// Allocation of streaming buffers
-		CallOnExit unqueueBuffers([&]
 		{
-			m_source->UnqueueAllBuffers();
-		});
+			std::lock_guard<std::recursive_mutex> lock(m_sourceLock);
+
+			// Fill the first buffers from the calling thread, so errors are reported to it
+			CallOnExit unqueueBuffers([&]
+			{
+				m_source->UnqueueAllBuffers();
+			});
 
-		try
-		{
 			for (std::size_t i = 0; i < m_bufferCount; ++i)
 			{
 				std::shared_ptr<AudioBuffer> buffer = m_source->GetAudioDevice()->CreateBuffer();
@@ -442,95 +450,72 @@ namespace Nz
 				if (FillAndQueueBuffer(std::move(buffer)))
 					break; // We have reached the end of the stream, there is no use to add new buffers
 			}
-		}
-		catch (const std::exception&)
-		{
-			err = std::current_exception();
 
-			std::unique_lock<std::mutex> lock(m);
-			cv.notify_all();
-			return;
-		}
+			unqueueBuffers.Reset();
 
-		m_source->Play();
-		if (startPaused)
-		{
-			// little hack to start paused (required by SetPlayingOffset)
-			m_source->Pause();
-			m_source->SetSampleOffset(0);
-		}
+			m_source->Play();
+			if (startPaused)
+			{
+				// little hack to start paused (required by SetPlayingOffset)
+				m_source->Pause();
+				m_source->SetSampleOffset(0);
+			}
 
-		CallOnExit stopSource([&]
-		{
-			// Stop playing of the sound (in the case where it has not been already done)
-			m_source->Stop();
-		});
+			m_streaming = true;
+		}
 
-		// Signal we're good
-		{
-			std::unique_lock<std::mutex> lock(m);
-			cv.notify_all();
-		} // m & cv no longer exists from here
+		m_streamId = m_streamer.RegisterStream([this] { return UpdateStream(); });
+		m_isStreamRegistered = true;
+	}
 
-		// From now, the source can be accessed from another thread, lock it before others destructors
-		CallOnExit lockSource([&]
-		{
-			exitLock.emplace(m_sourceLock);
-		});
+	void Music::StopStreaming()
+	{
+		m_streaming = false;
 
-		// Reading loop (Filling new buffers as playing)
-		while (m_streaming)
+		if (m_isStreamRegistered)
 		{
-			// Wait until buffers are processed
-			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			// Must not be called with the source lock held, as the streaming thread may be waiting for it
+			m_streamer.UnregisterStream(m_streamId);
+			m_isStreamRegistered = false;
 
 			std::lock_guard<std::recursive_mutex> lock(m_sourceLock);
 
-			SoundStatus status = m_source->GetStatus();
-			if (status == SoundStatus::Stopped)
-			{
-				// The reading has stopped, we have reached the end of the stream
-				m_streaming = false;
-				break;
-			}
-
-			// We treat read buffers
-			while (std::shared_ptr<AudioBuffer> buffer = m_source->TryUnqueueProcessedBuffer())
-			{
-				m_processedSamples += buffer->GetSampleCount();
-
-				if (FillAndQueueBuffer(std::move(buffer)))
-					break;
-			}
+			// Stop playing of the sound (in the case where it has not been already done)
+			m_source->Stop();
+			m_source->UnqueueAllBuffers();
 		}
 	}
 
-	void Music::StartThread(bool startPaused)
+	bool Music::UpdateStream()
 	{
-		std::mutex mutex;
-		std::condition_variable cv;
+		// Don't stall the other streams of the streaming thread while the music is being accessed
+		std::unique_lock<std::recursive_mutex> lock(m_sourceLock, std::try_to_lock);
+		if (!lock.owns_lock())
+			return m_streaming;
 
-		// Starting streaming thread
-		m_streaming = true;
-
-		std::exception_ptr exceptionPtr;
+		if (!m_streaming)
+			return false;
 
-		std::unique_lock<std::mutex> lock(mutex);
-		m_thread = std::thread(&Music::MusicThread, this, std::ref(cv), std::ref(mutex), std::ref(exceptionPtr), startPaused);
+		SoundStatus status = m_source->GetStatus();
+		if (status == SoundStatus::Stopped)
+		{
+			// The reading has stopped, we have reached the end of the stream
+			m_streaming = false;
 
-		// Wait until thread signal it has properly started (or an error occurred)
-		cv.wait(lock);
+			m_source->Stop();
+			m_source->UnqueueAllBuffers();
+			return false;
+		}
 
-		if (exceptionPtr)
-			std::rethrow_exception(exceptionPtr);
-	}
+		// We treat read buffers
+		while (std::shared_ptr<AudioBuffer> buffer = m_source->TryUnqueueProcessedBuffer())
+		{
+			m_processedSamples += buffer->GetSampleCount();
 
-	void Music::StopThread()
-	{
-		if (m_streaming)
-			m_streaming = false;
+			if (FillAndQueueBuffer(std::move(buffer)))
+				break;
+		}
 
-		if (m_thread.joinable())
-			m_thread.join();
+		return true;
 	}
 }
@@ -0,0 +1,118 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/SoftwareAudioBuffer.hpp>
+#include <Nazara/Audio/Algorithm.hpp>
+#include <Nazara/Audio/AudioDevice.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+	Time SoftwareAudioBuffer::GetDuration() const
+	{
+		if (m_sampleRate == 0)
+			return Time::Zero();
+
+		return Time::Microseconds(SafeCast<Int64>(1'000'000ULL * m_frameCount / m_sampleRate));
+	}
+
+	UInt64 SoftwareAudioBuffer::GetSampleCount() const
+	{
+		// Original sample count (all channels), as the source data
+		return m_sampleCount;
+	}
+
+	UInt64 SoftwareAudioBuffer::GetSize() const
+	{
+		return m_samples.size() * sizeof(float);
+	}
+
+	UInt32 SoftwareAudioBuffer::GetSampleRate() const
+	{
+		return m_sampleRate;
+	}
+
+	bool SoftwareAudioBuffer::IsCompatibleWith(const AudioDevice& device) const
+	{
+		return GetAudioDevice()->GetSubSystemIdentifier() == device.GetSubSystemIdentifier();
+	}
+
+	bool SoftwareAudioBuffer::Reset(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, const void* samples)
+	{
+		UInt32 channelCount = Nz::GetChannelCount(format);
+		if (channelCount == 0)
+		{
+			NazaraError("invalid audio format");
+			return false;
+		}
+
+		if (sampleRate == 0)
+		{
+			NazaraError("invalid sample rate");
+			return false;
+		}
+
+		constexpr float normalizationFactor = 1.f / 32768.f;
+
+		UInt64 frameCount = sampleCount / channelCount;
+		const Int16* input = static_cast<const Int16*>(samples);
+
+		// Samples are converted once to normalized floats, the mixer only handles mono and stereo
+		if (channelCount <= 2)
+		{
+			m_samples.resize(SafeCast<std::size_t>(frameCount * channelCount));
+			if (input)
+			{
+				for (std::size_t i = 0; i < m_samples.size(); ++i)
+					m_samples[i] = input[i] * normalizationFactor;
+			}
+			else
+				std::fill(m_samples.begin(), m_samples.end(), 0.f);
+
+			m_channelCount = channelCount;
+		}
+		else
+		{
+			// Fold surround channels to stereo: even channels to the left, odd channels to the right
+			m_samples.resize(SafeCast<std::size_t>(frameCount * 2));
+			if (input)
+			{
+				UInt32 leftChannelCount = (channelCount + 1) / 2;
+				UInt32 rightChannelCount = channelCount / 2;
+				float leftFactor = normalizationFactor / leftChannelCount;
+				float rightFactor = normalizationFactor / rightChannelCount;
+
+				for (UInt64 frame = 0; frame < frameCount; ++frame)
+				{
+					const Int16* frameInput = &input[frame * channelCount];
+
+					Int32 left = 0;
+					Int32 right = 0;
+					for (UInt32 channel = 0; channel < channelCount; channel += 2)
+						left += frameInput[channel];
+
+					for (UInt32 channel = 1; channel < channelCount; channel += 2)
+						right += frameInput[channel];
+
+					m_samples[frame * 2 + 0] = left * leftFactor;
+					m_samples[frame * 2 + 1] = right * rightFactor;
+				}
+			}
+			else
+				std::fill(m_samples.begin(), m_samples.end(), 0.f);
+
+			m_channelCount = 2;
+		}
+
+		m_format = format;
+		m_frameCount = frameCount;
+		m_sampleCount = sampleCount;
+		m_sampleRate = sampleRate;
+
+		return true;
+	}
+}
@@ -0,0 +1,545 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/SoftwareAudioDevice.hpp>
+#include <Nazara/Audio/SoftwareAudioBuffer.hpp>
+#include <Nazara/Audio/SoftwareAudioSource.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NAZARA_AUDIO_SOFTWAREAUDIODEVICE_SSE2
+	#include <emmintrin.h>
+#endif
+
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr float MaxPitch = 255.f;
+
+		// Adds gain-scaled interleaved stereo samples to the output
+		void MixStereo(float* output, const float* input, std::size_t sampleCount, float leftGain, float rightGain)
+		{
+			std::size_t i = 0;
+
+#ifdef NAZARA_AUDIO_SOFTWAREAUDIODEVICE_SSE2
+			__m128 gains = _mm_setr_ps(leftGain, rightGain, leftGain, rightGain);
+			for (; i + 4 <= sampleCount; i += 4)
+			{
+				__m128 samples = _mm_mul_ps(_mm_loadu_ps(&input[i]), gains);
+				_mm_storeu_ps(&output[i], _mm_add_ps(_mm_loadu_ps(&output[i]), samples));
+			}
+#endif
+
+			// i is always even here
+			for (; i < sampleCount; i += 2)
+			{
+				output[i + 0] += input[i + 0] * leftGain;
+				output[i + 1] += input[i + 1] * rightGain;
+			}
+		}
+
+		// Linearly interpolates frames of a mono or stereo buffer to interleaved stereo, every read frame must have a next frame in the buffer
+		void Resample(float* output, const float* samples, UInt32 channelCount, double offset, double step, UInt32 frameCount)
+		{
+			UInt32 i = 0;
+
+#ifdef NAZARA_AUDIO_SOFTWAREAUDIODEVICE_SSE2
+			// Positions are computed in double precision as buffers can be long, SSE2 has no gather so frames are loaded
+			// one by one but interpolation and interleaving are done for several frames at once
+			if (channelCount == 2)
+			{
+				for (; i + 2 <= frameCount; i += 2)
+				{
+					double firstPosition = offset + i * step;
+					double secondPosition = offset + (i + 1) * step;
+					std::size_t firstFrame = static_cast<std::size_t>(firstPosition);
+					std::size_t secondFrame = static_cast<std::size_t>(secondPosition);
+					float firstFactor = static_cast<float>(firstPosition - firstFrame);
+					float secondFactor = static_cast<float>(secondPosition - secondFrame);
+
+					const float* first = &samples[firstFrame * 2];
+					const float* second = &samples[secondFrame * 2];
+
+					__m128 current = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&first[0])), reinterpret_cast<const __m64*>(&second[0]));
+					__m128 next = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&first[2])), reinterpret_cast<const __m64*>(&second[2]));
+					__m128 factor = _mm_setr_ps(firstFactor, firstFactor, secondFactor, secondFactor);
+
+					_mm_storeu_ps(&output[i * 2], _mm_add_ps(current, _mm_mul_ps(_mm_sub_ps(next, current), factor)));
+				}
+			}
+			else
+			{
+				for (; i + 4 <= frameCount; i += 4)
+				{
+					alignas(16) float currents[4];
+					alignas(16) float nexts[4];
+					alignas(16) float factors[4];
+					for (UInt32 j = 0; j < 4; ++j)
+					{
+						double position = offset + (i + j) * step;
+						std::size_t frame = static_cast<std::size_t>(position);
+
+						currents[j] = samples[frame];
+						nexts[j] = samples[frame + 1];
+						factors[j] = static_cast<float>(position - frame);
+					}
+
+					__m128 current = _mm_load_ps(currents);
+					__m128 next = _mm_load_ps(nexts);
+					__m128 frames = _mm_add_ps(current, _mm_mul_ps(_mm_sub_ps(next, current), _mm_load_ps(factors)));
+
+					// Duplicate mono frames on both channels
+					_mm_storeu_ps(&output[i * 2 + 0], _mm_unpacklo_ps(frames, frames));
+					_mm_storeu_ps(&output[i * 2 + 4], _mm_unpackhi_ps(frames, frames));
+				}
+			}
+#endif
+
+			for (; i < frameCount; ++i)
+			{
+				double position = offset + i * step;
+				std::size_t frame = static_cast<std::size_t>(position);
+				float factor = static_cast<float>(position - frame);
+
+				for (UInt32 channel = 0; channel < 2; ++channel)
+				{
+					UInt32 inputChannel = (channelCount == 2) ? channel : 0;
+					float current = samples[frame * channelCount + inputChannel];
+					float next = samples[(frame + 1) * channelCount + inputChannel];
+
+					output[i * 2 + channel] = current + (next - current) * factor;
+				}
+			}
+		}
+	}
+
+	/*!
+	* \ingroup audio
+	* \class Nz::SoftwareAudioDevice
+	* \brief Audio class for a device mixing its sources on the CPU
+	*
+	* The device doesn't output anything by itself, the mix is rendered by calling Render (for offline rendering or to feed a platform audio output).
+	* Sources are prioritized by audibility, only the loudest ones are mixed while the others keep advancing silently.
+	*/
+
+	/*!
+	* \brief Constructs a SoftwareAudioDevice
+	*
+	* \param sampleRate Sample rate of the rendered output, sources are resampled to it
+	* \param maxVoiceCount Maximum number of sources mixed at once
+	*/
+	SoftwareAudioDevice::SoftwareAudioDevice(UInt32 sampleRate, std::size_t maxVoiceCount) :
+	m_maxVoiceCount(maxVoiceCount),
+	m_mixedVoiceCount(0),
+	m_listenerRotation(Quaternionf::Identity()),
+	m_listenerVelocity(Vector3f::Zero()),
+	m_listenerPosition(Vector3f::Zero()),
+	m_sampleRate(sampleRate),
+	m_dopplerFactor(1.f),
+	m_globalVolume(1.f),
+	m_speedOfSound(343.3f)
+	{
+		NazaraAssert(sampleRate > 0, "invalid sample rate");
+	}
+
+	std::shared_ptr<AudioBuffer> SoftwareAudioDevice::CreateBuffer()
+	{
+		return std::make_shared<SoftwareAudioBuffer>(shared_from_this());
+	}
+
+	std::shared_ptr<AudioSource> SoftwareAudioDevice::CreateSource()
+	{
+		return std::make_shared<SoftwareAudioSource>(std::static_pointer_cast<SoftwareAudioDevice>(shared_from_this()));
+	}
+
+	float SoftwareAudioDevice::GetDopplerFactor() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_dopplerFactor;
+	}
+
+	float SoftwareAudioDevice::GetGlobalVolume() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_globalVolume;
+	}
+
+	Vector3f SoftwareAudioDevice::GetListenerDirection(Vector3f* up) const
+	{
+		std::lock_guard lock(m_mutex);
+
+		if (up)
+			*up = m_listenerRotation * Vector3f::Up();
+
+		return m_listenerRotation * Vector3f::Forward();
+	}
+
+	Vector3f SoftwareAudioDevice::GetListenerPosition() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_listenerPosition;
+	}
+
+	Quaternionf SoftwareAudioDevice::GetListenerRotation() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_listenerRotation;
+	}
+
+	Vector3f SoftwareAudioDevice::GetListenerVelocity() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_listenerVelocity;
+	}
+
+	std::size_t SoftwareAudioDevice::GetMaxVoiceCount() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_maxVoiceCount;
+	}
+
+	/*!
+	* \brief Returns the number of sources which were mixed during the last Render call
+	*/
+	std::size_t SoftwareAudioDevice::GetMixedVoiceCount() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_mixedVoiceCount;
+	}
+
+	float SoftwareAudioDevice::GetSpeedOfSound() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_speedOfSound;
+	}
+
+	const void* SoftwareAudioDevice::GetSubSystemIdentifier() const
+	{
+		return this;
+	}
+
+	bool SoftwareAudioDevice::IsFormatSupported(AudioFormat format) const
+	{
+		// Surround formats are folded to stereo
+		return format != AudioFormat::Unknown;
+	}
+
+	/*!
+	* \brief Mixes every playing source and advances them
+	*
+	* \param output Interleaved stereo output, must be able to hold frameCount * 2 samples
+	* \param frameCount Number of frames to render
+	*/
+	void SoftwareAudioDevice::Render(float* output, UInt32 frameCount)
+	{
+		NazaraAssert(output || frameCount == 0, "invalid output");
+
+		std::lock_guard lock(m_mutex);
+		RenderInternal(output, frameCount);
+	}
+
+	/*!
+	* \brief Mixes every playing source and advances them, converting the mix to 16 bits samples
+	*
+	* \param output Interleaved stereo output, must be able to hold frameCount * 2 samples
+	* \param frameCount Number of frames to render
+	*/
+	void SoftwareAudioDevice::Render(Int16* output, UInt32 frameCount)
+	{
+		NazaraAssert(output || frameCount == 0, "invalid output");
+
+		std::lock_guard lock(m_mutex);
+
+		std::size_t sampleCount = std::size_t(frameCount) * 2;
+		m_floatBuffer.resize(sampleCount);
+		RenderInternal(m_floatBuffer.data(), frameCount);
+
+		const float* input = m_floatBuffer.data();
+		std::size_t i = 0;
+
+#ifdef NAZARA_AUDIO_SOFTWAREAUDIODEVICE_SSE2
+		__m128 minValue = _mm_set1_ps(-1.f);
+		__m128 maxValue = _mm_set1_ps(1.f);
+		__m128 scale = _mm_set1_ps(32767.f);
+		for (; i + 8 <= sampleCount; i += 8)
+		{
+			__m128 firstSamples = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&input[i]), minValue), maxValue);
+			__m128 secondSamples = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&input[i + 4]), minValue), maxValue);
+
+			__m128i first = _mm_cvtps_epi32(_mm_mul_ps(firstSamples, scale));
+			__m128i second = _mm_cvtps_epi32(_mm_mul_ps(secondSamples, scale));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&output[i]), _mm_packs_epi32(first, second));
+		}
+#endif
+
+		// lrint rounds using the current rounding mode (to nearest even by default), like _mm_cvtps_epi32
+		for (; i < sampleCount; ++i)
+			output[i] = static_cast<Int16>(std::lrint(std::clamp(input[i], -1.f, 1.f) * 32767.f));
+	}
+
+	void SoftwareAudioDevice::SetDopplerFactor(float dopplerFactor)
+	{
+		std::lock_guard lock(m_mutex);
+		m_dopplerFactor = dopplerFactor;
+	}
+
+	void SoftwareAudioDevice::SetGlobalVolume(float volume)
+	{
+		std::lock_guard lock(m_mutex);
+		m_globalVolume = volume;
+	}
+
+	void SoftwareAudioDevice::SetListenerDirection(const Vector3f& direction, const Vector3f& up)
+	{
+		std::lock_guard lock(m_mutex);
+		m_listenerRotation = Quaternionf::LookAt(direction, up);
+	}
+
+	void SoftwareAudioDevice::SetListenerPosition(const Vector3f& position)
+	{
+		std::lock_guard lock(m_mutex);
+		m_listenerPosition = position;
+	}
+
+	void SoftwareAudioDevice::SetListenerVelocity(const Vector3f& velocity)
+	{
+		std::lock_guard lock(m_mutex);
+		m_listenerVelocity = velocity;
+	}
+
+	void SoftwareAudioDevice::SetMaxVoiceCount(std::size_t maxVoiceCount)
+	{
+		std::lock_guard lock(m_mutex);
+		m_maxVoiceCount = maxVoiceCount;
+	}
+
+	void SoftwareAudioDevice::SetSpeedOfSound(float speed)
+	{
+		std::lock_guard lock(m_mutex);
+		m_speedOfSound = speed;
+	}
+
+	void SoftwareAudioDevice::ComputeVoice(SoftwareAudioSource& source, Voice& voice) const
+	{
+		float gain = source.m_volume * m_globalVolume;
+		float pitch = source.m_pitch;
+
+		// Non-spatialized sources are positioned relatively to the listener (like OpenAL relative sources)
+		Vector3f listenerToSource = (source.m_isSpatialized) ? source.m_position - m_listenerPosition : source.m_position;
+		float distance = listenerToSource.GetLength();
+
+		// Inverse distance clamped attenuation model (OpenAL default)
+		float minDistance = std::max(source.m_minDistance, std::numeric_limits<float>::epsilon());
+		gain *= minDistance / (minDistance + source.m_attenuation * (std::max(distance, minDistance) - minDistance));
+
+		float pan = 0.f;
+		if (distance > std::numeric_limits<float>::epsilon())
+		{
+			Vector3f localDirection = (source.m_isSpatialized) ? m_listenerRotation.GetConjugate() * listenerToSource : listenerToSource;
+			pan = std::clamp(localDirection.x / distance, -1.f, 1.f);
+
+			if (source.m_isSpatialized && m_dopplerFactor > 0.f)
+			{
+				// Velocities projected on the source to listener axis (positive when moving toward the listener), like OpenAL Soft
+				float listenerVelocity = -m_dopplerFactor * m_listenerVelocity.DotProduct(listenerToSource) / distance;
+				float sourceVelocity = -m_dopplerFactor * source.m_velocity.DotProduct(listenerToSource) / distance;
+
+				if (listenerVelocity >= m_speedOfSound)
+					pitch = 0.f; //< listener moves away faster than sound, it can't be reached
+				else if (sourceVelocity >= m_speedOfSound)
+					pitch *= MaxPitch; //< source moves toward the listener faster than sound
+				else
+					pitch *= std::min((m_speedOfSound - listenerVelocity) / (m_speedOfSound - sourceVelocity), MaxPitch);
+			}
+		}
+
+		const auto& queuedBuffers = source.m_queuedBuffers;
+		bool isMono = !queuedBuffers.empty() && queuedBuffers.front()->GetChannelCount() == 1;
+
+		// Stereo buffers are not spatialized, like OpenAL
+		if (isMono)
+		{
+			voice.leftGain = gain * std::min(1.f, 1.f - pan);
+			voice.rightGain = gain * std::min(1.f, 1.f + pan);
+		}
+		else
+		{
+			voice.leftGain = gain;
+			voice.rightGain = gain;
+		}
+
+		UInt32 bufferSampleRate = (!queuedBuffers.empty()) ? queuedBuffers.front()->GetSampleRate() : m_sampleRate;
+		voice.step = double(pitch) * bufferSampleRate / m_sampleRate;
+	}
+
+	void SoftwareAudioDevice::RegisterSource(SoftwareAudioSource* source)
+	{
+		std::lock_guard lock(m_mutex);
+		m_sources.push_back(source);
+	}
+
+	void SoftwareAudioDevice::RenderInternal(float* output, UInt32 frameCount)
+	{
+		std::fill(output, output + std::size_t(frameCount) * 2, 0.f);
+
+		m_voices.clear();
+		for (SoftwareAudioSource* source : m_sources)
+		{
+			if (source->m_status != SoundStatus::Playing)
+				continue;
+
+			Voice& voice = m_voices.emplace_back();
+			voice.source = source;
+			ComputeVoice(*source, voice);
+		}
+
+		// Only mix the most audible voices, the others are virtual
+		m_mixedVoiceCount = std::min(m_voices.size(), m_maxVoiceCount);
+		if (m_mixedVoiceCount < m_voices.size())
+		{
+			std::nth_element(m_voices.begin(), m_voices.begin() + m_mixedVoiceCount, m_voices.end(), [](const Voice& lhs, const Voice& rhs)
+			{
+				return std::max(lhs.leftGain, lhs.rightGain) > std::max(rhs.leftGain, rhs.rightGain);
+			});
+		}
+
+		for (std::size_t i = 0; i < m_voices.size(); ++i)
+			RenderVoice(m_voices[i], output, frameCount, i < m_mixedVoiceCount);
+	}
+
+	void SoftwareAudioDevice::RenderVoice(const Voice& voice, float* output, UInt32 frameCount, bool mix)
+	{
+		SoftwareAudioSource& source = *voice.source;
+		if (voice.step <= 0.0)
+			return;
+
+		bool hasProgressed = true;
+		UInt32 frameIndex = 0;
+		for (;;)
+		{
+			if (source.m_queuedBuffers.empty())
+			{
+				// Loop over every buffer, unless none of them has any frame
+				if (source.m_isLooping && !source.m_processedBuffers.empty() && hasProgressed)
+				{
+					source.RequeueBuffers();
+					hasProgressed = false;
+					continue;
+				}
+
+				// Buffers are left in the processed queue so they can be unqueued, like OpenAL
+				source.m_frameOffset = 0.0;
+				source.m_status = SoundStatus::Stopped;
+				break;
+			}
+
+			const SoftwareAudioBuffer& buffer = *source.m_queuedBuffers.front();
+			UInt64 bufferFrameCount = buffer.GetFrameCount();
+			if (source.m_frameOffset >= bufferFrameCount)
+			{
+				source.m_frameOffset -= bufferFrameCount;
+				source.m_processedBuffers.push_back(std::move(source.m_queuedBuffers.front()));
+				source.m_queuedBuffers.erase(source.m_queuedBuffers.begin());
+				continue;
+			}
+
+			// Checked last so a source reaching its end exactly with the output is stopped right away
+			if (frameIndex >= frameCount)
+				break;
+
+			// Number of output frames before reaching the end of this buffer
+			double remainingFrames = std::ceil((bufferFrameCount - source.m_frameOffset) / voice.step);
+			UInt32 renderedFrameCount = static_cast<UInt32>(std::clamp(remainingFrames, 1.0, double(frameCount - frameIndex)));
+
+			if (mix)
+			{
+				std::size_t sampleCount = std::size_t(renderedFrameCount) * 2;
+				m_resampleBuffer.resize(sampleCount);
+
+				const float* samples = buffer.GetSamples();
+				UInt32 channelCount = buffer.GetChannelCount();
+				UInt64 lastFrame = bufferFrameCount - 1;
+
+				double integralOffset;
+				if (voice.step == 1.0 && std::modf(source.m_frameOffset, &integralOffset) == 0.0)
+				{
+					// Same rate and no pitch, no need to interpolate
+					const float* input = &samples[static_cast<std::size_t>(integralOffset) * channelCount];
+					if (channelCount == 2)
+						std::memcpy(m_resampleBuffer.data(), input, sampleCount * sizeof(float));
+					else
+					{
+						for (UInt32 i = 0; i < renderedFrameCount; ++i)
+						{
+							m_resampleBuffer[i * 2 + 0] = input[i];
+							m_resampleBuffer[i * 2 + 1] = input[i];
+						}
+					}
+				}
+				else
+				{
+					// Frames read before the last one of the buffer are interpolated with the next frame of the buffer
+					UInt32 innerFrameCount = static_cast<UInt32>(std::clamp(std::ceil((lastFrame - source.m_frameOffset) / voice.step), 0.0, double(renderedFrameCount)));
+					while (innerFrameCount > 0 && source.m_frameOffset + (innerFrameCount - 1) * voice.step >= lastFrame)
+						innerFrameCount--;
+
+					while (innerFrameCount < renderedFrameCount && source.m_frameOffset + innerFrameCount * voice.step < lastFrame)
+						innerFrameCount++;
+
+					Resample(m_resampleBuffer.data(), samples, channelCount, source.m_frameOffset, voice.step, innerFrameCount);
+
+					// The last frame is interpolated with the first frame of the buffer played after this one, if any
+					const SoftwareAudioBuffer* nextBuffer = nullptr;
+					if (source.m_queuedBuffers.size() > 1)
+						nextBuffer = source.m_queuedBuffers[1].get();
+					else if (source.m_isLooping)
+						nextBuffer = (!source.m_processedBuffers.empty()) ? source.m_processedBuffers.front().get() : &buffer;
+
+					if (nextBuffer && nextBuffer->GetFrameCount() == 0)
+						nextBuffer = nullptr;
+
+					for (UInt32 i = innerFrameCount; i < renderedFrameCount; ++i)
+					{
+						double position = source.m_frameOffset + i * voice.step;
+						float factor = static_cast<float>(position - lastFrame);
+
+						for (UInt32 channel = 0; channel < 2; ++channel)
+						{
+							UInt32 inputChannel = (channelCount == 2) ? channel : 0;
+							float current = samples[lastFrame * channelCount + inputChannel];
+							float next = current;
+							if (nextBuffer)
+								next = nextBuffer->GetSamples()[(nextBuffer->GetChannelCount() == 2) ? channel : 0];
+
+							m_resampleBuffer[i * 2 + channel] = current + (next - current) * factor;
+						}
+					}
+				}
+
+				MixStereo(&output[std::size_t(frameIndex) * 2], m_resampleBuffer.data(), sampleCount, voice.leftGain, voice.rightGain);
+			}
+
+			source.m_frameOffset += renderedFrameCount * voice.step;
+			frameIndex += renderedFrameCount;
+			hasProgressed = true;
+		}
+	}
+
+	void SoftwareAudioDevice::UnregisterSource(SoftwareAudioSource* source)
+	{
+		std::lock_guard lock(m_mutex);
+
+		auto it = std::find(m_sources.begin(), m_sources.end(), source);
+		NazaraAssert(it != m_sources.end(), "source is not registered");
+
+		m_sources.erase(it);
+	}
+}
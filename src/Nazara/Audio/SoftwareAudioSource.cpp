@@ -0,0 +1,326 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/SoftwareAudioSource.hpp>
+#include <Nazara/Audio/SoftwareAudioBuffer.hpp>
+#include <Nazara/Audio/SoftwareAudioDevice.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+	SoftwareAudioSource::SoftwareAudioSource(std::shared_ptr<SoftwareAudioDevice> device) :
+	AudioSource(std::move(device)),
+	m_status(SoundStatus::Stopped),
+	m_position(Vector3f::Zero()),
+	m_velocity(Vector3f::Zero()),
+	m_isLooping(false),
+	m_isSpatialized(true),
+	m_frameOffset(0.0),
+	m_attenuation(1.f),
+	m_minDistance(1.f),
+	m_pitch(1.f),
+	m_volume(1.f)
+	{
+		GetDevice().RegisterSource(this);
+	}
+
+	SoftwareAudioSource::~SoftwareAudioSource()
+	{
+		GetDevice().UnregisterSource(this);
+	}
+
+	void SoftwareAudioSource::EnableLooping(bool loop)
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		m_isLooping = loop;
+	}
+
+	void SoftwareAudioSource::EnableSpatialization(bool spatialization)
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		m_isSpatialized = spatialization;
+	}
+
+	float SoftwareAudioSource::GetAttenuation() const
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		return m_attenuation;
+	}
+
+	float SoftwareAudioSource::GetMinDistance() const
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		return m_minDistance;
+	}
+
+	float SoftwareAudioSource::GetPitch() const
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		return m_pitch;
+	}
+
+	Time SoftwareAudioSource::GetPlayingOffset() const
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+
+		if (m_status == SoundStatus::Stopped)
+			return Time::Zero(); //< Always return 0 when stopped, to mimic OpenAL behavior
+
+		Time playingOffset = Time::Zero();
+		for (const auto& processedBuffer : m_processedBuffers)
+			playingOffset += processedBuffer->GetDuration();
+
+		if (!m_queuedBuffers.empty())
+			playingOffset += Time::Microseconds(static_cast<Int64>(m_frameOffset * 1'000'000.0 / m_queuedBuffers.front()->GetSampleRate()));
+
+		return playingOffset;
+	}
+
+	Vector3f SoftwareAudioSource::GetPosition() const
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		return m_position;
+	}
+
+	UInt32 SoftwareAudioSource::GetSampleOffset() const
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		return GetSampleOffsetInternal();
+	}
+
+	auto SoftwareAudioSource::GetSampleOffsetAndLatency() const -> OffsetWithLatency
+	{
+		OffsetWithLatency info;
+		info.sampleOffset = GetSampleOffset() * 1000;
+		info.sourceLatency = Time::Zero(); //< samples are consumed as soon as they are rendered
+
+		return info;
+	}
+
+	Vector3f SoftwareAudioSource::GetVelocity() const
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		return m_velocity;
+	}
+
+	SoundStatus SoftwareAudioSource::GetStatus() const
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		return m_status;
+	}
+
+	float SoftwareAudioSource::GetVolume() const
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		return m_volume;
+	}
+
+	bool SoftwareAudioSource::IsLooping() const
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		return m_isLooping;
+	}
+
+	bool SoftwareAudioSource::IsSpatializationEnabled() const
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		return m_isSpatialized;
+	}
+
+	void SoftwareAudioSource::QueueBuffer(std::shared_ptr<AudioBuffer> audioBuffer)
+	{
+		NazaraAssert(audioBuffer, "invalid buffer");
+		NazaraAssert(audioBuffer->IsCompatibleWith(*GetAudioDevice()), "incompatible buffer");
+
+		std::lock_guard lock(GetDevice().m_mutex);
+		m_queuedBuffers.emplace_back(std::static_pointer_cast<SoftwareAudioBuffer>(audioBuffer));
+	}
+
+	void SoftwareAudioSource::Pause()
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		m_status = SoundStatus::Paused;
+	}
+
+	void SoftwareAudioSource::Play()
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+
+		if (m_status == SoundStatus::Playing)
+		{
+			// Already playing, restart from beginning
+			RequeueBuffers();
+			m_frameOffset = 0.0;
+		}
+		else if (m_status == SoundStatus::Stopped && m_queuedBuffers.empty())
+		{
+			// Source reached its end, replay it (when stopped by the user, the offset was already reset or set by SetSampleOffset)
+			RequeueBuffers();
+			m_frameOffset = 0.0;
+		}
+
+		m_status = SoundStatus::Playing;
+	}
+
+	void SoftwareAudioSource::SetAttenuation(float attenuation)
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		m_attenuation = attenuation;
+	}
+
+	void SoftwareAudioSource::SetBuffer(std::shared_ptr<AudioBuffer> audioBuffer)
+	{
+		NazaraAssert(audioBuffer->IsCompatibleWith(*GetAudioDevice()), "incompatible buffer");
+
+		std::lock_guard lock(GetDevice().m_mutex);
+
+		m_queuedBuffers.clear();
+		m_queuedBuffers.emplace_back(std::static_pointer_cast<SoftwareAudioBuffer>(audioBuffer));
+		m_processedBuffers.clear();
+		m_frameOffset = 0.0;
+	}
+
+	void SoftwareAudioSource::SetMinDistance(float minDistance)
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		m_minDistance = minDistance;
+	}
+
+	void SoftwareAudioSource::SetPitch(float pitch)
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		m_pitch = pitch;
+	}
+
+	void SoftwareAudioSource::SetPlayingOffset(Time offset)
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+
+		RequeueBuffers();
+		if (m_queuedBuffers.empty())
+			return;
+
+		UInt64 sampleOffset = offset.AsMicroseconds() * m_queuedBuffers.front()->GetSampleRate() / 1'000'000ll;
+		SetSampleOffsetInternal(SafeCast<UInt32>(sampleOffset));
+	}
+
+	void SoftwareAudioSource::SetPosition(const Vector3f& position)
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		m_position = position;
+	}
+
+	void SoftwareAudioSource::SetSampleOffset(UInt32 offset)
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		SetSampleOffsetInternal(offset);
+	}
+
+	void SoftwareAudioSource::SetVelocity(const Vector3f& velocity)
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		m_velocity = velocity;
+	}
+
+	void SoftwareAudioSource::SetVolume(float volume)
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		m_volume = volume;
+	}
+
+	void SoftwareAudioSource::Stop()
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+		StopInternal();
+	}
+
+	std::shared_ptr<AudioBuffer> SoftwareAudioSource::TryUnqueueProcessedBuffer()
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+
+		if (m_processedBuffers.empty())
+			return {};
+
+		auto processedBuffer = std::move(m_processedBuffers.front());
+		m_processedBuffers.erase(m_processedBuffers.begin());
+
+		return processedBuffer;
+	}
+
+	void SoftwareAudioSource::UnqueueAllBuffers()
+	{
+		std::lock_guard lock(GetDevice().m_mutex);
+
+		m_processedBuffers.clear();
+		m_queuedBuffers.clear();
+		StopInternal();
+	}
+
+	SoftwareAudioDevice& SoftwareAudioSource::GetDevice() const
+	{
+		return SafeCast<SoftwareAudioDevice&>(*GetAudioDevice());
+	}
+
+	UInt32 SoftwareAudioSource::GetSampleOffsetInternal() const
+	{
+		if (m_status == SoundStatus::Stopped)
+			return 0; //< Always return 0 when stopped, to mimic OpenAL behavior
+
+		UInt64 sampleOffset = 0;
+		for (const auto& processedBuffer : m_processedBuffers)
+			sampleOffset += processedBuffer->GetFrameCount();
+
+		if (!m_queuedBuffers.empty())
+			sampleOffset += static_cast<UInt64>(m_frameOffset);
+
+		return SafeCast<UInt32>(sampleOffset);
+	}
+
+	void SoftwareAudioSource::RequeueBuffers()
+	{
+		// Put back all processed buffers in front of the queued buffers
+		if (!m_processedBuffers.empty())
+		{
+			m_queuedBuffers.insert(m_queuedBuffers.begin(), std::make_move_iterator(m_processedBuffers.begin()), std::make_move_iterator(m_processedBuffers.end()));
+			m_processedBuffers.clear();
+		}
+	}
+
+	void SoftwareAudioSource::SetSampleOffsetInternal(UInt32 offset)
+	{
+		RequeueBuffers();
+
+		std::size_t processedBufferIndex = 0;
+		for (; processedBufferIndex < m_queuedBuffers.size(); ++processedBufferIndex)
+		{
+			UInt64 bufferFrameCount = m_queuedBuffers[processedBufferIndex]->GetFrameCount();
+			if (offset < bufferFrameCount)
+				break;
+
+			offset -= SafeCast<UInt32>(bufferFrameCount);
+			m_processedBuffers.emplace_back(std::move(m_queuedBuffers[processedBufferIndex]));
+		}
+		m_queuedBuffers.erase(m_queuedBuffers.begin(), m_queuedBuffers.begin() + processedBufferIndex);
+
+		if (!m_queuedBuffers.empty())
+			m_frameOffset = offset;
+		else
+		{
+			m_frameOffset = 0.0;
+			m_status = SoundStatus::Stopped;
+		}
+	}
+
+	void SoftwareAudioSource::StopInternal()
+	{
+		RequeueBuffers();
+		m_frameOffset = 0.0;
+		m_status = SoundStatus::Stopped;
+	}
+}
@@ -0,0 +1,411 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/AsyncLogger.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		const char* errorType[] = {
+			"Assert failed: ",  // ErrorType::AssertFailed
+			"Internal error: ", // ErrorType::Internal
+			"Error: ",          // ErrorType::Normal
+			"Warning: "         // ErrorType::Warning
+		};
+
+		static_assert(sizeof(errorType) / sizeof(const char*) == ErrorTypeCount, "Error type array is incomplete");
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::AsyncLogger
+	* \brief Core class that represents a file logger writing from a background thread
+	*
+	* Records are formatted on the calling thread into a fixed-size lock-free ring buffer (multiple producers, single consumer),
+	* the writing thread then drains it in batches, formats timestamps (cached per second) and writes to the file.
+	*
+	* \remark When the ring buffer is full, the overflow policy decides whether the caller waits for a slot or the record is dropped
+	*/
+
+	/*!
+	* \brief Constructs an AsyncLogger object and starts its writing thread
+	*
+	* \param logPath Path to log
+	* \param recordCapacity Number of records the ring buffer can hold (rounded up to the next power of two)
+	* \param overflowPolicy What to do when the ring buffer is full
+	*/
+	AsyncLogger::AsyncLogger(std::filesystem::path logPath, std::size_t recordCapacity, LogOverflowPolicy overflowPolicy) :
+	m_running(true),
+	m_stdReplicationEnabled(true),
+	m_timeLoggingEnabled(true),
+	m_writerSleeping(false),
+	m_overflowPolicy(overflowPolicy),
+	m_batchCount(0),
+	m_droppedRecords(0),
+	m_writtenRecords(0),
+	m_enqueuePosition(0),
+	m_flushedPosition(0),
+	m_pendingFlushes(0),
+	m_outputPath(std::move(logPath)),
+	m_dequeuePosition(0),
+	m_timestampLength(0),
+	m_cachedTimestamp(0),
+	m_outputFileFailed(false)
+	{
+		std::size_t capacity = 2;
+		while (capacity < recordCapacity)
+			capacity <<= 1;
+
+		m_slotMask = capacity - 1;
+		m_slots = std::make_unique<Slot[]>(capacity);
+		for (std::size_t i = 0; i < capacity; ++i)
+			m_slots[i].sequence.store(i, std::memory_order_relaxed);
+
+		m_writerThread = std::thread(&AsyncLogger::WriterThread, this);
+	}
+
+	/*!
+	* \brief Destructs the object, writing every pending record before returning
+	*/
+	AsyncLogger::~AsyncLogger()
+	{
+		m_running.store(false, std::memory_order_release);
+		{
+			std::lock_guard<std::mutex> lock(m_wakeMutex);
+			m_wakeCondition.notify_one();
+		}
+
+		m_writerThread.join();
+	}
+
+	/*!
+	* \brief Enables the replication to the stdout
+	*
+	* \param enable If true, enables the replication
+	*/
+	void AsyncLogger::EnableStdReplication(bool enable)
+	{
+		m_stdReplicationEnabled.store(enable, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Enables the log of the time
+	*
+	* \param enable If true, enables the time log
+	*/
+	void AsyncLogger::EnableTimeLogging(bool enable)
+	{
+		m_timeLoggingEnabled.store(enable, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Waits until every record queued before this call has been written to the file
+	*
+	* \remark Does nothing if called from the writing thread
+	*/
+	void AsyncLogger::Flush()
+	{
+		if (std::this_thread::get_id() == m_writerThread.get_id())
+			return;
+
+		std::size_t targetPosition = m_enqueuePosition.load(std::memory_order_acquire);
+
+		m_pendingFlushes.fetch_add(1, std::memory_order_relaxed);
+		{
+			std::lock_guard<std::mutex> lock(m_wakeMutex);
+			m_wakeCondition.notify_one();
+		}
+
+		std::unique_lock<std::mutex> lock(m_flushMutex);
+		m_flushCondition.wait(lock, [&]
+		{
+			// Positions only grow, compare them using their distance to handle wrap-around
+			return static_cast<std::ptrdiff_t>(m_flushedPosition.load(std::memory_order_acquire) - targetPosition) >= 0;
+		});
+
+		m_pendingFlushes.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Gets the logger statistics
+	* \return Counters of queued, written and dropped records
+	*/
+	auto AsyncLogger::GetStatistics() const -> Statistics
+	{
+		Statistics statistics;
+		statistics.batchCount = m_batchCount.load(std::memory_order_relaxed);
+		statistics.droppedRecords = m_droppedRecords.load(std::memory_order_relaxed);
+		statistics.queuedRecords = m_enqueuePosition.load(std::memory_order_relaxed);
+		statistics.writtenRecords = m_writtenRecords.load(std::memory_order_relaxed);
+
+		return statistics;
+	}
+
+	/*!
+	* \brief Checks whether or not the replication to the stdout is enabled
+	* \return true If replication is enabled
+	*/
+	bool AsyncLogger::IsStdReplicationEnabled() const
+	{
+		return m_stdReplicationEnabled.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Checks whether or not the logging of the time is enabled
+	* \return true If logging of the time is enabled
+	*/
+	bool AsyncLogger::IsTimeLoggingEnabled() const
+	{
+		return m_timeLoggingEnabled.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Queues a string to be written in the log
+	*
+	* \param string String to log
+	*
+	* \see WriteError
+	*/
+	void AsyncLogger::Write(const std::string_view& string)
+	{
+		Enqueue(std::array<std::string_view, 1>{ string });
+	}
+
+	/*!
+	* \brief Queues an error to be written in the log
+	*
+	* \param type The error type
+	* \param error The error text
+	* \param line The line the error occurred
+	* \param file The file the error occurred
+	* \param function The function the error occurred
+	*
+	* \remark Failed assertions are flushed synchronously as the program is likely to abort right after
+	*
+	* \see Write
+	*/
+	void AsyncLogger::WriteError(ErrorType type, const std::string_view& error, unsigned int line, const char* file, const char* function)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		if (line != 0 && file && function)
+		{
+			std::array<char, 16> lineBuffer;
+			auto result = std::to_chars(lineBuffer.data(), lineBuffer.data() + lineBuffer.size(), line);
+
+			Enqueue(std::array<std::string_view, 9>{
+				errorType[UnderlyingCast(type)],
+				error,
+				" (",
+				file,
+				":",
+				std::string_view(lineBuffer.data(), result.ptr - lineBuffer.data()),
+				": ",
+				function,
+				")"
+			});
+		}
+		else
+			Enqueue(std::array<std::string_view, 2>{ errorType[UnderlyingCast(type)], error });
+
+		if (type == ErrorType::AssertFailed)
+			Flush();
+	}
+
+	template<std::size_t N>
+	bool AsyncLogger::Enqueue(const std::array<std::string_view, N>& parts)
+	{
+		std::size_t totalSize = 0;
+		for (const std::string_view& part : parts)
+			totalSize += part.size();
+
+		std::time_t currentTime = std::time(nullptr);
+
+		Slot* slot;
+		std::size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			slot = &m_slots[position & m_slotMask];
+
+			std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - position);
+			if (diff == 0)
+			{
+				if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+			{
+				// Ring buffer is full
+				if (m_overflowPolicy.load(std::memory_order_relaxed) == LogOverflowPolicy::DropNewest)
+				{
+					m_droppedRecords.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+
+				WakeWriterThread();
+				std::this_thread::yield();
+
+				position = m_enqueuePosition.load(std::memory_order_relaxed);
+			}
+			else
+				position = m_enqueuePosition.load(std::memory_order_relaxed);
+		}
+
+		Record& record = slot->record;
+		record.size = totalSize;
+		record.time = currentTime;
+
+		char* output;
+		if (totalSize > InlineRecordSize)
+		{
+			record.overflowData.resize(totalSize);
+			output = record.overflowData.data();
+		}
+		else
+			output = record.inlineData.data();
+
+		for (const std::string_view& part : parts)
+		{
+			std::memcpy(output, part.data(), part.size());
+			output += part.size();
+		}
+
+		slot->sequence.store(position + 1, std::memory_order_release);
+
+		WakeWriterThread();
+		return true;
+	}
+
+	void AsyncLogger::FormatTimestamp(std::time_t time)
+	{
+		if (time == m_cachedTimestamp && m_timestampLength > 0)
+			return;
+
+		m_cachedTimestamp = time;
+		m_timestampLength = std::strftime(m_timestampBuffer.data(), m_timestampBuffer.size(), "%d/%m/%Y - %H:%M:%S: ", std::localtime(&time));
+	}
+
+	bool AsyncLogger::HasPendingRecord() const
+	{
+		const Slot& slot = m_slots[m_dequeuePosition & m_slotMask];
+		return slot.sequence.load(std::memory_order_acquire) == m_dequeuePosition + 1;
+	}
+
+	void AsyncLogger::OpenOutputFile()
+	{
+		m_outputFile.open(m_outputPath, std::ios_base::trunc | std::ios_base::out);
+		if (!m_outputFile.is_open())
+		{
+			// We can't use NazaraError here as it would be logged back to us
+			m_outputFileFailed = true;
+			m_stdLogger.WriteError(ErrorType::Normal, "Failed to open output file");
+		}
+	}
+
+	bool AsyncLogger::ProcessRecords()
+	{
+		bool stdReplication = m_stdReplicationEnabled.load(std::memory_order_relaxed);
+		bool timeLogging = m_timeLoggingEnabled.load(std::memory_order_relaxed);
+
+		m_batchBuffer.clear();
+
+		std::size_t recordCount = 0;
+		while (recordCount < MaxBatchSize && HasPendingRecord())
+		{
+			Slot& slot = m_slots[m_dequeuePosition & m_slotMask];
+			Record& record = slot.record;
+
+			std::string_view content(record.size > InlineRecordSize ? record.overflowData.data() : record.inlineData.data(), record.size);
+			if (stdReplication || m_outputFileFailed)
+				m_stdLogger.Write(content);
+
+			if (timeLogging)
+			{
+				FormatTimestamp(record.time);
+				m_batchBuffer.append(m_timestampBuffer.data(), m_timestampLength);
+			}
+
+			m_batchBuffer.append(content);
+			m_batchBuffer.push_back('\n');
+
+			slot.sequence.store(m_dequeuePosition + m_slotMask + 1, std::memory_order_release);
+			m_dequeuePosition++;
+			recordCount++;
+		}
+
+		if (recordCount == 0 && m_pendingFlushes.load(std::memory_order_relaxed) == 0)
+			return false;
+
+		if (recordCount > 0)
+		{
+			if (!m_outputFile.is_open() && !m_outputFileFailed)
+				OpenOutputFile();
+
+			if (m_outputFile.is_open())
+				m_outputFile.write(m_batchBuffer.data(), m_batchBuffer.size());
+
+			m_batchCount.fetch_add(1, std::memory_order_relaxed);
+			m_writtenRecords.fetch_add(recordCount, std::memory_order_relaxed);
+		}
+
+		// Only hit the disk when we caught up with producers or when someone is waiting on it
+		if (!HasPendingRecord() || m_pendingFlushes.load(std::memory_order_relaxed) > 0)
+		{
+			if (m_outputFile.is_open())
+				m_outputFile.flush();
+
+			m_flushedPosition.store(m_dequeuePosition, std::memory_order_release);
+
+			std::lock_guard<std::mutex> lock(m_flushMutex);
+			m_flushCondition.notify_all();
+		}
+
+		return recordCount > 0;
+	}
+
+	void AsyncLogger::WakeWriterThread()
+	{
+		// Pairs with the fence in WriterThread, either the writer sees our record or we see it sleeping
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (m_writerSleeping.load(std::memory_order_relaxed))
+		{
+			std::lock_guard<std::mutex> lock(m_wakeMutex);
+			m_wakeCondition.notify_one();
+		}
+	}
+
+	void AsyncLogger::WriterThread()
+	{
+		for (;;)
+		{
+			if (ProcessRecords())
+				continue;
+
+			if (!m_running.load(std::memory_order_acquire))
+			{
+				// Producers may still have been publishing while we checked
+				if (!ProcessRecords())
+					break;
+
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_wakeMutex);
+			m_writerSleeping.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (!HasPendingRecord() && m_pendingFlushes.load(std::memory_order_relaxed) == 0 && m_running.load(std::memory_order_relaxed))
+				m_wakeCondition.wait_for(lock, std::chrono::milliseconds(100));
+
+			m_writerSleeping.store(false, std::memory_order_relaxed);
+		}
+	}
+}
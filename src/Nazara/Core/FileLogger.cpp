@@ -5,10 +5,7 @@
 #include <Nazara/Core/FileLogger.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Utils/CallOnExit.hpp>
-#include <array>
-#include <ctime>
 #include <filesystem>
-#include <sstream>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -27,6 +24,8 @@ namespace Nz
 
 	FileLogger::FileLogger(std::filesystem::path logPath) :
 	m_outputPath(std::move(logPath)),
+	m_timestampLength(0),
+	m_cachedTimestamp(0),
 	m_forceStdOutput(false),
 	m_stdReplicationEnabled(true),
 	m_timeLoggingEnabled(true)
@@ -118,21 +117,21 @@ namespace Nz
 			}
 		}
 
-		// Apply some processing before writing
-		std::ostringstream stream;
 		if (m_timeLoggingEnabled)
 		{
-			std::array<char, 24> buffer;
-
-			time_t currentTime = std::time(nullptr);
-			std::strftime(buffer.data(), 24, "%d/%m/%Y - %H:%M:%S: ", std::localtime(&currentTime));
+			// Formatting the date is expensive, only do it when the second changes
+			std::time_t currentTime = std::time(nullptr);
+			if (currentTime != m_cachedTimestamp || m_timestampLength == 0)
+			{
+				m_cachedTimestamp = currentTime;
+				m_timestampLength = std::strftime(m_timestampBuffer.data(), m_timestampBuffer.size(), "%d/%m/%Y - %H:%M:%S: ", std::localtime(&currentTime));
+			}
 
-			stream << buffer.data();
+			m_outputFile.write(m_timestampBuffer.data(), m_timestampLength);
 		}
 
-		stream << string << '\n';
-
-		m_outputFile << stream.str();
+		m_outputFile.write(string.data(), string.size());
+		m_outputFile.put('\n');
 	}
 
 	/*!
@@ -0,0 +1,215 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ParallelFor.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		struct Job
+		{
+			Detail::ParallelForCallback callback;
+			void* userdata;
+			std::atomic_size_t nextChunk;
+			std::exception_ptr exception;
+			std::mutex exceptionMutex;
+			std::size_t chunkCount;
+			std::size_t chunkSize;
+			std::size_t count;
+			unsigned int activeHelperCount; //< protected by the pool mutex
+			unsigned int helperCount;       //< protected by the pool mutex
+			unsigned int maxHelperCount;
+		};
+
+		// Threads are started on first use and live until the program exits, waiting for jobs when idle
+		class WorkerPool
+		{
+			public:
+				WorkerPool() :
+				m_running(true)
+				{
+					unsigned int threadCount = std::thread::hardware_concurrency();
+					unsigned int workerCount = (threadCount > 1) ? threadCount - 1 : 0; //< the calling thread works too
+
+					m_workers.reserve(workerCount);
+					for (unsigned int i = 0; i < workerCount; ++i)
+						m_workers.emplace_back(&WorkerPool::WorkerThread, this);
+				}
+
+				~WorkerPool()
+				{
+					{
+						std::lock_guard<std::mutex> lock(m_mutex);
+						m_running = false;
+					}
+					m_jobCondition.notify_all();
+
+					for (std::thread& worker : m_workers)
+						worker.join();
+				}
+
+				unsigned int GetWorkerCount() const
+				{
+					return static_cast<unsigned int>(m_workers.size());
+				}
+
+				void Run(Job& job)
+				{
+					{
+						std::lock_guard<std::mutex> lock(m_mutex);
+						m_pendingJobs.push_back(&job);
+					}
+
+					if (job.maxHelperCount == 1)
+						m_jobCondition.notify_one();
+					else
+						m_jobCondition.notify_all();
+
+					ProcessChunks(job, 0);
+
+					// Workers which didn't pick the job yet won't ever do it, wait for the ones still working on chunks
+					std::unique_lock<std::mutex> lock(m_mutex);
+					auto it = std::find(m_pendingJobs.begin(), m_pendingJobs.end(), &job);
+					if (it != m_pendingJobs.end())
+						m_pendingJobs.erase(it);
+
+					m_jobDoneCondition.wait(lock, [&] { return job.activeHelperCount == 0; });
+				}
+
+				static void ProcessChunks(Job& job, unsigned int workerIndex)
+				{
+					for (;;)
+					{
+						std::size_t chunkIndex = job.nextChunk.fetch_add(1, std::memory_order_relaxed);
+						if (chunkIndex >= job.chunkCount)
+							break;
+
+						std::size_t begin = chunkIndex * job.chunkSize;
+						std::size_t end = std::min(begin + job.chunkSize, job.count);
+
+						try
+						{
+							job.callback(job.userdata, begin, end, workerIndex);
+						}
+						catch (...)
+						{
+							std::lock_guard<std::mutex> lock(job.exceptionMutex);
+							if (!job.exception)
+								job.exception = std::current_exception();
+
+							job.nextChunk.store(job.chunkCount, std::memory_order_relaxed);
+							break;
+						}
+					}
+				}
+
+			private:
+				void WorkerThread()
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					for (;;)
+					{
+						m_jobCondition.wait(lock, [&] { return !m_running || !m_pendingJobs.empty(); });
+						if (!m_running)
+							break;
+
+						Job& job = *m_pendingJobs.front();
+						unsigned int workerIndex = ++job.helperCount;
+						if (job.helperCount == job.maxHelperCount)
+							m_pendingJobs.erase(m_pendingJobs.begin());
+
+						job.activeHelperCount++;
+						lock.unlock();
+
+						ProcessChunks(job, workerIndex);
+
+						lock.lock();
+						if (--job.activeHelperCount == 0)
+							m_jobDoneCondition.notify_all();
+					}
+				}
+
+				std::condition_variable m_jobCondition;
+				std::condition_variable m_jobDoneCondition;
+				std::mutex m_mutex;
+				std::vector<Job*> m_pendingJobs;
+				std::vector<std::thread> m_workers;
+				bool m_running;
+		};
+
+		WorkerPool& GetWorkerPool()
+		{
+			static WorkerPool pool;
+			return pool;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Returns the maximum number of threads a ParallelFor call can use, including the calling thread
+	* \return Worker thread count plus one
+	*/
+	unsigned int GetParallelForThreadCount()
+	{
+		return GetWorkerPool().GetWorkerCount() + 1;
+	}
+
+	namespace Detail
+	{
+		void ParallelFor(std::size_t count, std::size_t grainSize, unsigned int maxThreadCount, ParallelForCallback callback, void* userdata)
+		{
+			if (count == 0)
+				return;
+
+			grainSize = std::max<std::size_t>(grainSize, 1);
+
+			std::size_t chunkCount = (count + grainSize - 1) / grainSize;
+			if (chunkCount <= 1 || maxThreadCount == 1)
+			{
+				callback(userdata, 0, count, 0);
+				return;
+			}
+
+			WorkerPool& pool = GetWorkerPool();
+
+			unsigned int threadLimit = pool.GetWorkerCount() + 1;
+			if (maxThreadCount == 0 || maxThreadCount > threadLimit)
+				maxThreadCount = threadLimit;
+
+			std::size_t threadCount = std::min<std::size_t>(chunkCount, maxThreadCount);
+			if (threadCount <= 1)
+			{
+				callback(userdata, 0, count, 0);
+				return;
+			}
+
+			Job job;
+			job.callback = callback;
+			job.userdata = userdata;
+			job.count = count;
+			job.nextChunk = 0;
+			job.activeHelperCount = 0;
+			job.helperCount = 0;
+			job.maxHelperCount = static_cast<unsigned int>(threadCount - 1);
+
+			// Use a few chunks per thread to even out unbalanced workloads
+			job.chunkSize = std::max(grainSize, count / (threadCount * 4));
+			job.chunkCount = (count + job.chunkSize - 1) / job.chunkSize;
+
+			pool.Run(job);
+
+			if (job.exception)
+				std::rethrow_exception(job.exception);
+		}
+	}
+}
@@ -6,20 +6,57 @@
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Renderer/CommandBufferBuilder.hpp>
 #include <Nazara/Renderer/RenderFrame.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
-	BakedFrameGraph::BakedFrameGraph(std::vector<PassData> passes, std::vector<TextureData> textures, AttachmentIdToTextureId attachmentIdToTextureMapping, PassIdToPhysicalPassIndex passIdToPhysicalPassMapping) :
+	BakedFrameGraph::BakedFrameGraph(std::vector<PassData> passes, std::vector<TextureData> textures, AttachmentIdToTextureId attachmentIdToTextureMapping, PassIdToPhysicalPassIndex passIdToPhysicalPassMapping, Statistics statistics) :
 	m_passes(std::move(passes)),
 	m_textures(std::move(textures)),
 	m_attachmentToTextureMapping(std::move(attachmentIdToTextureMapping)),
 	m_passIdToPhysicalPassMapping(std::move(passIdToPhysicalPassMapping)),
+	m_statistics(std::move(statistics)),
 	m_height(0),
 	m_width(0)
 	{
-		const std::shared_ptr<RenderDevice>& renderDevice = Graphics::Instance()->GetRenderDevice();
-		m_commandPool = renderDevice->InstantiateCommandPool(QueueType::Graphics);
+		// A frame graph can be baked without a graphics instance to be inspected, but it can't be executed
+		if (Graphics* graphics = Graphics::Instance())
+			m_commandPool = graphics->GetRenderDevice()->InstantiateCommandPool(QueueType::Graphics);
+	}
+
+	UInt64 BakedFrameGraph::ComputeMemoryUsage(unsigned int frameWidth, unsigned int frameHeight) const
+	{
+		UInt64 memoryUsage = 0;
+		for (const auto& textureData : m_textures)
+		{
+			// Views don't own memory
+			if (textureData.viewData)
+				continue;
+
+			unsigned int width = 1;
+			unsigned int height = 1;
+			switch (textureData.size)
+			{
+				case FramePassAttachmentSize::Fixed:
+					width = textureData.width;
+					height = textureData.height;
+					break;
+
+				case FramePassAttachmentSize::SwapchainFactor:
+					width = frameWidth * textureData.width / 100'000;
+					height = frameHeight * textureData.height / 100'000;
+					break;
+			}
+
+			UInt64 textureSize = PixelFormatInfo::ComputeSize(textureData.format, width, height, 1);
+			if (textureData.type == ImageType::Cubemap)
+				textureSize *= 6;
+
+			memoryUsage += textureSize;
+		}
+
+		return memoryUsage;
 	}
 
 	void BakedFrameGraph::Execute(RenderFrame& renderFrame)
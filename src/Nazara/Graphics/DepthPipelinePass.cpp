@@ -10,6 +10,8 @@
 #include <Nazara/Graphics/FramePipeline.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Graphics/MaterialInstance.hpp>
+#include <Nazara/Graphics/MaterialPipeline.hpp>
 #include <Nazara/Renderer/RenderFrame.hpp>
 #include <Nazara/Graphics/Debug.hpp>
 
@@ -22,6 +24,7 @@ namespace Nz
 	m_viewer(viewer),
 	m_elementRegistry(elementRegistry),
 	m_pipeline(owner),
+	m_hasPendingShaders(false),
 	m_rebuildCommandBuffer(false),
 	m_rebuildElements(false)
 	{
@@ -29,6 +32,10 @@ namespace Nz
 
 	void DepthPipelinePass::Prepare(RenderFrame& renderFrame, const Frustumf& frustum, const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, std::size_t visibilityHash)
 	{
+		// Elements may use fallback pipelines while their shaders are compiling, rebuild them once compilation is over
+		if (m_hasPendingShaders && !HasPendingShaders())
+			m_rebuildElements = true;
+
 		if (m_lastVisibilityHash != visibilityHash || m_rebuildElements) //< FIXME
 		{
 			renderFrame.PushForRelease(std::move(m_renderElements));
@@ -37,6 +44,7 @@ namespace Nz
 			for (const auto& renderableData : visibleRenderables)
 			{
 				InstancedRenderable::ElementData elementData{
+					&frustum,
 					&renderableData.scissorBox,
 					renderableData.skeletonInstance,
 					renderableData.worldInstance
@@ -56,6 +64,7 @@ namespace Nz
 
 			m_renderQueueRegistry.Finalize();
 
+			m_hasPendingShaders = HasPendingShaders();
 			m_lastVisibilityHash = visibilityHash;
 			m_rebuildElements = true;
 		}
@@ -103,7 +112,7 @@ namespace Nz
 		}
 	}
 
-	void DepthPipelinePass::RegisterMaterialInstance(const MaterialInstance& materialInstance)
+	void DepthPipelinePass::RegisterMaterialInstance(const MaterialInstance& materialInstance, std::size_t count)
 	{
 		if (!materialInstance.HasPass(m_passIndex))
 			return;
@@ -112,6 +121,7 @@ namespace Nz
 		if (it == m_materialInstances.end())
 		{
 			auto& matPassEntry = m_materialInstances[&materialInstance];
+			matPassEntry.usedCount = count;
 			matPassEntry.onMaterialInstancePipelineInvalidated.Connect(materialInstance.OnMaterialInstancePipelineInvalidated, [=](const MaterialInstance*, std::size_t passIndex)
 			{
 				if (passIndex != m_passIndex)
@@ -126,7 +136,7 @@ namespace Nz
 			});
 		}
 		else
-			it->second.usedCount++;
+			it->second.usedCount += count;
 	}
 
 	FramePass& DepthPipelinePass::RegisterToFrameGraph(FrameGraph& frameGraph, std::size_t outputAttachment)
@@ -161,13 +171,27 @@ namespace Nz
 		return depthPrepass;
 	}
 
-	void DepthPipelinePass::UnregisterMaterialInstance(const MaterialInstance& materialInstance)
+	void DepthPipelinePass::UnregisterMaterialInstance(const MaterialInstance& materialInstance, std::size_t count)
 	{
 		auto it = m_materialInstances.find(&materialInstance);
 		if (it != m_materialInstances.end())
 		{
-			if (--it->second.usedCount == 0)
+			assert(it->second.usedCount >= count);
+			it->second.usedCount -= count;
+			if (it->second.usedCount == 0)
 				m_materialInstances.erase(it);
 		}
 	}
+
+	bool DepthPipelinePass::HasPendingShaders() const
+	{
+		for (auto&& [materialInstance, entry] : m_materialInstances)
+		{
+			const auto& materialPipeline = materialInstance->GetPipeline(m_passIndex);
+			if (materialPipeline && materialPipeline->HasPendingShaders())
+				return true;
+		}
+
+		return false;
+	}
 }
@@ -77,6 +77,7 @@ namespace Nz
 				visibleRenderable.skeletonInstance = nullptr;
 
 			visibilityHash = CombineHash(visibilityHash, std::hash<const void*>()(&renderableData));
+			visibilityHash = CombineHash(visibilityHash, renderableData.renderable->ComputeVisibilityHash(frustum, worldInstance->GetWorldMatrix()));
 		}
 
 		return m_visibleRenderables;
@@ -146,79 +147,57 @@ namespace Nz
 	
 	std::size_t ForwardFramePipeline::RegisterRenderable(std::size_t worldInstanceIndex, std::size_t skeletonInstanceIndex, const InstancedRenderable* instancedRenderable, UInt32 renderMask, const Recti& scissorBox)
 	{
-		std::size_t renderableIndex;
-		RenderableData* renderableData = m_renderablePool.Allocate(renderableIndex);
-		renderableData->renderable = instancedRenderable;
-		renderableData->renderMask = renderMask;
-		renderableData->scissorBox = scissorBox;
-		renderableData->skeletonInstanceIndex = skeletonInstanceIndex;
-		renderableData->worldInstanceIndex = worldInstanceIndex;
-
-		renderableData->onElementInvalidated.Connect(instancedRenderable->OnElementInvalidated, [=](InstancedRenderable* /*instancedRenderable*/)
-		{
-			// TODO: Invalidate only relevant viewers and passes
-			for (auto& viewerData : m_viewerPool)
-			{
-				UInt32 viewerRenderMask = viewerData.viewer->GetRenderMask();
-
-				if (viewerRenderMask & renderMask)
-				{
-					if (viewerData.depthPrepass)
-						viewerData.depthPrepass->InvalidateElements();
-
-					viewerData.forwardPass->InvalidateElements();
-				}
-			}
-		});
+		std::size_t renderableIndex = RegisterRenderableData(worldInstanceIndex, skeletonInstanceIndex, instancedRenderable, renderMask, scissorBox);
 
-		renderableData->onMaterialInvalidated.Connect(instancedRenderable->OnMaterialInvalidated, [this](InstancedRenderable* instancedRenderable, std::size_t materialIndex, const std::shared_ptr<MaterialInstance>& newMaterial)
+		std::size_t matCount = instancedRenderable->GetMaterialCount();
+		for (std::size_t i = 0; i < matCount; ++i)
 		{
-			if (newMaterial)
+			if (MaterialInstance* mat = instancedRenderable->GetMaterial(i).get())
 			{
-				RegisterMaterialInstance(newMaterial.get());
+				RegisterMaterialInstance(mat);
 
 				for (auto& viewerData : m_viewerPool)
 				{
 					if (viewerData.depthPrepass)
-						viewerData.depthPrepass->RegisterMaterialInstance(*newMaterial);
+						viewerData.depthPrepass->RegisterMaterialInstance(*mat);
 
-					viewerData.forwardPass->RegisterMaterialInstance(*newMaterial);
+					viewerData.forwardPass->RegisterMaterialInstance(*mat);
 				}
 			}
+		}
 
-			const auto& prevMaterial = instancedRenderable->GetMaterial(materialIndex);
-			if (prevMaterial)
-			{
-				UnregisterMaterialInstance(prevMaterial.get());
+		return renderableIndex;
+	}
 
-				for (auto& viewerData : m_viewerPool)
-				{
-					if (viewerData.depthPrepass)
-						viewerData.depthPrepass->UnregisterMaterialInstance(*prevMaterial);
+	void ForwardFramePipeline::RegisterRenderables(std::size_t renderableCount, const RenderableRegistration* registrations, std::size_t* renderableIndices)
+	{
+		// Renderables usually share their materials, register each material only once per batch
+		m_batchMaterialInstances.clear();
+		for (std::size_t i = 0; i < renderableCount; ++i)
+		{
+			const RenderableRegistration& registration = registrations[i];
+			renderableIndices[i] = RegisterRenderableData(registration.worldInstanceIndex, registration.skeletonInstanceIndex, registration.renderable, registration.renderMask, registration.scissorBox);
 
-					viewerData.forwardPass->UnregisterMaterialInstance(*prevMaterial);
-				}
+			std::size_t matCount = registration.renderable->GetMaterialCount();
+			for (std::size_t j = 0; j < matCount; ++j)
+			{
+				if (MaterialInstance* mat = registration.renderable->GetMaterial(j).get())
+					m_batchMaterialInstances[mat]++;
 			}
-		});
+		}
 
-		std::size_t matCount = instancedRenderable->GetMaterialCount();
-		for (std::size_t i = 0; i < matCount; ++i)
+		for (auto&& [mat, count] : m_batchMaterialInstances)
 		{
-			if (MaterialInstance* mat = instancedRenderable->GetMaterial(i).get())
-			{
-				RegisterMaterialInstance(mat);
+			RegisterMaterialInstance(mat, count);
 
-				for (auto& viewerData : m_viewerPool)
-				{
-					if (viewerData.depthPrepass)
-						viewerData.depthPrepass->RegisterMaterialInstance(*mat);
+			for (auto& viewerData : m_viewerPool)
+			{
+				if (viewerData.depthPrepass)
+					viewerData.depthPrepass->RegisterMaterialInstance(*mat, count);
 
-					viewerData.forwardPass->RegisterMaterialInstance(*mat);
-				}
+				viewerData.forwardPass->RegisterMaterialInstance(*mat, count);
 			}
 		}
-
-		return renderableIndex;
 	}
 
 	std::size_t ForwardFramePipeline::RegisterSkeleton(SkeletonInstancePtr skeletonInstance)
@@ -486,21 +465,54 @@ namespace Nz
 		std::size_t matCount = renderable.renderable->GetMaterialCount();
 		for (std::size_t i = 0; i < matCount; ++i)
 		{
-			for (auto& viewerData : m_viewerPool)
+			if (MaterialInstance* mat = renderable.renderable->GetMaterial(i).get())
 			{
-				const auto& material = renderable.renderable->GetMaterial(i);
-				UnregisterMaterialInstance(material.get());
+				UnregisterMaterialInstance(mat);
 
-				if (viewerData.depthPrepass)
-					viewerData.depthPrepass->UnregisterMaterialInstance(*material);
+				for (auto& viewerData : m_viewerPool)
+				{
+					if (viewerData.depthPrepass)
+						viewerData.depthPrepass->UnregisterMaterialInstance(*mat);
 
-				viewerData.forwardPass->UnregisterMaterialInstance(*material);
+					viewerData.forwardPass->UnregisterMaterialInstance(*mat);
+				}
 			}
 		}
 
 		m_renderablePool.Free(renderableIndex);
 	}
 
+	void ForwardFramePipeline::UnregisterRenderables(std::size_t renderableCount, const std::size_t* renderableIndices)
+	{
+		m_batchMaterialInstances.clear();
+		for (std::size_t i = 0; i < renderableCount; ++i)
+		{
+			RenderableData& renderable = *m_renderablePool.RetrieveFromIndex(renderableIndices[i]);
+
+			std::size_t matCount = renderable.renderable->GetMaterialCount();
+			for (std::size_t j = 0; j < matCount; ++j)
+			{
+				if (MaterialInstance* mat = renderable.renderable->GetMaterial(j).get())
+					m_batchMaterialInstances[mat]++;
+			}
+
+			m_renderablePool.Free(renderableIndices[i]);
+		}
+
+		for (auto&& [mat, count] : m_batchMaterialInstances)
+		{
+			for (auto& viewerData : m_viewerPool)
+			{
+				if (viewerData.depthPrepass)
+					viewerData.depthPrepass->UnregisterMaterialInstance(*mat, count);
+
+				viewerData.forwardPass->UnregisterMaterialInstance(*mat, count);
+			}
+
+			UnregisterMaterialInstance(mat, count);
+		}
+	}
+
 	void ForwardFramePipeline::UnregisterSkeleton(std::size_t skeletonIndex)
 	{
 		// Defer world instance release
@@ -551,6 +563,32 @@ namespace Nz
 		}
 	}
 
+	void ForwardFramePipeline::UpdateRenderableScissorBoxes(std::size_t renderableCount, const std::size_t* renderableIndices, const Recti& scissorBox)
+	{
+		UInt32 renderMask = 0;
+		for (std::size_t i = 0; i < renderableCount; ++i)
+		{
+			RenderableData* renderableData = m_renderablePool.RetrieveFromIndex(renderableIndices[i]);
+			renderableData->scissorBox = scissorBox;
+
+			renderMask |= renderableData->renderMask;
+		}
+
+		// Invalidate viewers once for the whole batch
+		for (auto& viewerData : m_viewerPool)
+		{
+			UInt32 viewerRenderMask = viewerData.viewer->GetRenderMask();
+
+			if (viewerRenderMask & renderMask)
+			{
+				if (viewerData.depthPrepass)
+					viewerData.depthPrepass->InvalidateElements();
+
+				viewerData.forwardPass->InvalidateElements();
+			}
+		}
+	}
+
 	void ForwardFramePipeline::UpdateViewerRenderMask(std::size_t viewerIndex, Int32 renderOrder)
 	{
 		ViewerData* viewerData = m_viewerPool.RetrieveFromIndex(viewerIndex);
@@ -669,7 +707,7 @@ namespace Nz
 		return frameGraph.Bake();
 	}
 
-	void ForwardFramePipeline::RegisterMaterialInstance(MaterialInstance* materialInstance)
+	void ForwardFramePipeline::RegisterMaterialInstance(MaterialInstance* materialInstance, std::size_t count)
 	{
 		auto it = m_materialInstances.find(materialInstance);
 		if (it == m_materialInstances.end())
@@ -682,17 +720,78 @@ namespace Nz
 			m_transferSet.insert(materialInstance);
 		}
 
-		it->second.usedCount++;
+		it->second.usedCount += count;
+	}
+
+	std::size_t ForwardFramePipeline::RegisterRenderableData(std::size_t worldInstanceIndex, std::size_t skeletonInstanceIndex, const InstancedRenderable* instancedRenderable, UInt32 renderMask, const Recti& scissorBox)
+	{
+		std::size_t renderableIndex;
+		RenderableData* renderableData = m_renderablePool.Allocate(renderableIndex);
+		renderableData->renderable = instancedRenderable;
+		renderableData->renderMask = renderMask;
+		renderableData->scissorBox = scissorBox;
+		renderableData->skeletonInstanceIndex = skeletonInstanceIndex;
+		renderableData->worldInstanceIndex = worldInstanceIndex;
+
+		renderableData->onElementInvalidated.Connect(instancedRenderable->OnElementInvalidated, [=](InstancedRenderable* /*instancedRenderable*/)
+		{
+			// TODO: Invalidate only relevant viewers and passes
+			for (auto& viewerData : m_viewerPool)
+			{
+				UInt32 viewerRenderMask = viewerData.viewer->GetRenderMask();
+
+				if (viewerRenderMask & renderMask)
+				{
+					if (viewerData.depthPrepass)
+						viewerData.depthPrepass->InvalidateElements();
+
+					viewerData.forwardPass->InvalidateElements();
+				}
+			}
+		});
+
+		renderableData->onMaterialInvalidated.Connect(instancedRenderable->OnMaterialInvalidated, [this](InstancedRenderable* instancedRenderable, std::size_t materialIndex, const std::shared_ptr<MaterialInstance>& newMaterial)
+		{
+			if (newMaterial)
+			{
+				RegisterMaterialInstance(newMaterial.get());
+
+				for (auto& viewerData : m_viewerPool)
+				{
+					if (viewerData.depthPrepass)
+						viewerData.depthPrepass->RegisterMaterialInstance(*newMaterial);
+
+					viewerData.forwardPass->RegisterMaterialInstance(*newMaterial);
+				}
+			}
+
+			const auto& prevMaterial = instancedRenderable->GetMaterial(materialIndex);
+			if (prevMaterial)
+			{
+				UnregisterMaterialInstance(prevMaterial.get());
+
+				for (auto& viewerData : m_viewerPool)
+				{
+					if (viewerData.depthPrepass)
+						viewerData.depthPrepass->UnregisterMaterialInstance(*prevMaterial);
+
+					viewerData.forwardPass->UnregisterMaterialInstance(*prevMaterial);
+				}
+			}
+		});
+
+		return renderableIndex;
 	}
 
-	void ForwardFramePipeline::UnregisterMaterialInstance(MaterialInstance* materialInstance)
+	void ForwardFramePipeline::UnregisterMaterialInstance(MaterialInstance* materialInstance, std::size_t count)
 	{
 		auto it = m_materialInstances.find(materialInstance);
 		assert(it != m_materialInstances.end());
 
 		MaterialInstanceData& materialInstanceData = it->second;
-		assert(materialInstanceData.usedCount > 0);
-		if (--materialInstanceData.usedCount == 0)
+		assert(materialInstanceData.usedCount >= count);
+		materialInstanceData.usedCount -= count;
+		if (materialInstanceData.usedCount == 0)
 			m_materialInstances.erase(it);
 	}
 }
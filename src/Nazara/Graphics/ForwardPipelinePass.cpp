@@ -10,6 +10,8 @@
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Graphics/MaterialInstance.hpp>
+#include <Nazara/Graphics/MaterialPipeline.hpp>
 #include <Nazara/Graphics/PredefinedShaderStructs.hpp>
 #include <Nazara/Graphics/ViewerInstance.hpp>
 #include <Nazara/Renderer/CommandBufferBuilder.hpp>
@@ -23,6 +25,7 @@ namespace Nz
 	m_viewer(viewer),
 	m_elementRegistry(elementRegistry),
 	m_pipeline(owner),
+	m_hasPendingShaders(false),
 	m_rebuildCommandBuffer(false),
 	m_rebuildElements(false)
 	{
@@ -33,6 +36,10 @@ namespace Nz
 
 	void ForwardPipelinePass::Prepare(RenderFrame& renderFrame, const Frustumf& frustum, const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, const std::vector<std::size_t>& visibleLights, std::size_t visibilityHash)
 	{
+		// Elements may use fallback pipelines while their shaders are compiling, rebuild them once compilation is over
+		if (m_hasPendingShaders && !HasPendingShaders())
+			m_rebuildElements = true;
+
 		if (m_lastVisibilityHash != visibilityHash || m_rebuildElements) //< FIXME
 		{
 			renderFrame.PushForRelease(std::move(m_renderElements));
@@ -150,6 +157,7 @@ namespace Nz
 					lightUboView = it->second;
 
 				InstancedRenderable::ElementData elementData{
+					&frustum,
 					&renderableData.scissorBox,
 					renderableData.skeletonInstance,
 					renderableData.worldInstance
@@ -197,6 +205,7 @@ namespace Nz
 				builder.EndDebugRegion();
 			}, QueueType::Transfer);
 
+			m_hasPendingShaders = HasPendingShaders();
 			m_lastVisibilityHash = visibilityHash;
 			m_rebuildElements = true;
 		}
@@ -269,7 +278,7 @@ namespace Nz
 		}
 	}
 
-	void ForwardPipelinePass::RegisterMaterialInstance(const MaterialInstance& materialInstance)
+	void ForwardPipelinePass::RegisterMaterialInstance(const MaterialInstance& materialInstance, std::size_t count)
 	{
 		if (!materialInstance.HasPass(m_forwardPassIndex))
 			return;
@@ -278,6 +287,7 @@ namespace Nz
 		if (it == m_materialInstances.end())
 		{
 			auto& matPassEntry = m_materialInstances[&materialInstance];
+			matPassEntry.usedCount = count;
 			matPassEntry.onMaterialInstancePipelineInvalidated.Connect(materialInstance.OnMaterialInstancePipelineInvalidated, [=](const MaterialInstance*, std::size_t passIndex)
 			{
 				if (passIndex != m_forwardPassIndex)
@@ -292,7 +302,7 @@ namespace Nz
 			});
 		}
 		else
-			it->second.usedCount++;
+			it->second.usedCount += count;
 	}
 
 	FramePass& ForwardPipelinePass::RegisterToFrameGraph(FrameGraph& frameGraph, std::size_t colorBufferIndex, std::size_t depthBufferIndex, bool hasDepthPrepass)
@@ -333,13 +343,27 @@ namespace Nz
 		return forwardPass;
 	}
 
-	void ForwardPipelinePass::UnregisterMaterialInstance(const MaterialInstance& materialInstance)
+	void ForwardPipelinePass::UnregisterMaterialInstance(const MaterialInstance& materialInstance, std::size_t count)
 	{
 		auto it = m_materialInstances.find(&materialInstance);
 		if (it != m_materialInstances.end())
 		{
-			if (--it->second.usedCount == 0)
+			assert(it->second.usedCount >= count);
+			it->second.usedCount -= count;
+			if (it->second.usedCount == 0)
 				m_materialInstances.erase(it);
 		}
 	}
+
+	bool ForwardPipelinePass::HasPendingShaders() const
+	{
+		for (auto&& [materialInstance, entry] : m_materialInstances)
+		{
+			const auto& materialPipeline = materialInstance->GetPipeline(m_forwardPassIndex);
+			if (materialPipeline && materialPipeline->HasPendingShaders())
+				return true;
+		}
+
+		return false;
+	}
 }
@@ -10,6 +10,7 @@
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Utils/StackArray.hpp>
 #include <stdexcept>
+#include <tuple>
 #include <unordered_set>
 #include <Nazara/Graphics/Debug.hpp>
 
@@ -30,6 +31,7 @@ namespace Nz
 		if (m_backbufferOutputs.empty())
 			throw std::runtime_error("no backbuffer output has been set");
 
+		m_pending.attachmentLifetimes.clear();
 		m_pending.attachmentReadList.clear();
 		m_pending.attachmentToTextures.clear();
 		m_pending.attachmentWriteList.clear();
@@ -65,6 +67,46 @@ namespace Nz
 		BuildBarriers();
 		BuildPhysicalBarriers();
 
+		BakedFrameGraph::Statistics statistics;
+		statistics.culledPassCount = m_framePasses.size() - m_pending.passList.size();
+		statistics.passOrder = m_pending.passList;
+		statistics.physicalPassCount = m_pending.physicalPasses.size();
+
+		statistics.barrierCount = 0;
+		statistics.layoutTransitionCount = 0;
+		for (const auto& physicalPass : m_pending.physicalPasses)
+		{
+			statistics.barrierCount += physicalPass.textureBarrier.size();
+			for (const auto& barrier : physicalPass.textureBarrier)
+			{
+				if (barrier.oldLayout != barrier.newLayout)
+					statistics.layoutTransitionCount++;
+			}
+		}
+
+		statistics.textureCount = 0;
+		for (const auto& texture : m_pending.textures)
+		{
+			if (!texture.viewData)
+				statistics.textureCount++;
+		}
+
+		// Count attachments sharing their texture with another attachment
+		std::unordered_set<std::size_t> allocatedTextures;
+		statistics.aliasedAttachmentCount = 0;
+		for (std::size_t attachmentId = 0; attachmentId < m_attachments.size(); ++attachmentId)
+		{
+			if (std::holds_alternative<AttachmentProxy>(m_attachments[attachmentId]) || std::holds_alternative<AttachmentLayer>(m_attachments[attachmentId]))
+				continue;
+
+			auto it = m_pending.attachmentToTextures.find(attachmentId);
+			if (it == m_pending.attachmentToTextures.end())
+				continue;
+
+			if (!allocatedTextures.insert(it->second).second)
+				statistics.aliasedAttachmentCount++;
+		}
+
 		std::vector<BakedFrameGraph::PassData> bakedPasses;
 		bakedPasses.reserve(m_pending.physicalPasses.size());
 
@@ -117,7 +159,7 @@ namespace Nz
 			static_cast<FrameGraphTextureData&>(bakedTexture) = std::move(texture);
 		}
 
-		return BakedFrameGraph(std::move(bakedPasses), std::move(bakedTextures), std::move(m_pending.attachmentToTextures), std::move(m_pending.passIdToPhysicalPassIndex));
+		return BakedFrameGraph(std::move(bakedPasses), std::move(bakedTextures), std::move(m_pending.attachmentToTextures), std::move(m_pending.passIdToPhysicalPassIndex), std::move(statistics));
 	}
 
 	void FrameGraph::AssignPhysicalPasses()
@@ -172,20 +214,38 @@ namespace Nz
 
 	void FrameGraph::AssignPhysicalTextures()
 	{
-		// Assign last use pass index for every attachment
-		for (std::size_t passIndex : m_pending.passList)
+		// Compute the lifetime (first and last use in the pass list) of every attachment
+		auto ExtendLifetime = [&](std::size_t attachmentId, std::size_t passListIndex)
 		{
-			const FramePass& framePass = m_framePasses[passIndex];
+			auto it = m_pending.attachmentLifetimes.find(attachmentId);
+			if (it == m_pending.attachmentLifetimes.end())
+				m_pending.attachmentLifetimes.emplace(attachmentId, AttachmentLifetime{ passListIndex, passListIndex });
+			else
+				it->second.lastUse = passListIndex;
+		};
+
+		for (std::size_t passListIndex = 0; passListIndex < m_pending.passList.size(); ++passListIndex)
+		{
+			const FramePass& framePass = m_framePasses[m_pending.passList[passListIndex]];
 			framePass.ForEachAttachment([&](std::size_t attachmentId)
 			{
 				attachmentId = ResolveAttachmentIndex(attachmentId);
-				m_pending.attachmentLastUse[attachmentId] = passIndex;
+				ExtendLifetime(attachmentId, passListIndex);
+
+				// Using a layer keeps its parent texture alive
+				if (std::size_t resourceId = ResolveResourceIndex(attachmentId); resourceId != attachmentId)
+					ExtendLifetime(resourceId, passListIndex);
 			});
 		}
 
-		for (std::size_t passIndex : m_pending.passList)
+		// Backbuffer outputs are read after the last pass and must never be reused
+		std::unordered_set<std::size_t> backbufferResources;
+		for (std::size_t output : m_backbufferOutputs)
+			backbufferResources.insert(ResolveResourceIndex(output));
+
+		for (std::size_t passListIndex = 0; passListIndex < m_pending.passList.size(); ++passListIndex)
 		{
-			const FramePass& framePass = m_framePasses[passIndex];
+			const FramePass& framePass = m_framePasses[m_pending.passList[passListIndex]];
 
 			for (const auto& input : framePass.GetInputs())
 			{
@@ -217,14 +277,15 @@ namespace Nz
 						// Special case where multiples attachments point simultaneously to the same texture
 						m_pending.attachmentToTextures.emplace(depthStencilOutput, textureId);
 
-						auto inputIt = m_pending.attachmentLastUse.find(depthStencilInput);
-						auto outputIt = m_pending.attachmentLastUse.find(depthStencilInput);
-						if (inputIt != m_pending.attachmentLastUse.end() && outputIt != m_pending.attachmentLastUse.end())
+						// Only the attachment used last should release the texture
+						auto inputIt = m_pending.attachmentLifetimes.find(ResolveAttachmentIndex(depthStencilInput));
+						auto outputIt = m_pending.attachmentLifetimes.find(ResolveAttachmentIndex(depthStencilOutput));
+						if (inputIt != m_pending.attachmentLifetimes.end() && outputIt != m_pending.attachmentLifetimes.end() && inputIt != outputIt)
 						{
-							if (inputIt->second > outputIt->second)
-								m_pending.attachmentLastUse.erase(outputIt);
+							if (inputIt->second.lastUse > outputIt->second.lastUse)
+								m_pending.attachmentLifetimes.erase(outputIt);
 							else
-								m_pending.attachmentLastUse.erase(inputIt);
+								m_pending.attachmentLifetimes.erase(inputIt);
 						}
 					}
 					else if (it->second != textureId)
@@ -240,31 +301,43 @@ namespace Nz
 				attachmentData.usage |= TextureUsage::DepthStencilAttachment;
 			}
 
-			framePass.ForEachAttachment([&](std::size_t attachmentId)
+			auto ReleaseTexture = [&](std::size_t attachmentId)
 			{
-				attachmentId = ResolveAttachmentIndex(attachmentId);
+				if (backbufferResources.find(attachmentId) != backbufferResources.end())
+					return;
 
-				auto it = m_pending.attachmentLastUse.find(attachmentId);
+				auto it = m_pending.attachmentLifetimes.find(attachmentId);
 
 				// If this pass is the last one where this attachment is used, push the texture to the reuse pool
-				if (it != m_pending.attachmentLastUse.end() && passIndex == it->second)
+				if (it == m_pending.attachmentLifetimes.end() || passListIndex != it->second.lastUse)
+					return;
+
+				m_pending.attachmentLifetimes.erase(it);
+
+				const auto& attachmentData = m_attachments[attachmentId];
+				if (std::holds_alternative<FramePassAttachment>(attachmentData))
 				{
-					const auto& attachmentData = m_attachments[attachmentId];
-					if (std::holds_alternative<FramePassAttachment>(attachmentData))
-					{
-						std::size_t textureId = Retrieve(m_pending.attachmentToTextures, attachmentId);
+					std::size_t textureId = Retrieve(m_pending.attachmentToTextures, attachmentId);
 
-						assert(std::find(m_pending.texture2DPool.begin(), m_pending.texture2DPool.end(), textureId) == m_pending.texture2DPool.end());
-						m_pending.texture2DPool.push_back(textureId);
-					}
-					else if (std::holds_alternative<AttachmentCube>(attachmentData))
-					{
-						std::size_t textureId = Retrieve(m_pending.attachmentToTextures, attachmentId);
+					assert(std::find(m_pending.texture2DPool.begin(), m_pending.texture2DPool.end(), textureId) == m_pending.texture2DPool.end());
+					m_pending.texture2DPool.push_back(textureId);
+				}
+				else if (std::holds_alternative<AttachmentCube>(attachmentData))
+				{
+					std::size_t textureId = Retrieve(m_pending.attachmentToTextures, attachmentId);
 
-						assert(std::find(m_pending.textureCubePool.begin(), m_pending.textureCubePool.end(), textureId) == m_pending.textureCubePool.end());
-						m_pending.textureCubePool.push_back(textureId);
-					}
+					assert(std::find(m_pending.textureCubePool.begin(), m_pending.textureCubePool.end(), textureId) == m_pending.textureCubePool.end());
+					m_pending.textureCubePool.push_back(textureId);
 				}
+			};
+
+			framePass.ForEachAttachment([&](std::size_t attachmentId)
+			{
+				attachmentId = ResolveAttachmentIndex(attachmentId);
+				ReleaseTexture(attachmentId);
+
+				if (std::size_t resourceId = ResolveResourceIndex(attachmentId); resourceId != attachmentId)
+					ReleaseTexture(resourceId);
 			});
 		}
 
@@ -692,7 +765,8 @@ namespace Nz
 
 	void FrameGraph::BuildPhysicalPasses()
 	{
-		const RenderPassCache& renderPassCache = Graphics::Instance()->GetRenderPassCache();
+		// Without a graphics instance (baking a graph for inspection), no render pass is created
+		Graphics* graphics = Graphics::Instance();
 
 		std::vector<TextureLayout> textureLayouts(m_pending.textures.size(), TextureLayout::Undefined);
 
@@ -915,7 +989,10 @@ namespace Nz
 
 			BuildPhysicalPassDependencies(colorAttachmentCount, depthStencilAttachmentIndex.has_value(), renderPassAttachments, subpassesDesc, subpassesDeps);
 
-			m_pending.renderPasses.push_back(renderPassCache.Get(renderPassAttachments, subpassesDesc, subpassesDeps));
+			if (graphics)
+				m_pending.renderPasses.push_back(graphics->GetRenderPassCache().Get(renderPassAttachments, subpassesDesc, subpassesDeps));
+			else
+				m_pending.renderPasses.push_back(nullptr);
 
 			physicalPassIndex++;
 		}
@@ -1060,10 +1137,19 @@ namespace Nz
 			{
 				const AttachmentLayer& texLayer = arg;
 
-				// TODO: Reuse texture views from pool?
-
 				std::size_t parentTextureId = RegisterTexture(texLayer.attachmentId);
 
+				// Reuse the view if the parent texture was reused from the pool and already has one on this layer
+				for (std::size_t textureId = 0; textureId < m_pending.textures.size(); ++textureId)
+				{
+					const FrameGraphTextureData& data = m_pending.textures[textureId];
+					if (data.viewData && data.viewData->parentTextureId == parentTextureId && data.viewData->arrayLayer == texLayer.layerIndex)
+					{
+						m_pending.attachmentToTextures.emplace(attachmentIndex, textureId);
+						return textureId;
+					}
+				}
+
 				std::size_t textureId = m_pending.textures.size();
 				m_pending.attachmentToTextures.emplace(attachmentIndex, textureId);
 
@@ -1133,9 +1219,142 @@ namespace Nz
 		return attachmentIndex;
 	}
 
+	std::size_t FrameGraph::ResolveResourceIndex(std::size_t attachmentIndex) const
+	{
+		attachmentIndex = ResolveAttachmentIndex(attachmentIndex);
+
+		// Layers share their memory with their parent attachment
+		if (const AttachmentLayer* layer = std::get_if<AttachmentLayer>(&m_attachments[attachmentIndex]))
+			attachmentIndex = ResolveAttachmentIndex(layer->attachmentId);
+
+		return attachmentIndex;
+	}
+
 	void FrameGraph::ReorderPasses()
 	{
-		/* TODO */
+		// Passes are listed in a valid execution order, reorder them (while respecting their dependencies) so that:
+		// - passes reading the same resource in the same layout are grouped together, saving layout transitions
+		// - a pass doesn't directly follow the pass it depends on if there's other work available, so barriers have less stalling
+		std::size_t passCount = m_pending.passList.size();
+		if (passCount <= 2)
+			return;
+
+		struct PassResources
+		{
+			std::vector<std::size_t> depthStencilReads;
+			std::vector<std::size_t> reads;
+			std::vector<std::size_t> writes;
+		};
+
+		std::vector<PassResources> passResources(passCount);
+		for (std::size_t i = 0; i < passCount; ++i)
+		{
+			const FramePass& framePass = m_framePasses[m_pending.passList[i]];
+			PassResources& resources = passResources[i];
+
+			for (const auto& input : framePass.GetInputs())
+				UniquePushBack(resources.reads, ResolveResourceIndex(input.attachmentId));
+
+			for (const auto& output : framePass.GetOutputs())
+				UniquePushBack(resources.writes, ResolveResourceIndex(output.attachmentId));
+
+			if (std::size_t depthStencilInput = framePass.GetDepthStencilInput(); depthStencilInput != FramePass::InvalidAttachmentId)
+				UniquePushBack(resources.depthStencilReads, ResolveResourceIndex(depthStencilInput));
+
+			if (std::size_t depthStencilOutput = framePass.GetDepthStencilOutput(); depthStencilOutput != FramePass::InvalidAttachmentId)
+				UniquePushBack(resources.writes, ResolveResourceIndex(depthStencilOutput));
+		}
+
+		auto Contains = [](const std::vector<std::size_t>& resources, std::size_t resourceId)
+		{
+			return std::find(resources.begin(), resources.end(), resourceId) != resources.end();
+		};
+
+		auto Intersects = [&](const std::vector<std::size_t>& first, const std::vector<std::size_t>& second)
+		{
+			for (std::size_t resourceId : first)
+			{
+				if (Contains(second, resourceId))
+					return true;
+			}
+
+			return false;
+		};
+
+		// A pass depends on every previous pass writing something it uses or using something it writes
+		std::vector<std::vector<std::size_t>> dependents(passCount);
+		std::vector<std::size_t> dependencyCount(passCount, 0);
+		std::vector<std::vector<bool>> dependsOn(passCount, std::vector<bool>(passCount, false));
+		for (std::size_t i = 0; i < passCount; ++i)
+		{
+			const PassResources& resources = passResources[i];
+			for (std::size_t j = 0; j < i; ++j)
+			{
+				const PassResources& previousResources = passResources[j];
+
+				bool hasDependency = Intersects(resources.writes, previousResources.writes) ||
+				                     Intersects(resources.writes, previousResources.reads) ||
+				                     Intersects(resources.writes, previousResources.depthStencilReads) ||
+				                     Intersects(resources.reads, previousResources.writes) ||
+				                     Intersects(resources.depthStencilReads, previousResources.writes);
+
+				if (hasDependency)
+				{
+					dependents[j].push_back(i);
+					dependencyCount[i]++;
+					dependsOn[i][j] = true;
+				}
+			}
+		}
+
+		PassList orderedPasses;
+		orderedPasses.reserve(passCount);
+
+		std::vector<bool> scheduled(passCount, false);
+		std::size_t lastPass = passCount;
+		for (std::size_t scheduledCount = 0; scheduledCount < passCount; ++scheduledCount)
+		{
+			std::size_t bestPass = passCount;
+			bool bestSharesInputs = false;
+			bool bestIsIndependent = false;
+			for (std::size_t i = 0; i < passCount; ++i)
+			{
+				if (scheduled[i] || dependencyCount[i] != 0)
+					continue;
+
+				bool sharesInputs = false;
+				bool isIndependent = true;
+				if (lastPass != passCount)
+				{
+					sharesInputs = Intersects(passResources[i].reads, passResources[lastPass].reads) ||
+					               Intersects(passResources[i].depthStencilReads, passResources[lastPass].depthStencilReads);
+
+					isIndependent = !dependsOn[i][lastPass];
+				}
+
+				// Candidates are visited in original order, only replace the best one if strictly better
+				if (bestPass == passCount || std::tie(sharesInputs, isIndependent) > std::tie(bestSharesInputs, bestIsIndependent))
+				{
+					bestPass = i;
+					bestSharesInputs = sharesInputs;
+					bestIsIndependent = isIndependent;
+				}
+			}
+
+			assert(bestPass != passCount);
+
+			scheduled[bestPass] = true;
+			for (std::size_t dependent : dependents[bestPass])
+			{
+				assert(dependencyCount[dependent] > 0);
+				dependencyCount[dependent]--;
+			}
+
+			orderedPasses.push_back(m_pending.passList[bestPass]);
+			lastPass = bestPass;
+		}
+
+		m_pending.passList = std::move(orderedPasses);
 	}
 
 	void FrameGraph::TraverseGraph(std::size_t passIndex)
@@ -14,4 +14,25 @@ namespace Nz
 	}
 
 	FramePipeline::~FramePipeline() = default;
+
+	void FramePipeline::RegisterRenderables(std::size_t renderableCount, const RenderableRegistration* registrations, std::size_t* renderableIndices)
+	{
+		for (std::size_t i = 0; i < renderableCount; ++i)
+		{
+			const RenderableRegistration& registration = registrations[i];
+			renderableIndices[i] = RegisterRenderable(registration.worldInstanceIndex, registration.skeletonInstanceIndex, registration.renderable, registration.renderMask, registration.scissorBox);
+		}
+	}
+
+	void FramePipeline::UnregisterRenderables(std::size_t renderableCount, const std::size_t* renderableIndices)
+	{
+		for (std::size_t i = 0; i < renderableCount; ++i)
+			UnregisterRenderable(renderableIndices[i]);
+	}
+
+	void FramePipeline::UpdateRenderableScissorBoxes(std::size_t renderableCount, const std::size_t* renderableIndices, const Recti& scissorBox)
+	{
+		for (std::size_t i = 0; i < renderableCount; ++i)
+			UpdateRenderableScissorBox(renderableIndices[i], scissorBox);
+	}
 }
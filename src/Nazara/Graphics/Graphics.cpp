@@ -81,6 +81,7 @@ namespace Nz
 	*/
 	Graphics::Graphics(Config config) :
 	ModuleBase("Graphics", this),
+	m_shaderCachePath(std::move(config.shaderCachePath)),
 	m_preferredDepthFormat(PixelFormat::Undefined),
 	m_preferredDepthStencilFormat(PixelFormat::Undefined)
 	{
@@ -121,6 +122,11 @@ namespace Nz
 		if (!m_renderDevice)
 			throw std::runtime_error("failed to instantiate render device");
 
+		// Pipeline binaries are only valid for the API and device which produced them
+		m_pipelineCacheKey = ShaderCache::ComputeKey(std::to_string(UnderlyingCast(renderer->QueryAPI())) + ":" + m_renderDevice->GetDeviceInfo().name);
+		if (!m_shaderCachePath.empty())
+			LoadShaderCache();
+
 		m_renderPassCache.emplace(*m_renderDevice);
 		m_samplerCache.emplace(m_renderDevice);
 
@@ -140,6 +146,9 @@ namespace Nz
 
 	Graphics::~Graphics()
 	{
+		if (!m_shaderCachePath.empty())
+			SaveShaderCache();
+
 		// Free of atlas if it is ours
 		std::shared_ptr<AbstractAtlas> defaultAtlas = Font::GetDefaultAtlas();
 		if (defaultAtlas && defaultAtlas->GetStorage() == DataStorage::Hardware)
@@ -227,6 +236,7 @@ namespace Nz
 		{
 			MaterialSettings settings;
 			PredefinedMaterials::AddBasicSettings(settings);
+			PredefinedMaterials::AddDistanceFieldSettings(settings);
 
 			MaterialPass forwardPass;
 			forwardPass.states.depthBuffer = true;
@@ -315,6 +325,9 @@ namespace Nz
 			renderStates.blend.srcAlpha = BlendFunc::One;
 			renderStates.blend.dstAlpha = BlendFunc::One;
 		});
+
+		m_defaultMaterials.basicDistanceField = m_defaultMaterials.basicTransparent->Clone();
+		m_defaultMaterials.basicDistanceField->SetValueProperty("DistanceField", true);
 	}
 
 	void Graphics::BuildDefaultTextures()
@@ -372,6 +385,23 @@ namespace Nz
 		}
 	}
 
+	void Graphics::LoadShaderCache()
+	{
+		std::error_code ec;
+		if (!std::filesystem::is_regular_file(m_shaderCachePath, ec))
+			return; //< cache will be created on exit
+
+		if (!m_shaderCache.Load(m_shaderCachePath))
+		{
+			NazaraWarning("failed to load shader cache, shaders will be recompiled");
+			return;
+		}
+
+		ByteArray pipelineCacheData;
+		if (m_shaderCache.Find(m_pipelineCacheKey, &pipelineCacheData))
+			m_renderDevice->LoadPipelineCacheData(pipelineCacheData.GetConstBuffer(), pipelineCacheData.GetSize());
+	}
+
 	void Graphics::RegisterMaterialPasses()
 	{
 		m_materialPassRegistry.RegisterPass("ForwardPass");
@@ -414,6 +444,16 @@ namespace Nz
 		m_shaderModuleResolver->RegisterModule(nzsl::Ast::UnserializeShader(unserializer));
 	}
 
+	void Graphics::SaveShaderCache()
+	{
+		ByteArray pipelineCacheData;
+		if (m_renderDevice->GetPipelineCacheData(pipelineCacheData))
+			m_shaderCache.Insert(m_pipelineCacheKey, std::move(pipelineCacheData));
+
+		if (m_shaderCache.IsModified())
+			m_shaderCache.Save(m_shaderCachePath);
+	}
+
 	void Graphics::SelectDepthStencilFormats()
 	{
 		for (PixelFormat depthStencilCandidate : { PixelFormat::Depth24, PixelFormat::Depth32F, PixelFormat::Depth16 })
@@ -8,4 +8,11 @@
 namespace Nz
 {
 	InstancedRenderable::~InstancedRenderable() = default;
+
+	std::size_t InstancedRenderable::ComputeVisibilityHash(const Frustumf& /*frustum*/, const Matrix4f& /*worldMatrix*/) const
+	{
+		// Renderables culling parts of themselves in BuildElement have to return a hash of their visible parts,
+		// for render elements to be rebuilt when it changes
+		return 0;
+	}
 }
@@ -253,6 +253,28 @@ namespace Nz
 		return UpdatePassStates(passIndex, stateUpdater);
 	}
 
+	/*!
+	* \brief Starts compiling the shaders of every enabled pass in the background
+	*
+	* \param vertexBuffers Vertex buffers the material will be used with
+	* \param vertexBufferCount Vertex buffer count
+	*
+	* \return Number of permutations which were queued for compilation
+	*
+	* \see MaterialPipeline::PrecompileShaders
+	*/
+	std::size_t MaterialInstance::PrecompileShaders(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount) const
+	{
+		std::size_t queuedCount = 0;
+		for (std::size_t i = 0; i < m_passes.size(); ++i)
+		{
+			if (const std::shared_ptr<MaterialPipeline>& pipeline = GetPipeline(i))
+				queuedCount += pipeline->PrecompileShaders(vertexBuffers, vertexBufferCount);
+		}
+
+		return queuedCount;
+	}
+
 	void MaterialInstance::SetTextureProperty(std::size_t textureIndex, std::shared_ptr<Texture> texture)
 	{
 		assert(textureIndex < m_textureOverride.size());
@@ -28,48 +28,122 @@ namespace Nz
 	*/
 	const std::shared_ptr<RenderPipeline>& MaterialPipeline::GetRenderPipeline(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount) const
 	{
-		for (const auto& pipeline : m_renderPipelines)
+		if (const std::shared_ptr<RenderPipeline>* pipeline = FindRenderPipeline(m_renderPipelines, vertexBuffers, vertexBufferCount))
+			return *pipeline;
+
+		RenderPipelineInfo renderPipelineInfo = BuildRenderPipelineInfo(vertexBuffers, vertexBufferCount);
+
+		for (const auto& shader : m_pipelineInfo.shaders)
 		{
-			const auto& pipelineInfo = pipeline->GetPipelineInfo();
-			if (pipelineInfo.vertexBuffers.size() != vertexBufferCount)
-				continue;
+			if (shader.uberShader)
+				renderPipelineInfo.shaderModules.push_back(shader.uberShader->Get(BuildShaderConfig(*shader.uberShader, renderPipelineInfo.vertexBuffers)));
+		}
 
-			bool isEqual = std::equal(pipelineInfo.vertexBuffers.begin(), pipelineInfo.vertexBuffers.end(), vertexBuffers, [](const auto& v1, const auto& v2)
-			{
-				return v1.binding == v2.binding && v1.declaration == v2.declaration;
-			});
+		return m_renderPipelines.emplace_back(Graphics::Instance()->GetRenderDevice()->InstantiateRenderPipeline(std::move(renderPipelineInfo)));
+	}
 
-			if (isEqual)
-				return pipeline;
+	/*!
+	* \brief Checks if some shader permutations used by this pipeline are still being compiled in the background
+	*
+	* Pipelines retrieved using TryGetRenderPipeline while this returns true may be fallback ones, they should be retrieved again once it returns false.
+	*
+	* \return True if at least one of the shaders has pending permutations
+	*/
+	bool MaterialPipeline::HasPendingShaders() const
+	{
+		for (const auto& shader : m_pipelineInfo.shaders)
+		{
+			if (shader.uberShader && shader.uberShader->GetPendingCount() > 0)
+				return true;
 		}
 
-		RenderPipelineInfo renderPipelineInfo;
-		static_cast<RenderStates&>(renderPipelineInfo).operator=(m_pipelineInfo); // Not the line I'm the most proud of
+		return false;
+	}
 
-		renderPipelineInfo.pipelineLayout = m_pipelineInfo.pipelineLayout;
+	/*!
+	* \brief Starts compiling the shader permutations required by this pipeline in the background
+	*
+	* \param vertexBuffers Vertex buffers the pipeline will be used with
+	* \param vertexBufferCount Vertex buffer count
+	* \param optionVariations Values taken by options which vary between the users of this pipeline (every combination is compiled), the pipeline option values are used if empty
+	* \param maxThreadCount Maximum number of threads used to compile permutations, 0 means one per hardware thread
+	*
+	* \return Number of permutations which were queued for compilation
+	*
+	* \see TryGetRenderPipeline
+	*/
+	std::size_t MaterialPipeline::PrecompileShaders(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount, const std::vector<UberShader::OptionVariations>& optionVariations, unsigned int maxThreadCount) const
+	{
+		std::vector<RenderPipelineInfo::VertexBufferData> vertexBufferData(vertexBuffers, vertexBuffers + vertexBufferCount);
 
-		std::unordered_map<UInt32, nzsl::Ast::ConstantSingleValue> optionValues;
-		for (std::size_t i = 0; i < m_pipelineInfo.optionValues.size(); ++i)
+		std::size_t queuedCount = 0;
+		for (const auto& shader : m_pipelineInfo.shaders)
 		{
-			const auto& option = m_pipelineInfo.optionValues[i];
+			if (shader.uberShader)
+				queuedCount += shader.uberShader->Precompile(UberShader::EnumerateConfigs(BuildShaderConfig(*shader.uberShader, vertexBufferData), optionVariations), maxThreadCount);
+		}
+
+		return queuedCount;
+	}
+
+	/*!
+	* \brief Retrieve a pipeline instance without waiting on shader compilation
+	*
+	* If some shader permutations of this pipeline are not compiled yet, they are compiled in the background and a pipeline using the generic permutations (default option values) is returned instead.
+	*
+	* \param vertexBuffers Vertex buffers the pipeline will be used with
+	* \param vertexBufferCount Vertex buffer count
+	* \param isFallback If not null, set to true when the returned pipeline is a fallback one
+	*
+	* \return Pipeline instance
+	*/
+	const std::shared_ptr<RenderPipeline>& MaterialPipeline::TryGetRenderPipeline(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount, bool* isFallback) const
+	{
+		if (isFallback)
+			*isFallback = false;
+
+		if (const std::shared_ptr<RenderPipeline>* pipeline = FindRenderPipeline(m_renderPipelines, vertexBuffers, vertexBufferCount))
+			return *pipeline;
+
+		RenderPipelineInfo renderPipelineInfo = BuildRenderPipelineInfo(vertexBuffers, vertexBufferCount);
+
+		bool isReady = true;
+		for (const auto& shader : m_pipelineInfo.shaders)
+		{
+			if (!shader.uberShader)
+				continue;
 
-			optionValues[option.hash] = option.value;
+			// Keep querying every shader so all missing permutations start compiling at once
+			std::shared_ptr<ShaderModule> shaderModule = shader.uberShader->TryGet(BuildShaderConfig(*shader.uberShader, renderPipelineInfo.vertexBuffers));
+			if (shaderModule)
+				renderPipelineInfo.shaderModules.push_back(std::move(shaderModule));
+			else
+				isReady = false;
 		}
 
-		renderPipelineInfo.vertexBuffers.assign(vertexBuffers, vertexBuffers + vertexBufferCount);
+		if (isReady)
+			return m_renderPipelines.emplace_back(Graphics::Instance()->GetRenderDevice()->InstantiateRenderPipeline(std::move(renderPipelineInfo)));
+
+		if (isFallback)
+			*isFallback = true;
 
+		if (const std::shared_ptr<RenderPipeline>* pipeline = FindRenderPipeline(m_fallbackRenderPipelines, vertexBuffers, vertexBufferCount))
+			return *pipeline;
+
+		renderPipelineInfo.shaderModules.clear();
 		for (const auto& shader : m_pipelineInfo.shaders)
 		{
 			if (shader.uberShader)
 			{
-				UberShader::Config config{ optionValues };
+				// Generic permutation only depends on vertex layout, it is shared by every pipeline using this UberShader
+				UberShader::Config config;
 				shader.uberShader->UpdateConfig(config, renderPipelineInfo.vertexBuffers);
 
 				renderPipelineInfo.shaderModules.push_back(shader.uberShader->Get(config));
 			}
 		}
 
-		return m_renderPipelines.emplace_back(Graphics::Instance()->GetRenderDevice()->InstantiateRenderPipeline(std::move(renderPipelineInfo)));
+		return m_fallbackRenderPipelines.emplace_back(Graphics::Instance()->GetRenderDevice()->InstantiateRenderPipeline(std::move(renderPipelineInfo)));
 	}
 
 	/*!
@@ -88,6 +162,52 @@ namespace Nz
 		return it->second;
 	}
 
+	RenderPipelineInfo MaterialPipeline::BuildRenderPipelineInfo(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount) const
+	{
+		RenderPipelineInfo renderPipelineInfo;
+		static_cast<RenderStates&>(renderPipelineInfo).operator=(m_pipelineInfo); // Not the line I'm the most proud of
+
+		renderPipelineInfo.pipelineLayout = m_pipelineInfo.pipelineLayout;
+		renderPipelineInfo.vertexBuffers.assign(vertexBuffers, vertexBuffers + vertexBufferCount);
+
+		return renderPipelineInfo;
+	}
+
+	UberShader::Config MaterialPipeline::BuildShaderConfig(UberShader& uberShader, const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers) const
+	{
+		UberShader::Config config;
+		for (std::size_t i = 0; i < m_pipelineInfo.optionValues.size(); ++i)
+		{
+			const auto& option = m_pipelineInfo.optionValues[i];
+
+			config.optionValues[option.hash] = option.value;
+		}
+
+		uberShader.UpdateConfig(config, vertexBuffers);
+
+		return config;
+	}
+
+	const std::shared_ptr<RenderPipeline>* MaterialPipeline::FindRenderPipeline(const std::vector<std::shared_ptr<RenderPipeline>>& renderPipelines, const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount)
+	{
+		for (const auto& pipeline : renderPipelines)
+		{
+			const auto& pipelineInfo = pipeline->GetPipelineInfo();
+			if (pipelineInfo.vertexBuffers.size() != vertexBufferCount)
+				continue;
+
+			bool isEqual = std::equal(pipelineInfo.vertexBuffers.begin(), pipelineInfo.vertexBuffers.end(), vertexBuffers, [](const auto& v1, const auto& v2)
+			{
+				return v1.binding == v2.binding && v1.declaration == v2.declaration;
+			});
+
+			if (isEqual)
+				return &pipeline;
+		}
+
+		return nullptr;
+	}
+
 	bool MaterialPipeline::Initialize()
 	{
 		/*BasicMaterialPass::Initialize();
@@ -30,6 +30,8 @@ namespace Nz
 					m_graphicalMesh->GetVertexDeclaration(i)
 				}
 			};
+
+			PrecompileShaders(i);
 		}
 
 		m_onInvalidated.Connect(m_graphicalMesh->OnInvalidated, [this](GraphicalMesh*)
@@ -54,7 +56,7 @@ namespace Nz
 
 			const auto& indexBuffer = m_graphicalMesh->GetIndexBuffer(i);
 			const auto& vertexBuffer = m_graphicalMesh->GetVertexBuffer(i);
-			const auto& renderPipeline = materialPipeline->GetRenderPipeline(submeshData.vertexBufferData.data(), submeshData.vertexBufferData.size());
+			const auto& renderPipeline = materialPipeline->TryGetRenderPipeline(submeshData.vertexBufferData.data(), submeshData.vertexBufferData.size());
 
 			std::size_t indexCount = m_graphicalMesh->GetIndexCount(i);
 			IndexType indexType = m_graphicalMesh->GetIndexType(i);
@@ -96,4 +98,11 @@ namespace Nz
 	{
 		return m_graphicalMesh->GetVertexBuffer(subMeshIndex);
 	}
+
+	void Model::PrecompileShaders(std::size_t subMeshIndex) const
+	{
+		// Start compiling the permutations this submesh will need so they're ready (or almost) when it's first rendered
+		const auto& subMeshData = m_submeshes[subMeshIndex];
+		subMeshData.material->PrecompileShaders(subMeshData.vertexBufferData.data(), subMeshData.vertexBufferData.size());
+	}
 }
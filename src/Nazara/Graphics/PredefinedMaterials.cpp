@@ -25,6 +25,18 @@ namespace Nz
 		settings.AddPropertyHandler(std::make_unique<UniformValuePropertyHandler>("AlphaTestThreshold"));
 	}
 
+	void PredefinedMaterials::AddDistanceFieldSettings(MaterialSettings& settings)
+	{
+		settings.AddValueProperty<bool>("DistanceField", false);
+		settings.AddValueProperty<Color>("DistanceFieldOutlineColor", Color(0.f, 0.f, 0.f, 0.f));
+		settings.AddValueProperty<float>("DistanceFieldOutlineWidth", 0.f);
+		settings.AddValueProperty<float>("DistanceFieldSmoothing", 0.06f);
+		settings.AddPropertyHandler(std::make_unique<OptionValuePropertyHandler>("DistanceField", "DistanceField"));
+		settings.AddPropertyHandler(std::make_unique<UniformValuePropertyHandler>("DistanceFieldOutlineColor"));
+		settings.AddPropertyHandler(std::make_unique<UniformValuePropertyHandler>("DistanceFieldOutlineWidth"));
+		settings.AddPropertyHandler(std::make_unique<UniformValuePropertyHandler>("DistanceFieldSmoothing"));
+	}
+
 	void PredefinedMaterials::AddPbrSettings(MaterialSettings& settings)
 	{
 		settings.AddTextureProperty("EmissiveMap", ImageType::E2D);
@@ -35,7 +35,7 @@ namespace Nz
 			0,
 			vertexDeclaration
 		};
-		const auto& renderPipeline = materialPipeline->GetRenderPipeline(&vertexBufferData, 1);
+		const auto& renderPipeline = materialPipeline->TryGetRenderPipeline(&vertexBufferData, 1);
 
 		const auto& whiteTexture = Graphics::Instance()->GetDefaultTextures().whiteTextures[UnderlyingCast(ImageType::E2D)];
 
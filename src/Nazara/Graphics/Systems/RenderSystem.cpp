@@ -25,10 +25,7 @@ namespace Nz
 	m_graphicsConstructObserver(registry, entt::collector.group<GraphicsComponent, NodeComponent>()),
 	m_lightConstructObserver(registry, entt::collector.group<LightComponent, NodeComponent>()),
 	m_sharedSkeletonConstructObserver(registry, entt::collector.group<GraphicsComponent, NodeComponent, SharedSkeletonComponent>(entt::exclude<SkeletonComponent>)),
-	m_skeletonConstructObserver(registry, entt::collector.group<GraphicsComponent, NodeComponent, SkeletonComponent>(entt::exclude<SharedSkeletonComponent>)),
-	m_cameraEntityPool(8),
-	m_graphicsEntityPool(1024),
-	m_lightEntityPool(32)
+	m_skeletonConstructObserver(registry, entt::collector.group<GraphicsComponent, NodeComponent, SkeletonComponent>(entt::exclude<SharedSkeletonComponent>))
 	{
 		m_cameraDestroyConnection = registry.on_destroy<CameraComponent>().connect<&RenderSystem::OnCameraDestroy>(this);
 		m_graphicsDestroyConnection = registry.on_destroy<GraphicsComponent>().connect<&RenderSystem::OnGraphicsDestroy>(this);
@@ -46,13 +43,25 @@ namespace Nz
 		m_graphicsConstructObserver.disconnect();
 		m_lightConstructObserver.disconnect();
 		m_pipeline.reset();
+		m_ownedTransformSystem.reset();
 	}
 
-	void RenderSystem::Update(Time /*elapsedTime*/)
+	void RenderSystem::Update(Time elapsedTime)
 	{
+		// Use the transform system of the registry if there's one, or create our own
+		TransformSystem* transformSystem = TransformSystem::Find(m_registry);
+		if (!transformSystem)
+		{
+			m_ownedTransformSystem = std::make_unique<TransformSystem>(m_registry);
+			transformSystem = m_ownedTransformSystem.get();
+		}
+
+		if (transformSystem == m_ownedTransformSystem.get())
+			transformSystem->Update(elapsedTime);
+
 		UpdateObservers();
 		UpdateVisibility();
-		UpdateInstances();
+		UpdateInstances(*transformSystem);
 
 		for (auto& windowPtr : m_renderWindows)
 		{
@@ -71,81 +80,64 @@ namespace Nz
 	{
 		assert(&m_registry == &registry);
 
-		auto it = m_cameraEntities.find(entity);
-		if (it == m_cameraEntities.end())
+		if (!m_cameraEntities.contains(entity))
 			return;
 
-		CameraEntity* cameraEntity = it->second;
+		CameraEntity& cameraEntity = m_cameraEntities.get(entity);
+		m_pipeline->UnregisterViewer(cameraEntity.viewerIndex);
 
-		m_cameraEntities.erase(it);
-		m_invalidatedCameraNode.erase(cameraEntity);
-		m_pipeline->UnregisterViewer(cameraEntity->viewerIndex);
-
-		m_cameraEntityPool.Free(cameraEntity->poolIndex);
+		m_invalidatedCameraNode.remove(entity);
+		m_cameraEntities.erase(entity);
 	}
 
 	void RenderSystem::OnGraphicsDestroy([[maybe_unused]] entt::registry& registry, entt::entity entity)
 	{
 		assert(&m_registry == &registry);
 
-		auto it = m_graphicsEntities.find(entity);
-		if (it == m_graphicsEntities.end())
+		if (!m_graphicsEntities.contains(entity))
 			return;
 
-		GraphicsEntity* graphicsEntity = it->second;
-
-		m_graphicsEntities.erase(entity);
-		m_invalidatedGfxWorldNode.erase(graphicsEntity);
-		m_newlyHiddenGfxEntities.erase(graphicsEntity);
-		m_newlyVisibleGfxEntities.erase(graphicsEntity);
+		GraphicsEntity& graphicsEntity = m_graphicsEntities.get(entity);
 
+		// Renderables are unregistered all at once on next update, keep them alive until then
 		GraphicsComponent& entityGfx = m_registry.get<GraphicsComponent>(entity);
-		if (entityGfx.IsVisible())
+		for (std::size_t renderableIndex = 0; renderableIndex < GraphicsComponent::MaxRenderableCount; ++renderableIndex)
 		{
-			for (std::size_t renderableIndex = 0; renderableIndex < GraphicsComponent::MaxRenderableCount; ++renderableIndex)
-			{
-				const auto& renderableEntry = entityGfx.GetRenderableEntry(renderableIndex);
-				if (!renderableEntry.renderable)
-					continue;
+			if (graphicsEntity.renderableIndices[renderableIndex] == NoInstance)
+				continue;
 
-				m_pipeline->UnregisterRenderable(graphicsEntity->renderableIndices[renderableIndex]);
-			}
+			m_removedRenderableIndices.push_back(graphicsEntity.renderableIndices[renderableIndex]);
+			m_removedRenderables.push_back(entityGfx.GetRenderableEntry(renderableIndex).renderable);
 		}
 
-		m_pipeline->UnregisterWorldInstance(graphicsEntity->worldInstanceIndex);
+		m_pipeline->UnregisterWorldInstance(graphicsEntity.worldInstanceIndex);
 
-		m_graphicsEntityPool.Free(graphicsEntity->poolIndex);
+		m_invalidatedGfxWorldNode.remove(entity);
+		m_newlyHiddenGfxEntities.remove(entity);
+		m_newlyVisibleGfxEntities.remove(entity);
+		m_graphicsEntities.erase(entity);
 	}
 
 	void RenderSystem::OnLightDestroy([[maybe_unused]] entt::registry& registry, entt::entity entity)
 	{
 		assert(&m_registry == &registry);
 
-		auto it = m_lightEntities.find(entity);
-		if (it == m_lightEntities.end())
+		if (!m_lightEntities.contains(entity))
 			return;
 
-		LightEntity* lightEntity = it->second;
+		LightEntity& lightEntity = m_lightEntities.get(entity);
 
-		m_lightEntities.erase(entity);
-		m_invalidatedLightWorldNode.erase(lightEntity);
-		m_newlyHiddenLightEntities.erase(lightEntity);
-		m_newlyVisibleLightEntities.erase(lightEntity);
-
-		LightComponent& entityLight = m_registry.get<LightComponent>(entity);
-		if (entityLight.IsVisible())
+		// Lights are owned by the component, they have to be unregistered right away
+		for (std::size_t& lightIndex : lightEntity.lightIndices)
 		{
-			for (std::size_t lightIndex = 0; lightIndex < LightComponent::MaxLightCount; ++lightIndex)
-			{
-				const auto& lightEntry = entityLight.GetLightEntry(lightIndex);
-				if (!lightEntry.light)
-					continue;
-
-				m_pipeline->UnregisterLight(lightEntity->lightIndices[lightIndex]);
-			}
+			if (lightIndex != NoInstance)
+				m_pipeline->UnregisterLight(lightIndex);
 		}
 
-		m_lightEntityPool.Free(lightEntity->poolIndex);
+		m_invalidatedLightWorldNode.remove(entity);
+		m_newlyHiddenLightEntities.remove(entity);
+		m_newlyVisibleLightEntities.remove(entity);
+		m_lightEntities.erase(entity);
 	}
 
 	void RenderSystem::OnNodeDestroy(entt::registry& registry, entt::entity entity)
@@ -186,67 +178,54 @@ namespace Nz
 			m_sharedSkeletonInstances.erase(skeletonInstanceIt);
 		}
 
-		auto it = m_graphicsEntities.find(entity);
-		if (it == m_graphicsEntities.end())
+		if (!m_graphicsEntities.contains(entity))
 			return;
 
-		GraphicsEntity* graphicsEntity = it->second;
-		graphicsEntity->skeletonInstanceIndex = NoInstance;
+		GraphicsEntity& graphicsEntity = m_graphicsEntities.get(entity);
+		graphicsEntity.skeletonInstanceIndex = NoInstance;
 	}
 
 	void RenderSystem::OnSkeletonDestroy(entt::registry& registry, entt::entity entity)
 	{
 		assert(&m_registry == &registry);
 
-		auto it = m_graphicsEntities.find(entity);
-		if (it == m_graphicsEntities.end())
+		if (!m_graphicsEntities.contains(entity))
 			return;
 
-		GraphicsEntity* graphicsEntity = it->second;
+		GraphicsEntity& graphicsEntity = m_graphicsEntities.get(entity);
 
-		m_pipeline->UnregisterSkeleton(graphicsEntity->skeletonInstanceIndex);
-		graphicsEntity->skeletonInstanceIndex = NoInstance;
+		m_pipeline->UnregisterSkeleton(graphicsEntity.skeletonInstanceIndex);
+		graphicsEntity.skeletonInstanceIndex = NoInstance;
 	}
 
-	void RenderSystem::UpdateInstances()
+	void RenderSystem::UpdateInstances(const TransformSystem& transformSystem)
 	{
-		for (CameraEntity* cameraEntity : m_invalidatedCameraNode)
+		auto UpdateCamera = [&](entt::entity entity, std::size_t slot)
 		{
-			entt::entity entity = cameraEntity->entity;
-
-			const NodeComponent& entityNode = m_registry.get<const NodeComponent>(entity);
 			CameraComponent& entityCamera = m_registry.get<CameraComponent>(entity);
 
-			Vector3f cameraPosition = entityNode.GetPosition(CoordSys::Global);
-			
+			const Vector3f& cameraPosition = transformSystem.GetWorldPosition(slot);
+
 			ViewerInstance& viewerInstance = entityCamera.GetViewerInstance();
 			viewerInstance.UpdateEyePosition(cameraPosition);
-			viewerInstance.UpdateViewMatrix(Nz::Matrix4f::TransformInverse(cameraPosition, entityNode.GetRotation(CoordSys::Global)));
-		}
-		m_invalidatedCameraNode.clear();
+			viewerInstance.UpdateViewMatrix(Nz::Matrix4f::TransformInverse(cameraPosition, transformSystem.GetWorldRotation(slot)));
+		};
 
-		for (GraphicsEntity* graphicsEntity : m_invalidatedGfxWorldNode)
+		auto UpdateGraphics = [&](entt::entity entity, std::size_t slot)
 		{
-			entt::entity entity = graphicsEntity->entity;
-
-			const NodeComponent& entityNode = m_registry.get<const NodeComponent>(entity);
 			GraphicsComponent& entityGraphics = m_registry.get<GraphicsComponent>(entity);
 
 			const WorldInstancePtr& worldInstance = entityGraphics.GetWorldInstance();
-			worldInstance->UpdateWorldMatrix(entityNode.GetTransformMatrix());
-		}
-		m_invalidatedGfxWorldNode.clear();
+			worldInstance->UpdateWorldMatrix(transformSystem.GetWorldMatrix(slot));
+		};
 
-		for (LightEntity* lightEntity : m_invalidatedLightWorldNode)
+		auto UpdateLight = [&](entt::entity entity, std::size_t slot)
 		{
-			entt::entity entity = lightEntity->entity;
-
-			const NodeComponent& entityNode = m_registry.get<const NodeComponent>(entity);
 			LightComponent& entityLight = m_registry.get<LightComponent>(entity);
 
-			const Vector3f& position = entityNode.GetPosition(CoordSys::Global);
-			const Quaternionf& rotation = entityNode.GetRotation(CoordSys::Global);
-			const Vector3f& scale = entityNode.GetScale(CoordSys::Global);
+			const Vector3f& position = transformSystem.GetWorldPosition(slot);
+			const Quaternionf& rotation = transformSystem.GetWorldRotation(slot);
+			const Vector3f& scale = transformSystem.GetWorldScale(slot);
 
 			for (const auto& lightEntry : entityLight.GetLights())
 			{
@@ -255,7 +234,51 @@ namespace Nz
 
 				lightEntry.light->UpdateTransform(position, rotation, scale);
 			}
+		};
+
+		// Walk the transforms updated this frame, slots of a range are contiguous in the transform system arrays
+		for (const TransformSystem::TransformRange& range : transformSystem.GetInvalidatedRanges())
+		{
+			for (std::size_t slot = range.first; slot < range.first + range.count; ++slot)
+			{
+				entt::entity entity = transformSystem.GetEntity(slot);
+				if (entity == entt::null)
+					continue;
+
+				if (m_cameraEntities.contains(entity))
+				{
+					UpdateCamera(entity, slot);
+					m_invalidatedCameraNode.remove(entity);
+				}
+
+				if (m_graphicsEntities.contains(entity))
+				{
+					UpdateGraphics(entity, slot);
+					m_invalidatedGfxWorldNode.remove(entity);
+				}
+
+				if (m_lightEntities.contains(entity))
+				{
+					UpdateLight(entity, slot);
+					m_invalidatedLightWorldNode.remove(entity);
+				}
+			}
 		}
+
+		// Entities registered this frame without their transform being updated
+		for (entt::entity entity : m_invalidatedCameraNode)
+			UpdateCamera(entity, transformSystem.GetSlot(m_registry.get<NodeComponent>(entity)));
+
+		m_invalidatedCameraNode.clear();
+
+		for (entt::entity entity : m_invalidatedGfxWorldNode)
+			UpdateGraphics(entity, transformSystem.GetSlot(m_registry.get<NodeComponent>(entity)));
+
+		m_invalidatedGfxWorldNode.clear();
+
+		for (entt::entity entity : m_invalidatedLightWorldNode)
+			UpdateLight(entity, transformSystem.GetSlot(m_registry.get<NodeComponent>(entity)));
+
 		m_invalidatedLightWorldNode.clear();
 	}
 
@@ -264,166 +287,130 @@ namespace Nz
 		m_cameraConstructObserver.each([&](entt::entity entity)
 		{
 			CameraComponent& entityCamera = m_registry.get<CameraComponent>(entity);
-			NodeComponent& entityNode = m_registry.get<NodeComponent>(entity);
-
-			std::size_t poolIndex;
-			CameraEntity* cameraEntity = m_cameraEntityPool.Allocate(poolIndex);
-			cameraEntity->poolIndex = poolIndex;
-			cameraEntity->entity = entity;
-			cameraEntity->viewerIndex = m_pipeline->RegisterViewer(&entityCamera, entityCamera.GetRenderOrder());
-			cameraEntity->onNodeInvalidation.Connect(entityNode.OnNodeInvalidation, [this, cameraEntity](const Node* /*node*/)
-			{
-				m_invalidatedCameraNode.insert(cameraEntity);
-			});
 
-			m_invalidatedCameraNode.insert(cameraEntity);
+			assert(!m_cameraEntities.contains(entity));
+			CameraEntity& cameraEntity = m_cameraEntities.emplace(entity);
+			cameraEntity.viewerIndex = m_pipeline->RegisterViewer(&entityCamera, entityCamera.GetRenderOrder());
 
-			assert(m_cameraEntities.find(entity) == m_cameraEntities.end());
-			m_cameraEntities.emplace(entity, cameraEntity);
+			m_invalidatedCameraNode.emplace(entity);
 		});
-		
+
 		m_graphicsConstructObserver.each([&](entt::entity entity)
 		{
 			GraphicsComponent& entityGfx = m_registry.get<GraphicsComponent>(entity);
-			NodeComponent& entityNode = m_registry.get<NodeComponent>(entity);
-
-			std::size_t poolIndex;
-			GraphicsEntity* graphicsEntity = m_graphicsEntityPool.Allocate(poolIndex);
-			graphicsEntity->entity = entity;
-			graphicsEntity->poolIndex = poolIndex;
-			graphicsEntity->renderableIndices.fill(std::numeric_limits<std::size_t>::max());
-			graphicsEntity->skeletonInstanceIndex = NoInstance; //< will be set in skeleton observer
-			graphicsEntity->worldInstanceIndex = m_pipeline->RegisterWorldInstance(entityGfx.GetWorldInstance());
-			graphicsEntity->onNodeInvalidation.Connect(entityNode.OnNodeInvalidation, [this, graphicsEntity](const Node* /*node*/)
-			{
-				m_invalidatedGfxWorldNode.insert(graphicsEntity);
-			});
 
-			graphicsEntity->onRenderableAttached.Connect(entityGfx.OnRenderableAttached, [this, graphicsEntity](GraphicsComponent* gfx, std::size_t renderableIndex)
+			assert(!m_graphicsEntities.contains(entity));
+			GraphicsEntity& graphicsEntity = m_graphicsEntities.emplace(entity);
+			graphicsEntity.renderableIndices.fill(NoInstance);
+			graphicsEntity.skeletonInstanceIndex = NoInstance; //< will be set in skeleton observer
+			graphicsEntity.worldInstanceIndex = m_pipeline->RegisterWorldInstance(entityGfx.GetWorldInstance());
+
+			// Entity data may move in storage, callbacks have to retrieve it from the entity
+			graphicsEntity.onRenderableAttached.Connect(entityGfx.OnRenderableAttached, [this, entity](GraphicsComponent* gfx, std::size_t renderableIndex)
 			{
 				if (!gfx->IsVisible())
 					return;
 
+				GraphicsEntity& graphicsData = m_graphicsEntities.get(entity);
+				if (graphicsData.renderableIndices[renderableIndex] != NoInstance)
+					return;
+
 				const auto& renderableEntry = gfx->GetRenderableEntry(renderableIndex);
-				graphicsEntity->renderableIndices[renderableIndex] = m_pipeline->RegisterRenderable(graphicsEntity->worldInstanceIndex, graphicsEntity->skeletonInstanceIndex, renderableEntry.renderable.get(), renderableEntry.renderMask, gfx->GetScissorBox());
+				graphicsData.renderableIndices[renderableIndex] = m_pipeline->RegisterRenderable(graphicsData.worldInstanceIndex, graphicsData.skeletonInstanceIndex, renderableEntry.renderable.get(), renderableEntry.renderMask, gfx->GetScissorBox());
 			});
 
-			graphicsEntity->onRenderableDetach.Connect(entityGfx.OnRenderableDetach, [this, graphicsEntity](GraphicsComponent* gfx, std::size_t renderableIndex)
+			graphicsEntity.onRenderableDetach.Connect(entityGfx.OnRenderableDetach, [this, entity](GraphicsComponent* /*gfx*/, std::size_t renderableIndex)
 			{
-				if (!gfx->IsVisible())
+				GraphicsEntity& graphicsData = m_graphicsEntities.get(entity);
+				if (graphicsData.renderableIndices[renderableIndex] == NoInstance)
 					return;
 
-				m_pipeline->UnregisterRenderable(graphicsEntity->renderableIndices[renderableIndex]);
+				m_pipeline->UnregisterRenderable(graphicsData.renderableIndices[renderableIndex]);
+				graphicsData.renderableIndices[renderableIndex] = NoInstance;
 			});
 
-			graphicsEntity->onScissorBoxUpdate.Connect(entityGfx.OnScissorBoxUpdate, [this, graphicsEntity](GraphicsComponent* gfx, const Recti& scissorBox)
+			graphicsEntity.onScissorBoxUpdate.Connect(entityGfx.OnScissorBoxUpdate, [this, entity](GraphicsComponent* /*gfx*/, const Recti& scissorBox)
 			{
-				if (!gfx->IsVisible())
-					return;
+				GraphicsEntity& graphicsData = m_graphicsEntities.get(entity);
 
-				for (std::size_t renderableIndex = 0; renderableIndex < LightComponent::MaxLightCount; ++renderableIndex)
+				std::array<std::size_t, GraphicsComponent::MaxRenderableCount> renderableIndices;
+				std::size_t renderableCount = 0;
+				for (std::size_t renderableIndex : graphicsData.renderableIndices)
 				{
-					const auto& renderableEntry = gfx->GetRenderableEntry(renderableIndex);
-					if (!renderableEntry.renderable)
-						continue;
-
-					m_pipeline->UpdateRenderableScissorBox(graphicsEntity->renderableIndices[renderableIndex], scissorBox);
+					if (renderableIndex != NoInstance)
+						renderableIndices[renderableCount++] = renderableIndex;
 				}
+
+				if (renderableCount > 0)
+					m_pipeline->UpdateRenderableScissorBoxes(renderableCount, renderableIndices.data(), scissorBox);
 			});
 
-			graphicsEntity->onVisibilityUpdate.Connect(entityGfx.OnVisibilityUpdate, [this, graphicsEntity](GraphicsComponent* /*gfx*/, bool isVisible)
+			graphicsEntity.onVisibilityUpdate.Connect(entityGfx.OnVisibilityUpdate, [this, entity](GraphicsComponent* /*gfx*/, bool isVisible)
 			{
-				if (isVisible)
-				{
-					m_newlyHiddenGfxEntities.erase(graphicsEntity);
-					m_newlyVisibleGfxEntities.insert(graphicsEntity);
-				}
-				else
-				{
-					m_newlyHiddenGfxEntities.insert(graphicsEntity);
-					m_newlyVisibleGfxEntities.erase(graphicsEntity);
-				}
+				entt::sparse_set& addedSet = (isVisible) ? m_newlyVisibleGfxEntities : m_newlyHiddenGfxEntities;
+				entt::sparse_set& removedSet = (isVisible) ? m_newlyHiddenGfxEntities : m_newlyVisibleGfxEntities;
+
+				removedSet.remove(entity);
+				if (!addedSet.contains(entity))
+					addedSet.emplace(entity);
 			});
-			m_invalidatedGfxWorldNode.insert(graphicsEntity);
 
-			if (entityGfx.IsVisible())
-				m_newlyVisibleGfxEntities.insert(graphicsEntity);
+			m_invalidatedGfxWorldNode.emplace(entity);
 
-			assert(m_graphicsEntities.find(entity) == m_graphicsEntities.end());
-			m_graphicsEntities.emplace(entity, graphicsEntity);
+			if (entityGfx.IsVisible())
+				m_newlyVisibleGfxEntities.emplace(entity);
 		});
 
 		m_lightConstructObserver.each([&](entt::entity entity)
 		{
 			LightComponent& entityLight = m_registry.get<LightComponent>(entity);
-			NodeComponent& entityNode = m_registry.get<NodeComponent>(entity);
 
-			std::size_t poolIndex;
-			LightEntity* lightEntity = m_lightEntityPool.Allocate(poolIndex);
-			lightEntity->entity = entity;
-			lightEntity->poolIndex = poolIndex;
-			lightEntity->onNodeInvalidation.Connect(entityNode.OnNodeInvalidation, [this, lightEntity](const Node* /*node*/)
-			{
-				m_invalidatedLightWorldNode.insert(lightEntity);
-			});
-
-			lightEntity->onNodeInvalidation.Connect(entityNode.OnNodeInvalidation, [this, lightEntity](const Node* /*node*/)
-			{
-				m_invalidatedLightWorldNode.insert(lightEntity);
-			});
+			assert(!m_lightEntities.contains(entity));
+			LightEntity& lightEntity = m_lightEntities.emplace(entity);
+			lightEntity.lightIndices.fill(NoInstance);
 
-			lightEntity->onLightAttached.Connect(entityLight.OnLightAttached, [this, lightEntity](LightComponent* light, std::size_t lightIndex)
+			lightEntity.onLightAttached.Connect(entityLight.OnLightAttached, [this, entity](LightComponent* light, std::size_t lightIndex)
 			{
 				if (!light->IsVisible())
 					return;
 
+				LightEntity& lightData = m_lightEntities.get(entity);
+				if (lightData.lightIndices[lightIndex] != NoInstance)
+					return;
+
 				const auto& lightEntry = light->GetLightEntry(lightIndex);
-				lightEntity->lightIndices[lightIndex] =	m_pipeline->RegisterLight(lightEntry.light.get(), lightEntry.renderMask);
+				lightData.lightIndices[lightIndex] = m_pipeline->RegisterLight(lightEntry.light.get(), lightEntry.renderMask);
 			});
 
-			lightEntity->onLightDetach.Connect(entityLight.OnLightDetach, [this, lightEntity](LightComponent* light, std::size_t lightIndex)
+			lightEntity.onLightDetach.Connect(entityLight.OnLightDetach, [this, entity](LightComponent* /*light*/, std::size_t lightIndex)
 			{
-				if (!light->IsVisible())
+				LightEntity& lightData = m_lightEntities.get(entity);
+				if (lightData.lightIndices[lightIndex] == NoInstance)
 					return;
 
-				m_pipeline->UnregisterLight(lightEntity->lightIndices[lightIndex]);
+				m_pipeline->UnregisterLight(lightData.lightIndices[lightIndex]);
+				lightData.lightIndices[lightIndex] = NoInstance;
 			});
 
-			lightEntity->onVisibilityUpdate.Connect(entityLight.OnVisibilityUpdate, [this, lightEntity](LightComponent* /*light*/, bool isVisible)
+			lightEntity.onVisibilityUpdate.Connect(entityLight.OnVisibilityUpdate, [this, entity](LightComponent* /*light*/, bool isVisible)
 			{
-				if (isVisible)
-				{
-					m_newlyHiddenLightEntities.erase(lightEntity);
-					m_newlyVisibleLightEntities.insert(lightEntity);
-				}
-				else
-				{
-					m_newlyHiddenLightEntities.insert(lightEntity);
-					m_newlyVisibleLightEntities.erase(lightEntity);
-				}
+				entt::sparse_set& addedSet = (isVisible) ? m_newlyVisibleLightEntities : m_newlyHiddenLightEntities;
+				entt::sparse_set& removedSet = (isVisible) ? m_newlyHiddenLightEntities : m_newlyVisibleLightEntities;
+
+				removedSet.remove(entity);
+				if (!addedSet.contains(entity))
+					addedSet.emplace(entity);
 			});
 
-			m_invalidatedLightWorldNode.insert(lightEntity);
+			m_invalidatedLightWorldNode.emplace(entity);
 
 			if (entityLight.IsVisible())
-			{
-				for (std::size_t lightIndex = 0; lightIndex < LightComponent::MaxLightCount; ++lightIndex)
-				{
-					const auto& lightEntry = entityLight.GetLightEntry(lightIndex);
-					if (!lightEntry.light)
-						continue;
-
-					lightEntity->lightIndices[lightIndex] = m_pipeline->RegisterLight(lightEntry.light.get(), lightEntry.renderMask);
-				}
-			}
-
-			assert(m_lightEntities.find(entity) == m_lightEntities.end());
-			m_lightEntities.emplace(entity, lightEntity);
+				m_newlyVisibleLightEntities.emplace(entity);
 		});
 
 		m_sharedSkeletonConstructObserver.each([&](entt::entity entity)
 		{
-			GraphicsEntity* graphicsEntity = Retrieve(m_graphicsEntities, entity);
+			GraphicsEntity& graphicsEntity = m_graphicsEntities.get(entity);
 
 			SharedSkeletonComponent& skeletonComponent = m_registry.get<SharedSkeletonComponent>(entity);
 			const std::shared_ptr<Skeleton>& skeleton = skeletonComponent.GetSkeleton();
@@ -434,92 +421,118 @@ namespace Nz
 				sharedSkeleton.skeletonInstanceIndex = m_pipeline->RegisterSkeleton(std::make_shared<SkeletonInstance>(skeleton));
 				sharedSkeleton.useCount = 1;
 
-				graphicsEntity->skeletonInstanceIndex = sharedSkeleton.skeletonInstanceIndex;
+				graphicsEntity.skeletonInstanceIndex = sharedSkeleton.skeletonInstanceIndex;
 			}
 			else
 			{
 				it->second.useCount++;
-				graphicsEntity->skeletonInstanceIndex = it->second.skeletonInstanceIndex;
+				graphicsEntity.skeletonInstanceIndex = it->second.skeletonInstanceIndex;
 			}
 		});
 
 		m_skeletonConstructObserver.each([&](entt::entity entity)
 		{
-			GraphicsEntity* graphicsEntity = Retrieve(m_graphicsEntities, entity);
+			GraphicsEntity& graphicsEntity = m_graphicsEntities.get(entity);
 
 			SkeletonComponent& skeletonComponent = m_registry.get<SkeletonComponent>(entity);
 			const std::shared_ptr<Skeleton>& skeleton = skeletonComponent.GetSkeleton();
 
-			graphicsEntity->skeletonInstanceIndex = m_pipeline->RegisterSkeleton(std::make_shared<SkeletonInstance>(skeleton));
+			graphicsEntity.skeletonInstanceIndex = m_pipeline->RegisterSkeleton(std::make_shared<SkeletonInstance>(skeleton));
 		});
 	}
 
 	void RenderSystem::UpdateVisibility()
 	{
-		// Unregister drawable for hidden entities
-		for (GraphicsEntity* graphicsEntity : m_newlyHiddenGfxEntities)
+		// Unregister renderables of hidden entities along with the ones of destroyed entities
+		for (entt::entity entity : m_newlyHiddenGfxEntities)
 		{
-			GraphicsComponent& entityGfx = m_registry.get<GraphicsComponent>(graphicsEntity->entity);
+			GraphicsEntity& graphicsEntity = m_graphicsEntities.get(entity);
 
-			for (std::size_t renderableIndex = 0; renderableIndex < GraphicsComponent::MaxRenderableCount; ++renderableIndex)
+			for (std::size_t& renderableIndex : graphicsEntity.renderableIndices)
 			{
-				const auto& renderableEntry = entityGfx.GetRenderableEntry(renderableIndex);
-				if (!renderableEntry.renderable)
+				if (renderableIndex == NoInstance)
 					continue;
 
-				m_pipeline->UnregisterRenderable(graphicsEntity->renderableIndices[renderableIndex]);
+				m_removedRenderableIndices.push_back(renderableIndex);
+				renderableIndex = NoInstance;
 			}
 		}
 		m_newlyHiddenGfxEntities.clear();
 
-		// Register drawable for newly visible entities
-		for (GraphicsEntity* graphicsEntity : m_newlyVisibleGfxEntities)
+		if (!m_removedRenderableIndices.empty())
 		{
-			GraphicsComponent& entityGfx = m_registry.get<GraphicsComponent>(graphicsEntity->entity);
+			m_pipeline->UnregisterRenderables(m_removedRenderableIndices.size(), m_removedRenderableIndices.data());
+			m_removedRenderableIndices.clear();
+			m_removedRenderables.clear();
+		}
+
+		// Register renderables of newly visible entities
+		for (entt::entity entity : m_newlyVisibleGfxEntities)
+		{
+			GraphicsEntity& graphicsEntity = m_graphicsEntities.get(entity);
+			GraphicsComponent& entityGfx = m_registry.get<GraphicsComponent>(entity);
 
 			for (std::size_t renderableIndex = 0; renderableIndex < GraphicsComponent::MaxRenderableCount; ++renderableIndex)
 			{
 				const auto& renderableEntry = entityGfx.GetRenderableEntry(renderableIndex);
-				if (!renderableEntry.renderable)
+				if (!renderableEntry.renderable || graphicsEntity.renderableIndices[renderableIndex] != NoInstance)
 					continue;
 
-				graphicsEntity->renderableIndices[renderableIndex] = m_pipeline->RegisterRenderable(graphicsEntity->worldInstanceIndex, graphicsEntity->skeletonInstanceIndex, renderableEntry.renderable.get(), renderableEntry.renderMask, entityGfx.GetScissorBox());
+				auto& registration = m_renderableRegistrations.emplace_back();
+				registration.renderable = renderableEntry.renderable.get();
+				registration.renderMask = renderableEntry.renderMask;
+				registration.scissorBox = entityGfx.GetScissorBox();
+				registration.skeletonInstanceIndex = graphicsEntity.skeletonInstanceIndex;
+				registration.worldInstanceIndex = graphicsEntity.worldInstanceIndex;
+
+				m_renderableRegistrationTargets.push_back(&graphicsEntity.renderableIndices[renderableIndex]);
 			}
 		}
 		m_newlyVisibleGfxEntities.clear();
 
-		// Unregister lights for hidden entities
-		for (LightEntity* lightEntity : m_newlyHiddenLightEntities)
+		if (!m_renderableRegistrations.empty())
 		{
-			LightComponent& entityLights = m_registry.get<LightComponent>(lightEntity->entity);
+			m_renderableIndices.resize(m_renderableRegistrations.size());
+			m_pipeline->RegisterRenderables(m_renderableRegistrations.size(), m_renderableRegistrations.data(), m_renderableIndices.data());
 
-			for (std::size_t lightIndex = 0; lightIndex < LightComponent::MaxLightCount; ++lightIndex)
+			for (std::size_t i = 0; i < m_renderableIndices.size(); ++i)
+				*m_renderableRegistrationTargets[i] = m_renderableIndices[i];
+
+			m_renderableRegistrations.clear();
+			m_renderableRegistrationTargets.clear();
+		}
+
+		// Unregister lights of hidden entities
+		for (entt::entity entity : m_newlyHiddenLightEntities)
+		{
+			LightEntity& lightEntity = m_lightEntities.get(entity);
+
+			for (std::size_t& lightIndex : lightEntity.lightIndices)
 			{
-				const auto& lightEntry = entityLights.GetLightEntry(lightIndex);
-				if (!lightEntry.light)
+				if (lightIndex == NoInstance)
 					continue;
 
-				m_pipeline->UnregisterLight(lightEntity->lightIndices[lightIndex]);
+				m_pipeline->UnregisterLight(lightIndex);
+				lightIndex = NoInstance;
 			}
 		}
-		m_newlyHiddenGfxEntities.clear();
+		m_newlyHiddenLightEntities.clear();
 
-		// Register lights for newly visible entities
-		for (LightEntity* lightEntity : m_newlyVisibleLightEntities)
+		// Register lights of newly visible entities
+		for (entt::entity entity : m_newlyVisibleLightEntities)
 		{
-			LightComponent& entityLights = m_registry.get<LightComponent>(lightEntity->entity);
+			LightEntity& lightEntity = m_lightEntities.get(entity);
+			LightComponent& entityLights = m_registry.get<LightComponent>(entity);
 
-			for (std::size_t renderableIndex = 0; renderableIndex < LightComponent::MaxLightCount; ++renderableIndex)
+			for (std::size_t lightIndex = 0; lightIndex < LightComponent::MaxLightCount; ++lightIndex)
 			{
-				const auto& lightEntry = entityLights.GetLightEntry(renderableIndex);
-				if (!lightEntry.light)
+				const auto& lightEntry = entityLights.GetLightEntry(lightIndex);
+				if (!lightEntry.light || lightEntity.lightIndices[lightIndex] != NoInstance)
 					continue;
 
-				lightEntity->lightIndices[renderableIndex] = m_pipeline->RegisterLight(lightEntry.light.get(), lightEntry.renderMask);
+				lightEntity.lightIndices[lightIndex] = m_pipeline->RegisterLight(lightEntry.light.get(), lightEntry.renderMask);
 			}
 		}
-		m_newlyVisibleGfxEntities.clear();
-
-		//FIXME: Handle light visibility
+		m_newlyVisibleLightEntities.clear();
 	}
 }
@@ -16,10 +16,16 @@ namespace Nz
 {
 	TextSprite::TextSprite(std::shared_ptr<MaterialInstance> material) :
 	InstancedRenderable(),
-	m_material(std::move(material))
+	m_material(std::move(material)),
+	m_hasDefaultMaterial(false),
+	m_hasDistanceFieldMaterial(false)
 	{
 		if (!m_material)
-			m_material = Graphics::Instance()->GetDefaultMaterials().basicTransparent->Clone();
+		{
+			// Default material follows the glyph render mode of the drawer fonts, see Update
+			m_material = GetDefaultMaterial(GlyphRenderMode::Bitmap)->Clone();
+			m_hasDefaultMaterial = true;
+		}
 	}
 
 	void TextSprite::BuildElement(ElementRendererRegistry& registry, const ElementData& elementData, std::size_t passIndex, std::vector<RenderElementOwner>& elements) const
@@ -36,7 +42,7 @@ namespace Nz
 			0,
 			vertexDeclaration
 		};
-		const auto& renderPipeline = materialPipeline->GetRenderPipeline(&vertexBufferData, 1);
+		const auto& renderPipeline = materialPipeline->TryGetRenderPipeline(&vertexBufferData, 1);
 
 		for (auto& pair : m_renderInfos)
 		{
@@ -94,6 +100,28 @@ namespace Nz
 			it->second.used = true;
 		}
 
+		if (m_hasDefaultMaterial)
+		{
+			// Distance field glyphes need a material able to resolve them
+			bool hasDistanceFieldFont = false;
+			for (std::size_t i = 0; i < fontCount; ++i)
+			{
+				if (drawer.GetFont(i)->GetGlyphRenderMode() == GlyphRenderMode::SignedDistanceField)
+				{
+					hasDistanceFieldFont = true;
+					break;
+				}
+			}
+
+			if (m_hasDistanceFieldMaterial != hasDistanceFieldFont)
+			{
+				std::shared_ptr<MaterialInstance> newMaterial = GetDefaultMaterial((hasDistanceFieldFont) ? GlyphRenderMode::SignedDistanceField : GlyphRenderMode::Bitmap)->Clone();
+				OnMaterialInvalidated(this, 0, newMaterial);
+				m_material = std::move(newMaterial);
+				m_hasDistanceFieldMaterial = hasDistanceFieldFont;
+			}
+		}
+
 		// Remove unused atlas slots
 		auto atlasIt = m_atlases.begin();
 		while (atlasIt != m_atlases.end())
@@ -220,6 +248,18 @@ namespace Nz
 		clearOnFail.Reset();
 	}
 
+	/*!
+	* \brief Returns the material used by text sprites created without one
+	* \return Basic transparent material, with distance field resolution for the SignedDistanceField render mode
+	*
+	* \param renderMode Glyph render mode of the drawn fonts
+	*/
+	const std::shared_ptr<MaterialInstance>& TextSprite::GetDefaultMaterial(GlyphRenderMode renderMode)
+	{
+		const auto& defaultMaterials = Graphics::Instance()->GetDefaultMaterials();
+		return (renderMode == GlyphRenderMode::SignedDistanceField) ? defaultMaterials.basicDistanceField : defaultMaterials.basicTransparent;
+	}
+
 	/*!
 	* \brief Handle the invalidation of an atlas
 	*
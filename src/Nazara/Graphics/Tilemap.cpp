@@ -6,6 +6,8 @@
 #include <Nazara/Graphics/ElementRendererRegistry.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/RenderSpriteChain.hpp>
+#include <Nazara/Graphics/WorldInstance.hpp>
+#include <Nazara/Math/BoundingVolume.hpp>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -21,15 +23,18 @@ namespace Nz
 	* To use it, you have to enable some tiles.
 	*
 	* \remark The default material is used for every material requested
+	*
+	* \remark Tiles are grouped in chunks of ChunkSize x ChunkSize tiles, only the vertices of modified chunks are rebuilt
+	* and chunks outside of the view frustum are not rendered
 	*/
 	Tilemap::Tilemap(const Vector2ui& mapSize, const Vector2f& tileSize, std::size_t materialCount) :
 	m_tiles(mapSize.x* mapSize.y),
 	m_layers(materialCount),
+	m_chunkCount((mapSize.x + ChunkSize - 1) / ChunkSize, (mapSize.y + ChunkSize - 1) / ChunkSize),
 	m_mapSize(mapSize),
 	m_tileSize(tileSize),
 	m_origin(0.f, 0.f),
-	m_isometricModeEnabled(false),
-	m_shouldRebuildVertices(false)
+	m_isometricModeEnabled(false)
 	{
 		NazaraAssert(m_tiles.size() != 0U, "Invalid map size");
 		NazaraAssert(m_tileSize.x > 0 && m_tileSize.y > 0, "Invalid tile size");
@@ -39,13 +44,32 @@ namespace Nz
 		for (auto& layer : m_layers)
 			layer.material = defaultMaterialInstance;
 
+		m_chunks.resize(m_chunkCount.x * m_chunkCount.y);
+
 		UpdateAABB();
 	}
 
 	void Tilemap::BuildElement(ElementRendererRegistry& registry, const ElementData& elementData, std::size_t passIndex, std::vector<RenderElementOwner>& elements) const
 	{
-		if (m_shouldRebuildVertices)
-			UpdateVertices();
+		// Only chunks having enabled tiles and intersecting the frustum are rendered
+		m_visibleChunks.clear();
+		for (std::size_t chunkIndex = 0; chunkIndex < m_chunks.size(); ++chunkIndex)
+		{
+			const Chunk& chunk = m_chunks[chunkIndex];
+			if (chunk.enabledTileCount == 0)
+				continue;
+
+			if (elementData.frustum && !IsChunkVisible(chunk, *elementData.frustum, elementData.worldInstance->GetWorldMatrix()))
+				continue;
+
+			if (chunk.shouldRebuildVertices)
+				UpdateChunkVertices(chunkIndex);
+
+			m_visibleChunks.push_back(chunkIndex);
+		}
+
+		if (m_visibleChunks.empty())
+			return;
 
 		const std::shared_ptr<VertexDeclaration>& vertexDeclaration = VertexDeclaration::Get(VertexLayout::XYZ_Color_UV);
 
@@ -56,12 +80,9 @@ namespace Nz
 
 		const auto& whiteTexture = Graphics::Instance()->GetDefaultTextures().whiteTextures[UnderlyingCast(ImageType::E2D)];
 
-		const VertexStruct_XYZ_Color_UV* vertices = reinterpret_cast<const VertexStruct_XYZ_Color_UV*>(m_vertices.data());
 		for (std::size_t layerIndex = 0; layerIndex < m_layers.size(); ++layerIndex)
 		{
 			const auto& layer = m_layers[layerIndex];
-			if (!layer.enabledTiles.TestAny())
-				continue;
 
 			const auto& materialPipeline = layer.material->GetPipeline(passIndex);
 			if (!materialPipeline)
@@ -69,15 +90,38 @@ namespace Nz
 
 			MaterialPassFlags passFlags = layer.material->GetPassFlags(passIndex);
 
-			const auto& renderPipeline = materialPipeline->GetRenderPipeline(&vertexBufferData, 1);
+			const auto& renderPipeline = materialPipeline->TryGetRenderPipeline(&vertexBufferData, 1);
+
+			for (std::size_t chunkIndex : m_visibleChunks)
+			{
+				const Chunk& chunk = m_chunks[chunkIndex];
+
+				std::size_t firstSprite = chunk.layerSpriteOffsets[layerIndex];
+				std::size_t spriteCount = chunk.layerSpriteOffsets[layerIndex + 1] - firstSprite;
+				if (spriteCount == 0)
+					continue;
 
-			std::size_t spriteCount = layer.enabledTileCount;
-			elements.emplace_back(registry.AllocateElement<RenderSpriteChain>(GetRenderLayer(), layer.material, passFlags, renderPipeline, *elementData.worldInstance, vertexDeclaration, whiteTexture, spriteCount, vertices, *elementData.scissorBox));
+				const VertexStruct_XYZ_Color_UV* vertices = &chunk.vertices[4 * firstSprite];
+				elements.emplace_back(registry.AllocateElement<RenderSpriteChain>(GetRenderLayer(), layer.material, passFlags, renderPipeline, *elementData.worldInstance, vertexDeclaration, whiteTexture, spriteCount, vertices, *elementData.scissorBox));
+			}
+		}
+	}
+
+	std::size_t Tilemap::ComputeVisibilityHash(const Frustumf& frustum, const Matrix4f& worldMatrix) const
+	{
+		std::size_t visibilityHash = 0;
+		for (std::size_t chunkIndex = 0; chunkIndex < m_chunks.size(); ++chunkIndex)
+		{
+			const Chunk& chunk = m_chunks[chunkIndex];
+			if (chunk.enabledTileCount == 0 || !IsChunkVisible(chunk, frustum, worldMatrix))
+				continue;
 
-			vertices += 4 * spriteCount;
+			visibilityHash = visibilityHash * 23 + chunkIndex + 1;
 		}
+
+		return visibilityHash;
 	}
-	
+
 	const std::shared_ptr<MaterialInstance>& Tilemap::GetMaterial(std::size_t i) const
 	{
 		assert(i < m_layers.size());
@@ -114,7 +158,57 @@ namespace Nz
 		return Vector3ui::Unit(); //< prevents division by zero
 	}
 
-	void Tilemap::UpdateVertices() const
+	bool Tilemap::IsChunkVisible(const Chunk& chunk, const Frustumf& frustum, const Matrix4f& worldMatrix) const
+	{
+		BoundingVolumef boundingVolume(chunk.aabb);
+		boundingVolume.Update(worldMatrix);
+
+		return frustum.Contains(boundingVolume);
+	}
+
+	void Tilemap::UpdateAABB()
+	{
+		Vector2f size = GetSize();
+		InstancedRenderable::UpdateAABB(Rectf(-m_origin * size, size));
+
+		// Chunk bounds cover all their tiles (enabled or not) so they don't change when tiles are enabled or disabled
+		float topCorner = m_tileSize.y * (m_mapSize.y - 1);
+		Vector2f originShift = m_origin * size;
+
+		for (unsigned int chunkY = 0; chunkY < m_chunkCount.y; ++chunkY)
+		{
+			unsigned int firstY = chunkY * ChunkSize;
+			unsigned int lastY = std::min(firstY + ChunkSize, m_mapSize.y) - 1;
+
+			for (unsigned int chunkX = 0; chunkX < m_chunkCount.x; ++chunkX)
+			{
+				unsigned int firstX = chunkX * ChunkSize;
+				unsigned int lastX = std::min(firstX + ChunkSize, m_mapSize.x) - 1;
+
+				Vector2f minPos;
+				Vector2f maxPos;
+				if (m_isometricModeEnabled)
+				{
+					// Odd lines are shifted by half a tile
+					minPos.Set(firstX * m_tileSize.x, topCorner - lastY / 2.f * m_tileSize.y);
+					maxPos.Set((lastX + 1) * m_tileSize.x + m_tileSize.x / 2.f, topCorner - firstY / 2.f * m_tileSize.y + m_tileSize.y);
+				}
+				else
+				{
+					minPos.Set(firstX * m_tileSize.x, topCorner - lastY * m_tileSize.y);
+					maxPos.Set((lastX + 1) * m_tileSize.x, topCorner - firstY * m_tileSize.y + m_tileSize.y);
+				}
+
+				minPos -= originShift;
+				maxPos -= originShift;
+
+				Vector2f chunkSize = maxPos - minPos;
+				m_chunks[chunkY * m_chunkCount.x + chunkX].aabb = Boxf(minPos.x, minPos.y, 0.f, chunkSize.x, chunkSize.y, 0.f);
+			}
+		}
+	}
+
+	void Tilemap::UpdateChunkVertices(std::size_t chunkIndex) const
 	{
 		std::array<Vector2f, RectCornerCount> cornerExtent;
 		cornerExtent[UnderlyingCast(RectCorner::LeftBottom)] = Vector2f(0.f, 0.f);
@@ -122,24 +216,42 @@ namespace Nz
 		cornerExtent[UnderlyingCast(RectCorner::LeftTop)] = Vector2f(0.f, 1.f);
 		cornerExtent[UnderlyingCast(RectCorner::RightTop)] = Vector2f(1.f, 1.f);
 
-		std::size_t spriteCount = 0;
-		for (const Layer& layer : m_layers)
-			spriteCount += layer.enabledTileCount;
+		Chunk& chunk = m_chunks[chunkIndex];
+
+		unsigned int firstX = (chunkIndex % m_chunkCount.x) * ChunkSize;
+		unsigned int firstY = (chunkIndex / m_chunkCount.x) * ChunkSize;
+		unsigned int endX = std::min(firstX + ChunkSize, m_mapSize.x);
+		unsigned int endY = std::min(firstY + ChunkSize, m_mapSize.y);
+
+		// Sprites are sorted by layer, count them to know where each layer begins
+		chunk.layerSpriteOffsets.assign(m_layers.size() + 1, 0);
+		for (unsigned int y = firstY; y < endY; ++y)
+		{
+			for (unsigned int x = firstX; x < endX; ++x)
+			{
+				const Tile& tile = m_tiles[y * m_mapSize.x + x];
+				if (tile.enabled)
+					chunk.layerSpriteOffsets[tile.layerIndex + 1]++;
+			}
+		}
 
-		m_vertices.resize(spriteCount * 4);
-		VertexStruct_XYZ_Color_UV* vertexPtr = m_vertices.data();
+		for (std::size_t layerIndex = 0; layerIndex < m_layers.size(); ++layerIndex)
+			chunk.layerSpriteOffsets[layerIndex + 1] += chunk.layerSpriteOffsets[layerIndex];
+
+		assert(chunk.layerSpriteOffsets.back() == chunk.enabledTileCount);
+		chunk.vertices.resize(chunk.enabledTileCount * 4);
 
 		float topCorner = m_tileSize.y * (m_mapSize.y - 1);
 		Vector2f originShift = m_origin * GetSize();
 
-		for (const Layer& layer : m_layers)
+		m_layerSpriteIndices.assign(chunk.layerSpriteOffsets.begin(), chunk.layerSpriteOffsets.end() - 1);
+		for (unsigned int y = firstY; y < endY; ++y)
 		{
-			for (std::size_t tileIndex = layer.enabledTiles.FindFirst(); tileIndex != layer.enabledTiles.npos; tileIndex = layer.enabledTiles.FindNext(tileIndex))
+			for (unsigned int x = firstX; x < endX; ++x)
 			{
-				const Tile& tile = m_tiles[tileIndex];
-
-				std::size_t x = tileIndex % m_mapSize.x;
-				std::size_t y = tileIndex / m_mapSize.x;
+				const Tile& tile = m_tiles[y * m_mapSize.x + x];
+				if (!tile.enabled)
+					continue;
 
 				Vector3f tileLeftBottom;
 				if (m_isometricModeEnabled)
@@ -147,6 +259,7 @@ namespace Nz
 				else
 					tileLeftBottom.Set(x * m_tileSize.x, topCorner - y * m_tileSize.y, 0.f);
 
+				VertexStruct_XYZ_Color_UV* vertexPtr = &chunk.vertices[4 * m_layerSpriteIndices[tile.layerIndex]++];
 				for (RectCorner corner : { RectCorner::LeftBottom, RectCorner::RightBottom, RectCorner::LeftTop, RectCorner::RightTop })
 				{
 					vertexPtr->color = tile.color;
@@ -158,6 +271,6 @@ namespace Nz
 			}
 		}
 
-		m_shouldRebuildVertices = false;
+		chunk.shouldRebuildVertices = false;
 	}
 }
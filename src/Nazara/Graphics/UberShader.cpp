@@ -4,11 +4,15 @@
 
 #include <Nazara/Graphics/UberShader.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ParallelFor.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Renderer/RenderDevice.hpp>
+#include <Nazara/Renderer/ShaderCache.hpp>
 #include <NZSL/Ast/ReflectVisitor.hpp>
 #include <NZSL/Ast/SanitizeVisitor.hpp>
+#include <cassert>
 #include <limits>
+#include <optional>
 #include <stdexcept>
 #include <Nazara/Graphics/Debug.hpp>
 
@@ -20,12 +24,17 @@ namespace Nz
 	}
 
 	UberShader::UberShader(nzsl::ShaderStageTypeFlags shaderStages, nzsl::ModuleResolver& moduleResolver, std::string moduleName) :
-	m_shaderStages(shaderStages)
+	m_compiledCount(0),
+	m_pendingCount(0),
+	m_shaderStages(shaderStages),
+	m_precompilationThreadCount(0),
+	m_isPrecompiling(false)
 	{
 		m_shaderModule = moduleResolver.Resolve(moduleName);
 		NazaraAssert(m_shaderModule, "invalid shader module");
 
 		m_shaderModule = Validate(*m_shaderModule, &m_optionIndexByName);
+		m_shaderModuleKey = ShaderCache::ComputeModuleKey(*m_shaderModule);
 
 		m_onShaderModuleUpdated.Connect(moduleResolver.OnModuleUpdated, [this, name = std::move(moduleName)](nzsl::ModuleResolver* resolver, const std::string& updatedModuleName)
 		{
@@ -39,9 +48,13 @@ namespace Nz
 				return;
 			}
 
+			// Workers compile from the current module, let them finish before replacing it
+			WaitForPrecompilation();
+
 			try
 			{
 				m_shaderModule = Validate(*newShaderModule, &m_optionIndexByName);
+				m_shaderModuleKey = ShaderCache::ComputeModuleKey(*m_shaderModule);
 			}
 			catch (const std::exception& e)
 			{
@@ -50,45 +63,284 @@ namespace Nz
 			}
 
 			// Clear cache
-			m_combinations.clear();
+			{
+				std::unique_lock lock(m_combinationMutex);
+				m_combinations.clear();
+			}
 
 			OnShaderUpdated(this);
 		});
 	}
 
 	UberShader::UberShader(nzsl::ShaderStageTypeFlags shaderStages, nzsl::Ast::ModulePtr shaderModule) :
+	m_compiledCount(0),
+	m_pendingCount(0),
 	m_shaderModule(std::move(shaderModule)),
-	m_shaderStages(shaderStages)
+	m_shaderStages(shaderStages),
+	m_precompilationThreadCount(0),
+	m_isPrecompiling(false)
 	{
 		NazaraAssert(m_shaderModule, "invalid shader module");
 
 		Validate(*m_shaderModule, &m_optionIndexByName);
+		m_shaderModuleKey = ShaderCache::ComputeModuleKey(*m_shaderModule);
 	}
 
-	const std::shared_ptr<ShaderModule>& UberShader::Get(const Config& config)
+	UberShader::~UberShader()
 	{
-		auto it = m_combinations.find(config);
-		if (it == m_combinations.end())
+		// Skip permutations which didn't start compiling yet
+		{
+			std::unique_lock lock(m_combinationMutex);
+			m_pendingCount -= m_precompilationQueue.size();
+			m_precompilationQueue.clear();
+		}
+
+		WaitForPrecompilation();
+	}
+
+	std::shared_ptr<ShaderModule> UberShader::Get(const Config& config)
+	{
+		std::unique_lock lock(m_combinationMutex);
+
+		// Precompilation may insert combinations and rehash the map while the lock is released, only keep a reference to the element
+		Combination& combination = m_combinations.try_emplace(config).first->second;
+		if (combination.isPending)
+		{
+			// Permutation is being compiled in the background, waiting for it is cheaper than compiling it again
+			m_combinationCondition.wait(lock, [&] { return !combination.isPending; });
+		}
+
+		if (!combination.shaderModule)
 		{
-			nzsl::ShaderWriter::States states;
-			// TODO: Remove this when arrays are accepted as config values
-			for (const auto& [optionHash, optionValue] : config.optionValues)
+			combination.isPending = true;
+			lock.unlock();
+
+			std::shared_ptr<ShaderModule> shaderModule;
+			try
 			{
-				std::uint32_t hash = optionHash;
-				
-				std::visit([&](auto&& arg)
-				{
-					states.optionValues[hash] = arg;
-				}, optionValue);
+				shaderModule = Compile(config);
+			}
+			catch (...)
+			{
+				lock.lock();
+				combination.isPending = false;
+				m_combinationCondition.notify_all();
+				throw;
+			}
+
+			lock.lock();
+			combination.shaderModule = std::move(shaderModule);
+			combination.isPending = false;
+			m_compiledCount++;
+
+			m_combinationCondition.notify_all();
+		}
+
+		return combination.shaderModule;
+	}
+
+	std::size_t UberShader::Precompile(const std::vector<Config>& configs, unsigned int maxThreadCount)
+	{
+		std::unique_lock lock(m_combinationMutex);
+
+		std::size_t queuedCount = 0;
+		for (const Config& config : configs)
+		{
+			auto it = m_combinations.find(config);
+			if (it != m_combinations.end() && (it->second.isPending || it->second.shaderModule))
+				continue;
+
+			if (it == m_combinations.end())
+				it = m_combinations.emplace(config, Combination{}).first;
+
+			it->second.isPending = true;
+			m_precompilationQueue.push_back(config);
+			queuedCount++;
+		}
+
+		if (queuedCount == 0)
+			return 0;
+
+		m_pendingCount += queuedCount;
+		m_precompilationThreadCount = maxThreadCount;
+
+		if (!m_isPrecompiling)
+		{
+			// Previous precompilation thread has nothing left to do and is exiting (it doesn't lock the mutex after clearing m_isPrecompiling)
+			if (m_precompilationThread.joinable())
+				m_precompilationThread.join();
+
+			m_isPrecompiling = true;
+			m_precompilationThread = std::thread(&UberShader::RunPrecompilation, this);
+		}
+
+		return queuedCount;
+	}
+
+	std::shared_ptr<ShaderModule> UberShader::TryGet(const Config& config)
+	{
+		{
+			std::unique_lock lock(m_combinationMutex);
+
+			auto it = m_combinations.find(config);
+			if (it != m_combinations.end())
+			{
+				if (it->second.isPending)
+					return nullptr;
+
+				if (it->second.shaderModule)
+					return it->second.shaderModule;
 			}
-			states.shaderModuleResolver = Graphics::Instance()->GetShaderModuleResolver();
+		}
+
+		// First request of this permutation (or its last compilation failed), compile it in the background
+		Precompile({ config });
+		return nullptr;
+	}
 
-			std::shared_ptr<ShaderModule> stage = Graphics::Instance()->GetRenderDevice()->InstantiateShaderModule(m_shaderStages, *m_shaderModule, std::move(states));
+	void UberShader::WaitForPrecompilation()
+	{
+		std::thread precompilationThread;
+		{
+			std::unique_lock lock(m_combinationMutex);
+			m_combinationCondition.wait(lock, [&] { return !m_isPrecompiling; });
 
-			it = m_combinations.emplace(config, std::move(stage)).first;
+			precompilationThread = std::move(m_precompilationThread);
 		}
 
-		return it->second;
+		if (precompilationThread.joinable())
+			precompilationThread.join();
+	}
+
+	std::vector<UberShader::Config> UberShader::EnumerateConfigs(const Config& baseConfig, const std::vector<OptionVariations>& optionVariations)
+	{
+		std::size_t configCount = 1;
+		for (const OptionVariations& variations : optionVariations)
+			configCount *= variations.values.size();
+
+		std::vector<Config> configs;
+		if (configCount == 0)
+			return configs;
+
+		configs.reserve(configCount);
+
+		// Cartesian product of every option values, the first option varies the fastest
+		std::vector<std::size_t> valueIndices(optionVariations.size(), 0);
+		for (std::size_t i = 0; i < configCount; ++i)
+		{
+			Config& config = configs.emplace_back(baseConfig);
+			for (std::size_t j = 0; j < optionVariations.size(); ++j)
+				config.optionValues[optionVariations[j].hash] = optionVariations[j].values[valueIndices[j]];
+
+			for (std::size_t j = 0; j < optionVariations.size(); ++j)
+			{
+				if (++valueIndices[j] < optionVariations[j].values.size())
+					break;
+
+				valueIndices[j] = 0;
+			}
+		}
+
+		return configs;
+	}
+
+	std::shared_ptr<ShaderModule> UberShader::Compile(const Config& config) const
+	{
+		if (m_compileCallback)
+			return m_compileCallback(*this, config);
+
+		nzsl::ShaderWriter::States states;
+		// TODO: Remove this when arrays are accepted as config values
+		for (const auto& [optionHash, optionValue] : config.optionValues)
+		{
+			std::uint32_t hash = optionHash;
+			
+			std::visit([&](auto&& arg)
+			{
+				states.optionValues[hash] = arg;
+			}, optionValue);
+		}
+		states.shaderModuleResolver = Graphics::Instance()->GetShaderModuleResolver();
+
+		const std::shared_ptr<RenderDevice>& renderDevice = Graphics::Instance()->GetRenderDevice();
+
+		std::shared_ptr<ShaderModule> stage;
+		if (std::optional<ShaderLanguage> binaryLanguage = renderDevice->GetShaderBinaryLanguage())
+		{
+			// Reuse the binary compiled during a previous run if any
+			ShaderCache& shaderCache = Graphics::Instance()->GetShaderCache();
+			UInt64 shaderKey = ShaderCache::ComputeShaderKey(m_shaderStages, m_shaderModuleKey, states, *binaryLanguage);
+
+			ByteArray binary;
+			bool hasBinary = shaderCache.Find(shaderKey, &binary);
+			if (!hasBinary && ShaderCache::CompileShader(m_shaderStages, *m_shaderModule, states, *binaryLanguage, &binary))
+			{
+				shaderCache.Insert(shaderKey, binary);
+				hasBinary = true;
+			}
+
+			if (hasBinary)
+				stage = renderDevice->InstantiateShaderModule(m_shaderStages, *binaryLanguage, binary.GetConstBuffer(), binary.GetSize(), states);
+		}
+
+		if (!stage)
+			stage = renderDevice->InstantiateShaderModule(m_shaderStages, *m_shaderModule, std::move(states));
+
+		return stage;
+	}
+
+	void UberShader::RunPrecompilation()
+	{
+		for (;;)
+		{
+			std::vector<Config> configs;
+			unsigned int threadCount;
+			{
+				std::unique_lock lock(m_combinationMutex);
+				if (m_precompilationQueue.empty())
+				{
+					m_isPrecompiling = false;
+					m_combinationCondition.notify_all();
+					return;
+				}
+
+				configs = std::move(m_precompilationQueue);
+				m_precompilationQueue.clear();
+
+				threadCount = m_precompilationThreadCount;
+			}
+
+			ParallelFor(configs.size(), 1, threadCount, [&](std::size_t begin, std::size_t end)
+			{
+				for (std::size_t i = begin; i < end; ++i)
+				{
+					std::shared_ptr<ShaderModule> shaderModule;
+					try
+					{
+						shaderModule = Compile(configs[i]);
+					}
+					catch (const std::exception& e)
+					{
+						NazaraError(std::string("failed to precompile shader permutation: ") + e.what());
+					}
+
+					std::unique_lock lock(m_combinationMutex);
+
+					auto it = m_combinations.find(configs[i]);
+					assert(it != m_combinations.end());
+
+					it->second.shaderModule = std::move(shaderModule);
+					it->second.isPending = false;
+
+					if (it->second.shaderModule)
+						m_compiledCount++;
+
+					m_pendingCount--;
+
+					m_combinationCondition.notify_all();
+				}
+			});
+		}
 	}
 
 	nzsl::Ast::ModulePtr UberShader::Validate(const nzsl::Ast::Module& module, std::unordered_map<std::string, Option>* options)
@@ -100,7 +352,8 @@ namespace Nz
 
 		nzsl::Ast::SanitizeVisitor::Options sanitizeOptions;
 		sanitizeOptions.partialSanitization = true;
-		sanitizeOptions.moduleResolver = Graphics::Instance()->GetShaderModuleResolver();
+		if (Graphics* graphics = Graphics::Instance())
+			sanitizeOptions.moduleResolver = graphics->GetShaderModuleResolver();
 
 		nzsl::Ast::ModulePtr sanitizedModule = nzsl::Ast::Sanitize(module, sanitizeOptions);
 
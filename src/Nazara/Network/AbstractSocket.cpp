@@ -7,6 +7,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Network/Algorithm.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
 #include <Nazara/Network/Win32/SocketImpl.hpp>
@@ -48,6 +49,7 @@ namespace Nz
 	*/
 
 	AbstractSocket::AbstractSocket(AbstractSocket&& abstractSocket) noexcept :
+	m_completionQueue(std::move(abstractSocket.m_completionQueue)),
 	m_protocol(abstractSocket.m_protocol),
 	m_lastError(abstractSocket.m_lastError),
 	m_handle(abstractSocket.m_handle),
@@ -79,6 +81,13 @@ namespace Nz
 		{
 			OnClose();
 
+			// Pending asynchronous operations must be cancelled before the handle can be reused
+			if (m_completionQueue)
+			{
+				m_completionQueue->Cancel(m_handle);
+				m_completionQueue = nullptr;
+			}
+
 			SocketImpl::Close(m_handle);
 			m_handle = SocketImpl::InvalidHandle;
 		}
@@ -243,6 +252,7 @@ namespace Nz
 	{
 		Close();
 
+		m_completionQueue = std::move(abstractSocket.m_completionQueue);
 		m_handle = abstractSocket.m_handle;
 		m_protocol = abstractSocket.m_protocol;
 		m_isBlockingEnabled = abstractSocket.m_isBlockingEnabled;
@@ -175,7 +175,8 @@ namespace Nz
 		if (!InitSocket(listenAddress))
 			return false;
 
-		m_address = listenAddress;
+		// Port may have been picked by the system
+		m_address = (m_socket.GetState() == SocketState::Bound) ? m_socket.GetBoundAddress() : listenAddress;
 		m_allowsIncomingConnections = (listenAddress.IsValid() && !listenAddress.IsLoopback());
 		m_randomSeed = *reinterpret_cast<UInt32*>(this);
 		m_randomSeed += s_randomGenerator();
@@ -208,6 +209,27 @@ namespace Nz
 		for (std::size_t i = 0; i < peerCount; ++i)
 			m_peers.emplace_back(this, UInt16(i));
 
+		// Datagrams are received and sent by batches, each one having its own MTU-sized buffer
+		for (DatagramBatch* batch : { &m_incomingBatch, &m_outgoingBatch })
+		{
+			batch->count = 0;
+			batch->index = 0;
+			batch->buffers.resize(ENetConstants::ENetHost_DatagramBatchSize);
+			batch->data.resize(ENetConstants::ENetHost_DatagramBatchSize);
+			batch->datagrams.resize(ENetConstants::ENetHost_DatagramBatchSize);
+			batch->peers.resize(ENetConstants::ENetHost_DatagramBatchSize);
+
+			for (std::size_t i = 0; i < ENetConstants::ENetHost_DatagramBatchSize; ++i)
+			{
+				batch->buffers[i].data = batch->data[i].data();
+				batch->buffers[i].dataLength = batch->data[i].size();
+
+				batch->datagrams[i].buffers = &batch->buffers[i];
+				batch->datagrams[i].bufferCount = 1;
+				batch->datagrams[i].dataLength = 0;
+			}
+		}
+
 		return true;
 	}
 
@@ -334,6 +356,12 @@ namespace Nz
 		m_socket.SetReceiveBufferSize(ENetConstants::ENetHost_ReceiveBufferSize);
 		m_socket.SetSendBufferSize(ENetConstants::ENetHost_SendBufferSize);
 
+		if (m_isReusePortEnabled && !m_socket.EnableReusePort(true))
+		{
+			NazaraError("Failed to enable port reuse: " + std::string(ErrorToString(m_socket.GetLastError())));
+			return false;
+		}
+
 		if (address.IsValid() && !address.IsLoopback())
 		{
 			if (m_socket.Bind(address) != SocketState::Bound)
@@ -416,6 +444,49 @@ namespace Nz
 		return false;
 	}
 
+	int ENetHost::FlushOutgoingDatagrams(ENetEvent* event)
+	{
+		int result = 0;
+
+		std::size_t datagramIndex = 0;
+		while (datagramIndex < m_outgoingBatch.count)
+		{
+			std::size_t sentCount;
+			if (!m_socket.SendDatagrams(&m_outgoingBatch.datagrams[datagramIndex], m_outgoingBatch.count - datagramIndex, &sentCount))
+			{
+				ENetPeer* peer = m_outgoingBatch.peers[datagramIndex];
+
+				SocketError lastError = m_socket.GetLastError();
+				if ((lastError == SocketError::NetworkError || lastError == SocketError::UnreachableHost) && !peer->IsConnected())
+				{
+					//< Network is down or unreachable (ex: IPv6 address when not supported), fails peer connection immediately
+					// only one event can be reported at once, other failing peers are notified without it
+					NotifyDisconnect(peer, (result == 0) ? event : nullptr, true);
+					result = 1;
+
+					// Skip this datagram and keep sending the others
+					datagramIndex++;
+					continue;
+				}
+
+				m_outgoingBatch.count = 0;
+				return -1;
+			}
+
+			// Socket would block, remaining datagrams are dropped (as they were when sent one by one)
+			if (sentCount == 0)
+				break;
+
+			for (std::size_t i = datagramIndex; i < datagramIndex + sentCount; ++i)
+				m_totalSentData += m_outgoingBatch.buffers[i].dataLength;
+
+			datagramIndex += sentCount;
+		}
+
+		m_outgoingBatch.count = 0;
+		return result;
+	}
+
 	ENetPeer* ENetHost::HandleConnect(ENetProtocolHeader* /*header*/, ENetProtocol* command)
 	{
 		if (!m_allowsIncomingConnections)
@@ -705,6 +776,7 @@ namespace Nz
 		for (unsigned int i = 0; i < 256; ++i)
 		{
 			bool shouldReceive = true;
+			UInt8* receivedData = m_packetData[0].data();
 			std::size_t receivedLength;
 
 			if (m_isSimulationEnabled)
@@ -727,11 +799,28 @@ namespace Nz
 
 			if (shouldReceive)
 			{
-				if (!m_socket.Receive(m_packetData[0].data(), m_packetData[0].size(), &m_receivedAddress, &receivedLength))
-					return -1; //< Error
+				// Receive datagrams by batches, the remaining ones from the previous batch are handled first
+				if (m_incomingBatch.index >= m_incomingBatch.count)
+				{
+					m_incomingBatch.count = 0;
+					m_incomingBatch.index = 0;
 
-				if (receivedLength == 0)
-					return 0;
+					if (!m_socket.ReceiveDatagrams(m_incomingBatch.datagrams.data(), m_incomingBatch.datagrams.size(), &m_incomingBatch.count))
+						return -1; //< Error
+
+					if (m_incomingBatch.count == 0)
+						return 0;
+				}
+
+				std::size_t datagramIndex = m_incomingBatch.index++;
+
+				const NetDatagram& datagram = m_incomingBatch.datagrams[datagramIndex];
+				if (datagram.dataLength == 0)
+					continue; //< Empty or truncated datagram
+
+				m_receivedAddress = datagram.address;
+				receivedData = m_incomingBatch.data[datagramIndex].data();
+				receivedLength = datagram.dataLength;
 
 				if (m_isSimulationEnabled)
 				{
@@ -744,7 +833,7 @@ namespace Nz
 						PendingIncomingPacket pendingPacket;
 						pendingPacket.deliveryTime = m_serviceTime + delay;
 						pendingPacket.from = m_receivedAddress;
-						pendingPacket.data.Reset(0, m_packetData[0].data(), receivedLength);
+						pendingPacket.data.Reset(0, receivedData, receivedLength);
 
 						auto it = std::upper_bound(m_pendingIncomingPackets.begin(), m_pendingIncomingPackets.end(), pendingPacket, [] (const PendingIncomingPacket& first, const PendingIncomingPacket& second)
 						{
@@ -757,7 +846,7 @@ namespace Nz
 				}
 			}
 
-			m_receivedData = m_packetData[0].data();
+			m_receivedData = receivedData;
 			m_receivedDataLength = receivedLength;
 
 			m_totalReceivedData += receivedLength;
@@ -925,11 +1014,7 @@ namespace Nz
 			if (peer->m_sentReliableCommands.empty())
 				peer->m_nextTimeout = m_serviceTime + outgoingCommand->roundTripTimeout;
 
-			peer->m_sentReliableCommands.emplace_back(std::move(*outgoingCommand));
-
-			peer->m_outgoingReliableCommands.erase(outgoingCommand);
-			outgoingCommand = peer->m_sentReliableCommands.end();
-			--outgoingCommand;
+			peer->m_sentReliableCommands.splice(peer->m_sentReliableCommands.end(), peer->m_outgoingReliableCommands, outgoingCommand);
 
 			outgoingCommand->sentTime = m_serviceTime;
 
@@ -994,7 +1079,11 @@ namespace Nz
 				if (checkForTimeouts && !currentPeer->m_sentReliableCommands.empty() && ENetTimeGreaterEqual(m_serviceTime, currentPeer->m_nextTimeout) && currentPeer->CheckTimeouts(event))
 				{
 					if (event && event->type != ENetEventType::None)
+					{
+						// Don't hold already gathered datagrams until next call
+						FlushOutgoingDatagrams(nullptr);
 						return 1;
+					}
 					else
 						continue;
 				}
@@ -1055,9 +1144,13 @@ namespace Nz
 				std::size_t compressedSize = 0;
 				if (m_compressor)
 				{
-					compressedSize = m_compressor->Compress(currentPeer, &m_buffers[1], m_bufferCount - 1, m_packetSize - sizeof(ENetProtocolHeader), m_packetData[1].data(), m_packetData[1].size());
-					if (compressedSize > 0)
+					// Only keep compressed data if it's actually smaller than the original
+					std::size_t inputSize = m_packetSize - sizeof(ENetProtocolHeader);
+					compressedSize = m_compressor->Compress(currentPeer, &m_buffers[1], m_bufferCount - 1, inputSize, m_packetData[1].data(), std::min(inputSize, m_packetData[1].size()));
+					if (compressedSize > 0 && compressedSize < inputSize)
 						m_headerFlags |= ENetProtocolHeaderFlag_Compressed;
+					else
+						compressedSize = 0;
 				}
 
 				if (currentPeer->m_outgoingPeerID < ENetConstants::ENetProtocol_MaximumPeerId)
@@ -1112,31 +1205,29 @@ namespace Nz
 
 				if (sendNow)
 				{
-					std::size_t sentLength = 0;
+					// Gather the datagram into the outgoing batch, sent by FlushOutgoingDatagrams
+					if (m_outgoingBatch.count >= m_outgoingBatch.datagrams.size())
+					{
+						if (int result = FlushOutgoingDatagrams(event); result != 0)
+							return result;
+					}
+
+					std::size_t datagramIndex = m_outgoingBatch.count++;
+					UInt8* datagramData = m_outgoingBatch.data[datagramIndex].data();
 
-					if (!m_socket.SendMultiple(currentPeer->GetAddress(), m_buffers.data(), m_bufferCount, &sentLength))
+					std::size_t datagramSize = 0;
+					for (std::size_t i = 0; i < m_bufferCount; ++i)
 					{
-						switch (m_socket.GetLastError())
-						{
-							case SocketError::NetworkError:
-							case SocketError::UnreachableHost:
-							{
-								if (!currentPeer->IsConnected())
-								{
-									//< Network is down or unreachable (ex: IPv6 address when not supported), fails peer connection immediately
-									NotifyDisconnect(currentPeer, event, true);
-									return 1;
-								}
-
-								[[fallthrough]];
-							}
+						const NetBuffer& buffer = m_buffers[i];
+						assert(datagramSize + buffer.dataLength <= m_outgoingBatch.data[datagramIndex].size());
 
-							default:
-								return -1;
-						}
+						std::memcpy(&datagramData[datagramSize], buffer.data, buffer.dataLength);
+						datagramSize += buffer.dataLength;
 					}
 
-					m_totalSentData += sentLength;
+					m_outgoingBatch.buffers[datagramIndex].dataLength = datagramSize;
+					m_outgoingBatch.datagrams[datagramIndex].address = currentPeer->GetAddress();
+					m_outgoingBatch.peers[datagramIndex] = currentPeer;
 				}
 
 				currentPeer->RemoveSentUnreliableCommands();
@@ -1144,6 +1235,9 @@ namespace Nz
 			}
 		}
 
+		if (int result = FlushOutgoingDatagrams(event); result != 0)
+			return result;
+
 		if (!m_pendingOutgoingPackets.empty())
 		{
 			auto it = m_pendingOutgoingPackets.begin();
@@ -1230,10 +1324,10 @@ namespace Nz
 				m_packetSize += packetBuffer.dataLength;
 
 				// In order to keep the packet buffer alive until we send it, place it into a temporary queue
-				peer->m_sentUnreliableCommands.emplace_back(std::move(*outgoingCommand));
+				peer->m_sentUnreliableCommands.splice(peer->m_sentUnreliableCommands.end(), peer->m_outgoingUnreliableCommands, outgoingCommand);
 			}
-
-			peer->m_outgoingUnreliableCommands.erase(outgoingCommand);
+			else
+				peer->m_outgoingUnreliableCommands.erase(outgoingCommand);
 
 			++m_bufferCount;
 			++m_commandCount;
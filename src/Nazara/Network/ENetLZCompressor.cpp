@@ -0,0 +1,433 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetLZCompressor.hpp>
+#include <Nazara/Network/ENetProtocol.hpp>
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr std::size_t MinMatch = 4;
+		constexpr std::size_t MaxOffset = 0xFFFF;
+		constexpr UInt32 InvalidPosition = 0xFFFFFFFF;
+
+		UInt32 Read32(const UInt8* ptr)
+		{
+			UInt32 value;
+			std::memcpy(&value, ptr, sizeof(value));
+
+			return value;
+		}
+
+		UInt64 Read64(const UInt8* ptr)
+		{
+			UInt64 value;
+			std::memcpy(&value, ptr, sizeof(value));
+
+			return value;
+		}
+
+		template<unsigned int HashLog>
+		UInt32 Hash(UInt32 sequence)
+		{
+			return (sequence * 2654435761U) >> (32 - HashLog);
+		}
+
+		bool WriteLength(UInt8*& outData, UInt8* outEnd, std::size_t length)
+		{
+			for (;;)
+			{
+				if (outData >= outEnd)
+					return false;
+
+				if (length < 0xFF)
+				{
+					*outData++ = static_cast<UInt8>(length);
+					return true;
+				}
+
+				*outData++ = 0xFF;
+				length -= 0xFF;
+			}
+		}
+
+		bool ReadLength(const UInt8*& inData, const UInt8* inEnd, std::size_t& length)
+		{
+			for (;;)
+			{
+				if (inData >= inEnd)
+					return false;
+
+				UInt8 byte = *inData++;
+				length += byte;
+				if (byte != 0xFF)
+					return true;
+			}
+		}
+
+		bool WriteSequence(UInt8*& outData, UInt8* outEnd, const UInt8* literals, std::size_t literalLength, std::size_t offset, std::size_t matchLength)
+		{
+			if (outData >= outEnd)
+				return false;
+
+			UInt8& token = *outData++;
+			token = static_cast<UInt8>(std::min<std::size_t>(literalLength, 0xF) << 4);
+
+			if (literalLength >= 0xF && !WriteLength(outData, outEnd, literalLength - 0xF))
+				return false;
+
+			if (literalLength > static_cast<std::size_t>(outEnd - outData))
+				return false;
+
+			std::memcpy(outData, literals, literalLength);
+			outData += literalLength;
+
+			// Last sequence only holds literals
+			if (matchLength == 0)
+				return true;
+
+			if (outEnd - outData < 2)
+				return false;
+
+			*outData++ = static_cast<UInt8>(offset & 0xFF);
+			*outData++ = static_cast<UInt8>(offset >> 8);
+
+			matchLength -= MinMatch;
+			token |= static_cast<UInt8>(std::min<std::size_t>(matchLength, 0xF));
+
+			if (matchLength >= 0xF && !WriteLength(outData, outEnd, matchLength - 0xF))
+				return false;
+
+			return true;
+		}
+	}
+
+	/*!
+	* \ingroup network
+	* \class Nz::ENetLZCompressor
+	* \brief Network class implementing a fast LZ77 compressor (using a LZ4-like block format) for ENet packets
+	*
+	* Small game packets rarely repeat within themselves, the compressor can be given a dictionary (of content frequently found in packets) used as if it was preceding every packet.
+	* Both hosts must use the same dictionary, TrainDictionary can build one from packets samples.
+	*/
+
+	ENetLZCompressor::ENetLZCompressor() :
+	ENetLZCompressor(ByteArray())
+	{
+	}
+
+	ENetLZCompressor::ENetLZCompressor(ByteArray dictionary) :
+	m_generation(0)
+	{
+		m_hashTable.fill(0);
+		SetDictionary(std::move(dictionary));
+	}
+
+	/*!
+	* \brief Compresses the buffers
+	* \return Compressed size or 0 if the compressed data doesn't fit into maxOutputSize (or if input is bigger than MaxInputSize)
+	*
+	* \param peer Peer the data is sent to (unused)
+	* \param buffers Buffers to compress
+	* \param bufferCount Number of buffers
+	* \param totalInputSize Sum of the buffers sizes
+	* \param output Output buffer
+	* \param maxOutputSize Size of the output buffer
+	*/
+	std::size_t ENetLZCompressor::Compress(const ENetPeer* /*peer*/, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		if (totalInputSize == 0 || totalInputSize > MaxInputSize)
+			return 0;
+
+		// Window is dictionary followed by packet data, which allows matches to reference the dictionary
+		std::size_t dictionarySize = m_dictionary.GetSize();
+		std::size_t windowSize = dictionarySize + totalInputSize;
+		m_window.resize(windowSize);
+
+		std::size_t windowOffset = dictionarySize;
+		for (std::size_t i = 0; i < bufferCount; ++i)
+		{
+			std::size_t length = std::min(buffers[i].dataLength, windowSize - windowOffset);
+			std::memcpy(&m_window[windowOffset], buffers[i].data, length);
+			windowOffset += length;
+		}
+
+		if (windowOffset != windowSize)
+			return 0;
+
+		// Hash table entries are tagged with a generation instead of being cleared for every packet
+		if (++m_generation == 0)
+		{
+			m_hashTable.fill(0);
+			m_generation = 1;
+		}
+
+		UInt32 generationTag = UInt32(m_generation) << 16;
+
+		const UInt8* window = m_window.data();
+		UInt8* outData = output;
+		UInt8* outEnd = output + maxOutputSize;
+
+		std::size_t anchor = dictionarySize;
+		std::size_t position = dictionarySize;
+		while (position + MinMatch <= windowSize)
+		{
+			UInt32 sequence = Read32(&window[position]);
+			UInt32 hash = Hash<HashLog>(sequence);
+
+			UInt32 entry = m_hashTable[hash];
+			m_hashTable[hash] = generationTag | UInt32(position);
+
+			std::size_t reference = InvalidPosition;
+			if ((entry & 0xFFFF0000) == generationTag && Read32(&window[entry & 0xFFFF]) == sequence)
+				reference = entry & 0xFFFF;
+			else
+			{
+				UInt32 dictionaryPosition = m_dictionaryTable[hash];
+				if (dictionaryPosition != InvalidPosition && Read32(&window[dictionaryPosition]) == sequence)
+					reference = dictionaryPosition;
+			}
+
+			if (reference == InvalidPosition || position - reference > MaxOffset)
+			{
+				// Skip faster on incompressible data
+				position += 1 + ((position - anchor) >> 5);
+				continue;
+			}
+
+			// Extend match backward (over pending literals) and forward
+			while (position > anchor && reference > 0 && window[position - 1] == window[reference - 1])
+			{
+				position--;
+				reference--;
+			}
+
+			std::size_t matchLength = MinMatch;
+			while (position + matchLength < windowSize && window[reference + matchLength] == window[position + matchLength])
+				matchLength++;
+
+			if (!WriteSequence(outData, outEnd, &window[anchor], position - anchor, position - reference, matchLength))
+				return 0;
+
+			position += matchLength;
+			anchor = position;
+
+			if (position - 2 + MinMatch <= windowSize)
+				m_hashTable[Hash<HashLog>(Read32(&window[position - 2]))] = generationTag | UInt32(position - 2);
+		}
+
+		if (!WriteSequence(outData, outEnd, &window[anchor], windowSize - anchor, 0, 0))
+			return 0;
+
+		return static_cast<std::size_t>(outData - output);
+	}
+
+	/*!
+	* \brief Decompresses data compressed with Compress, using the same dictionary
+	* \return Decompressed size or 0 if the data is invalid or doesn't fit into maxOutputSize
+	*
+	* \param peer Peer the data was received from (unused)
+	* \param input Compressed data
+	* \param inputSize Size of the compressed data
+	* \param output Output buffer
+	* \param maxOutputSize Size of the output buffer
+	*/
+	std::size_t ENetLZCompressor::Decompress(const ENetPeer* /*peer*/, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		const UInt8* dictionary = m_dictionary.GetConstBuffer();
+		std::size_t dictionarySize = m_dictionary.GetSize();
+
+		const UInt8* inData = input;
+		const UInt8* inEnd = input + inputSize;
+		std::size_t outSize = 0;
+
+		while (inData < inEnd)
+		{
+			UInt8 token = *inData++;
+
+			std::size_t literalLength = token >> 4;
+			if (literalLength == 0xF && !ReadLength(inData, inEnd, literalLength))
+				return 0;
+
+			if (literalLength > static_cast<std::size_t>(inEnd - inData) || literalLength > maxOutputSize - outSize)
+				return 0;
+
+			std::memcpy(&output[outSize], inData, literalLength);
+			inData += literalLength;
+			outSize += literalLength;
+
+			if (inData == inEnd)
+				break;
+
+			if (inEnd - inData < 2)
+				return 0;
+
+			std::size_t offset = inData[0] | (inData[1] << 8);
+			inData += 2;
+
+			std::size_t matchLength = token & 0xF;
+			if (matchLength == 0xF && !ReadLength(inData, inEnd, matchLength))
+				return 0;
+
+			matchLength += MinMatch;
+
+			if (offset == 0 || offset > outSize + dictionarySize || matchLength > maxOutputSize - outSize)
+				return 0;
+
+			if (offset > outSize)
+			{
+				// Match starts in the dictionary
+				std::size_t dictionaryOffset = offset - outSize;
+				std::size_t length = std::min(dictionaryOffset, matchLength);
+				std::memcpy(&output[outSize], &dictionary[dictionarySize - dictionaryOffset], length);
+				outSize += length;
+				matchLength -= length;
+			}
+
+			if (offset >= matchLength)
+			{
+				std::memcpy(&output[outSize], &output[outSize - offset], matchLength);
+				outSize += matchLength;
+			}
+			else
+			{
+				// Overlapping match, repeats the last offset bytes
+				for (std::size_t i = 0; i < matchLength; ++i)
+				{
+					output[outSize] = output[outSize - offset];
+					outSize++;
+				}
+			}
+		}
+
+		return outSize;
+	}
+
+	/*!
+	* \brief Changes the dictionary used by the compressor
+	*
+	* \param dictionary New dictionary, only its last MaxDictionarySize bytes are used
+	*
+	* \remark Both hosts must use the same dictionary
+	*/
+	void ENetLZCompressor::SetDictionary(ByteArray dictionary)
+	{
+		if (dictionary.GetSize() > MaxDictionarySize)
+			dictionary.Erase(dictionary.begin(), dictionary.begin() + (dictionary.GetSize() - MaxDictionarySize));
+
+		m_dictionary = std::move(dictionary);
+
+		// Dictionary positions are the same for every packet, hash them once
+		m_dictionaryTable.fill(InvalidPosition);
+
+		const UInt8* data = m_dictionary.GetConstBuffer();
+		std::size_t dictionarySize = m_dictionary.GetSize();
+		for (std::size_t i = 0; i + MinMatch <= dictionarySize; ++i)
+			m_dictionaryTable[Hash<HashLog>(Read32(&data[i]))] = UInt32(i);
+
+		m_window.assign(data, data + dictionarySize);
+		m_window.reserve(dictionarySize + ENetConstants::ENetProtocol_MaximumMTU);
+	}
+
+	/*!
+	* \brief Builds a dictionary from packets samples
+	* \return Dictionary to use with SetDictionary
+	*
+	* Picks the byte sequences found in most samples, the more samples the better.
+	*
+	* \param samples Packets samples, ideally as sent by ENetHost
+	* \param sampleCount Number of samples
+	* \param dictionarySize Maximum size of the dictionary
+	*/
+	ByteArray ENetLZCompressor::TrainDictionary(const ByteArray* samples, std::size_t sampleCount, std::size_t dictionarySize)
+	{
+		constexpr std::size_t SegmentSize = 8;
+
+		struct Segment
+		{
+			std::size_t offset;
+			std::size_t sampleIndex;
+			UInt32 sampleCount;
+		};
+
+		dictionarySize = std::min(dictionarySize, MaxDictionarySize);
+
+		// Count in how many samples each segment appears
+		std::unordered_map<UInt64, Segment> segments;
+		std::unordered_set<UInt64> sampleSegments;
+		for (std::size_t sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+		{
+			const ByteArray& sample = samples[sampleIndex];
+			if (sample.GetSize() < SegmentSize)
+				continue;
+
+			sampleSegments.clear();
+			for (std::size_t offset = 0; offset + SegmentSize <= sample.GetSize(); ++offset)
+			{
+				UInt64 key = Read64(&sample[offset]);
+				if (!sampleSegments.insert(key).second)
+					continue;
+
+				auto it = segments.find(key);
+				if (it == segments.end())
+					segments.emplace(key, Segment{ offset, sampleIndex, 1 });
+				else
+					it->second.sampleCount++;
+			}
+		}
+
+		std::vector<std::pair<UInt64, const Segment*>> candidates;
+		for (auto&& [key, segment] : segments)
+		{
+			if (segment.sampleCount >= 2)
+				candidates.emplace_back(key, &segment);
+		}
+
+		std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs)
+		{
+			if (lhs.second->sampleCount != rhs.second->sampleCount)
+				return lhs.second->sampleCount > rhs.second->sampleCount;
+
+			return lhs.first < rhs.first; //< keep training deterministic
+		});
+
+		// Append most common segments first, extended with the following bytes as long as they're common too
+		ByteArray dictionary;
+		std::unordered_set<UInt64> usedSegments;
+		for (auto&& [key, segment] : candidates)
+		{
+			if (dictionary.GetSize() >= dictionarySize)
+				break;
+
+			if (!usedSegments.insert(key).second)
+				continue;
+
+			const ByteArray& sample = samples[segment->sampleIndex];
+
+			std::size_t begin = segment->offset;
+			std::size_t end = begin + SegmentSize;
+			while (end < sample.GetSize() && end - begin < dictionarySize - dictionary.GetSize())
+			{
+				UInt64 nextKey = Read64(&sample[end + 1 - SegmentSize]);
+
+				auto it = segments.find(nextKey);
+				if (it == segments.end() || it->second.sampleCount < 2 || !usedSegments.insert(nextKey).second)
+					break;
+
+				end++;
+			}
+
+			std::size_t length = std::min(end - begin, dictionarySize - dictionary.GetSize());
+			dictionary.Append(&sample[begin], length);
+		}
+
+		return dictionary;
+	}
+}
@@ -20,6 +20,22 @@
 
 namespace Nz
 {
+	ENetPeer::ENetPeer(ENetHost* host, UInt16 peerId) :
+	m_host(host),
+	m_dispatchedCommands(host->m_incomingCommandPool),
+	m_outgoingReliableCommands(host->m_outgoingCommandPool),
+	m_outgoingUnreliableCommands(host->m_outgoingCommandPool),
+	m_sentReliableCommands(host->m_outgoingCommandPool),
+	m_sentUnreliableCommands(host->m_outgoingCommandPool),
+	m_state(ENetPeerState::Disconnected),
+	m_incomingSessionID(0xFF),
+	m_outgoingSessionID(0xFF),
+	m_incomingPeerID(peerId),
+	m_isSimulationEnabled(false)
+	{
+		Reset();
+	}
+
 	void ENetPeer::Disconnect(UInt32 data)
 	{
 		if (m_state == ENetPeerState::Disconnecting ||
@@ -230,7 +246,7 @@ namespace Nz
 				if (packetSize - fragmentOffset < fragmentLength)
 					fragmentLength = UInt16(packetSize - fragmentOffset);
 
-				OutgoingCommand outgoingCommand;
+				OutgoingCommand& outgoingCommand = (commandNumber & ENetProtocolFlag_Acknowledge) ? m_outgoingReliableCommands.emplace_back() : m_outgoingUnreliableCommands.emplace_back();
 				outgoingCommand.fragmentOffset = fragmentOffset;
 				outgoingCommand.fragmentLength = fragmentLength;
 				outgoingCommand.packet = packetRef;
@@ -323,8 +339,11 @@ namespace Nz
 			command.roundTripTimeout = m_roundTripTime + 4 * m_roundTripTimeVariance;
 			command.roundTripTimeoutLimit = m_timeoutLimit * command.roundTripTimeout;
 
-			m_outgoingReliableCommands.insert(insertPosition, std::move(command));
-			it = m_sentReliableCommands.erase(it);
+			auto next = it;
+			++next;
+
+			m_outgoingReliableCommands.splice(insertPosition, m_sentReliableCommands, it);
+			it = next;
 
 			if (it == m_sentReliableCommands.begin() && !m_sentReliableCommands.empty())
 			{
@@ -374,9 +393,9 @@ namespace Nz
 
 	void ENetPeer::DispatchIncomingUnreliableCommands(Channel& channel)
 	{
-		std::list<IncomingCommmand>::iterator currentCommand;
-		std::list<IncomingCommmand>::iterator droppedCommand;
-		std::list<IncomingCommmand>::iterator startCommand;
+		ENetCommandList<IncomingCommmand>::iterator currentCommand;
+		ENetCommandList<IncomingCommmand>::iterator droppedCommand;
+		ENetCommandList<IncomingCommmand>::iterator startCommand;
 
 		for (droppedCommand = startCommand = currentCommand = channel.incomingUnreliableCommands.begin();
 		     currentCommand != channel.incomingUnreliableCommands.end();
@@ -880,7 +899,7 @@ namespace Nz
 		RemoveSentReliableCommand(1, 0xFF);
 
 		if (channelCount < m_channels.size())
-			m_channels.resize(channelCount);
+			ResizeChannels(channelCount);
 
 		m_outgoingPeerID = NetToHost(command->verifyConnect.outgoingPeerID);
 		m_incomingSessionID = command->verifyConnect.incomingSessionID;
@@ -901,7 +920,7 @@ namespace Nz
 
 	void ENetPeer::InitIncoming(std::size_t channelCount, const IpAddress& address, ENetProtocolConnect& incomingCommand)
 	{
-		m_channels.resize(channelCount);
+		ResizeChannels(channelCount);
 		m_address = address;
 
 		m_connectID = incomingCommand.connectID;
@@ -942,7 +961,7 @@ namespace Nz
 
 	void ENetPeer::InitOutgoing(std::size_t channelCount, const IpAddress& address, UInt32 connectId, UInt32 windowSize)
 	{
-		m_channels.resize(channelCount);
+		ResizeChannels(channelCount);
 
 		m_address = address;
 		m_connectID = connectId;
@@ -974,7 +993,7 @@ namespace Nz
 
 	ENetProtocolCommand ENetPeer::RemoveSentReliableCommand(UInt16 reliableSequenceNumber, UInt8 channelId)
 	{
-		std::list<OutgoingCommand>* commandList = nullptr;
+		ENetCommandList<OutgoingCommand>* commandList = nullptr;
 
 		bool found = false;
 		auto currentCommand = m_sentReliableCommands.begin();
@@ -1068,6 +1087,20 @@ namespace Nz
 		m_channels.clear();
 	}
 
+	void ENetPeer::ResizeChannels(std::size_t channelCount)
+	{
+		if (channelCount < m_channels.size())
+		{
+			m_channels.erase(m_channels.begin() + channelCount, m_channels.end());
+			return;
+		}
+
+		// Channels command lists need the host command pool and can't be default constructed
+		m_channels.reserve(channelCount);
+		for (std::size_t i = m_channels.size(); i < channelCount; ++i)
+			m_channels.emplace_back(m_host->m_incomingCommandPool);
+	}
+
 	bool ENetPeer::QueueAcknowledgement(ENetProtocol*command, UInt16 sentTime)
 	{
 		if (command->header.channelID < m_channels.size())
@@ -1131,8 +1164,8 @@ namespace Nz
 				return discardCommand();
 		}
 
-		std::list<IncomingCommmand>* commandList = nullptr;
-		std::list<IncomingCommmand>::reverse_iterator currentCommand;
+		ENetCommandList<IncomingCommmand>* commandList = nullptr;
+		ENetCommandList<IncomingCommmand>::reverse_iterator currentCommand;
 
 		switch (command.header.command & ENetProtocolCommand_Mask)
 		{
@@ -1229,7 +1262,7 @@ namespace Nz
 		ENetPacketRef packet = m_host->AllocatePacket(ENetPacketFlags(flags));
 		packet->data.Reset(0, data, dataLength);
 
-		IncomingCommmand incomingCommand;
+		IncomingCommmand& incomingCommand = *commandList->emplace(currentCommand.base());
 		incomingCommand.reliableSequenceNumber = command.header.reliableSequenceNumber;
 		incomingCommand.unreliableSequenceNumber = unreliableSequenceNumber & 0xFFFF;
 		incomingCommand.command = command;
@@ -1240,8 +1273,6 @@ namespace Nz
 		if (packet)
 			m_totalWaitingData += packet->data.GetDataSize();
 
-		auto it = commandList->insert(currentCommand.base(), incomingCommand);
-
 		switch (command.header.command & ENetProtocolCommand_Mask)
 		{
 			case ENetProtocolCommand_SendFragment:
@@ -1254,12 +1285,12 @@ namespace Nz
 				break;
 		}
 
-		return &(*it);
+		return &incomingCommand;
 	}
 
 	void ENetPeer::QueueOutgoingCommand(ENetProtocol& command, ENetPacketRef packet, UInt32 offset, UInt16 length)
 	{
-		OutgoingCommand outgoingCommand;
+		OutgoingCommand& outgoingCommand = (command.header.command & ENetProtocolFlag_Acknowledge) ? m_outgoingReliableCommands.emplace_back() : m_outgoingUnreliableCommands.emplace_back();
 		outgoingCommand.command = command;
 		outgoingCommand.fragmentLength = length;
 		outgoingCommand.fragmentOffset = offset;
@@ -1329,11 +1360,6 @@ namespace Nz
 			default:
 				break;
 		}
-
-		if (outgoingCommand.command.header.command & ENetProtocolFlag_Acknowledge)
-			m_outgoingReliableCommands.emplace_back(outgoingCommand);
-		else
-			m_outgoingUnreliableCommands.emplace_back(outgoingCommand);
 	}
 
 	int ENetPeer::Throttle(UInt32 rtt)
@@ -0,0 +1,639 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+/*
+	Copyright(c) 2002 - 2016 Lee Salzman
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// Adaptation constants tuned aggressively for small packet sizes rather than large file compression
+		constexpr UInt32 RangeCoderTop = 1 << 24;
+		constexpr UInt32 RangeCoderBottom = 1 << 16;
+
+		constexpr UInt16 ContextSymbolDelta = 3;
+		constexpr UInt16 ContextSymbolMinimum = 1;
+		constexpr UInt16 ContextEscapeMinimum = 1;
+
+		constexpr std::size_t SubcontextOrder = 2;
+		constexpr UInt16 SubcontextSymbolDelta = 2;
+		constexpr UInt16 SubcontextEscapeDelta = 5;
+
+		struct RangeEncoder
+		{
+			bool Encode(UInt32 under, UInt32 count, UInt32 total)
+			{
+				range /= total;
+				low += under * range;
+				range *= count;
+				for (;;)
+				{
+					if ((low ^ (low + range)) >= RangeCoderTop)
+					{
+						if (range >= RangeCoderBottom)
+							break;
+
+						range = (0u - low) & (RangeCoderBottom - 1);
+					}
+
+					if (!Output(static_cast<UInt8>(low >> 24)))
+						return false;
+
+					range <<= 8;
+					low <<= 8;
+				}
+
+				return true;
+			}
+
+			bool Flush()
+			{
+				while (low)
+				{
+					if (!Output(static_cast<UInt8>(low >> 24)))
+						return false;
+
+					low <<= 8;
+				}
+
+				return true;
+			}
+
+			bool Output(UInt8 value)
+			{
+				if (outData >= outEnd)
+					return false;
+
+				*outData++ = value;
+				return true;
+			}
+
+			UInt8* outData;
+			UInt8* outEnd;
+			UInt32 low = 0;
+			UInt32 range = ~UInt32(0);
+		};
+
+		struct RangeDecoder
+		{
+			void Decode(UInt32 under, UInt32 count)
+			{
+				low += under * range;
+				range *= count;
+				for (;;)
+				{
+					if ((low ^ (low + range)) >= RangeCoderTop)
+					{
+						if (range >= RangeCoderBottom)
+							break;
+
+						range = (0u - low) & (RangeCoderBottom - 1);
+					}
+
+					code <<= 8;
+					if (inData < inEnd)
+						code |= *inData++;
+
+					range <<= 8;
+					low <<= 8;
+				}
+			}
+
+			UInt32 Read(UInt32 total)
+			{
+				range /= total;
+				return (code - low) / range;
+			}
+
+			void Seed()
+			{
+				for (unsigned int shift : { 24, 16, 8, 0 })
+				{
+					if (inData < inEnd)
+						code |= UInt32(*inData++) << shift;
+				}
+			}
+
+			const UInt8* inData;
+			const UInt8* inEnd;
+			UInt32 code = 0;
+			UInt32 low = 0;
+			UInt32 range = ~UInt32(0);
+		};
+	}
+
+	/*!
+	* \ingroup network
+	* \class Nz::ENetRangeCoderCompressor
+	* \brief Network class implementing the adaptive range coder of the reference ENet implementation
+	*
+	* This compressor uses an order-2 context model, rebuilt for every packet, which makes it independent of packet loss and peers.
+	* It usually gives better ratios than ENetLZCompressor on small packets at a higher CPU cost.
+	*/
+
+	/*!
+	* \brief Compresses the buffers using the range coder
+	* \return Compressed size or 0 if the compressed data doesn't fit into maxOutputSize
+	*
+	* \param peer Peer the data is sent to (unused)
+	* \param buffers Buffers to compress
+	* \param bufferCount Number of buffers
+	* \param totalInputSize Sum of the buffers sizes
+	* \param output Output buffer
+	* \param maxOutputSize Size of the output buffer
+	*/
+	std::size_t ENetRangeCoderCompressor::Compress(const ENetPeer* /*peer*/, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		if (bufferCount == 0 || totalInputSize == 0)
+			return 0;
+
+		const UInt8* inData = static_cast<const UInt8*>(buffers->data);
+		const UInt8* inEnd = inData + buffers->dataLength;
+		buffers++;
+		bufferCount--;
+
+		RangeEncoder encoder;
+		encoder.outData = output;
+		encoder.outEnd = output + maxOutputSize;
+
+		std::size_t nextSymbol = 0;
+		Symbol* root = CreateContext(nextSymbol, ContextEscapeMinimum, ContextSymbolMinimum);
+		UInt16 predicted = 0;
+		std::size_t order = 0;
+
+		for (;;)
+		{
+			while (inData >= inEnd)
+			{
+				if (bufferCount == 0)
+					break;
+
+				inData = static_cast<const UInt8*>(buffers->data);
+				inEnd = inData + buffers->dataLength;
+				buffers++;
+				bufferCount--;
+			}
+
+			if (inData >= inEnd)
+				break;
+
+			UInt8 value = *inData++;
+
+			UInt16* parent = &predicted;
+			bool encoded = false;
+			for (Symbol* subcontext = &m_symbols[predicted]; subcontext != root; subcontext = &m_symbols[subcontext->parent])
+			{
+				UInt16 count, under;
+				Symbol* symbol = EncodeSymbol(subcontext, value, under, count, SubcontextSymbolDelta, 0, nextSymbol);
+				*parent = static_cast<UInt16>(GetSymbolIndex(symbol));
+				parent = &symbol->parent;
+
+				UInt16 total = subcontext->total;
+				if (count > 0)
+				{
+					if (!encoder.Encode(subcontext->escapes + under, count, total))
+						return 0;
+				}
+				else
+				{
+					if (subcontext->escapes > 0 && subcontext->escapes < total)
+					{
+						if (!encoder.Encode(0, subcontext->escapes, total))
+							return 0;
+					}
+
+					subcontext->escapes += SubcontextEscapeDelta;
+					subcontext->total += SubcontextEscapeDelta;
+				}
+
+				subcontext->total += SubcontextSymbolDelta;
+				if (count > 0xFF - 2 * SubcontextSymbolDelta || subcontext->total > RangeCoderBottom - 0x100)
+					RescaleContext(subcontext, 0);
+
+				if (count > 0)
+				{
+					encoded = true;
+					break;
+				}
+			}
+
+			if (!encoded)
+			{
+				UInt16 count, under;
+				Symbol* symbol = EncodeSymbol(root, value, under, count, ContextSymbolDelta, ContextSymbolMinimum, nextSymbol);
+				*parent = static_cast<UInt16>(GetSymbolIndex(symbol));
+
+				if (!encoder.Encode(root->escapes + under, count, root->total))
+					return 0;
+
+				root->total += ContextSymbolDelta;
+				if (count > 0xFF - 2 * ContextSymbolDelta + ContextSymbolMinimum || root->total > RangeCoderBottom - 0x100)
+					RescaleContext(root, ContextSymbolMinimum);
+			}
+
+			if (order >= SubcontextOrder)
+				predicted = m_symbols[predicted].parent;
+			else
+				order++;
+
+			// Free symbols
+			if (nextSymbol >= m_symbols.size() - SubcontextOrder)
+			{
+				nextSymbol = 0;
+				root = CreateContext(nextSymbol, ContextEscapeMinimum, ContextSymbolMinimum);
+				predicted = 0;
+				order = 0;
+			}
+		}
+
+		// The decoder reads an escape from the root context when it reaches the flushed low bound, which ends decoding
+		if (!encoder.Flush())
+			return 0;
+
+		return static_cast<std::size_t>(encoder.outData - output);
+	}
+
+	/*!
+	* \brief Decompresses data compressed with Compress
+	* \return Decompressed size or 0 if the data is invalid or doesn't fit into maxOutputSize
+	*
+	* \param peer Peer the data was received from (unused)
+	* \param input Compressed data
+	* \param inputSize Size of the compressed data
+	* \param output Output buffer
+	* \param maxOutputSize Size of the output buffer
+	*/
+	std::size_t ENetRangeCoderCompressor::Decompress(const ENetPeer* /*peer*/, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		if (inputSize == 0)
+			return 0;
+
+		RangeDecoder decoder;
+		decoder.inData = input;
+		decoder.inEnd = input + inputSize;
+
+		UInt8* outData = output;
+		UInt8* outEnd = output + maxOutputSize;
+
+		std::size_t nextSymbol = 0;
+		Symbol* root = CreateContext(nextSymbol, ContextEscapeMinimum, ContextSymbolMinimum);
+		UInt16 predicted = 0;
+		std::size_t order = 0;
+
+		decoder.Seed();
+
+		for (;;)
+		{
+			UInt8 value = 0;
+			UInt16 bottom;
+			UInt16 count, under;
+			UInt16* parent = &predicted;
+
+			Symbol* subcontext;
+			bool decoded = false;
+			for (subcontext = &m_symbols[predicted]; subcontext != root; subcontext = &m_symbols[subcontext->parent])
+			{
+				if (subcontext->escapes <= 0)
+					continue;
+
+				UInt16 total = subcontext->total;
+				if (subcontext->escapes >= total)
+					continue;
+
+				UInt32 code = decoder.Read(total);
+				if (code >= total)
+					return 0;
+
+				if (code < subcontext->escapes)
+				{
+					decoder.Decode(0, subcontext->escapes);
+					continue;
+				}
+
+				code -= subcontext->escapes;
+
+				Symbol* symbol = DecodeSymbol(subcontext, static_cast<UInt16>(code), value, under, count);
+				if (!symbol)
+					return 0;
+
+				bottom = static_cast<UInt16>(GetSymbolIndex(symbol));
+				decoder.Decode(subcontext->escapes + under, count);
+
+				subcontext->total += SubcontextSymbolDelta;
+				if (count > 0xFF - 2 * SubcontextSymbolDelta || subcontext->total > RangeCoderBottom - 0x100)
+					RescaleContext(subcontext, 0);
+
+				decoded = true;
+				break;
+			}
+
+			if (!decoded)
+			{
+				UInt16 total = root->total;
+				UInt32 code = decoder.Read(total);
+				if (code >= total)
+					return 0;
+
+				if (code < root->escapes)
+				{
+					// End of data
+					decoder.Decode(0, root->escapes);
+					break;
+				}
+
+				code -= root->escapes;
+
+				Symbol* symbol = DecodeRootSymbol(root, static_cast<UInt16>(code), value, under, count, nextSymbol);
+				if (!symbol)
+					return 0;
+
+				bottom = static_cast<UInt16>(GetSymbolIndex(symbol));
+				decoder.Decode(root->escapes + under, count);
+
+				root->total += ContextSymbolDelta;
+				if (count > 0xFF - 2 * ContextSymbolDelta + ContextSymbolMinimum || root->total > RangeCoderBottom - 0x100)
+					RescaleContext(root, ContextSymbolMinimum);
+			}
+
+			// Update the contexts which escaped like the encoder did
+			for (Symbol* patch = &m_symbols[predicted]; patch != subcontext; patch = &m_symbols[patch->parent])
+			{
+				UInt16 patchCount, patchUnder;
+				Symbol* symbol = EncodeSymbol(patch, value, patchUnder, patchCount, SubcontextSymbolDelta, 0, nextSymbol);
+				*parent = static_cast<UInt16>(GetSymbolIndex(symbol));
+				parent = &symbol->parent;
+
+				if (patchCount <= 0)
+				{
+					patch->escapes += SubcontextEscapeDelta;
+					patch->total += SubcontextEscapeDelta;
+				}
+
+				patch->total += SubcontextSymbolDelta;
+				if (patchCount > 0xFF - 2 * SubcontextSymbolDelta || patch->total > RangeCoderBottom - 0x100)
+					RescaleContext(patch, 0);
+			}
+			*parent = bottom;
+
+			if (outData >= outEnd)
+				return 0;
+
+			*outData++ = value;
+
+			if (order >= SubcontextOrder)
+				predicted = m_symbols[predicted].parent;
+			else
+				order++;
+
+			// Free symbols
+			if (nextSymbol >= m_symbols.size() - SubcontextOrder)
+			{
+				nextSymbol = 0;
+				root = CreateContext(nextSymbol, ContextEscapeMinimum, ContextSymbolMinimum);
+				predicted = 0;
+				order = 0;
+			}
+		}
+
+		return static_cast<std::size_t>(outData - output);
+	}
+
+	auto ENetRangeCoderCompressor::CreateContext(std::size_t& nextSymbol, UInt16 escapes, UInt16 minimum) -> Symbol*
+	{
+		Symbol* context = CreateSymbol(nextSymbol, 0, 0);
+		context->escapes = escapes;
+		context->total = escapes + 256 * minimum;
+		context->symbols = 0;
+
+		return context;
+	}
+
+	auto ENetRangeCoderCompressor::CreateSymbol(std::size_t& nextSymbol, UInt8 value, UInt16 count) -> Symbol*
+	{
+		Symbol* symbol = &m_symbols[nextSymbol++];
+		symbol->value = value;
+		symbol->count = static_cast<UInt8>(count);
+		symbol->under = count;
+		symbol->left = 0;
+		symbol->right = 0;
+		symbol->symbols = 0;
+		symbol->escapes = 0;
+		symbol->total = 0;
+		symbol->parent = 0;
+
+		return symbol;
+	}
+
+	auto ENetRangeCoderCompressor::DecodeRootSymbol(Symbol* context, UInt16 code, UInt8& value, UInt16& under, UInt16& count, std::size_t& nextSymbol) -> Symbol*
+	{
+		constexpr UInt16 minimum = ContextSymbolMinimum;
+		constexpr UInt16 update = ContextSymbolDelta;
+
+		under = 0;
+		count = minimum;
+
+		if (!context->symbols)
+		{
+			value = static_cast<UInt8>(code / minimum);
+			under = code - code % minimum;
+
+			Symbol* symbol = CreateSymbol(nextSymbol, value, update);
+			context->symbols = static_cast<UInt16>(symbol - context);
+
+			return symbol;
+		}
+
+		Symbol* node = context + context->symbols;
+		for (;;)
+		{
+			UInt16 after = static_cast<UInt16>(under + node->under + (node->value + 1) * minimum);
+			UInt16 before = static_cast<UInt16>(node->count + minimum);
+
+			if (code >= after)
+			{
+				under += node->under;
+				if (node->right)
+				{
+					node += node->right;
+					continue;
+				}
+
+				value = static_cast<UInt8>(node->value + 1 + (code - after) / minimum);
+				under = static_cast<UInt16>(code - (code - after) % minimum);
+
+				Symbol* symbol = CreateSymbol(nextSymbol, value, update);
+				node->right = static_cast<UInt16>(symbol - node);
+
+				return symbol;
+			}
+			else if (code < after - before)
+			{
+				node->under += update;
+				if (node->left)
+				{
+					node += node->left;
+					continue;
+				}
+
+				value = static_cast<UInt8>(node->value - 1 - (after - before - code - 1) / minimum);
+				under = static_cast<UInt16>(code - (after - before - code - 1) % minimum);
+
+				Symbol* symbol = CreateSymbol(nextSymbol, value, update);
+				node->left = static_cast<UInt16>(symbol - node);
+
+				return symbol;
+			}
+			else
+			{
+				value = node->value;
+				count += node->count;
+				under = after - before;
+				node->under += update;
+				node->count += update;
+
+				return node;
+			}
+		}
+	}
+
+	auto ENetRangeCoderCompressor::DecodeSymbol(Symbol* context, UInt16 code, UInt8& value, UInt16& under, UInt16& count) -> Symbol*
+	{
+		constexpr UInt16 update = SubcontextSymbolDelta;
+
+		under = 0;
+		count = 0;
+
+		// Subcontexts only encode symbols they already know about
+		if (!context->symbols)
+			return nullptr;
+
+		Symbol* node = context + context->symbols;
+		for (;;)
+		{
+			UInt16 after = static_cast<UInt16>(under + node->under);
+			UInt16 before = node->count;
+
+			if (code >= after)
+			{
+				under += node->under;
+				if (!node->right)
+					return nullptr;
+
+				node += node->right;
+			}
+			else if (code < after - before)
+			{
+				node->under += update;
+				if (!node->left)
+					return nullptr;
+
+				node += node->left;
+			}
+			else
+			{
+				value = node->value;
+				count += node->count;
+				under = after - before;
+				node->under += update;
+				node->count += update;
+
+				return node;
+			}
+		}
+	}
+
+	auto ENetRangeCoderCompressor::EncodeSymbol(Symbol* context, UInt8 value, UInt16& under, UInt16& count, UInt16 update, UInt16 minimum, std::size_t& nextSymbol) -> Symbol*
+	{
+		under = value * minimum;
+		count = minimum;
+
+		if (!context->symbols)
+		{
+			Symbol* symbol = CreateSymbol(nextSymbol, value, update);
+			context->symbols = static_cast<UInt16>(symbol - context);
+
+			return symbol;
+		}
+
+		Symbol* node = context + context->symbols;
+		for (;;)
+		{
+			if (value < node->value)
+			{
+				node->under += update;
+				if (node->left)
+				{
+					node += node->left;
+					continue;
+				}
+
+				Symbol* symbol = CreateSymbol(nextSymbol, value, update);
+				node->left = static_cast<UInt16>(symbol - node);
+
+				return symbol;
+			}
+			else if (value > node->value)
+			{
+				under += node->under;
+				if (node->right)
+				{
+					node += node->right;
+					continue;
+				}
+
+				Symbol* symbol = CreateSymbol(nextSymbol, value, update);
+				node->right = static_cast<UInt16>(symbol - node);
+
+				return symbol;
+			}
+			else
+			{
+				count += node->count;
+				under += node->under - node->count;
+				node->under += update;
+				node->count += update;
+
+				return node;
+			}
+		}
+	}
+
+	void ENetRangeCoderCompressor::RescaleContext(Symbol* context, UInt16 minimum)
+	{
+		context->total = (context->symbols) ? RescaleSymbol(context + context->symbols) : 0;
+		context->escapes -= context->escapes >> 1;
+		context->total += context->escapes + 256 * minimum;
+	}
+
+	UInt16 ENetRangeCoderCompressor::RescaleSymbol(Symbol* symbol)
+	{
+		UInt16 total = 0;
+		for (;;)
+		{
+			symbol->count -= symbol->count >> 1;
+			symbol->under = symbol->count;
+			if (symbol->left)
+				symbol->under += RescaleSymbol(symbol + symbol->left);
+
+			total += symbol->under;
+			if (!symbol->right)
+				break;
+
+			symbol += symbol->right;
+		}
+
+		return total;
+	}
+}
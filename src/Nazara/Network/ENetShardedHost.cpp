@@ -0,0 +1,320 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <string>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::ENetShardedHost
+	* \brief Network class running a server over multiple ENetHost, each servicing its own peers on its own thread
+	*
+	* Every shard owns a socket bound to the same port (using SO_REUSEPORT), the system then balances incoming connections between them.
+	* As the system always delivers datagrams of a remote address to the same socket, a peer stays on the shard it connected to.
+	*
+	* Events are handled on the shard threads by the callback given to Start, which is free to use the shard host and its peers.
+	* Other threads can't access a shard host directly, they interact with it through Broadcast, Disconnect, Send and Post which queue work for the shard thread.
+	*
+	* \remark Port sharing is only supported on POSIX systems, on other systems only one shard can be created
+	*/
+
+	ENetShardedHost::ENetShardedHost() :
+	m_running(false)
+	{
+	}
+
+	ENetShardedHost::~ENetShardedHost()
+	{
+		Destroy();
+	}
+
+	/*!
+	* \brief Sends a packet to every connected peer of every shard
+	*
+	* \param channelId Channel to send the packet on
+	* \param flags Packet flags
+	* \param packet Packet to send, copied for every shard
+	*
+	* \remark This is thread-safe
+	*/
+	void ENetShardedHost::Broadcast(UInt8 channelId, ENetPacketFlags flags, const NetPacket& packet)
+	{
+		for (std::size_t shardIndex = 0; shardIndex < m_shards.size(); ++shardIndex)
+		{
+			Message message;
+			message.type = MessageType::Broadcast;
+			message.channelId = channelId;
+			message.flags = flags;
+			message.packet.Reset(packet.GetNetCode(), packet.GetConstData() + NetPacket::HeaderSize, packet.GetDataSize());
+
+			PushMessage(shardIndex, std::move(message));
+		}
+	}
+
+	/*!
+	* \brief Creates the shards, listening on any address of a protocol
+	* \return true If successful
+	*
+	* \param protocol Net protocol to listen on
+	* \param port Port to listen on (if zero, a port is picked by the first shard and used by the others)
+	* \param shardCount Number of shards (if zero, the number of hardware threads is used)
+	* \param peerCountPerShard Maximum number of peers each shard can handle
+	* \param channelCount Number of channels
+	*/
+	bool ENetShardedHost::Create(NetProtocol protocol, UInt16 port, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount)
+	{
+		return CreateShards(shardCount, [&](ENetHost& host, UInt16 shardPort)
+		{
+			return host.Create(protocol, (shardPort != 0) ? shardPort : port, peerCountPerShard, channelCount);
+		});
+	}
+
+	/*!
+	* \brief Creates the shards, listening on an address
+	* \return true If successful
+	*
+	* \param listenAddress Address to listen on (if its port is zero, a port is picked by the first shard and used by the others)
+	* \param shardCount Number of shards (if zero, the number of hardware threads is used)
+	* \param peerCountPerShard Maximum number of peers each shard can handle
+	* \param channelCount Number of channels
+	*/
+	bool ENetShardedHost::Create(const IpAddress& listenAddress, std::size_t shardCount, std::size_t peerCountPerShard, std::size_t channelCount)
+	{
+		NazaraAssert(listenAddress.IsValid() && !listenAddress.IsLoopback(), "Invalid listening address");
+
+		return CreateShards(shardCount, [&](ENetHost& host, UInt16 shardPort)
+		{
+			IpAddress address = listenAddress;
+			if (shardPort != 0)
+				address.SetPort(shardPort);
+
+			return host.Create(address, peerCountPerShard, channelCount);
+		});
+	}
+
+	/*!
+	* \brief Stops the shard threads and destroys the shards
+	*/
+	void ENetShardedHost::Destroy()
+	{
+		Stop();
+		m_shards.clear();
+	}
+
+	/*!
+	* \brief Disconnects a peer
+	*
+	* \param peer Handle of the peer to disconnect
+	* \param data Disconnection data sent to the peer
+	*
+	* \remark This is thread-safe, nothing happens if the peer has already disconnected
+	*/
+	void ENetShardedHost::Disconnect(const ENetShardedPeer& peer, UInt32 data)
+	{
+		Message message;
+		message.type = MessageType::Disconnect;
+		message.peerId = peer.peerId;
+		message.connectId = peer.connectId;
+		message.data = data;
+
+		PushMessage(peer.shardIndex, std::move(message));
+	}
+
+	/*!
+	* \brief Runs a task on a shard thread
+	*
+	* \param shardIndex Index of the shard
+	* \param task Task to run, with the shard host
+	*
+	* \remark This is thread-safe, tasks are executed in order on the shard thread before it services its host
+	*/
+	void ENetShardedHost::Post(std::size_t shardIndex, ShardTask task)
+	{
+		Message message;
+		message.type = MessageType::Task;
+		message.task = std::move(task);
+
+		PushMessage(shardIndex, std::move(message));
+	}
+
+	/*!
+	* \brief Sends a packet to a peer of any shard
+	*
+	* \param peer Handle of the peer
+	* \param channelId Channel to send the packet on
+	* \param flags Packet flags
+	* \param packet Packet to send
+	*
+	* \remark This is thread-safe, the packet is dropped if the peer has disconnected in the meantime
+	*/
+	void ENetShardedHost::Send(const ENetShardedPeer& peer, UInt8 channelId, ENetPacketFlags flags, NetPacket&& packet)
+	{
+		Message message;
+		message.type = MessageType::Send;
+		message.channelId = channelId;
+		message.flags = flags;
+		message.packet = std::move(packet);
+		message.peerId = peer.peerId;
+		message.connectId = peer.connectId;
+
+		PushMessage(peer.shardIndex, std::move(message));
+	}
+
+	/*!
+	* \brief Starts a thread per shard, servicing its host
+	*
+	* \param callback Callback called for every event, from the thread of the shard which received it
+	* \param serviceTimeout Maximum time a shard waits for network activity before processing its queued messages (in milliseconds)
+	*/
+	void ENetShardedHost::Start(EventCallback callback, UInt32 serviceTimeout)
+	{
+		NazaraAssert(!m_shards.empty(), "Sharded host has not been created");
+		NazaraAssert(callback, "Invalid callback");
+
+		Stop();
+
+		m_eventCallback = std::move(callback);
+		m_running = true;
+
+		for (std::size_t shardIndex = 0; shardIndex < m_shards.size(); ++shardIndex)
+			m_shards[shardIndex]->thread = std::thread(&ENetShardedHost::ShardThread, this, shardIndex, serviceTimeout);
+	}
+
+	/*!
+	* \brief Stops the shard threads (shards are kept and can be started again)
+	*
+	* \remark Messages which were not processed yet are kept
+	*/
+	void ENetShardedHost::Stop()
+	{
+		m_running = false;
+
+		for (auto& shardPtr : m_shards)
+		{
+			if (shardPtr->thread.joinable())
+				shardPtr->thread.join();
+		}
+	}
+
+	bool ENetShardedHost::CreateShards(std::size_t shardCount, const std::function<bool(ENetHost& host, UInt16 port)>& createHost)
+	{
+		Destroy();
+
+		if (shardCount == 0)
+			shardCount = std::max(std::thread::hardware_concurrency(), 1U);
+
+		UInt16 boundPort = 0;
+		for (std::size_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+		{
+			auto& shard = m_shards.emplace_back(std::make_unique<Shard>());
+			shard->host.EnableReusePort(shardCount > 1);
+
+			if (!createHost(shard->host, boundPort))
+			{
+				NazaraError("Failed to create shard #" + std::to_string(shardIndex));
+				m_shards.clear();
+				return false;
+			}
+
+			// Every shard has to bind the same port
+			if (shardIndex == 0)
+				boundPort = shard->host.GetBoundAddress().GetPort();
+		}
+
+		return true;
+	}
+
+	void ENetShardedHost::PushMessage(std::size_t shardIndex, Message&& message)
+	{
+		NazaraAssert(shardIndex < m_shards.size(), "Shard index out of range");
+
+		Shard& shard = *m_shards[shardIndex];
+		{
+			std::lock_guard<std::mutex> lock(shard.messageMutex);
+			shard.pendingMessages.push_back(std::move(message));
+		}
+
+		shard.hasPendingMessages.store(true, std::memory_order_release);
+	}
+
+	void ENetShardedHost::ProcessMessages(std::size_t shardIndex, Shard& shard)
+	{
+		{
+			std::lock_guard<std::mutex> lock(shard.messageMutex);
+			std::swap(shard.pendingMessages, shard.processedMessages);
+		}
+
+		ENetHost& host = shard.host;
+		for (Message& message : shard.processedMessages)
+		{
+			switch (message.type)
+			{
+				case MessageType::Broadcast:
+					host.Broadcast(message.channelId, message.flags, std::move(message.packet));
+					break;
+
+				case MessageType::Disconnect:
+				{
+					if (ENetPeer* peer = ResolvePeer(host, message.peerId, message.connectId))
+						peer->Disconnect(message.data);
+
+					break;
+				}
+
+				case MessageType::Send:
+				{
+					if (ENetPeer* peer = ResolvePeer(host, message.peerId, message.connectId))
+						peer->Send(message.channelId, message.flags, std::move(message.packet));
+
+					break;
+				}
+
+				case MessageType::Task:
+					message.task(shardIndex, host);
+					break;
+			}
+		}
+
+		// Keep the vector capacity for the next messages
+		shard.processedMessages.clear();
+	}
+
+	void ENetShardedHost::ShardThread(std::size_t shardIndex, UInt32 serviceTimeout)
+	{
+		Shard& shard = *m_shards[shardIndex];
+
+		ENetEvent event;
+		while (m_running.load(std::memory_order_relaxed))
+		{
+			if (shard.hasPendingMessages.exchange(false, std::memory_order_acquire))
+				ProcessMessages(shardIndex, shard);
+
+			if (shard.host.Service(&event, serviceTimeout) > 0)
+			{
+				do
+				{
+					m_eventCallback(shardIndex, shard.host, event);
+				}
+				while (shard.host.CheckEvents(&event));
+			}
+		}
+
+		// Send what has been queued by the last events
+		shard.host.Flush();
+	}
+
+	ENetPeer* ENetShardedHost::ResolvePeer(ENetHost& host, UInt16 peerId, UInt32 connectId)
+	{
+		ENetPeer* peer = host.GetPeer(peerId);
+		if (!peer || peer->GetConnectId() != connectId || !peer->IsConnected())
+			return nullptr;
+
+		return peer;
+	}
+}
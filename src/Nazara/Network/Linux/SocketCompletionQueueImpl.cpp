@@ -0,0 +1,783 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Linux/SocketCompletionQueueImpl.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Network/Posix/SocketImpl.hpp>
+#include <algorithm>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		template<typename T>
+		T LoadAcquire(const T* value)
+		{
+			return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+		}
+
+		template<typename T>
+		void StoreRelease(T* value, T newValue)
+		{
+			__atomic_store_n(value, newValue, __ATOMIC_RELEASE);
+		}
+	}
+
+	SocketCompletionQueueImpl::SocketCompletionQueueImpl(SocketCompletionQueue::Statistics& statistics) :
+	m_bufferRing(nullptr),
+	m_completionEntries(nullptr),
+	m_submissionEntries(nullptr),
+	m_operationPool(256),
+	m_statistics(statistics),
+	m_bufferRingTail(0),
+	m_localSubmissionTail(0),
+	m_pendingSubmissionCount(0),
+	m_ringMemory(nullptr),
+	m_ringHandle(-1)
+	{
+	}
+
+	SocketCompletionQueueImpl::~SocketCompletionQueueImpl()
+	{
+		if (m_ringHandle >= 0)
+		{
+			// Cancel everything before releasing the memory the kernel may still write to (receive buffers)
+			if (m_submissionEntries)
+				CancelOperations(-1, IORING_ASYNC_CANCEL_ANY | IORING_ASYNC_CANCEL_ALL);
+
+			if (m_bufferRing)
+				munmap(m_bufferRing, m_bufferRingSize);
+
+			if (m_submissionEntries)
+				munmap(m_submissionEntries, m_submissionEntriesSize);
+
+			if (m_ringMemory)
+				munmap(m_ringMemory, m_ringSize);
+
+			close(m_ringHandle);
+		}
+
+		m_operationPool.Clear();
+	}
+
+	bool SocketCompletionQueueImpl::Accept(SocketHandle handle, SocketCompletionQueue::AcceptCallback&& callback)
+	{
+		Operation* operation = AllocateOperation(handle, OperationType::Accept);
+		operation->acceptCallback = std::move(callback);
+
+		LinkOperation(operation);
+		if (!SubmitOperation(operation))
+		{
+			UnlinkOperation(operation);
+			ReleaseOperation(operation);
+			return false;
+		}
+
+		return true;
+	}
+
+	void SocketCompletionQueueImpl::Cancel(SocketHandle handle)
+	{
+		auto it = m_socketOperations.find(handle);
+		if (it == m_socketOperations.end())
+			return;
+
+		SocketOperations& socketOperations = it->second;
+
+		// Operations which were submitted are released when the kernel reports their cancellation
+		for (Operation* operation = socketOperations.first; operation; operation = operation->next)
+			operation->isCancelled = true;
+
+		// Only the first send of the queue was submitted
+		if (Operation* send = socketOperations.sendQueueFirst)
+		{
+			send->isCancelled = true;
+
+			Operation* queuedSend = send->next;
+			while (queuedSend)
+			{
+				Operation* nextSend = queuedSend->next;
+				ReleaseOperation(queuedSend);
+				queuedSend = nextSend;
+			}
+		}
+
+		m_socketOperations.erase(it);
+
+		// Cancellation is matched by descriptor, which may be reused as soon as the socket is closed
+		CancelOperations(handle, IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL);
+	}
+
+	bool SocketCompletionQueueImpl::Create(std::size_t entryCount, std::size_t bufferCount, std::size_t bufferSize)
+	{
+		NazaraAssert(m_ringHandle < 0, "Completion queue already created");
+
+		io_uring_params parameters = {};
+		parameters.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN | IORING_SETUP_TASKRUN_FLAG;
+		parameters.cq_entries = static_cast<UInt32>(entryCount * 4); //< multishot operations post many completions for a single submission
+
+		m_ringHandle = static_cast<int>(syscall(__NR_io_uring_setup, static_cast<unsigned int>(entryCount), &parameters));
+		if (m_ringHandle < 0 && errno == EINVAL)
+		{
+			// Cooperative task running requires Linux 5.19, fallback to interrupts
+			unsigned int completionEntryCount = parameters.cq_entries;
+
+			parameters = {};
+			parameters.flags = IORING_SETUP_CQSIZE;
+			parameters.cq_entries = completionEntryCount;
+
+			m_ringHandle = static_cast<int>(syscall(__NR_io_uring_setup, static_cast<unsigned int>(entryCount), &parameters));
+		}
+
+		if (m_ringHandle < 0)
+		{
+			NazaraError("Failed to setup io_uring (errno " + NumberToString(errno) + ": " + Error::GetLastSystemError() + ')');
+			return false;
+		}
+
+		constexpr UInt32 requiredFeatures = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+		if ((parameters.features & requiredFeatures) != requiredFeatures || !ProbeOperations(m_ringHandle))
+		{
+			NazaraError("io_uring implementation is too old (Linux 6.0 is required)");
+			return false;
+		}
+
+		std::size_t submissionRingSize = parameters.sq_off.array + parameters.sq_entries * sizeof(unsigned int);
+		std::size_t completionRingSize = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+
+		// Both rings share the same mapping (IORING_FEAT_SINGLE_MMAP)
+		m_ringSize = std::max(submissionRingSize, completionRingSize);
+		m_ringMemory = mmap(nullptr, m_ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringHandle, IORING_OFF_SQ_RING);
+		if (m_ringMemory == MAP_FAILED)
+		{
+			m_ringMemory = nullptr;
+			NazaraError("Failed to map io_uring rings (errno " + NumberToString(errno) + ": " + Error::GetLastSystemError() + ')');
+			return false;
+		}
+
+		m_submissionEntriesSize = parameters.sq_entries * sizeof(io_uring_sqe);
+		void* submissionEntries = mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringHandle, IORING_OFF_SQES);
+		if (submissionEntries == MAP_FAILED)
+		{
+			NazaraError("Failed to map io_uring submission entries (errno " + NumberToString(errno) + ": " + Error::GetLastSystemError() + ')');
+			return false;
+		}
+
+		UInt8* ringMemory = static_cast<UInt8*>(m_ringMemory);
+
+		m_submissionEntries = static_cast<io_uring_sqe*>(submissionEntries);
+		m_submissionEntryCount = parameters.sq_entries;
+		m_submissionFlags = reinterpret_cast<unsigned int*>(ringMemory + parameters.sq_off.flags);
+		m_submissionHead = reinterpret_cast<unsigned int*>(ringMemory + parameters.sq_off.head);
+		m_submissionMask = *reinterpret_cast<unsigned int*>(ringMemory + parameters.sq_off.ring_mask);
+		m_submissionTail = reinterpret_cast<unsigned int*>(ringMemory + parameters.sq_off.tail);
+		m_localSubmissionTail = *m_submissionTail;
+
+		// Submission entries are always pushed in order, the indirection array can be filled once
+		unsigned int* submissionArray = reinterpret_cast<unsigned int*>(ringMemory + parameters.sq_off.array);
+		for (unsigned int i = 0; i < m_submissionEntryCount; ++i)
+			submissionArray[i] = i;
+
+		m_completionEntries = reinterpret_cast<io_uring_cqe*>(ringMemory + parameters.cq_off.cqes);
+		m_completionHead = reinterpret_cast<unsigned int*>(ringMemory + parameters.cq_off.head);
+		m_completionMask = *reinterpret_cast<unsigned int*>(ringMemory + parameters.cq_off.ring_mask);
+		m_completionTail = reinterpret_cast<unsigned int*>(ringMemory + parameters.cq_off.tail);
+
+		// Provided buffer ring, the kernel picks a buffer from it when data is received
+		unsigned int bufferRingEntryCount = 1;
+		while (bufferRingEntryCount < bufferCount && bufferRingEntryCount < 32768)
+			bufferRingEntryCount <<= 1;
+
+		m_bufferRingSize = bufferRingEntryCount * sizeof(io_uring_buf);
+		void* bufferRing = mmap(nullptr, m_bufferRingSize, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+		if (bufferRing == MAP_FAILED)
+		{
+			NazaraError("Failed to allocate buffer ring (errno " + NumberToString(errno) + ": " + Error::GetLastSystemError() + ')');
+			return false;
+		}
+
+		m_bufferRing = static_cast<io_uring_buf_ring*>(bufferRing);
+
+		io_uring_buf_reg bufferRegistration = {};
+		bufferRegistration.ring_addr = reinterpret_cast<UInt64>(m_bufferRing);
+		bufferRegistration.ring_entries = bufferRingEntryCount;
+		bufferRegistration.bgid = BufferGroupId;
+
+		if (syscall(__NR_io_uring_register, m_ringHandle, IORING_REGISTER_PBUF_RING, &bufferRegistration, 1) < 0)
+		{
+			NazaraError("Failed to register buffer ring (errno " + NumberToString(errno) + ": " + Error::GetLastSystemError() + ')');
+			return false;
+		}
+
+		m_bufferSize = bufferSize;
+		m_bufferRingMask = static_cast<UInt16>(bufferRingEntryCount - 1);
+		m_bufferData.resize(bufferRingEntryCount * bufferSize);
+
+		for (unsigned int i = 0; i < bufferRingEntryCount; ++i)
+			RecycleBuffer(static_cast<UInt16>(i));
+
+		return true;
+	}
+
+	unsigned int SocketCompletionQueueImpl::Poll(int msTimeout, SocketError* error)
+	{
+		bool hasCompletions = LoadAcquire(m_completionTail) != *m_completionHead;
+		bool mustWait = !hasCompletions && msTimeout != 0;
+
+		// Skip the syscall when there's nothing to submit and the kernel doesn't need us to run its completion work
+		unsigned int submissionFlags = LoadAcquire(m_submissionFlags);
+		if (m_pendingSubmissionCount > 0 || mustWait || (submissionFlags & (IORING_SQ_TASKRUN | IORING_SQ_CQ_OVERFLOW)) != 0)
+		{
+			if (!Enter((mustWait) ? 1 : 0, msTimeout, error))
+				return 0;
+		}
+
+		if (error)
+			*error = SocketError::NoError;
+
+		// Only process completions which were there at this point, as callbacks may lead to new ones
+		unsigned int head = *m_completionHead;
+		unsigned int tail = LoadAcquire(m_completionTail);
+
+		unsigned int completionCount = 0;
+		for (; head != tail; ++head)
+		{
+			io_uring_cqe completion = m_completionEntries[head & m_completionMask];
+
+			// Release the entry before calling the callback as the kernel can reuse it from now
+			StoreRelease(m_completionHead, head + 1);
+
+			if (HandleCompletion(completion))
+				completionCount++;
+		}
+
+		m_statistics.completionCount += completionCount;
+
+		return completionCount;
+	}
+
+	bool SocketCompletionQueueImpl::Receive(SocketHandle handle, SocketCompletionQueue::ReceiveCallback&& callback)
+	{
+		Operation* operation = AllocateOperation(handle, OperationType::Receive);
+		operation->receiveCallback = std::move(callback);
+
+		LinkOperation(operation);
+		if (!SubmitOperation(operation))
+		{
+			UnlinkOperation(operation);
+			ReleaseOperation(operation);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool SocketCompletionQueueImpl::ReceiveFrom(SocketHandle handle, SocketCompletionQueue::ReceiveFromCallback&& callback)
+	{
+		Operation* operation = AllocateOperation(handle, OperationType::ReceiveFrom);
+		operation->receiveFromCallback = std::move(callback);
+
+		// With buffer selection, the kernel writes the header, the name and the payload in the picked buffer
+		std::memset(&operation->message, 0, sizeof(msghdr));
+		operation->message.msg_namelen = sizeof(operation->address);
+
+		LinkOperation(operation);
+		if (!SubmitOperation(operation))
+		{
+			UnlinkOperation(operation);
+			ReleaseOperation(operation);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool SocketCompletionQueueImpl::Send(SocketHandle handle, const void* buffer, std::size_t size, SocketCompletionQueue::SendCallback&& callback)
+	{
+		Operation* operation = AllocateOperation(handle, OperationType::Send);
+		operation->data.assign(static_cast<const UInt8*>(buffer), static_cast<const UInt8*>(buffer) + size);
+		operation->sendCallback = std::move(callback);
+
+		SocketOperations& socketOperations = m_socketOperations[handle];
+		if (socketOperations.sendQueueLast)
+		{
+			// Will be submitted once the previous sends are done
+			socketOperations.sendQueueLast->next = operation;
+			socketOperations.sendQueueLast = operation;
+			return true;
+		}
+
+		socketOperations.sendQueueFirst = operation;
+		socketOperations.sendQueueLast = operation;
+
+		if (!SubmitOperation(operation))
+		{
+			socketOperations.sendQueueFirst = nullptr;
+			socketOperations.sendQueueLast = nullptr;
+			if (!socketOperations.first)
+				m_socketOperations.erase(handle);
+
+			ReleaseOperation(operation);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool SocketCompletionQueueImpl::SendTo(SocketHandle handle, const IpAddress& to, const void* buffer, std::size_t size, SocketCompletionQueue::SendCallback&& callback)
+	{
+		Operation* operation = AllocateOperation(handle, OperationType::SendTo);
+		operation->data.assign(static_cast<const UInt8*>(buffer), static_cast<const UInt8*>(buffer) + size);
+		operation->sendCallback = std::move(callback);
+
+		operation->ioVector.iov_base = operation->data.data();
+		operation->ioVector.iov_len = operation->data.size();
+
+		std::memset(&operation->message, 0, sizeof(msghdr));
+		operation->message.msg_name = operation->address.data();
+		operation->message.msg_namelen = IpAddressImpl::ToSockAddr(to, operation->address.data());
+		operation->message.msg_iov = &operation->ioVector;
+		operation->message.msg_iovlen = 1;
+
+		// Datagrams are sent atomically, they don't need to be queued like stream sends
+		LinkOperation(operation);
+		if (!SubmitOperation(operation))
+		{
+			UnlinkOperation(operation);
+			ReleaseOperation(operation);
+			return false;
+		}
+
+		return true;
+	}
+
+	auto SocketCompletionQueueImpl::AllocateOperation(SocketHandle handle, OperationType type) -> Operation*
+	{
+		std::size_t poolIndex;
+		Operation* operation = m_operationPool.Allocate(poolIndex);
+		operation->handle = handle;
+		operation->poolIndex = poolIndex;
+		operation->type = type;
+
+		return operation;
+	}
+
+	void SocketCompletionQueueImpl::CancelOperations(int fd, UInt32 cancelFlags)
+	{
+		// Operations still in the submission queue have to reach the kernel to be cancelled
+		if (m_pendingSubmissionCount > 0)
+			Enter(0, 0, nullptr);
+
+		// Synchronous cancellation only returns once every matching operation completed, the kernel won't touch
+		// the socket or our buffers afterwards; completions of cancelled operations are dropped by the next Poll
+		io_uring_sync_cancel_reg cancelRegistration = {};
+		cancelRegistration.fd = fd;
+		cancelRegistration.flags = cancelFlags;
+		cancelRegistration.timeout.tv_sec = -1; //< no timeout
+		cancelRegistration.timeout.tv_nsec = -1;
+
+		if (syscall(__NR_io_uring_register, m_ringHandle, IORING_REGISTER_SYNC_CANCEL, &cancelRegistration, 1) >= 0 || errno == ENOENT)
+			return;
+
+		// Interrupted by a signal: fall back to an asynchronous cancellation, operations may complete after the socket is closed
+		// but they are flagged as cancelled so their completions are dropped
+		NazaraWarning("synchronous cancellation failed: " + Error::GetLastSystemError());
+
+		io_uring_sqe submission = {};
+		submission.opcode = IORING_OP_ASYNC_CANCEL;
+		submission.fd = fd;
+		submission.cancel_flags = cancelFlags;
+
+		if (PushSubmission(submission))
+			Enter(0, 0, nullptr);
+	}
+
+	bool SocketCompletionQueueImpl::Enter(unsigned int minCompleteCount, int msTimeout, SocketError* error)
+	{
+		__kernel_timespec timeout;
+		io_uring_getevents_arg arguments = {};
+		if (minCompleteCount > 0 && msTimeout > 0)
+		{
+			timeout.tv_sec = msTimeout / 1000;
+			timeout.tv_nsec = (msTimeout % 1000) * 1'000'000LL;
+			arguments.ts = reinterpret_cast<UInt64>(&timeout);
+		}
+
+		unsigned int flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+
+		long result = syscall(__NR_io_uring_enter, m_ringHandle, m_pendingSubmissionCount, minCompleteCount, flags, &arguments, sizeof(arguments));
+		m_statistics.syscallCount++;
+
+		if (result < 0)
+		{
+			int errorCode = errno;
+			switch (errorCode)
+			{
+				// Timeout expired, or the kernel has completions to flush first
+				case ETIME:
+				case EAGAIN:
+				case EBUSY:
+					return true;
+
+				default:
+					if (error)
+						*error = SocketImpl::TranslateErrorToSocketError(errorCode);
+
+					return false;
+			}
+		}
+
+		unsigned int submittedCount = static_cast<unsigned int>(result);
+		m_pendingSubmissionCount -= std::min(submittedCount, m_pendingSubmissionCount);
+		m_statistics.submissionCount += submittedCount;
+
+		return true;
+	}
+
+	bool SocketCompletionQueueImpl::HandleCompletion(const io_uring_cqe& completion)
+	{
+		// Cancellation requests don't have an operation
+		Operation* operation = reinterpret_cast<Operation*>(completion.user_data);
+		if (!operation)
+			return false;
+
+		bool isFinal = (completion.flags & IORING_CQE_F_MORE) == 0;
+		bool invokeCallback = !operation->isCancelled && completion.res != -ECANCELED;
+
+		switch (operation->type)
+		{
+			case OperationType::Accept:
+			{
+				if (completion.res >= 0)
+				{
+					SocketHandle clientHandle = completion.res;
+					if (invokeCallback)
+					{
+						// Multishot accept doesn't report the peer address (its buffer would be shared by every completion)
+						IpAddress peerAddress = SocketImpl::QueryPeerAddress(clientHandle);
+						operation->acceptCallback(SocketError::NoError, clientHandle, peerAddress);
+					}
+					else
+						SocketImpl::Close(clientHandle);
+				}
+				else if (invokeCallback)
+					operation->acceptCallback(SocketImpl::TranslateErrorToSocketError(-completion.res), SocketImpl::InvalidHandle, IpAddress::Invalid);
+
+				if (isFinal)
+				{
+					// The kernel may stop a multishot accept without error (when the completion queue overflows)
+					if (operation->isCancelled || completion.res < 0 || !SubmitOperation(operation))
+					{
+						UnlinkOperation(operation);
+						ReleaseOperation(operation);
+					}
+				}
+				break;
+			}
+
+			case OperationType::Receive:
+			case OperationType::ReceiveFrom:
+				HandleReceiveCompletion(operation, completion, isFinal);
+				break;
+
+			case OperationType::Send:
+			case OperationType::SendTo:
+				HandleSendCompletion(operation, completion);
+				break;
+		}
+
+		return true;
+	}
+
+	void SocketCompletionQueueImpl::HandleReceiveCompletion(Operation* operation, const io_uring_cqe& completion, bool isFinal)
+	{
+		bool invokeCallback = !operation->isCancelled && completion.res != -ECANCELED;
+
+		if (completion.flags & IORING_CQE_F_BUFFER)
+		{
+			UInt16 bufferId = static_cast<UInt16>(completion.flags >> IORING_CQE_BUFFER_SHIFT);
+			UInt8* buffer = &m_bufferData[bufferId * m_bufferSize];
+
+			if (invokeCallback && completion.res >= 0)
+			{
+				if (operation->type == OperationType::Receive)
+					operation->receiveCallback((completion.res > 0) ? SocketError::NoError : SocketError::ConnectionClosed, buffer, static_cast<std::size_t>(completion.res));
+				else
+				{
+					// Buffer layout: io_uring_recvmsg_out, name, control, payload
+					const io_uring_recvmsg_out* header = reinterpret_cast<const io_uring_recvmsg_out*>(buffer);
+					const UInt8* name = buffer + sizeof(io_uring_recvmsg_out);
+					const UInt8* payload = name + operation->message.msg_namelen + operation->message.msg_controllen;
+
+					std::size_t payloadOffset = static_cast<std::size_t>(payload - buffer);
+					std::size_t payloadSize = std::min<std::size_t>(header->payloadlen, static_cast<std::size_t>(completion.res) - std::min<std::size_t>(payloadOffset, completion.res));
+
+					IpAddress from;
+					if (header->namelen > 0)
+					{
+						std::memcpy(operation->address.data(), name, std::min<std::size_t>(header->namelen, operation->address.size()));
+						from = IpAddressImpl::FromSockAddr(reinterpret_cast<const sockaddr*>(operation->address.data()));
+					}
+
+					SocketError error = (header->flags & MSG_TRUNC) ? SocketError::DatagramSize : SocketError::NoError;
+					operation->receiveFromCallback(error, from, payload, payloadSize);
+				}
+			}
+
+			// Buffer content is only valid during the callback
+			RecycleBuffer(bufferId);
+		}
+		else if (completion.res == -ENOBUFS)
+			m_statistics.bufferExhaustionCount++;
+		else if (invokeCallback)
+		{
+			SocketError error = (completion.res == 0) ? SocketError::ConnectionClosed : SocketImpl::TranslateErrorToSocketError(-completion.res);
+			if (operation->type == OperationType::Receive)
+				operation->receiveCallback(error, nullptr, 0);
+			else
+				operation->receiveFromCallback(error, IpAddress::Invalid, nullptr, 0);
+		}
+
+		if (isFinal)
+		{
+			// Multishot receive stops when running out of buffers, they were given back by the callbacks so it can be rearmed
+			bool rearm = !operation->isCancelled && (completion.res > 0 || completion.res == -ENOBUFS);
+			if (!rearm || !SubmitOperation(operation))
+			{
+				UnlinkOperation(operation);
+				ReleaseOperation(operation);
+			}
+		}
+	}
+
+	void SocketCompletionQueueImpl::HandleSendCompletion(Operation* operation, const io_uring_cqe& completion)
+	{
+		bool invokeCallback = !operation->isCancelled && completion.res != -ECANCELED && operation->sendCallback;
+
+		if (operation->type == OperationType::SendTo)
+		{
+			if (invokeCallback)
+			{
+				if (completion.res >= 0)
+					operation->sendCallback(SocketError::NoError, static_cast<std::size_t>(completion.res));
+				else
+					operation->sendCallback(SocketImpl::TranslateErrorToSocketError(-completion.res), 0);
+			}
+
+			UnlinkOperation(operation);
+			ReleaseOperation(operation);
+			return;
+		}
+
+		if (completion.res > 0)
+			operation->sent += static_cast<std::size_t>(completion.res);
+
+		// Stream sockets may only send a part of the data, send the remaining part before moving to the next send
+		if (!operation->isCancelled && completion.res > 0 && operation->sent < operation->data.size())
+		{
+			if (SubmitOperation(operation))
+				return;
+		}
+
+		if (operation->isCancelled)
+		{
+			// Socket operations were already detached
+			ReleaseOperation(operation);
+			return;
+		}
+
+		SocketHandle handle = operation->handle;
+
+		auto it = m_socketOperations.find(handle);
+		NazaraAssert(it != m_socketOperations.end(), "Send operation is not registered");
+
+		SocketOperations& socketOperations = it->second;
+		NazaraAssert(socketOperations.sendQueueFirst == operation, "Send operation is not at the front of the queue");
+
+		socketOperations.sendQueueFirst = operation->next;
+		if (!socketOperations.sendQueueFirst)
+			socketOperations.sendQueueLast = nullptr;
+
+		operation->next = nullptr;
+
+		if (invokeCallback)
+		{
+			if (completion.res >= 0)
+				operation->sendCallback(SocketError::NoError, operation->sent);
+			else
+				operation->sendCallback(SocketImpl::TranslateErrorToSocketError(-completion.res), operation->sent);
+		}
+
+		ReleaseOperation(operation);
+
+		// The callback may have cancelled the socket operations
+		it = m_socketOperations.find(handle);
+		if (it == m_socketOperations.end())
+			return;
+
+		while (Operation* nextSend = it->second.sendQueueFirst)
+		{
+			if (SubmitOperation(nextSend))
+				return;
+
+			it->second.sendQueueFirst = nextSend->next;
+			if (!it->second.sendQueueFirst)
+				it->second.sendQueueLast = nullptr;
+
+			if (nextSend->sendCallback)
+				nextSend->sendCallback(SocketError::ResourceError, 0);
+			ReleaseOperation(nextSend);
+		}
+
+		if (!it->second.first)
+			m_socketOperations.erase(it);
+	}
+
+	void SocketCompletionQueueImpl::LinkOperation(Operation* operation)
+	{
+		SocketOperations& socketOperations = m_socketOperations[operation->handle];
+
+		operation->previous = nullptr;
+		operation->next = socketOperations.first;
+		if (socketOperations.first)
+			socketOperations.first->previous = operation;
+
+		socketOperations.first = operation;
+	}
+
+	bool SocketCompletionQueueImpl::PushSubmission(const io_uring_sqe& submission)
+	{
+		if (m_localSubmissionTail - LoadAcquire(m_submissionHead) >= m_submissionEntryCount)
+		{
+			// Submission queue is full, flush it
+			if (!Enter(0, 0, nullptr) || m_localSubmissionTail - LoadAcquire(m_submissionHead) >= m_submissionEntryCount)
+			{
+				NazaraError("Submission queue is full");
+				return false;
+			}
+		}
+
+		std::memcpy(&m_submissionEntries[m_localSubmissionTail & m_submissionMask], &submission, sizeof(io_uring_sqe));
+		StoreRelease(m_submissionTail, ++m_localSubmissionTail);
+
+		m_pendingSubmissionCount++;
+		return true;
+	}
+
+	void SocketCompletionQueueImpl::RecycleBuffer(UInt16 bufferId)
+	{
+		// Don't use io_uring_buf_ring::bufs, its flexible array is declared after an empty struct which takes space in C++
+		io_uring_buf& buffer = reinterpret_cast<io_uring_buf*>(m_bufferRing)[m_bufferRingTail & m_bufferRingMask];
+		buffer.addr = reinterpret_cast<UInt64>(&m_bufferData[bufferId * m_bufferSize]);
+		buffer.len = static_cast<UInt32>(m_bufferSize);
+		buffer.bid = bufferId;
+
+		StoreRelease(&m_bufferRing->tail, ++m_bufferRingTail);
+	}
+
+	void SocketCompletionQueueImpl::ReleaseOperation(Operation* operation)
+	{
+		m_operationPool.Free(operation->poolIndex);
+	}
+
+	bool SocketCompletionQueueImpl::SubmitOperation(Operation* operation)
+	{
+		io_uring_sqe submission = {};
+		submission.fd = operation->handle;
+		submission.user_data = reinterpret_cast<UInt64>(operation);
+
+		switch (operation->type)
+		{
+			case OperationType::Accept:
+				submission.opcode = IORING_OP_ACCEPT;
+				submission.ioprio = IORING_ACCEPT_MULTISHOT;
+				submission.accept_flags = SOCK_CLOEXEC;
+				break;
+
+			case OperationType::Receive:
+				submission.opcode = IORING_OP_RECV;
+				submission.ioprio = IORING_RECV_MULTISHOT;
+				submission.flags = IOSQE_BUFFER_SELECT;
+				submission.buf_group = BufferGroupId;
+				break;
+
+			case OperationType::ReceiveFrom:
+				submission.opcode = IORING_OP_RECVMSG;
+				submission.addr = reinterpret_cast<UInt64>(&operation->message);
+				submission.len = 1;
+				submission.ioprio = IORING_RECV_MULTISHOT;
+				submission.flags = IOSQE_BUFFER_SELECT;
+				submission.buf_group = BufferGroupId;
+				break;
+
+			case OperationType::Send:
+				submission.opcode = IORING_OP_SEND;
+				submission.addr = reinterpret_cast<UInt64>(operation->data.data() + operation->sent);
+				submission.len = static_cast<UInt32>(operation->data.size() - operation->sent);
+				submission.msg_flags = MSG_NOSIGNAL;
+				break;
+
+			case OperationType::SendTo:
+				submission.opcode = IORING_OP_SENDMSG;
+				submission.addr = reinterpret_cast<UInt64>(&operation->message);
+				submission.len = 1;
+				submission.msg_flags = MSG_NOSIGNAL;
+				break;
+		}
+
+		return PushSubmission(submission);
+	}
+
+	void SocketCompletionQueueImpl::UnlinkOperation(Operation* operation)
+	{
+		// Operations of a cancelled socket were detached
+		if (operation->isCancelled)
+			return;
+
+		auto it = m_socketOperations.find(operation->handle);
+		if (it == m_socketOperations.end())
+			return;
+
+		SocketOperations& socketOperations = it->second;
+		if (operation->previous)
+			operation->previous->next = operation->next;
+		else
+			socketOperations.first = operation->next;
+
+		if (operation->next)
+			operation->next->previous = operation->previous;
+
+		operation->next = nullptr;
+		operation->previous = nullptr;
+
+		if (!socketOperations.first && !socketOperations.sendQueueFirst)
+			m_socketOperations.erase(it);
+	}
+
+	bool SocketCompletionQueueImpl::ProbeOperations(int ringHandle)
+	{
+		constexpr std::size_t ProbeOperationCount = 256;
+
+		std::vector<UInt8> probeBuffer(sizeof(io_uring_probe) + ProbeOperationCount * sizeof(io_uring_probe_op));
+		io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(probeBuffer.data());
+
+		if (syscall(__NR_io_uring_register, ringHandle, IORING_REGISTER_PROBE, probe, ProbeOperationCount) < 0)
+			return false;
+
+		// Multishot receive isn't advertised by the probe, it was added along with IORING_OP_SEND_ZC (Linux 6.0)
+		for (UInt8 operation : { IORING_OP_ACCEPT, IORING_OP_ASYNC_CANCEL, IORING_OP_RECV, IORING_OP_RECVMSG, IORING_OP_SEND, IORING_OP_SENDMSG, IORING_OP_SEND_ZC })
+		{
+			if (operation > probe->last_op || (probe->ops[operation].flags & IO_URING_OP_SUPPORTED) == 0)
+				return false;
+		}
+
+		return true;
+	}
+}
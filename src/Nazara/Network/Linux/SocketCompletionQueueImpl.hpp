@@ -0,0 +1,130 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_LINUX_SOCKETCOMPLETIONQUEUEIMPL_HPP
+#define NAZARA_NETWORK_LINUX_SOCKETCOMPLETIONQUEUEIMPL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <Nazara/Network/Posix/IpAddressImpl.hpp>
+#include <Nazara/Utils/MemoryPool.hpp>
+#include <unordered_map>
+#include <vector>
+#include <linux/io_uring.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+namespace Nz
+{
+	class SocketCompletionQueueImpl
+	{
+		public:
+			SocketCompletionQueueImpl(SocketCompletionQueue::Statistics& statistics);
+			SocketCompletionQueueImpl(const SocketCompletionQueueImpl&) = delete;
+			SocketCompletionQueueImpl(SocketCompletionQueueImpl&&) = delete;
+			~SocketCompletionQueueImpl();
+
+			bool Accept(SocketHandle handle, SocketCompletionQueue::AcceptCallback&& callback);
+
+			void Cancel(SocketHandle handle);
+
+			bool Create(std::size_t entryCount, std::size_t bufferCount, std::size_t bufferSize);
+
+			unsigned int Poll(int msTimeout, SocketError* error);
+
+			bool Receive(SocketHandle handle, SocketCompletionQueue::ReceiveCallback&& callback);
+			bool ReceiveFrom(SocketHandle handle, SocketCompletionQueue::ReceiveFromCallback&& callback);
+
+			bool Send(SocketHandle handle, const void* buffer, std::size_t size, SocketCompletionQueue::SendCallback&& callback);
+			bool SendTo(SocketHandle handle, const IpAddress& to, const void* buffer, std::size_t size, SocketCompletionQueue::SendCallback&& callback);
+
+			SocketCompletionQueueImpl& operator=(const SocketCompletionQueueImpl&) = delete;
+			SocketCompletionQueueImpl& operator=(SocketCompletionQueueImpl&&) = delete;
+
+		private:
+			enum class OperationType
+			{
+				Accept,
+				Receive,
+				ReceiveFrom,
+				Send,
+				SendTo
+			};
+
+			struct Operation
+			{
+				OperationType type;
+				Operation* next = nullptr;
+				Operation* previous = nullptr;
+				SocketCompletionQueue::AcceptCallback acceptCallback;
+				SocketCompletionQueue::ReceiveCallback receiveCallback;
+				SocketCompletionQueue::ReceiveFromCallback receiveFromCallback;
+				SocketCompletionQueue::SendCallback sendCallback;
+				SocketHandle handle;
+				IpAddressImpl::SockAddrBuffer address;
+				iovec ioVector;
+				msghdr message;
+				std::size_t poolIndex;
+				std::size_t sent = 0;
+				std::vector<UInt8> data;
+				bool isCancelled = false;
+			};
+
+			// Pending sends are kept apart as a stream socket can only have one of them in flight,
+			// otherwise a partial send could get interleaved with the next one
+			struct SocketOperations
+			{
+				Operation* first = nullptr;
+				Operation* sendQueueFirst = nullptr;
+				Operation* sendQueueLast = nullptr;
+			};
+
+			Operation* AllocateOperation(SocketHandle handle, OperationType type);
+			void CancelOperations(int fd, UInt32 cancelFlags);
+			bool Enter(unsigned int minCompleteCount, int msTimeout, SocketError* error);
+			bool HandleCompletion(const io_uring_cqe& completion);
+			void HandleReceiveCompletion(Operation* operation, const io_uring_cqe& completion, bool isFinal);
+			void HandleSendCompletion(Operation* operation, const io_uring_cqe& completion);
+			void LinkOperation(Operation* operation);
+			bool PushSubmission(const io_uring_sqe& submission);
+			void RecycleBuffer(UInt16 bufferId);
+			void ReleaseOperation(Operation* operation);
+			bool SubmitOperation(Operation* operation);
+			void UnlinkOperation(Operation* operation);
+
+			static bool ProbeOperations(int ringHandle);
+
+			static constexpr UInt16 BufferGroupId = 0;
+
+			std::size_t m_bufferRingSize;
+			std::size_t m_bufferSize;
+			std::size_t m_ringSize;
+			std::size_t m_submissionEntriesSize;
+			std::unordered_map<SocketHandle, SocketOperations> m_socketOperations;
+			std::vector<UInt8> m_bufferData;
+			io_uring_buf_ring* m_bufferRing;
+			io_uring_cqe* m_completionEntries;
+			io_uring_sqe* m_submissionEntries;
+			MemoryPool<Operation> m_operationPool;
+			SocketCompletionQueue::Statistics& m_statistics;
+			UInt16 m_bufferRingMask;
+			UInt16 m_bufferRingTail;
+			unsigned int m_completionMask;
+			unsigned int m_localSubmissionTail;
+			unsigned int m_pendingSubmissionCount;
+			unsigned int m_submissionEntryCount;
+			unsigned int m_submissionMask;
+			unsigned int* m_completionHead;
+			unsigned int* m_completionTail;
+			unsigned int* m_submissionFlags;
+			unsigned int* m_submissionHead;
+			unsigned int* m_submissionTail;
+			void* m_ringMemory;
+			int m_ringHandle;
+	};
+}
+
+#endif // NAZARA_NETWORK_LINUX_SOCKETCOMPLETIONQUEUEIMPL_HPP
@@ -6,13 +6,16 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Network/Posix/SocketImpl.hpp>
+#include <algorithm>
 #include <cstring>
 #include <unistd.h>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
 {
-	SocketPollerImpl::SocketPollerImpl()
+	SocketPollerImpl::SocketPollerImpl() :
+	m_socketCount(0),
+	m_events(1)
 	{
 		m_handle = epoll_create1(0);
 	}
@@ -24,27 +27,38 @@ namespace Nz
 
 	void SocketPollerImpl::Clear()
 	{
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
-		m_sockets.clear();
+		for (std::size_t socket = m_registeredSockets.FindFirst(); socket != m_registeredSockets.npos; socket = m_registeredSockets.FindNext(socket))
+		{
+			if (epoll_ctl(m_handle, EPOLL_CTL_DEL, static_cast<SocketHandle>(socket), nullptr) != 0)
+				NazaraWarning("An error occured while removing socket from epoll structure (errno " + NumberToString(errno) + ": " + Error::GetLastSystemError() + ')');
+		}
+
+		ResetReadySockets();
+		m_registeredSockets.Reset();
+		m_socketCount = 0;
+	}
+
+	const std::vector<SocketPoller::ReadySocket>& SocketPollerImpl::GetReadySockets() const
+	{
+		return m_readySockets;
 	}
 
 	bool SocketPollerImpl::IsReadyToRead(SocketHandle socket) const
 	{
-		return m_readyToReadSockets.count(socket) != 0;
+		return m_readyToReadSockets.UnboundedTest(static_cast<std::size_t>(socket));
 	}
 
 	bool SocketPollerImpl::IsReadyToWrite(SocketHandle socket) const
 	{
-		return m_readyToWriteSockets.count(socket) != 0;
+		return m_readyToWriteSockets.UnboundedTest(static_cast<std::size_t>(socket));
 	}
 
 	bool SocketPollerImpl::IsRegistered(SocketHandle socket) const
 	{
-		return m_sockets.count(socket) != 0;
+		return m_registeredSockets.UnboundedTest(static_cast<std::size_t>(socket));
 	}
 
-	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode mode)
 	{
 		NazaraAssert(!IsRegistered(socket), "Socket is already registered");
 
@@ -59,13 +73,35 @@ namespace Nz
 		if (eventFlags & SocketPollEvent::Write)
 			entry.events |= EPOLLOUT;
 
+		if (mode == SocketPollMode::EdgeTriggered)
+			entry.events |= EPOLLET;
+
 		if (epoll_ctl(m_handle, EPOLL_CTL_ADD, socket, &entry) != 0)
 		{
 			NazaraError("Failed to add socket to epoll structure (errno " + NumberToString(errno) + ": " + Error::GetLastSystemError() + ')');
 			return false;
 		}
 
-		m_sockets.insert(socket);
+		// Grow everything here so that Wait never allocates
+		std::size_t index = static_cast<std::size_t>(socket);
+		if (index >= m_registrations.size())
+		{
+			std::size_t newSize = std::max(index + 1, m_registrations.size() * 2);
+			m_registrations.resize(newSize);
+			m_readyToReadSockets.Resize(newSize);
+			m_readyToWriteSockets.Resize(newSize);
+			m_registeredSockets.Resize(newSize);
+		}
+
+		m_registrations[index].userdata = userdata;
+		m_registeredSockets.Set(index);
+
+		m_socketCount++;
+		if (m_events.size() < m_socketCount)
+		{
+			m_events.resize(std::max(m_socketCount, m_events.size() * 2));
+			m_readySockets.reserve(m_events.size());
+		}
 
 		return true;
 	}
@@ -74,9 +110,21 @@ namespace Nz
 	{
 		NazaraAssert(IsRegistered(socket), "Socket is not registered");
 
-		m_readyToReadSockets.erase(socket);
-		m_readyToWriteSockets.erase(socket);
-		m_sockets.erase(socket);
+		std::size_t index = static_cast<std::size_t>(socket);
+
+		// The ready list may be iterated while unregistering, keep the entry but remove its events
+		if (m_readyToReadSockets.Test(index) || m_readyToWriteSockets.Test(index))
+		{
+			SocketPoller::ReadySocket& readySocket = m_readySockets[m_registrations[index].readyIndex];
+			readySocket.events = SocketPollEventFlags{};
+			readySocket.userdata = nullptr;
+		}
+
+		m_readyToReadSockets.Reset(index);
+		m_readyToWriteSockets.Reset(index);
+		m_registeredSockets.Reset(index);
+		m_registrations[index].userdata = nullptr;
+		m_socketCount--;
 
 		if (epoll_ctl(m_handle, EPOLL_CTL_DEL, socket, nullptr) != 0)
 			NazaraWarning("An error occured while removing socket from epoll structure (errno " + NumberToString(errno) + ": " + Error::GetLastSystemError() + ')');
@@ -84,13 +132,10 @@ namespace Nz
 
 	unsigned int SocketPollerImpl::Wait(int msTimeout, SocketError* error)
 	{
-		int activeSockets;
-
-		// Reset status of sockets
-		m_events.resize(m_sockets.size());
-		std::memset(m_events.data(), 0, m_events.size() * sizeof(epoll_event));
+		// Only reset the sockets which were ready, instead of clearing everything
+		ResetReadySockets();
 
-		activeSockets = epoll_wait(m_handle, m_events.data(), static_cast<int>(m_events.size()), static_cast<int>(msTimeout));
+		int activeSockets = epoll_wait(m_handle, m_events.data(), static_cast<int>(m_events.size()), static_cast<int>(msTimeout));
 		if (activeSockets == -1)
 		{
 			if (error)
@@ -99,32 +144,54 @@ namespace Nz
 			return 0;
 		}
 
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
-		if (activeSockets > 0)
+		for (int i = 0; i < activeSockets; ++i)
 		{
-			int socketCount = activeSockets;
-			for (int i = 0; i < socketCount; ++i)
+			const epoll_event& event = m_events[i];
+
+			SocketPollEventFlags readyEvents;
+			if (event.events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+				readyEvents |= SocketPollEvent::Read;
+
+			if (event.events & (EPOLLOUT | EPOLLERR))
+				readyEvents |= SocketPollEvent::Write;
+
+			if (!readyEvents)
 			{
-				if (m_events[i].events & (EPOLLIN | EPOLLOUT | EPOLLHUP | EPOLLERR))
-				{
-					if (m_events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
-						m_readyToReadSockets.insert(m_events[i].data.fd);
-
-					if (m_events[i].events & (EPOLLOUT | EPOLLERR))
-						m_readyToWriteSockets.insert(m_events[i].data.fd);
-				}
-				else
-				{
-					NazaraWarning("Descriptor " + NumberToString(m_events[i].data.fd) + " was returned by epoll without EPOLLIN nor EPOLLOUT flags (events: 0x" + NumberToString(m_events[i].events, 16) + ')');
-					activeSockets--;
-				}
+				NazaraWarning("Descriptor " + NumberToString(event.data.fd) + " was returned by epoll without EPOLLIN nor EPOLLOUT flags (events: 0x" + NumberToString(event.events, 16) + ')');
+				continue;
 			}
+
+			std::size_t index = static_cast<std::size_t>(event.data.fd);
+			if (readyEvents & SocketPollEvent::Read)
+				m_readyToReadSockets.Set(index);
+
+			if (readyEvents & SocketPollEvent::Write)
+				m_readyToWriteSockets.Set(index);
+
+			Registration& registration = m_registrations[index];
+			registration.readyIndex = m_readySockets.size();
+
+			SocketPoller::ReadySocket& readySocket = m_readySockets.emplace_back();
+			readySocket.handle = event.data.fd;
+			readySocket.events = readyEvents;
+			readySocket.userdata = registration.userdata;
 		}
 
 		if (error)
 			*error = SocketError::NoError;
 
-		return activeSockets;
+		return static_cast<unsigned int>(m_readySockets.size());
+	}
+
+	void SocketPollerImpl::ResetReadySockets()
+	{
+		for (const SocketPoller::ReadySocket& readySocket : m_readySockets)
+		{
+			std::size_t index = static_cast<std::size_t>(readySocket.handle);
+			m_readyToReadSockets.Reset(index);
+			m_readyToWriteSockets.Reset(index);
+		}
+
+		m_readySockets.clear();
 	}
 }
@@ -9,7 +9,8 @@
 
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/SocketHandle.hpp>
-#include <unordered_set>
+#include <Nazara/Network/SocketPoller.hpp>
+#include <Nazara/Utils/Bitset.hpp>
 #include <vector>
 #include <sys/epoll.h>
 
@@ -23,20 +24,34 @@ namespace Nz
 
 			void Clear();
 
+			const std::vector<SocketPoller::ReadySocket>& GetReadySockets() const;
+
 			bool IsReadyToRead(SocketHandle socket) const;
 			bool IsReadyToWrite(SocketHandle socket) const;
 			bool IsRegistered(SocketHandle socket) const;
 
-			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags);
+			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode mode);
 			void UnregisterSocket(SocketHandle socket);
 
 			unsigned int Wait(int msTimeout, SocketError* error);
 
 		private:
-			std::unordered_set<SocketHandle> m_readyToReadSockets;
-			std::unordered_set<SocketHandle> m_readyToWriteSockets;
-			std::unordered_set<SocketHandle> m_sockets;
+			void ResetReadySockets();
+
+			// Descriptors are small integers, registrations and ready states are indexed by them
+			struct Registration
+			{
+				void* userdata = nullptr;
+				std::size_t readyIndex;
+			};
+
+			std::size_t m_socketCount;
+			std::vector<Registration> m_registrations;
+			std::vector<SocketPoller::ReadySocket> m_readySockets;
 			std::vector<epoll_event> m_events;
+			Bitset<UInt64> m_readyToReadSockets;
+			Bitset<UInt64> m_readyToWriteSockets;
+			Bitset<UInt64> m_registeredSockets;
 			int m_handle;
 	};
 }
@@ -4,10 +4,176 @@
 
 #include <Nazara/Network/NetPacket.hpp>
 #include <Nazara/Core/MemoryView.hpp>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
 {
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Buffers are binned by capacity in power of two size classes, from 64B to 64KiB
+		constexpr std::size_t MinSizeClassLog2 = 6;
+		constexpr std::size_t MaxSizeClassLog2 = 16;
+		constexpr std::size_t SizeClassCount = MaxSizeClassLog2 - MinSizeClassLog2 + 1;
+
+		constexpr std::size_t GlobalBinCapacity = 1024;
+		constexpr std::size_t ThreadBinCapacity = 64;
+		constexpr std::size_t TransferBatchSize = ThreadBinCapacity / 2;
+
+		using BufferBin = std::vector<std::unique_ptr<ByteArray>>;
+
+		// Size class of a buffer able to hold size bytes (SizeClassCount if too big to be cached)
+		std::size_t GetAcquireSizeClass(std::size_t size)
+		{
+			for (std::size_t sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+			{
+				if (size <= (std::size_t(1) << (sizeClass + MinSizeClassLog2)))
+					return sizeClass;
+			}
+
+			return SizeClassCount;
+		}
+
+		// Size class whose requests can be served by a buffer of this capacity (SizeClassCount if it shouldn't be cached)
+		std::size_t GetReleaseSizeClass(std::size_t capacity)
+		{
+			if (capacity < (std::size_t(1) << MinSizeClassLog2) || capacity >= (std::size_t(1) << (MaxSizeClassLog2 + 1)))
+				return SizeClassCount;
+
+			std::size_t sizeClass = 0;
+			while (capacity >= (std::size_t(1) << (sizeClass + MinSizeClassLog2 + 1)))
+				sizeClass++;
+
+			return sizeClass;
+		}
+
+		struct GlobalBufferCache
+		{
+			struct Bin
+			{
+				std::mutex mutex;
+				BufferBin buffers;
+			};
+
+			std::array<Bin, SizeClassCount> bins;
+			std::atomic<UInt64> allocatedBufferCount = 0;
+			std::atomic<UInt64> discardedBufferCount = 0;
+			std::atomic<UInt64> globalTransferCount = 0;
+		};
+
+		GlobalBufferCache s_globalBufferCache;
+
+		// Moves up to count buffers from a bin to another, discarding what doesn't fit
+		void TransferBuffers(BufferBin& from, BufferBin& to, std::size_t count, std::size_t capacity)
+		{
+			count = std::min(count, from.size());
+
+			std::size_t movedCount = std::min(count, capacity - std::min(capacity, to.size()));
+			for (std::size_t i = 0; i < movedCount; ++i)
+			{
+				to.push_back(std::move(from.back()));
+				from.pop_back();
+			}
+
+			if (movedCount < count)
+			{
+				from.resize(from.size() - (count - movedCount));
+				s_globalBufferCache.discardedBufferCount.fetch_add(count - movedCount, std::memory_order_relaxed);
+			}
+
+			s_globalBufferCache.globalTransferCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		// Thread caches are only accessed by their thread and don't need any synchronization, they exchange buffers with the global cache by batches
+		struct ThreadBufferCache
+		{
+			~ThreadBufferCache()
+			{
+				Clear();
+			}
+
+			void Clear()
+			{
+				for (std::size_t sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+				{
+					BufferBin& bin = bins[sizeClass];
+					if (bin.empty())
+						continue;
+
+					auto& globalBin = s_globalBufferCache.bins[sizeClass];
+
+					std::lock_guard<std::mutex> lock(globalBin.mutex);
+					TransferBuffers(bin, globalBin.buffers, bin.size(), GlobalBinCapacity);
+				}
+			}
+
+			std::unique_ptr<ByteArray> Acquire(std::size_t minCapacity)
+			{
+				acquireCount++;
+
+				std::size_t sizeClass = GetAcquireSizeClass(minCapacity);
+				if (sizeClass == SizeClassCount)
+				{
+					s_globalBufferCache.allocatedBufferCount.fetch_add(1, std::memory_order_relaxed);
+					return std::make_unique<ByteArray>(minCapacity);
+				}
+
+				BufferBin& bin = bins[sizeClass];
+				if (bin.empty())
+				{
+					auto& globalBin = s_globalBufferCache.bins[sizeClass];
+
+					std::lock_guard<std::mutex> lock(globalBin.mutex);
+					if (!globalBin.buffers.empty())
+						TransferBuffers(globalBin.buffers, bin, TransferBatchSize, ThreadBinCapacity);
+				}
+
+				if (!bin.empty())
+				{
+					reuseCount++;
+
+					std::unique_ptr<ByteArray> buffer = std::move(bin.back());
+					bin.pop_back();
+
+					return buffer;
+				}
+
+				s_globalBufferCache.allocatedBufferCount.fetch_add(1, std::memory_order_relaxed);
+				return std::make_unique<ByteArray>(std::size_t(1) << (sizeClass + MinSizeClassLog2));
+			}
+
+			void Release(std::unique_ptr<ByteArray> buffer)
+			{
+				std::size_t sizeClass = GetReleaseSizeClass(buffer->GetCapacity());
+				if (sizeClass == SizeClassCount)
+				{
+					s_globalBufferCache.discardedBufferCount.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+
+				BufferBin& bin = bins[sizeClass];
+				if (bin.size() >= ThreadBinCapacity)
+				{
+					auto& globalBin = s_globalBufferCache.bins[sizeClass];
+
+					std::lock_guard<std::mutex> lock(globalBin.mutex);
+					TransferBuffers(bin, globalBin.buffers, TransferBatchSize, GlobalBinCapacity);
+				}
+
+				bin.push_back(std::move(buffer));
+			}
+
+			std::array<BufferBin, SizeClassCount> bins;
+			UInt64 acquireCount = 0;
+			UInt64 reuseCount = 0;
+		};
+
+		thread_local ThreadBufferCache s_threadBufferCache;
+	}
+
 	/*!
 	* \ingroup network
 	* \class Nz::NetPacket
@@ -92,6 +258,38 @@ namespace Nz
 		return Serialize(context, packetSize) && Serialize(context, netCode);
 	}
 
+	/*!
+	* \brief Gets statistics about the packet buffer caches
+	* \return Global statistics and statistics of the calling thread
+	*
+	* Packet buffers are recycled through a cache per thread (binned by size classes, not requiring any lock) which exchange batches of buffers with a global list when they are empty or full.
+	*/
+
+	auto NetPacket::GetBufferCacheStatistics() -> BufferCacheStatistics
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		BufferCacheStatistics statistics;
+		statistics.allocatedBufferCount = s_globalBufferCache.allocatedBufferCount.load(std::memory_order_relaxed);
+		statistics.discardedBufferCount = s_globalBufferCache.discardedBufferCount.load(std::memory_order_relaxed);
+		statistics.globalTransferCount = s_globalBufferCache.globalTransferCount.load(std::memory_order_relaxed);
+		statistics.threadAcquireCount = s_threadBufferCache.acquireCount;
+		statistics.threadReuseCount = s_threadBufferCache.reuseCount;
+
+		statistics.globalBufferCount = 0;
+		for (auto& bin : s_globalBufferCache.bins)
+		{
+			std::lock_guard<std::mutex> lock(bin.mutex);
+			statistics.globalBufferCount += bin.buffers.size();
+		}
+
+		statistics.threadBufferCount = 0;
+		for (const auto& bin : s_threadBufferCache.bins)
+			statistics.threadBufferCount += bin.size();
+
+		return statistics;
+	}
+
 	/*!
 	* \brief Operation to do when stream is empty
 	*/
@@ -110,10 +308,9 @@ namespace Nz
 		if (!m_buffer)
 			return;
 
-		std::size_t size = m_buffer->GetSize();
+		NAZARA_USE_ANONYMOUS_NAMESPACE
 
-		std::lock_guard<std::mutex> lock(s_availableBuffersMutex);
-		s_availableBuffers.emplace_back(std::make_pair(size, std::move(m_buffer)));
+		s_threadBufferCache.Release(std::move(m_buffer));
 	}
 
 	/*!
@@ -130,21 +327,15 @@ namespace Nz
 	{
 		NazaraAssert(minCapacity >= cursorPos, "Cannot init stream with a smaller capacity than wanted cursor pos");
 
-		{
-			std::lock_guard<std::mutex> lock(s_availableBuffersMutex);
+		NAZARA_USE_ANONYMOUS_NAMESPACE
 
+		// Keep our buffer if it's big enough
+		if (!m_buffer || m_buffer->GetCapacity() < minCapacity)
+		{
 			FreeStream(); //< In case it wasn't released yet
-
-			if (!s_availableBuffers.empty())
-			{
-				m_buffer = std::move(s_availableBuffers.back().second);
-				s_availableBuffers.pop_back();
-			}
+			m_buffer = s_threadBufferCache.Acquire(minCapacity);
 		}
 
-		if (!m_buffer)
-			m_buffer = std::make_unique<ByteArray>();
-
 		m_buffer->Resize(minCapacity);
 
 		m_memoryStream.SetBuffer(m_buffer.get(), openMode);
@@ -168,9 +359,14 @@ namespace Nz
 
 	void NetPacket::Uninitialize()
 	{
-		s_availableBuffers.clear();
-	}
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		s_threadBufferCache.Clear();
 
-	std::mutex NetPacket::s_availableBuffersMutex;
-	std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> NetPacket::s_availableBuffers;
+		for (auto& bin : s_globalBufferCache.bins)
+		{
+			std::lock_guard<std::mutex> lock(bin.mutex);
+			bin.buffers.clear();
+		}
+	}
 }
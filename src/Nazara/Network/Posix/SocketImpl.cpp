@@ -8,6 +8,7 @@
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Network/Algorithm.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/Posix/IpAddressImpl.hpp>
 #include <Nazara/Utils/StackArray.hpp>
 #include <cstring>
@@ -15,6 +16,7 @@
 #include <unistd.h>
 #include <netinet/tcp.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <sys/types.h>
 #include <sys/uio.h>
 #include <Nazara/Network/Debug.hpp>
@@ -496,6 +498,135 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::ReceiveDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+#if defined(NAZARA_PLATFORM_LINUX)
+		std::size_t totalBufferCount = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			totalBufferCount += datagrams[i].bufferCount;
+
+		StackArray<iovec> sysBuffers = NazaraStackArray(iovec, totalBufferCount);
+		StackArray<mmsghdr> messages = NazaraStackArray(mmsghdr, datagramCount);
+		StackArray<IpAddressImpl::SockAddrBuffer> nameBuffers = NazaraStackArray(IpAddressImpl::SockAddrBuffer, datagramCount);
+
+		iovec* sysBuffer = sysBuffers.data();
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			const NetDatagram& datagram = datagrams[i];
+			for (std::size_t j = 0; j < datagram.bufferCount; ++j)
+			{
+				sysBuffer[j].iov_base = datagram.buffers[j].data;
+				sysBuffer[j].iov_len = datagram.buffers[j].dataLength;
+			}
+
+			nameBuffers[i].fill(0);
+
+			mmsghdr& message = messages[i];
+			std::memset(&message, 0, sizeof(message));
+			message.msg_hdr.msg_iov = sysBuffer;
+			message.msg_hdr.msg_iovlen = datagram.bufferCount;
+			message.msg_hdr.msg_name = nameBuffers[i].data();
+			message.msg_hdr.msg_namelen = static_cast<socklen_t>(nameBuffers[i].size());
+
+			sysBuffer += datagram.bufferCount;
+		}
+
+		// MSG_WAITFORONE makes blocking sockets return as soon as one datagram has been received
+		int messageCount = recvmmsg(handle, messages.data(), static_cast<unsigned int>(datagramCount), MSG_WAITFORONE, nullptr);
+		if (messageCount == -1)
+		{
+			int errorCode = errno;
+			if (errorCode == EAGAIN)
+				errorCode = EWOULDBLOCK;
+
+			switch (errorCode)
+			{
+				case EWOULDBLOCK:
+					messageCount = 0;
+					break;
+
+				default:
+				{
+					if (error)
+						*error = TranslateErrorToSocketError(errorCode);
+
+					return false; //< Error
+				}
+			}
+		}
+
+		for (int i = 0; i < messageCount; ++i)
+		{
+			NetDatagram& datagram = datagrams[i];
+			const mmsghdr& message = messages[i];
+
+			if (message.msg_hdr.msg_flags & MSG_TRUNC)
+			{
+				// Truncated datagram, it has been consumed so report it without data
+				datagram.address = IpAddress::Invalid;
+				datagram.dataLength = 0;
+				continue;
+			}
+
+			datagram.address = IpAddressImpl::FromSockAddr(reinterpret_cast<const sockaddr*>(nameBuffers[i].data()));
+			datagram.dataLength = message.msg_len;
+		}
+
+		if (received)
+			*received = static_cast<std::size_t>(messageCount);
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+#else
+		// Pull datagrams one by one until the socket would block
+		std::size_t datagramIndex = 0;
+		for (; datagramIndex < datagramCount; ++datagramIndex)
+		{
+			NetDatagram& datagram = datagrams[datagramIndex];
+
+			int byteRead;
+			SocketError receiveError;
+			if (!ReceiveMultiple(handle, datagram.buffers, datagram.bufferCount, &datagram.address, &byteRead, &receiveError))
+			{
+				if (receiveError == SocketError::ConnectionClosed || receiveError == SocketError::DatagramSize)
+				{
+					// Empty or truncated datagram, it has been consumed so report it without data
+					datagram.address = IpAddress::Invalid;
+					datagram.dataLength = 0;
+					continue;
+				}
+
+				// Report datagrams we already received first
+				if (datagramIndex > 0)
+					break;
+
+				if (error)
+					*error = receiveError;
+
+				return false;
+			}
+
+			if (byteRead == 0)
+				break; //< Would block
+
+			datagram.dataLength = static_cast<std::size_t>(byteRead);
+		}
+
+		if (received)
+			*received = datagramIndex;
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+#endif
+	}
+
 	bool SocketImpl::ReceiveFrom(SocketHandle handle, void* buffer, int length, IpAddress* from, int* read, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -683,6 +814,105 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SendDatagrams(SocketHandle handle, const NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+#if defined(NAZARA_PLATFORM_LINUX)
+		std::size_t totalBufferCount = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			totalBufferCount += datagrams[i].bufferCount;
+
+		StackArray<iovec> sysBuffers = NazaraStackArray(iovec, totalBufferCount);
+		StackArray<mmsghdr> messages = NazaraStackArray(mmsghdr, datagramCount);
+		StackArray<IpAddressImpl::SockAddrBuffer> nameBuffers = NazaraStackArray(IpAddressImpl::SockAddrBuffer, datagramCount);
+
+		iovec* sysBuffer = sysBuffers.data();
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			const NetDatagram& datagram = datagrams[i];
+			for (std::size_t j = 0; j < datagram.bufferCount; ++j)
+			{
+				sysBuffer[j].iov_base = datagram.buffers[j].data;
+				sysBuffer[j].iov_len = datagram.buffers[j].dataLength;
+			}
+
+			mmsghdr& message = messages[i];
+			std::memset(&message, 0, sizeof(message));
+			message.msg_hdr.msg_iov = sysBuffer;
+			message.msg_hdr.msg_iovlen = datagram.bufferCount;
+			message.msg_hdr.msg_name = nameBuffers[i].data();
+			message.msg_hdr.msg_namelen = IpAddressImpl::ToSockAddr(datagram.address, nameBuffers[i].data());
+
+			sysBuffer += datagram.bufferCount;
+		}
+
+		int messageCount = sendmmsg(handle, messages.data(), static_cast<unsigned int>(datagramCount), MSG_NOSIGNAL);
+		if (messageCount == -1)
+		{
+			int errorCode = errno;
+			if (errorCode == EAGAIN)
+				errorCode = EWOULDBLOCK;
+
+			switch (errorCode)
+			{
+				case EWOULDBLOCK:
+					messageCount = 0;
+					break;
+
+				default:
+				{
+					if (error)
+						*error = TranslateErrorToSocketError(errorCode);
+
+					return false; //< Error
+				}
+			}
+		}
+
+		if (sent)
+			*sent = static_cast<std::size_t>(messageCount);
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+#else
+		// Send datagrams one by one until the socket would block
+		std::size_t datagramIndex = 0;
+		for (; datagramIndex < datagramCount; ++datagramIndex)
+		{
+			const NetDatagram& datagram = datagrams[datagramIndex];
+
+			int byteSent;
+			SocketError sendError;
+			if (!SendMultiple(handle, datagram.buffers, datagram.bufferCount, datagram.address, &byteSent, &sendError))
+			{
+				// Report datagrams we already sent first
+				if (datagramIndex > 0)
+					break;
+
+				if (error)
+					*error = sendError;
+
+				return false;
+			}
+
+			if (byteSent == 0)
+				break; //< Would block
+		}
+
+		if (sent)
+			*sent = datagramIndex;
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+#endif
+	}
+
 	bool SocketImpl::SendMultiple(SocketHandle handle, const NetBuffer* buffers, std::size_t bufferCount, const IpAddress& to, int* sent, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -926,6 +1156,34 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool reusePort, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+
+#ifdef SO_REUSEPORT
+		int option = reusePort;
+		if (setsockopt(handle, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<const char*>(&option), sizeof(option)) == -1)
+		{
+			if (error)
+				*error = TranslateErrorToSocketError(errno);
+
+			return false; //< Error
+		}
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+#else
+		NazaraUnused(reusePort);
+
+		if (error)
+			*error = SocketError::NotSupported;
+
+		return false;
+#endif
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
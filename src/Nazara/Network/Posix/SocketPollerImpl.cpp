@@ -4,6 +4,7 @@
 
 #include <Nazara/Network/Posix/SocketPollerImpl.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <algorithm>
 #include <poll.h>
 #include <Nazara/Network/Debug.hpp>
 
@@ -11,31 +12,37 @@ namespace Nz
 {
 	void SocketPollerImpl::Clear()
 	{
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
-		m_allSockets.clear();
+		ResetReadySockets();
+		m_registeredSockets.Reset();
 		m_sockets.clear();
 	}
 
+	const std::vector<SocketPoller::ReadySocket>& SocketPollerImpl::GetReadySockets() const
+	{
+		return m_readySockets;
+	}
+
 	bool SocketPollerImpl::IsReadyToRead(SocketHandle socket) const
 	{
-		return m_readyToReadSockets.count(socket) != 0;
+		return m_readyToReadSockets.UnboundedTest(static_cast<std::size_t>(socket));
 	}
 
 	bool SocketPollerImpl::IsReadyToWrite(SocketHandle socket) const
 	{
-		return m_readyToWriteSockets.count(socket) != 0;
+		return m_readyToWriteSockets.UnboundedTest(static_cast<std::size_t>(socket));
 	}
 
 	bool SocketPollerImpl::IsRegistered(SocketHandle socket) const
 	{
-		return m_allSockets.count(socket) != 0;
+		return m_registeredSockets.UnboundedTest(static_cast<std::size_t>(socket));
 	}
 
-	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode /*mode*/)
 	{
 		NazaraAssert(!IsRegistered(socket), "Socket is already registered");
 
+		// poll has no edge-triggered mode, level-triggered notifications are a superset of edge-triggered ones
+
 		PollSocket entry = {
 			socket,
 			0,
@@ -48,9 +55,27 @@ namespace Nz
 		if (eventFlags & SocketPollEvent::Write)
 			entry.events |= POLLWRNORM;
 
-		m_allSockets[socket] = m_sockets.size();
+		// Grow everything here so that Wait never allocates
+		std::size_t index = static_cast<std::size_t>(socket);
+		if (index >= m_registrations.size())
+		{
+			std::size_t newSize = std::max(index + 1, m_registrations.size() * 2);
+			m_registrations.resize(newSize);
+			m_readyToReadSockets.Resize(newSize);
+			m_readyToWriteSockets.Resize(newSize);
+			m_registeredSockets.Resize(newSize);
+		}
+
+		Registration& registration = m_registrations[index];
+		registration.pollIndex = m_sockets.size();
+		registration.userdata = userdata;
+
+		m_registeredSockets.Set(index);
 		m_sockets.emplace_back(entry);
 
+		if (m_readySockets.capacity() < m_sockets.size())
+			m_readySockets.reserve(std::max(m_sockets.size(), m_readySockets.capacity() * 2));
+
 		return true;
 	}
 
@@ -58,34 +83,43 @@ namespace Nz
 	{
 		NazaraAssert(IsRegistered(socket), "Socket is not registered");
 
+		std::size_t index = static_cast<std::size_t>(socket);
+		Registration& registration = m_registrations[index];
+
 		if (m_sockets.size() > 1U)
 		{
 			// Instead of using vector::erase, let's move the last element to the now unoccupied position
-			std::size_t entry = m_allSockets[socket];
+			std::size_t entry = registration.pollIndex;
 
 			// Get the last element and update it's position
 			const PollSocket& lastElement = m_sockets.back();
-			m_allSockets[lastElement.fd] = entry;
+			m_registrations[static_cast<std::size_t>(lastElement.fd)].pollIndex = entry;
 
 			// Now move it properly (lastElement is invalid after the following line) and pop it
 			m_sockets[entry] = std::move(m_sockets.back());
 		}
 		m_sockets.pop_back();
 
-		m_allSockets.erase(socket);
-		m_readyToReadSockets.erase(socket);
-		m_readyToWriteSockets.erase(socket);
+		// The ready list may be iterated while unregistering, keep the entry but remove its events
+		if (m_readyToReadSockets.Test(index) || m_readyToWriteSockets.Test(index))
+		{
+			SocketPoller::ReadySocket& readySocket = m_readySockets[registration.readyIndex];
+			readySocket.events = SocketPollEventFlags{};
+			readySocket.userdata = nullptr;
+		}
+
+		registration.userdata = nullptr;
+		m_readyToReadSockets.Reset(index);
+		m_readyToWriteSockets.Reset(index);
+		m_registeredSockets.Reset(index);
 	}
 
 	unsigned int SocketPollerImpl::Wait(int msTimeout, SocketError* error)
 	{
-		unsigned int activeSockets;
+		// Only reset the sockets which were ready, instead of clearing everything
+		ResetReadySockets();
 
-		// Reset status of sockets
-		activeSockets = SocketImpl::Poll(m_sockets.data(), m_sockets.size(), static_cast<int>(msTimeout), error);
-
-		m_readyToReadSockets.clear();
-		m_readyToWriteSockets.clear();
+		unsigned int activeSockets = SocketImpl::Poll(m_sockets.data(), m_sockets.size(), static_cast<int>(msTimeout), error);
 		if (activeSockets > 0U)
 		{
 			unsigned int socketRemaining = activeSockets;
@@ -94,19 +128,32 @@ namespace Nz
 				if (!entry.revents)
 					continue;
 
-				if (entry.revents & (POLLRDNORM | POLLWRNORM | POLLHUP | POLLERR))
+				SocketPollEventFlags readyEvents;
+				if (entry.revents & (POLLRDNORM | POLLHUP | POLLERR))
+					readyEvents |= SocketPollEvent::Read;
+
+				if (entry.revents & (POLLWRNORM | POLLERR))
+					readyEvents |= SocketPollEvent::Write;
+
+				if (readyEvents)
 				{
-					if (entry.revents & (POLLRDNORM | POLLHUP | POLLERR))
-						m_readyToReadSockets.insert(entry.fd);
+					std::size_t index = static_cast<std::size_t>(entry.fd);
+					if (readyEvents & SocketPollEvent::Read)
+						m_readyToReadSockets.Set(index);
+
+					if (readyEvents & SocketPollEvent::Write)
+						m_readyToWriteSockets.Set(index);
 
-					if (entry.revents & (POLLWRNORM | POLLERR))
-						m_readyToWriteSockets.insert(entry.fd);
+					Registration& registration = m_registrations[index];
+					registration.readyIndex = m_readySockets.size();
+
+					SocketPoller::ReadySocket& readySocket = m_readySockets.emplace_back();
+					readySocket.handle = entry.fd;
+					readySocket.events = readyEvents;
+					readySocket.userdata = registration.userdata;
 				}
 				else
-				{
 					NazaraWarning("Socket " + NumberToString(entry.fd) + " was returned by poll without POLLRDNORM nor POLLWRNORM events (events: 0x" + NumberToString(entry.revents, 16) + ')');
-					activeSockets--;
-				}
 
 				entry.revents = 0;
 
@@ -115,6 +162,18 @@ namespace Nz
 			}
 		}
 
-		return activeSockets;
+		return static_cast<unsigned int>(m_readySockets.size());
+	}
+
+	void SocketPollerImpl::ResetReadySockets()
+	{
+		for (const SocketPoller::ReadySocket& readySocket : m_readySockets)
+		{
+			std::size_t index = static_cast<std::size_t>(readySocket.handle);
+			m_readyToReadSockets.Reset(index);
+			m_readyToWriteSockets.Reset(index);
+		}
+
+		m_readySockets.clear();
 	}
 }
@@ -8,9 +8,9 @@
 #define NAZARA_NETWORK_POSIX_SOCKETPOLLERIMPL_HPP
 
 #include <Nazara/Network/SocketHandle.hpp>
+#include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/Posix/SocketImpl.hpp>
-#include <unordered_map>
-#include <unordered_set>
+#include <Nazara/Utils/Bitset.hpp>
 #include <vector>
 
 namespace Nz
@@ -23,20 +23,34 @@ namespace Nz
 
 			void Clear();
 
+			const std::vector<SocketPoller::ReadySocket>& GetReadySockets() const;
+
 			bool IsReadyToRead(SocketHandle socket) const;
 			bool IsReadyToWrite(SocketHandle socket) const;
 			bool IsRegistered(SocketHandle socket) const;
 
-			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags);
+			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode mode);
 			void UnregisterSocket(SocketHandle socket);
 
 			unsigned int Wait(int msTimeout, SocketError* error);
 
 		private:
-			std::unordered_set<SocketHandle> m_readyToReadSockets;
-			std::unordered_set<SocketHandle> m_readyToWriteSockets;
-			std::unordered_map<SocketHandle, std::size_t> m_allSockets;
+			void ResetReadySockets();
+
+			// Descriptors are small integers, registrations and ready states are indexed by them
+			struct Registration
+			{
+				void* userdata = nullptr;
+				std::size_t pollIndex;
+				std::size_t readyIndex;
+			};
+
 			std::vector<PollSocket> m_sockets;
+			std::vector<Registration> m_registrations;
+			std::vector<SocketPoller::ReadySocket> m_readySockets;
+			Bitset<UInt64> m_readyToReadSockets;
+			Bitset<UInt64> m_readyToWriteSockets;
+			Bitset<UInt64> m_registeredSockets;
 	};
 }
 
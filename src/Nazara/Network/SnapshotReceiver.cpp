@@ -0,0 +1,260 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/SnapshotReceiver.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <cstring>
+#include <string>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::SnapshotReceiver
+	* \brief Network class applying the snapshots encoded by a SnapshotReplicator to a registry
+	*
+	* Replicated entities are created in the registry when they first appear in a snapshot and destroyed when the server destroys them.
+	* A history of the received states is kept for every entity, as the server encodes them against the last state it knows the client received.
+	*
+	* Snapshots are meant to be sent unreliably, states older than the last applied one are not applied (but are still kept as they may be used as a reference).
+	*
+	* \see SnapshotReplicator, SnapshotSchema
+	*/
+
+	/*!
+	* \brief Constructs a receiver creating replicated entities in a registry
+	*
+	* \param registry Registry to create the replicated entities in
+	* \param schema Schema of the replicated components, which must match the one of the server
+	*/
+	SnapshotReceiver::SnapshotReceiver(entt::registry& registry, SnapshotSchema schema) :
+	m_entityCount(0),
+	m_registry(registry),
+	m_schema(std::move(schema)),
+	m_lastSnapshotId(0),
+	m_hasReceivedSnapshot(false)
+	{
+	}
+
+	/*!
+	* \brief Destroys every replicated entity and forgets received states
+	*
+	* \remark As the server is not aware of this, the peer should be removed from the replicator and added back
+	*/
+	void SnapshotReceiver::Clear()
+	{
+		for (auto& [entityId, replicatedEntity] : m_entities)
+		{
+			if (replicatedEntity->entity != entt::null && m_registry.valid(replicatedEntity->entity))
+				m_registry.destroy(replicatedEntity->entity);
+		}
+
+		m_entities.clear();
+		m_removedEntities.clear();
+		m_entityCount = 0;
+		m_hasReceivedSnapshot = false;
+	}
+
+	/*!
+	* \brief Decodes a snapshot and applies it to the registry
+	* \return true if the snapshot was successfully decoded
+	*
+	* \param stream Stream to read the snapshot from (such as a received NetPacket)
+	* \param snapshotId Optional pointer receiving the snapshot id, which should be sent back to the server to acknowledge it
+	*
+	* \remark Produces a NazaraError if the snapshot refers to a state which is not known, in which case the snapshot should not be acknowledged
+	*/
+	bool SnapshotReceiver::Decode(ByteStream& stream, UInt16* snapshotId)
+	{
+		std::size_t componentCount = m_schema.GetComponentCount();
+
+		UInt16 currentSnapshotId = UInt16(stream.ReadBits(16));
+
+		for (;;)
+		{
+			bool hasRecord = false;
+			stream >> hasRecord;
+			if (!hasRecord)
+				break;
+
+			UInt32 entityId = UInt32(stream.ReadBits(32));
+
+			bool isRemoval = false;
+			stream >> isRemoval;
+
+			auto it = m_entities.find(entityId);
+			if (it == m_entities.end())
+				it = m_entities.emplace(entityId, std::make_unique<ReplicatedEntity>()).first;
+
+			ReplicatedEntity& replicatedEntity = *it->second;
+
+			if (isRemoval)
+			{
+				if (replicatedEntity.isRemoved)
+					continue;
+
+				if (replicatedEntity.entity != entt::null)
+				{
+					if (m_registry.valid(replicatedEntity.entity))
+						m_registry.destroy(replicatedEntity.entity);
+
+					replicatedEntity.entity = entt::null;
+					m_entityCount--;
+				}
+
+				// Keep the entity around for a while so an older snapshot can't bring it back
+				replicatedEntity.isRemoved = true;
+				replicatedEntity.lastSnapshotId = currentSnapshotId;
+				m_removedEntities.push_back({ entityId, currentSnapshotId });
+				continue;
+			}
+
+			bool hasBaseline = false;
+			stream >> hasBaseline;
+
+			const EntityState* baseline = nullptr;
+			if (hasBaseline)
+			{
+				UInt16 baselineSnapshotId = UInt16(currentSnapshotId - stream.ReadBits(SnapshotSchema::HistorySizeBitCount));
+
+				const EntityState& baselineState = replicatedEntity.history[baselineSnapshotId % SnapshotSchema::HistorySize];
+				if (!baselineState.isValid || baselineState.snapshotId != baselineSnapshotId)
+				{
+					NazaraError("Snapshot #" + std::to_string(currentSnapshotId) + " refers to an unknown state (entity #" + std::to_string(entityId) + ", snapshot #" + std::to_string(baselineSnapshotId) + ")");
+					return false;
+				}
+
+				baseline = &baselineState;
+			}
+
+			m_decodedState.componentMask = UInt32(stream.ReadBits(UInt8(componentCount)));
+			m_decodedState.data.clear();
+
+			std::size_t baselineOffset = 0;
+			for (std::size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+			{
+				UInt32 componentBit = 1U << componentIndex;
+				UInt32 componentBitCount = m_schema.GetComponent(componentIndex).bitCount;
+				std::size_t componentSize = SnapshotSchema::GetEncodedSize(componentBitCount);
+
+				bool inBaseline = baseline && (baseline->componentMask & componentBit);
+				if (m_decodedState.componentMask & componentBit)
+				{
+					bool changed = true;
+					if (inBaseline)
+						stream >> changed;
+
+					std::size_t offset = m_decodedState.data.size();
+					m_decodedState.data.resize(offset + componentSize);
+
+					if (changed)
+						SnapshotSchema::ReadEncodedComponent(stream, &m_decodedState.data[offset], componentBitCount);
+					else
+						std::memcpy(&m_decodedState.data[offset], &baseline->data[baselineOffset], componentSize);
+				}
+
+				if (inBaseline)
+					baselineOffset += componentSize;
+			}
+
+			// Store the state in the history (swapping buffers so their memory gets reused)
+			EntityState& state = replicatedEntity.history[currentSnapshotId % SnapshotSchema::HistorySize];
+			std::swap(state.data, m_decodedState.data);
+			state.componentMask = m_decodedState.componentMask;
+			state.snapshotId = currentSnapshotId;
+			state.isValid = true;
+
+			if (replicatedEntity.isRemoved)
+				continue;
+
+			if (!replicatedEntity.hasAppliedState || SnapshotSchema::IsMoreRecent(currentSnapshotId, replicatedEntity.lastSnapshotId))
+			{
+				ApplyState(replicatedEntity, state);
+
+				replicatedEntity.hasAppliedState = true;
+				replicatedEntity.lastSnapshotId = currentSnapshotId;
+			}
+		}
+
+		if (!m_hasReceivedSnapshot || SnapshotSchema::IsMoreRecent(currentSnapshotId, m_lastSnapshotId))
+		{
+			m_hasReceivedSnapshot = true;
+			m_lastSnapshotId = currentSnapshotId;
+
+			PruneRemovedEntities();
+		}
+
+		if (snapshotId)
+			*snapshotId = currentSnapshotId;
+
+		return true;
+	}
+
+	/*!
+	* \brief Gets the local entity corresponding to a replicated entity
+	* \return Local entity or entt::null if the entity is unknown or has been destroyed
+	*
+	* \param remoteEntityId Id of the entity on the server (as given by entt::to_integral)
+	*/
+	entt::entity SnapshotReceiver::GetEntity(UInt32 remoteEntityId) const
+	{
+		auto it = m_entities.find(remoteEntityId);
+		if (it == m_entities.end())
+			return entt::null;
+
+		return it->second->entity;
+	}
+
+	void SnapshotReceiver::ApplyState(ReplicatedEntity& replicatedEntity, const EntityState& state)
+	{
+		if (replicatedEntity.entity == entt::null || !m_registry.valid(replicatedEntity.entity))
+		{
+			if (replicatedEntity.entity == entt::null)
+				m_entityCount++;
+
+			replicatedEntity.entity = m_registry.create();
+			replicatedEntity.appliedComponentMask = 0;
+		}
+
+		ByteStream stream;
+		if (!state.data.empty())
+			stream.SetStream(state.data.data(), state.data.size());
+
+		std::size_t componentCount = m_schema.GetComponentCount();
+		for (std::size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+		{
+			UInt32 componentBit = 1U << componentIndex;
+			const auto& component = m_schema.GetComponent(componentIndex);
+
+			if (state.componentMask & componentBit)
+			{
+				component.decode(m_registry, replicatedEntity.entity, stream);
+
+				// Skip padding bits, components are byte-aligned
+				std::size_t paddingBitCount = SnapshotSchema::GetEncodedSize(component.bitCount) * 8 - component.bitCount;
+				if (paddingBitCount > 0)
+					stream.ReadBits(UInt8(paddingBitCount));
+			}
+			else if (replicatedEntity.appliedComponentMask & componentBit)
+				component.remove(m_registry, replicatedEntity.entity);
+		}
+
+		replicatedEntity.appliedComponentMask = state.componentMask;
+	}
+
+	void SnapshotReceiver::PruneRemovedEntities()
+	{
+		auto it = m_removedEntities.begin();
+		for (; it != m_removedEntities.end(); ++it)
+		{
+			if (UInt16(m_lastSnapshotId - it->snapshotId) < RemovedEntityLifetime)
+				break;
+
+			m_entities.erase(it->entityId);
+		}
+
+		m_removedEntities.erase(m_removedEntities.begin(), it);
+	}
+}
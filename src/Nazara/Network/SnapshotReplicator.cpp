@@ -0,0 +1,441 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/SnapshotReplicator.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/Components/ReplicationComponent.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::SnapshotReplicator
+	* \brief Network class replicating the components of entities (having a ReplicationComponent) to peers using delta-compressed snapshots
+	*
+	* Every tick, the server captures the state of the replicated entities (CaptureSnapshot) and encodes a snapshot for each peer (EncodeSnapshot), which is sent as an unreliable packet.
+	* When a peer receives a snapshot, it sends back its id which has to be given to Acknowledge.
+	*
+	* Each entity is delta-encoded against its last state acknowledged by the peer, unchanged components only take one bit and unchanged entities are not sent at all.
+	* When all changed entities don't fit the bandwidth budget of a peer, the ones with the highest accumulated priority (see ReplicationComponent) are sent first, the others accumulate priority for the next snapshot.
+	*
+	* The transport is left to the caller, which makes it usable with an ENetHost (NetPacket is a ByteStream) as well as any other stream.
+	*
+	* \see SnapshotReceiver, SnapshotSchema
+	*/
+
+	/*!
+	* \brief Constructs a replicator for the entities of a registry
+	*
+	* \param registry Registry containing the entities to replicate
+	* \param schema Schema of the replicated components
+	*/
+	SnapshotReplicator::SnapshotReplicator(entt::registry& registry, SnapshotSchema schema) :
+	m_registry(registry),
+	m_schema(std::move(schema)),
+	m_snapshotId(0)
+	{
+	}
+
+	/*!
+	* \brief Handles the acknowledgment of a snapshot by a peer
+	*
+	* Entities sent in this snapshot will be delta-encoded against the acknowledged state from now on.
+	*
+	* \param peerIndex Index of the peer
+	* \param snapshotId Id of the snapshot received by the peer (as returned by SnapshotReceiver::Decode)
+	*
+	* \remark Acknowledgments of unknown or too old snapshots are ignored
+	*/
+	void SnapshotReplicator::Acknowledge(std::size_t peerIndex, UInt16 snapshotId)
+	{
+		NazaraAssert(peerIndex < m_peers.size() && m_peers[peerIndex], "Invalid peer index");
+		Peer& peer = *m_peers[peerIndex];
+
+		SentSnapshot& sentSnapshot = peer.sentSnapshots[snapshotId % SnapshotSchema::HistorySize];
+		if (!sentSnapshot.isValid || sentSnapshot.snapshotId != snapshotId)
+			return;
+
+		for (SentEntity& sentEntity : sentSnapshot.entities)
+		{
+			auto it = peer.entities.find(sentEntity.entityId);
+			if (it == peer.entities.end())
+				continue;
+
+			// Peer destroyed the entity, we no longer have to track it
+			if (!sentEntity.state)
+			{
+				peer.entities.erase(it);
+				continue;
+			}
+
+			PeerEntity& peerEntity = it->second;
+			if (!peerEntity.ackedState || SnapshotSchema::IsMoreRecent(snapshotId, peerEntity.ackedSnapshotId))
+			{
+				peerEntity.ackedState = std::move(sentEntity.state);
+				peerEntity.ackedSnapshotId = snapshotId;
+			}
+		}
+
+		sentSnapshot.entities.clear();
+		sentSnapshot.isValid = false;
+	}
+
+	/*!
+	* \brief Registers a peer to replicate entities to
+	* \return Index of the peer
+	*
+	* \param bandwidthBudget Maximum size of a snapshot for this peer, in bytes
+	*/
+	std::size_t SnapshotReplicator::AddPeer(std::size_t bandwidthBudget)
+	{
+		auto it = std::find(m_peers.begin(), m_peers.end(), nullptr);
+		if (it == m_peers.end())
+			it = m_peers.insert(it, nullptr);
+
+		*it = std::make_unique<Peer>();
+		(*it)->bandwidthBudget = bandwidthBudget;
+
+		return std::distance(m_peers.begin(), it);
+	}
+
+	/*!
+	* \brief Captures the current state of the replicated entities and starts a new snapshot
+	*
+	* This encodes the components of every entity having a ReplicationComponent, it has to be called once per tick before encoding the snapshots of the peers.
+	*/
+	void SnapshotReplicator::CaptureSnapshot()
+	{
+		Time startTime = GetElapsedNanoseconds();
+
+		m_snapshotId++;
+
+		// Encode every entity in the same buffer, byte-aligning each component so they can be compared and copied individually
+		m_captureBuffer.Clear(true);
+		m_captureEntries.clear();
+		{
+			ByteStream stream(&m_captureBuffer, OpenMode::WriteOnly);
+
+			std::size_t componentCount = m_schema.GetComponentCount();
+			auto view = m_registry.view<const ReplicationComponent>();
+			for (entt::entity entity : view)
+			{
+				CaptureEntry& entry = m_captureEntries.emplace_back();
+				entry.componentMask = 0;
+				entry.entityId = UInt32(entt::to_integral(entity));
+				entry.offset = UInt32(m_captureBuffer.GetSize());
+				entry.priority = view.get<const ReplicationComponent>(entity).GetPriority();
+
+				for (std::size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+				{
+					const auto& component = m_schema.GetComponent(componentIndex);
+
+					std::size_t offset = m_captureBuffer.GetSize();
+					if (!component.encode(m_registry, entity, stream))
+						continue;
+
+					stream.FlushBits();
+					NazaraAssert(m_captureBuffer.GetSize() - offset == SnapshotSchema::GetEncodedSize(component.bitCount), "Component encoder didn't write the expected number of bits");
+
+					entry.componentMask |= 1U << componentIndex;
+				}
+			}
+		}
+
+		// Share states which didn't change since the last capture, peers compare them by pointer first
+		for (const CaptureEntry& entry : m_captureEntries)
+		{
+			std::size_t endOffset = (&entry != &m_captureEntries.back()) ? (&entry + 1)->offset : m_captureBuffer.GetSize();
+			const UInt8* data = m_captureBuffer.GetConstBuffer() + entry.offset;
+			std::size_t size = endOffset - entry.offset;
+
+			CapturedEntity& capturedEntity = m_capturedEntities[entry.entityId];
+			capturedEntity.priority = entry.priority;
+			capturedEntity.snapshotId = m_snapshotId;
+
+			const EntityState* previousState = capturedEntity.state.get();
+			if (previousState && previousState->componentMask == entry.componentMask && previousState->data.size() == size && (size == 0 || std::memcmp(previousState->data.data(), data, size) == 0))
+				continue;
+
+			auto state = std::make_shared<EntityState>();
+			state->componentMask = entry.componentMask;
+			state->data.assign(data, data + size);
+
+			capturedEntity.state = std::move(state);
+		}
+
+		for (auto it = m_capturedEntities.begin(); it != m_capturedEntities.end();)
+		{
+			if (it->second.snapshotId != m_snapshotId)
+				it = m_capturedEntities.erase(it);
+			else
+				++it;
+		}
+
+		m_statistics.capturedEntityCount += m_captureEntries.size();
+		m_statistics.captureTime += GetElapsedNanoseconds() - startTime;
+	}
+
+	/*!
+	* \brief Encodes the last captured snapshot for a peer
+	* \return Size of the encoded snapshot, in bytes
+	*
+	* The snapshot contains entities which changed since their last acknowledged state (or which were destroyed), by order of priority, within the bandwidth budget of the peer.
+	*
+	* \param peerIndex Index of the peer
+	* \param stream Stream to write the snapshot to (such as a NetPacket)
+	*
+	* \remark A snapshot can only be encoded once per peer, as the acknowledgment of the peer couldn't tell which of them was received
+	*/
+	std::size_t SnapshotReplicator::EncodeSnapshot(std::size_t peerIndex, ByteStream& stream)
+	{
+		NazaraAssert(peerIndex < m_peers.size() && m_peers[peerIndex], "Invalid peer index");
+		Peer& peer = *m_peers[peerIndex];
+
+		SentSnapshot& sentSnapshot = peer.sentSnapshots[m_snapshotId % SnapshotSchema::HistorySize];
+		if (sentSnapshot.isValid && sentSnapshot.snapshotId == m_snapshotId)
+		{
+			NazaraError("Snapshot #" + std::to_string(m_snapshotId) + " has already been encoded for this peer");
+			return 0;
+		}
+
+		Time startTime = GetElapsedNanoseconds();
+
+		constexpr UInt32 RemovalRecordSize = 1 + 32 + 1; //< continuation bit, entity id, removal bit
+
+		m_candidates.clear();
+
+		// Destroyed entities
+		for (auto it = peer.entities.begin(); it != peer.entities.end();)
+		{
+			PeerEntity& peerEntity = it->second;
+			if (m_capturedEntities.find(it->first) != m_capturedEntities.end())
+			{
+				++it;
+				continue;
+			}
+
+			// The peer never received this entity
+			if (!peerEntity.ackedState && !peerEntity.sentState)
+			{
+				it = peer.entities.erase(it);
+				continue;
+			}
+
+			Candidate& candidate = m_candidates.emplace_back();
+			candidate.baseline = nullptr;
+			candidate.baselineSnapshotId = 0;
+			candidate.bitCount = RemovalRecordSize;
+			candidate.entityId = it->first;
+			candidate.peerEntity = &peerEntity;
+			candidate.priority = std::numeric_limits<float>::infinity();
+
+			++it;
+		}
+
+		// Changed entities
+		for (auto& [entityId, capturedEntity] : m_capturedEntities)
+		{
+			PeerEntity& peerEntity = peer.entities[entityId];
+
+			const EntityState& state = *capturedEntity.state;
+			auto IsSame = [&](const std::shared_ptr<const EntityState>& otherState)
+			{
+				return otherState && (otherState == capturedEntity.state || IsSameState(*otherState, state));
+			};
+
+			// The peer has this state and nothing else is on the way
+			if (IsSame(peerEntity.ackedState) && IsSame(peerEntity.sentState))
+			{
+				peerEntity.priority = 0.f;
+				continue;
+			}
+
+			peerEntity.priority += capturedEntity.priority;
+
+			Candidate& candidate = m_candidates.emplace_back();
+			candidate.state = capturedEntity.state;
+			candidate.entityId = entityId;
+			candidate.peerEntity = &peerEntity;
+			candidate.priority = peerEntity.priority;
+
+			// The peer keeps a limited history of states
+			if (peerEntity.ackedState && UInt16(m_snapshotId - peerEntity.ackedSnapshotId) < SnapshotSchema::HistorySize)
+			{
+				candidate.baseline = peerEntity.ackedState.get();
+				candidate.baselineSnapshotId = peerEntity.ackedSnapshotId;
+			}
+			else
+			{
+				candidate.baseline = nullptr;
+				candidate.baselineSnapshotId = 0;
+			}
+
+			candidate.bitCount = ComputeRecordSize(state, candidate.baseline);
+		}
+
+		std::sort(m_candidates.begin(), m_candidates.end(), [](const Candidate& lhs, const Candidate& rhs)
+		{
+			return lhs.priority > rhs.priority;
+		});
+
+		sentSnapshot.entities.clear();
+		sentSnapshot.snapshotId = m_snapshotId;
+		sentSnapshot.isValid = true;
+
+		stream.WriteBits(m_snapshotId, 16);
+
+		UInt64 budgetBitCount = UInt64(peer.bandwidthBudget) * 8;
+		UInt64 usedBitCount = 16 + 1; //< snapshot id and end bit
+		for (Candidate& candidate : m_candidates)
+		{
+			if (usedBitCount + candidate.bitCount > budgetBitCount)
+			{
+				m_statistics.deferredEntityCount++;
+				continue;
+			}
+
+			usedBitCount += candidate.bitCount;
+
+			SentEntity& sentEntity = sentSnapshot.entities.emplace_back();
+			sentEntity.entityId = candidate.entityId;
+
+			if (candidate.state)
+			{
+				WriteRecord(stream, candidate.entityId, *candidate.state, candidate.baseline, candidate.baselineSnapshotId);
+
+				candidate.peerEntity->priority = 0.f;
+				candidate.peerEntity->sentState = candidate.state;
+				sentEntity.state = std::move(candidate.state);
+
+				m_statistics.sentEntityCount++;
+			}
+			else
+			{
+				stream << true; //< record
+				stream.WriteBits(candidate.entityId, 32);
+				stream << true; //< removal
+
+				m_statistics.removedEntityCount++;
+			}
+		}
+
+		stream << false; //< end of records
+		stream.FlushBits();
+
+		std::size_t snapshotSize = std::size_t((usedBitCount + 7) / 8);
+
+		m_statistics.encodedByteCount += snapshotSize;
+		m_statistics.encodedSnapshotCount++;
+		m_statistics.encodeTime += GetElapsedNanoseconds() - startTime;
+
+		return snapshotSize;
+	}
+
+	/*!
+	* \brief Unregisters a peer
+	*
+	* \param peerIndex Index of the peer, which may be reused by the next call to AddPeer
+	*/
+	void SnapshotReplicator::RemovePeer(std::size_t peerIndex)
+	{
+		NazaraAssert(peerIndex < m_peers.size() && m_peers[peerIndex], "Invalid peer index");
+		m_peers[peerIndex].reset();
+	}
+
+	UInt32 SnapshotReplicator::ComputeRecordSize(const EntityState& state, const EntityState* baseline) const
+	{
+		std::size_t componentCount = m_schema.GetComponentCount();
+
+		UInt32 bitCount = 1 + 32 + 1 + 1 + UInt32(componentCount); //< continuation bit, entity id, removal bit, baseline bit, component mask
+		if (baseline)
+			bitCount += SnapshotSchema::HistorySizeBitCount;
+
+		std::size_t offset = 0;
+		std::size_t baselineOffset = 0;
+		for (std::size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+		{
+			UInt32 componentBit = 1U << componentIndex;
+			UInt32 componentBitCount = m_schema.GetComponent(componentIndex).bitCount;
+			std::size_t componentSize = SnapshotSchema::GetEncodedSize(componentBitCount);
+
+			bool inBaseline = baseline && (baseline->componentMask & componentBit);
+			if (state.componentMask & componentBit)
+			{
+				if (inBaseline)
+				{
+					bitCount += 1; //< changed bit
+					if (std::memcmp(&state.data[offset], &baseline->data[baselineOffset], componentSize) != 0)
+						bitCount += componentBitCount;
+				}
+				else
+					bitCount += componentBitCount;
+
+				offset += componentSize;
+			}
+
+			if (inBaseline)
+				baselineOffset += componentSize;
+		}
+
+		return bitCount;
+	}
+
+	bool SnapshotReplicator::IsSameState(const EntityState& lhs, const EntityState& rhs)
+	{
+		return lhs.componentMask == rhs.componentMask && lhs.data == rhs.data;
+	}
+
+	void SnapshotReplicator::WriteRecord(ByteStream& stream, UInt32 entityId, const EntityState& state, const EntityState* baseline, UInt16 baselineSnapshotId)
+	{
+		std::size_t componentCount = m_schema.GetComponentCount();
+
+		stream << true; //< record
+		stream.WriteBits(entityId, 32);
+		stream << false; //< removal
+
+		stream << (baseline != nullptr);
+		if (baseline)
+			stream.WriteBits(UInt16(m_snapshotId - baselineSnapshotId), SnapshotSchema::HistorySizeBitCount);
+
+		stream.WriteBits(state.componentMask, UInt8(componentCount));
+
+		std::size_t offset = 0;
+		std::size_t baselineOffset = 0;
+		for (std::size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+		{
+			UInt32 componentBit = 1U << componentIndex;
+			UInt32 componentBitCount = m_schema.GetComponent(componentIndex).bitCount;
+			std::size_t componentSize = SnapshotSchema::GetEncodedSize(componentBitCount);
+
+			bool inBaseline = baseline && (baseline->componentMask & componentBit);
+			if (state.componentMask & componentBit)
+			{
+				bool changed = true;
+				if (inBaseline)
+				{
+					changed = (std::memcmp(&state.data[offset], &baseline->data[baselineOffset], componentSize) != 0);
+					stream << changed;
+				}
+
+				if (changed)
+				{
+					SnapshotSchema::WriteEncodedComponent(stream, &state.data[offset], componentBitCount);
+					m_statistics.sentComponentCount++;
+				}
+				else
+					m_statistics.unchangedComponentCount++;
+
+				offset += componentSize;
+			}
+
+			if (inBaseline)
+				baselineOffset += componentSize;
+		}
+	}
+}
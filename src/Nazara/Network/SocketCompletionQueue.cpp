@@ -0,0 +1,238 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
+
+#if defined(NAZARA_PLATFORM_LINUX)
+#include <Nazara/Network/Linux/SocketCompletionQueueImpl.hpp>
+#endif
+
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+#if !defined(NAZARA_PLATFORM_LINUX)
+	class SocketCompletionQueueImpl
+	{
+	};
+#endif
+
+	/*!
+	* \ingroup network
+	* \class Nz::SocketCompletionQueue
+	* \brief Network class running socket operations asynchronously and reporting their completion through callbacks
+	*
+	* Unlike SocketPoller which reports sockets ready to be used by blocking-style calls, operations are submitted to the system
+	* which performs them and reports their results, callbacks are then called by Poll on the thread calling it.
+	*
+	* Accept and receive operations are persistent: a single submission reports every incoming connection or data until the socket is closed.
+	* Received data is written by the system directly in buffers owned by the queue (Create parameters), the data given to the receive callbacks
+	* is only valid during the callback.
+	*
+	* Operations are started through TcpServer::AcceptAsync, TcpClient::ReceiveAsync/SendAsync and UdpSocket::ReceiveFromAsync/SendToAsync,
+	* a socket can only be used with one queue and closing it cancels its pending operations (without calling their callbacks).
+	*
+	* \remark This is only supported on Linux 6.0 or newer (using io_uring), see IsSupported
+	* \remark The queue must outlive the sockets using it, and must be used from a single thread
+	*/
+
+	SocketCompletionQueue::SocketCompletionQueue() = default;
+
+	SocketCompletionQueue::~SocketCompletionQueue()
+	{
+		Destroy();
+	}
+
+	/*!
+	* \brief Creates the queue
+	* \return true If successful
+	*
+	* \param entryCount Number of operations which can be submitted between two polls
+	* \param bufferCount Number of receive buffers shared by every socket of the queue (rounded up to a power of two)
+	* \param bufferSize Size of a receive buffer, data received over this size is split (TCP) or truncated (UDP)
+	*/
+	bool SocketCompletionQueue::Create(std::size_t entryCount, std::size_t bufferCount, std::size_t bufferSize)
+	{
+		NazaraAssert(entryCount > 0, "Invalid entry count");
+		NazaraAssert(bufferCount > 0, "Invalid buffer count");
+		NazaraAssert(bufferSize > 0, "Invalid buffer size");
+
+		Destroy();
+
+#if defined(NAZARA_PLATFORM_LINUX)
+		auto impl = std::make_unique<SocketCompletionQueueImpl>(m_statistics);
+		if (!impl->Create(entryCount, bufferCount, bufferSize))
+			return false;
+
+		m_impl = std::move(impl);
+		ResetStatistics();
+
+		return true;
+#else
+		NazaraUnused(entryCount);
+		NazaraUnused(bufferCount);
+		NazaraUnused(bufferSize);
+
+		NazaraError("Socket completion queues are not supported on this platform");
+		return false;
+#endif
+	}
+
+	/*!
+	* \brief Destroys the queue, cancelling every pending operation
+	*
+	* \remark Sockets used with the queue should be closed before
+	*/
+	void SocketCompletionQueue::Destroy()
+	{
+		m_impl.reset();
+	}
+
+	/*!
+	* \brief Submits the pending operations and calls the callbacks of completed operations
+	* \return Number of completions processed
+	*
+	* \param msTimeout Maximum time to wait for a completion in milliseconds, 0 will returns immediately and -1 will block indefinitely
+	* \param error If valid, this will be set to the error status of the poll
+	*
+	* \remark When no operation has been submitted and no completion is ready, a zero timeout doesn't lead to any system call
+	*/
+	unsigned int SocketCompletionQueue::Poll(int msTimeout, SocketError* error)
+	{
+		NazaraAssert(m_impl, "Completion queue has not been created");
+
+#if defined(NAZARA_PLATFORM_LINUX)
+		return m_impl->Poll(msTimeout, error);
+#else
+		NazaraUnused(msTimeout);
+
+		if (error)
+			*error = SocketError::NotSupported;
+
+		return 0;
+#endif
+	}
+
+	/*!
+	* \brief Checks whether completion queues can be created on this system
+	* \return true If Create can succeed
+	*/
+	bool SocketCompletionQueue::IsSupported()
+	{
+#if defined(NAZARA_PLATFORM_LINUX)
+		static bool isSupported = []
+		{
+			ErrorFlags errFlags(ErrorMode::Silent);
+
+			SocketCompletionQueue::Statistics statistics;
+			SocketCompletionQueueImpl impl(statistics);
+			return impl.Create(1, 1, 1);
+		}();
+
+		return isSupported;
+#else
+		return false;
+#endif
+	}
+
+	bool SocketCompletionQueue::Accept(AbstractSocket& socket, AcceptCallback callback)
+	{
+		if (!Register(socket))
+			return false;
+
+#if defined(NAZARA_PLATFORM_LINUX)
+		return m_impl->Accept(socket.GetNativeHandle(), std::move(callback));
+#else
+		NazaraUnused(callback);
+		return false;
+#endif
+	}
+
+	void SocketCompletionQueue::Cancel(SocketHandle handle)
+	{
+#if defined(NAZARA_PLATFORM_LINUX)
+		if (m_impl)
+			m_impl->Cancel(handle);
+#else
+		NazaraUnused(handle);
+#endif
+	}
+
+	bool SocketCompletionQueue::Receive(AbstractSocket& socket, ReceiveCallback callback)
+	{
+		if (!Register(socket))
+			return false;
+
+#if defined(NAZARA_PLATFORM_LINUX)
+		return m_impl->Receive(socket.GetNativeHandle(), std::move(callback));
+#else
+		NazaraUnused(callback);
+		return false;
+#endif
+	}
+
+	bool SocketCompletionQueue::ReceiveFrom(AbstractSocket& socket, ReceiveFromCallback callback)
+	{
+		if (!Register(socket))
+			return false;
+
+#if defined(NAZARA_PLATFORM_LINUX)
+		return m_impl->ReceiveFrom(socket.GetNativeHandle(), std::move(callback));
+#else
+		NazaraUnused(callback);
+		return false;
+#endif
+	}
+
+	bool SocketCompletionQueue::Register(AbstractSocket& socket)
+	{
+		if (!m_impl)
+		{
+			NazaraError("Completion queue has not been created");
+			return false;
+		}
+
+		if (socket.m_completionQueue && socket.m_completionQueue != this)
+		{
+			NazaraError("Socket is already used with another completion queue");
+			return false;
+		}
+
+		socket.m_completionQueue = this;
+		return true;
+	}
+
+	bool SocketCompletionQueue::Send(AbstractSocket& socket, const void* buffer, std::size_t size, SendCallback callback)
+	{
+		NazaraAssert(buffer && size > 0, "Invalid buffer");
+
+		if (!Register(socket))
+			return false;
+
+#if defined(NAZARA_PLATFORM_LINUX)
+		return m_impl->Send(socket.GetNativeHandle(), buffer, size, std::move(callback));
+#else
+		NazaraUnused(callback);
+		return false;
+#endif
+	}
+
+	bool SocketCompletionQueue::SendTo(AbstractSocket& socket, const IpAddress& to, const void* buffer, std::size_t size, SendCallback callback)
+	{
+		NazaraAssert(to.IsValid(), "Invalid address");
+		NazaraAssert(buffer && size > 0, "Invalid buffer");
+
+		if (!Register(socket))
+			return false;
+
+#if defined(NAZARA_PLATFORM_LINUX)
+		return m_impl->SendTo(socket.GetNativeHandle(), to, buffer, size, std::move(callback));
+#else
+		NazaraUnused(callback);
+		return false;
+#endif
+	}
+}
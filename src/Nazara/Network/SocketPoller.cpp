@@ -58,6 +58,24 @@ namespace Nz
 		m_impl->Clear();
 	}
 
+	/*!
+	* \brief Gets the sockets reported ready by the last Wait operation
+	*
+	* This is the preferred way of handling the results of a Wait operation, as it only contains the ready sockets along with their events
+	* and the userdata given at registration, avoiding to query every registered socket.
+	*
+	* \remark Unregistering a socket while iterating this list is allowed, its entry is kept but its events and userdata are cleared.
+	* \remark The list is only valid until the next call to Wait
+	*
+	* \return A reference to the list of ready sockets
+	*
+	* \see Wait
+	*/
+	const std::vector<SocketPoller::ReadySocket>& SocketPoller::GetReadySockets() const
+	{
+		return m_impl->GetReadySockets();
+	}
+
 	/*!
 	* \brief Checks if a specific socket is ready to read data
 	*
@@ -132,19 +150,24 @@ namespace Nz
 	* \remark It is an error to register a socket twice in the same SocketPoller.
 	* \remark The socket should not be freed while it is registered in the SocketPooler.
 	*
+	* \remark Edge-triggered mode is only supported on Linux, other platforms fall back to level-triggered notifications which
+	*         are a superset of edge-triggered ones (code written for edge-triggered mode works with both).
+	*
 	* \param socket Reference to the socket to register
 	* \param eventFlags Socket events to watch
+	* \param userdata Pointer reported along with the socket in the ready list (see GetReadySockets)
+	* \param mode Whether the socket should be reported on every Wait while it is ready (level-triggered) or only when its state changes (edge-triggered)
 	*
 	* \return True if the socket is registered, false otherwise
 	*
 	* \see IsRegistered
 	* \see UnregisterSocket
 	*/
-	bool SocketPoller::RegisterSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags)
+	bool SocketPoller::RegisterSocket(AbstractSocket& socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode mode)
 	{
 		NazaraAssert(!IsRegistered(socket), "This socket is already registered in this SocketPoller");
 
-		return m_impl->RegisterSocket(socket.GetNativeHandle(), eventFlags);
+		return m_impl->RegisterSocket(socket.GetNativeHandle(), eventFlags, userdata, mode);
 	}
 
 	/*!
@@ -172,7 +195,7 @@ namespace Nz
 	* \brief Wait until any registered socket switches to a ready state.
 	*
 	* Waits a specific/undetermined amount of time until at least one socket part of the SocketPoller becomes ready.
-	* To query the ready state of the registered socket, use the IsReadyToRead or IsReadyToWrite functions.
+	* To query the ready state of the registered socket, use GetReadySockets or the IsReadyToRead or IsReadyToWrite functions.
 	*
 	* If error is a valid pointer, it will be used to report the last error occurred (if no error occurred, a value of NoError will be reported)
 	*
@@ -203,6 +226,6 @@ namespace Nz
 			return 0;
 		}
 
-		return readySockets > 0;
+		return readySockets;
 	}
 }
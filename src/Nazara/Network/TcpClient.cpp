@@ -232,6 +232,24 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Receives data asynchronously, until the connection is closed
+	* \return true If the operation was submitted
+	*
+	* \param queue Completion queue running the operation
+	* \param callback Callback called with every received data (or an error), from SocketCompletionQueue::Poll
+	*
+	* \remark Received data is only valid during the callback
+	* \remark The connection being closed by the peer is reported by a SocketError::ConnectionClosed error
+	*/
+	bool TcpClient::ReceiveAsync(SocketCompletionQueue& queue, SocketCompletionQueue::ReceiveCallback callback)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Invalid handle");
+		NazaraAssert(callback, "Invalid callback");
+
+		return queue.Receive(*this, std::move(callback));
+	}
+
 	/*!
 	* \brief Receives the packet available
 	* \return true If packet received
@@ -371,6 +389,25 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Sends data asynchronously
+	* \return true If the operation was submitted
+	*
+	* \param queue Completion queue running the operation
+	* \param buffer Raw memory to send, copied by the queue
+	* \param size Size of the buffer
+	* \param callback Optional callback called once every byte was sent (or an error happened), from SocketCompletionQueue::Poll
+	*
+	* \remark Asynchronous sends of a client are performed in order, one after the other
+	*/
+	bool TcpClient::SendAsync(SocketCompletionQueue& queue, const void* buffer, std::size_t size, SocketCompletionQueue::SendCallback callback)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Invalid handle");
+		NazaraAssert(buffer && size > 0, "Invalid buffer");
+
+		return queue.Send(*this, buffer, size, std::move(callback));
+	}
+
 	/*!
 	* \brief Sends multiple buffers at once
 	* \return true If data were sent
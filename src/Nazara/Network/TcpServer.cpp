@@ -4,6 +4,7 @@
 
 #include <Nazara/Network/TcpServer.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/SocketCompletionQueue.hpp>
 #include <Nazara/Network/TcpClient.hpp>
 #include <Nazara/Network/Debug.hpp>
 
@@ -23,6 +24,30 @@ namespace Nz
 	* \brief Network class that represents a server in a TCP connection
 	*/
 
+	/*!
+	* \brief Accepts every incoming connection asynchronously
+	* \return true If the operation was submitted
+	*
+	* \param queue Completion queue running the operation
+	* \param callback Callback called with every accepted client (or an error), from SocketCompletionQueue::Poll
+	*
+	* \remark The operation lasts until the server is closed or an error is reported
+	*/
+	bool TcpServer::AcceptAsync(SocketCompletionQueue& queue, AcceptCallback callback)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Server isn't listening");
+		NazaraAssert(callback, "Invalid callback");
+
+		return queue.Accept(*this, [cb = std::move(callback)](SocketError error, SocketHandle handle, const IpAddress& peerAddress)
+		{
+			TcpClient client;
+			if (handle != SocketImpl::InvalidHandle)
+				client.Reset(handle, peerAddress);
+
+			cb(error, std::move(client));
+		});
+	}
+
 	/*!
 	* \brief Accepts a client
 	* \return true If client'socket is valid
@@ -5,6 +5,7 @@
 #include <Nazara/Network/UdpSocket.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
@@ -67,6 +68,34 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Allows other sockets to bind the same address and port
+	* \return true If the option was applied
+	*
+	* When multiple UDP sockets are bound to the same address with this option, the system load-balances incoming datagrams between them (a given remote address always reaching the same socket).
+	* Must be called before binding the socket.
+	*
+	* \param reusePort Should the port be shared
+	*
+	* \remark Produces a NazaraAssert if socket is invalid
+	* \remark This is not supported on Windows (whose SO_REUSEADDR doesn't load-balance) and fails with SocketError::NotSupported
+	*/
+
+	bool UdpSocket::EnableReusePort(bool reusePort)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Invalid handle");
+
+		if (m_isReusePortEnabled != reusePort)
+		{
+			if (!SocketImpl::SetReusePort(m_handle, reusePort, &m_lastError))
+				return false;
+
+			m_isReusePortEnabled = reusePort;
+		}
+
+		return true;
+	}
+
 	/*!
 	* \brief Gets the maximum datagram size allowed
 	* \return Number of bytes
@@ -120,6 +149,50 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Receives datagrams asynchronously, until the socket is closed
+	* \return true If the operation was submitted
+	*
+	* \param queue Completion queue running the operation
+	* \param callback Callback called with every received datagram (or an error), from SocketCompletionQueue::Poll
+	*
+	* \remark Received data is only valid during the callback
+	* \remark Datagrams over the buffer size of the queue are truncated and reported with a SocketError::DatagramSize error
+	*/
+	bool UdpSocket::ReceiveFromAsync(SocketCompletionQueue& queue, SocketCompletionQueue::ReceiveFromCallback callback)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssert(callback, "Invalid callback");
+
+		return queue.ReceiveFrom(*this, std::move(callback));
+	}
+
+	/*!
+	* \brief Receives multiple datagrams at once
+	* \return true If no error occurred (even if no datagram was available)
+	*
+	* \param datagrams Datagrams to fill, each one with its own buffers, their address and dataLength will be set for received datagrams
+	* \param datagramCount Maximum number of datagrams to receive
+	* \param receivedCount Optional argument to get the number of datagrams received
+	*
+	* \remark On Linux this is a single recvmmsg call, other platforms receive datagrams one by one until the socket would block
+	* \remark Empty or truncated datagrams are reported with a zero dataLength
+	*/
+	bool UdpSocket::ReceiveDatagrams(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* receivedCount)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		std::size_t received;
+		if (!SocketImpl::ReceiveDatagrams(m_handle, datagrams, datagramCount, &received, &m_lastError))
+			return false;
+
+		if (receivedCount)
+			*receivedCount = received;
+
+		return true;
+	}
+
 	/*!
 	* \brief Receive multiple datagram from one peer
 	* \return true If data were sent
@@ -233,6 +306,50 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Sends multiple datagrams at once
+	* \return true If no error occurred
+	*
+	* \param datagrams Datagrams to send, each one with its own destination address (must match socket protocol) and buffers
+	* \param datagramCount Number of datagrams to send
+	* \param sentCount Optional argument to get the number of datagrams sent, which may be less than datagramCount if the socket would block
+	*
+	* \remark On Linux this is a single sendmmsg call, other platforms send datagrams one by one
+	*/
+	bool UdpSocket::SendDatagrams(const NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sentCount)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		std::size_t sent;
+		if (!SocketImpl::SendDatagrams(m_handle, datagrams, datagramCount, &sent, &m_lastError))
+			return false;
+
+		if (sentCount)
+			*sentCount = sent;
+
+		return true;
+	}
+
+	/*!
+	* \brief Sends a datagram asynchronously
+	* \return true If the operation was submitted
+	*
+	* \param queue Completion queue running the operation
+	* \param to Destination IpAddress (must match socket protocol)
+	* \param buffer Raw memory to send, copied by the queue
+	* \param size Size of the buffer
+	* \param callback Optional callback called once the datagram was sent (or an error happened), from SocketCompletionQueue::Poll
+	*/
+	bool UdpSocket::SendToAsync(SocketCompletionQueue& queue, const IpAddress& to, const void* buffer, std::size_t size, SocketCompletionQueue::SendCallback callback)
+	{
+		NazaraAssert(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssert(to.IsValid(), "Invalid ip address");
+		NazaraAssert(to.GetProtocol() == m_protocol, "IP Address has a different protocol than the socket");
+
+		return queue.SendTo(*this, to, buffer, size, std::move(callback));
+	}
+
 	/*!
 	* \brief Sends multiple buffers as one datagram
 	* \return true If data were sent
@@ -303,5 +420,6 @@ namespace Nz
 
 		m_boundAddress = IpAddress::Invalid;
 		m_isBroadCastingEnabled = false;
+		m_isReusePortEnabled = false;
 	}
 }
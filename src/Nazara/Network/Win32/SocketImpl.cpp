@@ -537,6 +537,54 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::ReceiveDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		// Winsock has no multiple datagram receive function, pull datagrams one by one until the socket would block
+		std::size_t datagramIndex = 0;
+		for (; datagramIndex < datagramCount; ++datagramIndex)
+		{
+			NetDatagram& datagram = datagrams[datagramIndex];
+
+			int byteRead;
+			SocketError receiveError;
+			if (!ReceiveMultiple(handle, datagram.buffers, datagram.bufferCount, &datagram.address, &byteRead, &receiveError))
+			{
+				if (receiveError == SocketError::ConnectionClosed || receiveError == SocketError::DatagramSize)
+				{
+					// Empty or truncated datagram, it has been consumed so report it without data
+					datagram.address = IpAddress::Invalid;
+					datagram.dataLength = 0;
+					continue;
+				}
+
+				// Report datagrams we already received first
+				if (datagramIndex > 0)
+					break;
+
+				if (error)
+					*error = receiveError;
+
+				return false;
+			}
+
+			if (byteRead == 0)
+				break; //< Would block
+
+			datagram.dataLength = static_cast<std::size_t>(byteRead);
+		}
+
+		if (received)
+			*received = datagramIndex;
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::ReceiveFrom(SocketHandle handle, void* buffer, int length, IpAddress* from, int* read, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -697,6 +745,44 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SendDatagrams(SocketHandle handle, const NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+		NazaraAssert(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		// Winsock has no multiple datagram send function, send datagrams one by one until the socket would block
+		std::size_t datagramIndex = 0;
+		for (; datagramIndex < datagramCount; ++datagramIndex)
+		{
+			const NetDatagram& datagram = datagrams[datagramIndex];
+
+			int byteSent;
+			SocketError sendError;
+			if (!SendMultiple(handle, datagram.buffers, datagram.bufferCount, datagram.address, &byteSent, &sendError))
+			{
+				// Report datagrams we already sent first
+				if (datagramIndex > 0)
+					break;
+
+				if (error)
+					*error = sendError;
+
+				return false;
+			}
+
+			if (byteSent == 0)
+				break; //< Would block
+		}
+
+		if (sent)
+			*sent = datagramIndex;
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::SendMultiple(SocketHandle handle, const NetBuffer* buffers, std::size_t bufferCount, const IpAddress& to, int* sent, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
@@ -908,6 +994,17 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool /*reusePort*/, SocketError* error)
+	{
+		NazaraAssert(handle != InvalidHandle, "Invalid handle");
+
+		// SO_REUSEADDR allows multiple sockets to bind the same port on Windows, but only one of them receives datagrams
+		if (error)
+			*error = SocketError::NotSupported;
+
+		return false;
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssert(handle != InvalidHandle, "Invalid handle");
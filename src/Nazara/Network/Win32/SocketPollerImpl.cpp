@@ -5,6 +5,7 @@
 #include <Nazara/Network/Win32/SocketPollerImpl.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <algorithm>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
@@ -27,11 +28,18 @@ namespace Nz
 		m_readyToWriteSockets.clear();
 		m_sockets.clear();
 		#else
+		m_userdata.clear();
 		FD_ZERO(&m_readSockets);
 		FD_ZERO(&m_readyToReadSockets);
 		FD_ZERO(&m_readyToWriteSockets);
 		FD_ZERO(&m_writeSockets);
 		#endif
+		m_readySockets.clear();
+	}
+
+	const std::vector<SocketPoller::ReadySocket>& SocketPollerImpl::GetReadySockets() const
+	{
+		return m_readySockets;
 	}
 
 	bool SocketPollerImpl::IsReadyToRead(SocketHandle socket) const
@@ -63,10 +71,12 @@ namespace Nz
 		#endif
 	}
 
-	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags)
+	bool SocketPollerImpl::RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode /*mode*/)
 	{
 		NazaraAssert(!IsRegistered(socket), "Socket is already registered");
 
+		// Neither WSAPoll nor select have an edge-triggered mode, level-triggered notifications are a superset of edge-triggered ones
+
 		#if NAZARA_NETWORK_POLL_SUPPORT
 		PollSocket entry = {
 			socket,
@@ -80,7 +90,10 @@ namespace Nz
 		if (eventFlags & SocketPollEvent::Write)
 			entry.events |= POLLWRNORM;
 
-		m_allSockets[socket] = m_sockets.size();
+		Registration& registration = m_allSockets[socket];
+		registration.pollIndex = m_sockets.size();
+		registration.userdata = userdata;
+
 		m_sockets.emplace_back(entry);
 		#else
 		for (std::size_t i = 0; i < 2; ++i)
@@ -97,8 +110,19 @@ namespace Nz
 
 			FD_SET(socket, &targetSet);
 		}
+
+		m_userdata[socket] = userdata;
 		#endif
 
+		// Reserve the ready list here so that Wait never allocates it
+		#if NAZARA_NETWORK_POLL_SUPPORT
+		std::size_t socketCount = m_allSockets.size();
+		#else
+		std::size_t socketCount = m_userdata.size();
+		#endif
+		if (m_readySockets.capacity() < socketCount)
+			m_readySockets.reserve(std::max(socketCount, m_readySockets.capacity() * 2));
+
 		return true;
 	}
 
@@ -110,11 +134,11 @@ namespace Nz
 		if (m_sockets.size() > 1U)
 		{
 			// Instead of using vector::erase, let's move the last element to the now unoccupied position
-			std::size_t entry = m_allSockets[socket];
+			std::size_t entry = m_allSockets[socket].pollIndex;
 
 			// Get the last element and update it's position
 			const PollSocket& lastElement = m_sockets.back();
-			m_allSockets[lastElement.fd] = entry;
+			m_allSockets[lastElement.fd].pollIndex = entry;
 
 			// Now move it properly (lastElement is invalid after the following line) and pop it
 			m_sockets[entry] = std::move(m_sockets.back());
@@ -125,19 +149,31 @@ namespace Nz
 		m_readyToReadSockets.erase(socket);
 		m_readyToWriteSockets.erase(socket);
 		#else
+		m_userdata.erase(socket);
 		FD_CLR(socket, &m_readSockets);
 		FD_CLR(socket, &m_readyToReadSockets);
 		FD_CLR(socket, &m_readyToWriteSockets);
 		FD_CLR(socket, &m_writeSockets);
 		#endif
+
+		// The ready list may be iterated while unregistering, keep the entry but remove its events
+		for (SocketPoller::ReadySocket& readySocket : m_readySockets)
+		{
+			if (readySocket.handle == socket)
+			{
+				readySocket.events = SocketPollEventFlags{};
+				readySocket.userdata = nullptr;
+				break;
+			}
+		}
 	}
 
 	unsigned int SocketPollerImpl::Wait(int msTimeout, SocketError* error)
 	{
-		unsigned int activeSockets;
+		m_readySockets.clear();
 
 		#if NAZARA_NETWORK_POLL_SUPPORT
-		activeSockets = SocketImpl::Poll(m_sockets.data(), m_sockets.size(), static_cast<int>(msTimeout), error);
+		unsigned int activeSockets = SocketImpl::Poll(m_sockets.data(), m_sockets.size(), static_cast<int>(msTimeout), error);
 
 		m_readyToReadSockets.clear();
 		m_readyToWriteSockets.clear();
@@ -149,19 +185,28 @@ namespace Nz
 				if (!entry.revents)
 					continue;
 
-				if (entry.revents & (POLLRDNORM | POLLWRNORM | POLLHUP | POLLERR))
+				SocketPollEventFlags readyEvents;
+				if (entry.revents & (POLLRDNORM | POLLHUP | POLLERR))
 				{
-					if (entry.revents & (POLLRDNORM | POLLHUP | POLLERR))
-						m_readyToReadSockets.insert(entry.fd);
+					m_readyToReadSockets.insert(entry.fd);
+					readyEvents |= SocketPollEvent::Read;
+				}
 
-					if (entry.revents & (POLLWRNORM | POLLERR))
-						m_readyToWriteSockets.insert(entry.fd);
+				if (entry.revents & (POLLWRNORM | POLLERR))
+				{
+					m_readyToWriteSockets.insert(entry.fd);
+					readyEvents |= SocketPollEvent::Write;
 				}
-				else
+
+				if (readyEvents)
 				{
-					NazaraWarning("Socket " + NumberToString(entry.fd) + " was returned by WSAPoll without POLLRDNORM nor POLLWRNORM events (events: 0x" + NumberToString(entry.revents, 16) + ')');
-					activeSockets--;
+					SocketPoller::ReadySocket& readySocket = m_readySockets.emplace_back();
+					readySocket.handle = entry.fd;
+					readySocket.events = readyEvents;
+					readySocket.userdata = m_allSockets[entry.fd].userdata;
 				}
+				else
+					NazaraWarning("Socket " + NumberToString(entry.fd) + " was returned by WSAPoll without POLLRDNORM nor POLLWRNORM events (events: 0x" + NumberToString(entry.revents, 16) + ')');
 
 				entry.revents = 0;
 
@@ -173,6 +218,9 @@ namespace Nz
 		fd_set* readSet = nullptr;
 		fd_set* writeSet = nullptr;
 
+		FD_ZERO(&m_readyToReadSockets);
+		FD_ZERO(&m_readyToWriteSockets);
+
 		if (m_readSockets.fd_count > 0)
 		{
 			m_readyToReadSockets = m_readSockets;
@@ -182,7 +230,7 @@ namespace Nz
 		if (m_writeSockets.fd_count > 0)
 		{
 			m_readyToWriteSockets = m_writeSockets;
-			readSet = &m_readyToWriteSockets;
+			writeSet = &m_readyToWriteSockets;
 		}
 
 		timeval tv;
@@ -192,19 +240,45 @@ namespace Nz
 		int selectValue = ::select(0xDEADBEEF, readSet, writeSet, nullptr, (msTimeout >= 0) ? &tv : nullptr); //< The first argument is ignored on Windows
 		if (selectValue == SOCKET_ERROR)
 		{
+			FD_ZERO(&m_readyToReadSockets);
+			FD_ZERO(&m_readyToWriteSockets);
+
 			if (error)
 				*error = SocketImpl::TranslateWSAErrorToSocketError(WSAGetLastError());
 
 			return 0;
 		}
 
-		assert(selectValue >= 0);
-		activeSockets = static_cast<unsigned int>(selectValue);
+		// On Windows, select leaves only the ready sockets in the front of the fd_set arrays
+		for (u_int i = 0; i < m_readyToReadSockets.fd_count; ++i)
+		{
+			SocketHandle socket = m_readyToReadSockets.fd_array[i];
+
+			SocketPoller::ReadySocket& readySocket = m_readySockets.emplace_back();
+			readySocket.handle = socket;
+			readySocket.events = SocketPollEvent::Read;
+			readySocket.userdata = m_userdata[socket];
+
+			if (FD_ISSET(socket, &m_readyToWriteSockets))
+				readySocket.events |= SocketPollEvent::Write;
+		}
+
+		for (u_int i = 0; i < m_readyToWriteSockets.fd_count; ++i)
+		{
+			SocketHandle socket = m_readyToWriteSockets.fd_array[i];
+			if (FD_ISSET(socket, &m_readyToReadSockets))
+				continue; //< Already reported above
+
+			SocketPoller::ReadySocket& readySocket = m_readySockets.emplace_back();
+			readySocket.handle = socket;
+			readySocket.events = SocketPollEvent::Write;
+			readySocket.userdata = m_userdata[socket];
+		}
 
 		if (error)
 			*error = SocketError::NoError;
 		#endif
 
-		return activeSockets;
+		return static_cast<unsigned int>(m_readySockets.size());
 	}
 }
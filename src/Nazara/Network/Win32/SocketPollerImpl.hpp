@@ -9,6 +9,7 @@
 
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/SocketHandle.hpp>
+#include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/Win32/SocketImpl.hpp>
 #include <WinSock2.h>
 #include <unordered_map>
@@ -25,27 +26,38 @@ namespace Nz
 
 			void Clear();
 
+			const std::vector<SocketPoller::ReadySocket>& GetReadySockets() const;
+
 			bool IsReadyToRead(SocketHandle socket) const;
 			bool IsReadyToWrite(SocketHandle socket) const;
 			bool IsRegistered(SocketHandle socket) const;
 
-			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags);
+			bool RegisterSocket(SocketHandle socket, SocketPollEventFlags eventFlags, void* userdata, SocketPollMode mode);
 			void UnregisterSocket(SocketHandle socket);
 
 			unsigned int Wait(int msTimeout, SocketError* error);
 
 		private:
+			// SOCKET handles are not small integers on Windows, they can't index dense arrays
 			#if NAZARA_NETWORK_POLL_SUPPORT
+			struct Registration
+			{
+				void* userdata;
+				std::size_t pollIndex;
+			};
+
 			std::unordered_set<SocketHandle> m_readyToReadSockets;
 			std::unordered_set<SocketHandle> m_readyToWriteSockets;
-			std::unordered_map<SocketHandle, std::size_t> m_allSockets;
+			std::unordered_map<SocketHandle, Registration> m_allSockets;
 			std::vector<PollSocket> m_sockets;
 			#else
+			std::unordered_map<SocketHandle, void*> m_userdata;
 			fd_set m_readSockets;
 			fd_set m_readyToReadSockets;
 			fd_set m_readyToWriteSockets;
 			fd_set m_writeSockets;
 			#endif
+			std::vector<SocketPoller::ReadySocket> m_readySockets;
 	};
 }
 
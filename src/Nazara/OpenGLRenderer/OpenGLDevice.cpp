@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/OpenGLRenderer/OpenGLDevice.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/OpenGLRenderer/OpenGLBuffer.hpp>
 #include <Nazara/OpenGLRenderer/OpenGLCommandPool.hpp>
 #include <Nazara/OpenGLRenderer/OpenGLComputePipeline.hpp>
@@ -16,13 +18,20 @@
 #include <Nazara/OpenGLRenderer/Wrapper/Loader.hpp>
 #include <Nazara/Renderer/CommandPool.hpp>
 #include <array>
+#include <cstring>
 #include <stdexcept>
 #include <Nazara/OpenGLRenderer/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		constexpr UInt32 ProgramBinaryMagic = 0x4E474C50; //< "NGLP"
+	}
+
 	OpenGLDevice::OpenGLDevice(GL::Loader& loader, const Renderer::Config& config) :
-	m_loader(loader)
+	m_loader(loader),
+	m_isProgramBinarySupported(false)
 	{
 		GL::ContextParams params;
 		params.type = loader.GetPreferredContextType();
@@ -115,6 +124,10 @@ namespace Nz
 			};
 		}
 
+		// Program binaries (OpenGL 4.1 / OpenGL ES 3.0), drivers may support them without exposing any format
+		if (m_referenceContext->GetParams().type == GL::ContextType::OpenGL_ES || m_referenceContext->GetParams().glMajorVersion > 4 || (m_referenceContext->GetParams().glMajorVersion == 4 && m_referenceContext->GetParams().glMinorVersion >= 1))
+			m_isProgramBinarySupported = m_referenceContext->GetInteger<GLint>(GL_NUM_PROGRAM_BINARY_FORMATS) > 0;
+
 		m_contexts.insert(m_referenceContext.get());
 	}
 
@@ -144,6 +157,21 @@ namespace Nz
 		return contextPtr;
 	}
 
+	bool OpenGLDevice::FindProgramBinary(UInt64 key, GLenum* binaryFormat, std::vector<UInt8>* binary) const
+	{
+		auto it = m_programBinaries.find(key);
+		if (it == m_programBinaries.end())
+			return false;
+
+		if (binaryFormat)
+			*binaryFormat = it->second.format;
+
+		if (binary)
+			*binary = it->second.data;
+
+		return true;
+	}
+
 	const RenderDeviceInfo& OpenGLDevice::GetDeviceInfo() const
 	{
 		return m_deviceInfo;
@@ -155,6 +183,35 @@ namespace Nz
 		return m_deviceInfo.features;
 	}
 
+	bool OpenGLDevice::GetPipelineCacheData(ByteArray& data) const
+	{
+		if (m_programBinaries.empty())
+			return false;
+
+		auto Write = [&](const void* ptr, std::size_t size)
+		{
+			data.Append(ptr, size);
+		};
+
+		UInt32 binaryCount = static_cast<UInt32>(m_programBinaries.size());
+
+		data.Clear(true);
+		Write(&ProgramBinaryMagic, sizeof(ProgramBinaryMagic));
+		Write(&binaryCount, sizeof(binaryCount));
+		for (auto&& [key, programBinary] : m_programBinaries)
+		{
+			UInt32 format = programBinary.format;
+			UInt32 size = static_cast<UInt32>(programBinary.data.size());
+
+			Write(&key, sizeof(key));
+			Write(&format, sizeof(format));
+			Write(&size, sizeof(size));
+			Write(programBinary.data.data(), programBinary.data.size());
+		}
+
+		return true;
+	}
+
 	std::shared_ptr<RenderBuffer> OpenGLDevice::InstantiateBuffer(BufferType type, UInt64 size, BufferUsageFlags usageFlags, const void* initialData)
 	{
 		return std::make_shared<OpenGLBuffer>(*this, type, size, usageFlags, initialData);
@@ -180,6 +237,53 @@ namespace Nz
 		return std::make_shared<OpenGLRenderPass>(std::move(attachments), std::move(subpassDescriptions), std::move(subpassDependencies));
 	}
 
+	bool OpenGLDevice::LoadPipelineCacheData(const void* data, std::size_t size)
+	{
+		if (!m_isProgramBinarySupported)
+			return false;
+
+		const UInt8* ptr = static_cast<const UInt8*>(data);
+		const UInt8* end = ptr + size;
+		auto Read = [&](void* value, std::size_t valueSize)
+		{
+			if (std::size_t(end - ptr) < valueSize)
+				return false;
+
+			std::memcpy(value, ptr, valueSize);
+			ptr += valueSize;
+			return true;
+		};
+
+		UInt32 magic;
+		UInt32 binaryCount;
+		if (!Read(&magic, sizeof(magic)) || magic != ProgramBinaryMagic || !Read(&binaryCount, sizeof(binaryCount)))
+		{
+			NazaraError("invalid program binary cache");
+			return false;
+		}
+
+		// Binaries from another driver version will be rejected by glProgramBinary, programs are then compiled from their sources
+		for (UInt32 i = 0; i < binaryCount; ++i)
+		{
+			UInt64 key;
+			UInt32 format;
+			UInt32 binarySize;
+			if (!Read(&key, sizeof(key)) || !Read(&format, sizeof(format)) || !Read(&binarySize, sizeof(binarySize)) || std::size_t(end - ptr) < binarySize)
+			{
+				NazaraError("program binary cache is corrupted");
+				return false;
+			}
+
+			auto& programBinary = m_programBinaries[key];
+			programBinary.format = format;
+			programBinary.data.assign(ptr, ptr + binarySize);
+
+			ptr += binarySize;
+		}
+
+		return true;
+	}
+
 	std::shared_ptr<RenderPipeline> OpenGLDevice::InstantiateRenderPipeline(RenderPipelineInfo pipelineInfo)
 	{
 		return std::make_shared<OpenGLRenderPipeline>(*this, std::move(pipelineInfo));
@@ -217,6 +321,11 @@ namespace Nz
 			case PixelFormat::Undefined:
 				return false;
 
+			case PixelFormat::BC4:
+			case PixelFormat::BC5:
+			case PixelFormat::BC7:
+				return false; //< RGTC/BPTC formats have no upload path yet
+
 			case PixelFormat::A8:
 			case PixelFormat::BGR8:
 			case PixelFormat::BGR8_SRGB:
@@ -289,4 +398,11 @@ namespace Nz
 
 		return false;
 	}
+
+	void OpenGLDevice::StoreProgramBinary(UInt64 key, GLenum binaryFormat, std::vector<UInt8> binary)
+	{
+		auto& programBinary = m_programBinaries[key];
+		programBinary.format = binaryFormat;
+		programBinary.data = std::move(binary);
+	}
 }
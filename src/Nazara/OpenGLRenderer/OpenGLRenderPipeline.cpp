@@ -7,10 +7,13 @@
 #include <Nazara/OpenGLRenderer/OpenGLRenderPipelineLayout.hpp>
 #include <Nazara/OpenGLRenderer/OpenGLShaderModule.hpp>
 #include <Nazara/OpenGLRenderer/Utils.hpp>
+#include <Nazara/Renderer/ShaderCache.hpp>
 #include <NZSL/GlslWriter.hpp>
 #include <NZSL/ShaderBuilder.hpp>
 #include <NZSL/Ast/Module.hpp>
 #include <cassert>
+#include <memory>
+#include <optional>
 #include <stdexcept>
 #include <Nazara/OpenGLRenderer/Debug.hpp>
 
@@ -33,16 +36,27 @@ namespace Nz
 		// Enable pipeline states before compiling and linking the program, for drivers which embed some pipeline states into the shader binary (to avoid recompilation later)
 		activeContext->UpdateStates(m_pipelineInfo, false);
 
+		struct ModuleSources
+		{
+			const OpenGLShaderModule* shaderModule;
+			std::vector<OpenGLShaderModule::ShaderSource> sources;
+		};
+
 		nzsl::ShaderStageTypeFlags stageFlags;
 		std::vector<OpenGLShaderModule::ExplicitBinding> explicitBindings;
+		std::vector<ModuleSources> moduleSources;
 
 		for (const auto& shaderModulePtr : m_pipelineInfo.shaderModules)
 		{
 			OpenGLShaderModule& shaderModule = static_cast<OpenGLShaderModule&>(*shaderModulePtr);
-			stageFlags |= shaderModule.Attach(m_program, pipelineLayout.GetBindingMapping(), &explicitBindings);
+
+			auto& entry = moduleSources.emplace_back();
+			entry.shaderModule = &shaderModule;
+			stageFlags |= shaderModule.GenerateSources(pipelineLayout.GetBindingMapping(), &entry.sources, &explicitBindings);
 		}
 
 		// OpenGL ES programs must have both vertex and fragment shaders or a compute shader or a mesh and fragment shader.
+		std::vector<std::unique_ptr<OpenGLShaderModule>> dummyModules;
 		if (device.GetReferenceContext().GetParams().type == GL::ContextType::OpenGL_ES)
 		{
 			auto GenerateIfMissing = [&](nzsl::ShaderStageType stage)
@@ -53,8 +67,11 @@ namespace Nz
 					dummyModule.rootNode = nzsl::ShaderBuilder::MultiStatement();
 					dummyModule.rootNode->statements.push_back(nzsl::ShaderBuilder::DeclareFunction(stage, "main", {}, {}));
 
-					OpenGLShaderModule shaderModule(device, stage, dummyModule);
-					stageFlags |= shaderModule.Attach(m_program, pipelineLayout.GetBindingMapping(), &explicitBindings);
+					auto& shaderModule = dummyModules.emplace_back(std::make_unique<OpenGLShaderModule>(device, stage, dummyModule));
+
+					auto& entry = moduleSources.emplace_back();
+					entry.shaderModule = shaderModule.get();
+					stageFlags |= shaderModule->GenerateSources(pipelineLayout.GetBindingMapping(), &entry.sources, &explicitBindings);
 				}
 			};
 
@@ -62,11 +79,57 @@ namespace Nz
 			GenerateIfMissing(nzsl::ShaderStageType::Vertex);
 		}
 
-		m_program.Link();
+		// Try to skip compilation and linking using a program binary of the same sources from a previous run
+		std::optional<UInt64> binaryKey;
+		bool isLoadedFromBinary = false;
+		if (device.IsProgramBinarySupported())
+		{
+			std::string programSources;
+			for (const auto& entry : moduleSources)
+			{
+				for (const auto& source : entry.sources)
+				{
+					programSources += std::to_string(UnderlyingCast(source.stage));
+					programSources += ':';
+					programSources += source.code;
+				}
+			}
+
+			binaryKey = ShaderCache::ComputeKey(programSources);
+
+			GLenum binaryFormat;
+			std::vector<UInt8> binary;
+			if (device.FindProgramBinary(*binaryKey, &binaryFormat, &binary))
+			{
+				m_program.SetBinary(binaryFormat, binary.data(), SafeCast<GLsizei>(binary.size()));
 
-		std::string errLog;
-		if (!m_program.GetLinkStatus(&errLog))
-			throw std::runtime_error("failed to link program: " + errLog);
+				// Binary may be rejected by the driver (after a driver update for example), in which case we compile the program normally
+				isLoadedFromBinary = m_program.GetLinkStatus();
+			}
+		}
+
+		if (!isLoadedFromBinary)
+		{
+			if (binaryKey)
+				m_program.SetParameter(GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+			for (const auto& entry : moduleSources)
+				entry.shaderModule->AttachSources(m_program, entry.sources);
+
+			m_program.Link();
+
+			std::string errLog;
+			if (!m_program.GetLinkStatus(&errLog))
+				throw std::runtime_error("failed to link program: " + errLog);
+
+			if (binaryKey)
+			{
+				GLenum binaryFormat;
+				std::vector<UInt8> binary;
+				if (m_program.GetBinary(&binaryFormat, &binary))
+					device.StoreProgramBinary(*binaryKey, binaryFormat, std::move(binary));
+			}
+		}
 
 		m_flipYUniformLocation = m_program.GetUniformLocation(nzsl::GlslWriter::GetFlipYUniformName().data());
 		if (m_flipYUniformLocation != -1)
@@ -85,6 +85,39 @@ namespace Nz
 
 	nzsl::ShaderStageTypeFlags OpenGLShaderModule::Attach(GL::Program& program, const nzsl::GlslWriter::BindingMapping& bindingMapping, std::vector<ExplicitBinding>* explicitBindings) const
 	{
+		std::vector<ShaderSource> sources;
+		nzsl::ShaderStageTypeFlags stageFlags = GenerateSources(bindingMapping, &sources, explicitBindings);
+		AttachSources(program, sources);
+
+		return stageFlags;
+	}
+
+	void OpenGLShaderModule::AttachSources(GL::Program& program, const std::vector<ShaderSource>& sources) const
+	{
+		for (const auto& source : sources)
+		{
+			GL::Shader shader;
+
+			if (!shader.Create(m_device, ToOpenGL(source.stage)))
+				throw std::runtime_error("failed to create shader"); //< TODO: Handle error message
+
+			if (!m_debugName.empty())
+				shader.SetDebugName(m_debugName);
+
+			shader.SetSource(source.code.data(), GLint(source.code.size()));
+			shader.Compile();
+
+			CheckCompilationStatus(shader);
+
+			program.AttachShader(shader.GetObjectId());
+			// Shader object can be safely released now (it won't be deleted by the driver until program gets deleted)
+		}
+	}
+
+	nzsl::ShaderStageTypeFlags OpenGLShaderModule::GenerateSources(const nzsl::GlslWriter::BindingMapping& bindingMapping, std::vector<ShaderSource>* sources, std::vector<ExplicitBinding>* explicitBindings) const
+	{
+		NazaraAssert(sources, "Invalid source vector");
+
 		const auto& context = m_device.GetReferenceContext();
 		const auto& contextParams = context.GetParams();
 
@@ -108,23 +141,18 @@ namespace Nz
 		nzsl::ShaderStageTypeFlags stageFlags;
 		for (const auto& shaderEntry : m_shaders)
 		{
-			GL::Shader shader;
-
-			if (!shader.Create(m_device, ToOpenGL(shaderEntry.stage)))
-				throw std::runtime_error("failed to create shader"); //< TODO: Handle error message
-
-			if (!m_debugName.empty())
-				shader.SetDebugName(m_debugName);
+			auto& source = sources->emplace_back();
+			source.stage = shaderEntry.stage;
 
 			std::visit([&](auto&& arg)
 			{
 				using T = std::decay_t<decltype(arg)>;
 				if constexpr (std::is_same_v<T, GlslShader>)
-					shader.SetSource(arg.sourceCode.data(), GLint(arg.sourceCode.size()));
+					source.code = arg.sourceCode;
 				else if constexpr (std::is_same_v<T, ShaderStatement>)
 				{
 					nzsl::GlslWriter::Output output = writer.Generate(shaderEntry.stage, *arg.ast, bindingMapping, m_states);
-					shader.SetSource(output.code.data(), GLint(output.code.size()));
+					source.code = std::move(output.code);
 
 					if (explicitBindings)
 					{
@@ -151,13 +179,6 @@ namespace Nz
 
 			}, shaderEntry.shader);
 
-			shader.Compile();
-
-			CheckCompilationStatus(shader);
-
-			program.AttachShader(shader.GetObjectId());
-			// Shader object can be safely released now (it won't be deleted by the driver until program gets deleted)
-
 			stageFlags |= shaderEntry.stage;
 		}
 
@@ -3,9 +3,18 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ParallelFor.hpp>
 #include <Nazara/Physics2D/Arbiter2D.hpp>
 #include <Nazara/Utils/StackArray.hpp>
 #include <chipmunk/chipmunk.h>
+#include <chipmunk/chipmunk_private.h>
+#include <chipmunk/cpHastySpace.h>
+#include <algorithm>
+#include <atomic>
+#include <tuple>
 #include <Nazara/Physics2D/Debug.hpp>
 
 namespace Nz
@@ -76,20 +85,251 @@ namespace Nz
 			else
 				return cpSpaceDebugColor{1.f, 0.f, 0.f, 1.f};
 		}
+
+		// Batched queries go straight to the space spatial indices, as cpSpace*Query functions lock the space (which isn't thread-safe)
+		constexpr std::size_t BatchQueryGrainSize = 64;
+
+		struct PointQueryContext
+		{
+			cpVect point;
+			cpShapeFilter filter;
+		};
+
+		struct RegionQueryContext
+		{
+			cpBB bb;
+			cpShapeFilter filter;
+			RigidBody2D** bodies;
+			std::size_t bodyCount;
+			std::size_t maxBodyCount;
+		};
+
+		struct SegmentQueryContext
+		{
+			cpVect from;
+			cpVect to;
+			cpFloat radius;
+			cpShapeFilter filter;
+		};
+
+		cpCollisionID NearestPointQuery(void* obj, void* shapePtr, cpCollisionID id, void* data)
+		{
+			const PointQueryContext& context = *static_cast<const PointQueryContext*>(obj);
+			cpShape* shape = static_cast<cpShape*>(shapePtr);
+			cpPointQueryInfo& out = *static_cast<cpPointQueryInfo*>(data);
+
+			if (!cpShapeFilterReject(shape->filter, context.filter) && !shape->sensor)
+			{
+				cpPointQueryInfo info;
+				cpShapePointQuery(shape, context.point, &info);
+				if (info.distance < out.distance)
+					out = info;
+			}
+
+			return id;
+		}
+
+		cpCollisionID RegionQuery(void* obj, void* shapePtr, cpCollisionID id, void* /*data*/)
+		{
+			RegionQueryContext& context = *static_cast<RegionQueryContext*>(obj);
+			cpShape* shape = static_cast<cpShape*>(shapePtr);
+
+			if (context.bodyCount < context.maxBodyCount && !cpShapeFilterReject(shape->filter, context.filter) && cpBBIntersects(context.bb, shape->bb))
+				context.bodies[context.bodyCount++] = static_cast<RigidBody2D*>(cpShapeGetUserData(shape));
+
+			return id;
+		}
+
+		cpFloat SegmentQueryFirst(void* obj, void* shapePtr, void* data)
+		{
+			const SegmentQueryContext& context = *static_cast<const SegmentQueryContext*>(obj);
+			cpShape* shape = static_cast<cpShape*>(shapePtr);
+			cpSegmentQueryInfo& out = *static_cast<cpSegmentQueryInfo*>(data);
+
+			cpSegmentQueryInfo info;
+			if (!cpShapeFilterReject(shape->filter, context.filter) && !shape->sensor && cpShapeSegmentQuery(shape, context.from, context.to, context.radius, &info) && info.alpha < out.alpha)
+				out = info;
+
+			return out.alpha;
+		}
+
+		// Saved states are raw native values (cpFloat included) so a restored world continues exactly like the saved one
+		constexpr UInt32 StateMagic = 0x4E503244; //< "NP2D"
+		constexpr UInt8 StateVersion = 2;
+		constexpr std::size_t StateHeaderSize = sizeof(UInt32) + 2 * sizeof(UInt8) + 2 * sizeof(UInt32) + sizeof(Int64) + sizeof(cpTimestamp) + sizeof(cpFloat);
+		constexpr std::size_t StateBodySize = sizeof(UInt32) + 10 * sizeof(cpFloat) + sizeof(UInt8);
+		constexpr std::size_t StateContactSize = 2 * sizeof(UInt64) + sizeof(UInt8);
+
+		UInt64 GetShapeKey(const cpShape* shape)
+		{
+			const RigidBody2D* rigidBody = static_cast<const RigidBody2D*>(cpShapeGetUserData(shape));
+			return UInt64(rigidBody->GetBodyIndex()) << 32 | rigidBody->GetShapeIndex(const_cast<cpShape*>(shape));
+		}
 	}
 
 	PhysWorld2D::PhysWorld2D() :
+	PhysWorld2D(1)
+	{
+	}
+
+	PhysWorld2D::PhysWorld2D(unsigned int threadCount) :
 	m_maxStepCount(50),
+	m_sleepTime(Time::Zero()),
 	m_stepSize(Time::TickDuration(200)),
-	m_timestepAccumulator(Time::Zero())
+	m_timestepAccumulator(Time::Zero()),
+	m_isDeterministic(false),
+	m_isResettingCollisionState(false),
+	m_isThreaded(threadCount != 1),
+	m_isUsingSpatialHash(false)
 	{
-		m_handle = cpSpaceNew();
+		// Hasty spaces run the constraint solver on multiple threads (0 means one per core), collision callbacks are still called from Step
+		if (m_isThreaded)
+		{
+			m_handle = cpHastySpaceNew();
+			cpHastySpaceSetThreads(m_handle, threadCount);
+		}
+		else
+			m_handle = cpSpaceNew();
+
 		cpSpaceSetUserData(m_handle, this);
 	}
 
 	PhysWorld2D::~PhysWorld2D()
 	{
-		cpSpaceFree(m_handle);
+		if (m_isThreaded)
+			cpHastySpaceFree(m_handle);
+		else
+			cpSpaceFree(m_handle);
+	}
+
+	std::size_t PhysWorld2D::BatchNearestBodyQuery(const NearestBodyRequest* requests, std::size_t requestCount, NearestQueryResult* results)
+	{
+		NazaraAssert(requestCount == 0 || (requests && results), "Invalid requests or results");
+		NazaraAssert(!cpSpaceIsLocked(m_handle), "Queries cannot be run while the world is being stepped");
+
+		std::atomic_size_t hitCount(0);
+		ParallelFor(requestCount, BatchQueryGrainSize, GetQueryThreadCount(), [&](std::size_t begin, std::size_t end)
+		{
+			std::size_t localHitCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const NearestBodyRequest& request = requests[i];
+				NearestQueryResult& result = results[i];
+
+				PointQueryContext context;
+				context.filter = cpShapeFilterNew(request.collisionGroup, request.categoryMask, request.collisionMask);
+				context.point = cpv(request.from.x, request.from.y);
+
+				cpPointQueryInfo queryInfo = { nullptr, cpvzero, request.maxDistance, cpvzero };
+
+				cpBB bb = cpBBNewForCircle(context.point, std::max<cpFloat>(request.maxDistance, 0.0));
+				cpSpatialIndexQuery(m_handle->dynamicShapes, &context, bb, &NearestPointQuery, &queryInfo);
+				cpSpatialIndexQuery(m_handle->staticShapes, &context, bb, &NearestPointQuery, &queryInfo);
+
+				if (queryInfo.shape)
+				{
+					result.closestPoint.Set(Nz::Vector2<cpFloat>(queryInfo.point.x, queryInfo.point.y));
+					result.distance = float(queryInfo.distance);
+					result.fraction.Set(Nz::Vector2<cpFloat>(queryInfo.gradient.x, queryInfo.gradient.y));
+					result.nearestBody = static_cast<Nz::RigidBody2D*>(cpShapeGetUserData(queryInfo.shape));
+
+					localHitCount++;
+				}
+				else
+				{
+					result.closestPoint = request.from;
+					result.distance = request.maxDistance;
+					result.fraction = Nz::Vector2f::Zero();
+					result.nearestBody = nullptr;
+				}
+			}
+
+			hitCount += localHitCount;
+		});
+
+		return hitCount;
+	}
+
+	std::size_t PhysWorld2D::BatchRaycastQueryFirst(const RaycastRequest* requests, std::size_t requestCount, RaycastHit* hitInfos)
+	{
+		NazaraAssert(requestCount == 0 || (requests && hitInfos), "Invalid requests or results");
+		NazaraAssert(!cpSpaceIsLocked(m_handle), "Queries cannot be run while the world is being stepped");
+
+		std::atomic_size_t hitCount(0);
+		ParallelFor(requestCount, BatchQueryGrainSize, GetQueryThreadCount(), [&](std::size_t begin, std::size_t end)
+		{
+			std::size_t localHitCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const RaycastRequest& request = requests[i];
+				RaycastHit& hitInfo = hitInfos[i];
+
+				SegmentQueryContext context;
+				context.filter = cpShapeFilterNew(request.collisionGroup, request.categoryMask, request.collisionMask);
+				context.from = cpv(request.from.x, request.from.y);
+				context.radius = request.radius;
+				context.to = cpv(request.to.x, request.to.y);
+
+				cpSegmentQueryInfo queryInfo = { nullptr, context.to, cpvzero, 1.0 };
+				cpSpatialIndexSegmentQuery(m_handle->staticShapes, &context, context.from, context.to, 1.0, &SegmentQueryFirst, &queryInfo);
+				cpSpatialIndexSegmentQuery(m_handle->dynamicShapes, &context, context.from, context.to, queryInfo.alpha, &SegmentQueryFirst, &queryInfo);
+
+				if (queryInfo.shape)
+				{
+					hitInfo.fraction = float(queryInfo.alpha);
+					hitInfo.hitNormal.Set(Nz::Vector2<cpFloat>(queryInfo.normal.x, queryInfo.normal.y));
+					hitInfo.hitPos.Set(Nz::Vector2<cpFloat>(queryInfo.point.x, queryInfo.point.y));
+					hitInfo.nearestBody = static_cast<Nz::RigidBody2D*>(cpShapeGetUserData(queryInfo.shape));
+
+					localHitCount++;
+				}
+				else
+				{
+					hitInfo.fraction = 1.f;
+					hitInfo.hitNormal = Nz::Vector2f::Zero();
+					hitInfo.hitPos = request.to;
+					hitInfo.nearestBody = nullptr;
+				}
+			}
+
+			hitCount += localHitCount;
+		});
+
+		return hitCount;
+	}
+
+	std::size_t PhysWorld2D::BatchRegionQuery(const RegionRequest* requests, std::size_t requestCount, RigidBody2D** bodies, std::size_t maxBodyPerRequest, std::size_t* bodyCounts)
+	{
+		NazaraAssert(requestCount == 0 || (requests && bodies && bodyCounts), "Invalid requests or results");
+		NazaraAssert(!cpSpaceIsLocked(m_handle), "Queries cannot be run while the world is being stepped");
+
+		std::atomic_size_t totalBodyCount(0);
+		ParallelFor(requestCount, BatchQueryGrainSize, GetQueryThreadCount(), [&](std::size_t begin, std::size_t end)
+		{
+			std::size_t localBodyCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const Rectf& boundingBox = requests[i].boundingBox;
+
+				// Bodies are written in a fixed-size slice per request, the ones which don't fit are ignored
+				RegionQueryContext context;
+				context.bb = cpBBNew(boundingBox.x, boundingBox.y, boundingBox.x + boundingBox.width, boundingBox.y + boundingBox.height);
+				context.bodies = &bodies[i * maxBodyPerRequest];
+				context.bodyCount = 0;
+				context.filter = cpShapeFilterNew(requests[i].collisionGroup, requests[i].categoryMask, requests[i].collisionMask);
+				context.maxBodyCount = maxBodyPerRequest;
+
+				cpSpatialIndexQuery(m_handle->dynamicShapes, &context, context.bb, &RegionQuery, nullptr);
+				cpSpatialIndexQuery(m_handle->staticShapes, &context, context.bb, &RegionQuery, nullptr);
+
+				bodyCounts[i] = context.bodyCount;
+				localBodyCount += context.bodyCount;
+			}
+
+			totalBodyCount += localBodyCount;
+		});
+
+		return totalBodyCount;
 	}
 
 	void PhysWorld2D::DebugDraw(const DebugDrawOptions& options, bool drawShapes, bool drawConstraints, bool drawCollisions)
@@ -128,6 +368,34 @@ namespace Nz
 		cpSpaceDebugDraw(m_handle, &drawOptions);
 	}
 
+	void PhysWorld2D::EnableDeterminism(bool enable)
+	{
+		m_isDeterministic = enable;
+
+		// Sleeping components are rebuilt from the contact graph, which isn't part of saved states
+		if (m_isDeterministic)
+		{
+			cpSpaceSetSleepTimeThreshold(m_handle, std::numeric_limits<cpFloat>::infinity());
+			for (RigidBody2D* rigidBody : m_bodies)
+			{
+				if (rigidBody && rigidBody->GetHandle())
+					cpBodyActivate(rigidBody->GetHandle());
+			}
+		}
+		else
+			SetSleepTime(m_sleepTime);
+	}
+
+	float PhysWorld2D::GetCollisionBias() const
+	{
+		return float(cpSpaceGetCollisionBias(m_handle));
+	}
+
+	float PhysWorld2D::GetCollisionSlop() const
+	{
+		return float(cpSpaceGetCollisionSlop(m_handle));
+	}
+
 	float PhysWorld2D::GetDamping() const
 	{
 		return float(cpSpaceGetDamping(m_handle));
@@ -144,6 +412,12 @@ namespace Nz
 		return m_handle;
 	}
 
+	float PhysWorld2D::GetInterpolationFactor() const
+	{
+		// Remaining simulation time, as a fraction of a step
+		return std::min(m_timestepAccumulator.AsSeconds<float>() / m_stepSize.AsSeconds<float>(), 1.f);
+	}
+
 	std::size_t PhysWorld2D::GetIterationCount() const
 	{
 		return cpSpaceGetIterations(m_handle);
@@ -159,6 +433,19 @@ namespace Nz
 		return m_stepSize;
 	}
 
+	unsigned int PhysWorld2D::GetThreadCount() const
+	{
+		if (m_isThreaded)
+			return static_cast<unsigned int>(cpHastySpaceGetThreads(m_handle));
+		else
+			return 1;
+	}
+
+	bool PhysWorld2D::IsThreaded() const
+	{
+		return m_isThreaded;
+	}
+
 	bool PhysWorld2D::NearestBodyQuery(const Vector2f & from, float maxDistance, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, RigidBody2D** nearestBody)
 	{
 		cpShapeFilter filter = cpShapeFilterNew(collisionGroup, categoryMask, collisionMask);
@@ -316,6 +603,195 @@ namespace Nz
 		InitCallbacks(cpSpaceAddCollisionHandler(m_handle, collisionIdA, collisionIdB), std::move(callbacks));
 	}
 
+	bool PhysWorld2D::RestoreState(const ByteArray& state)
+	{
+		NazaraAssert(!cpSpaceIsLocked(m_handle), "State cannot be restored while the world is being stepped");
+
+		const UInt8* ptr = state.GetConstBuffer();
+		if (state.GetSize() < StateHeaderSize || ReadRawValue<UInt32>(ptr) != StateMagic)
+		{
+			NazaraError("invalid physics state");
+			return false;
+		}
+
+		UInt8 version = ReadRawValue<UInt8>(ptr);
+		UInt8 floatSize = ReadRawValue<UInt8>(ptr);
+		if (version != StateVersion || floatSize != sizeof(cpFloat))
+		{
+			NazaraError("unsupported physics state version (" + std::to_string(version) + ")");
+			return false;
+		}
+
+		UInt32 bodyCount = ReadRawValue<UInt32>(ptr);
+		UInt32 contactCount = ReadRawValue<UInt32>(ptr);
+		if (state.GetSize() != StateHeaderSize + bodyCount * StateBodySize + contactCount * StateContactSize)
+		{
+			NazaraError("corrupted physics state");
+			return false;
+		}
+
+		Int64 timestepAccumulator = ReadRawValue<Int64>(ptr);
+		cpTimestamp stamp = ReadRawValue<cpTimestamp>(ptr);
+		cpFloat currentDt = ReadRawValue<cpFloat>(ptr);
+
+		// Check every body still exists before touching the world
+		const UInt8* bodyData = ptr;
+		for (UInt32 i = 0; i < bodyCount; ++i)
+		{
+			const UInt8* bodyPtr = bodyData + i * StateBodySize;
+			UInt32 bodyIndex = ReadRawValue<UInt32>(bodyPtr);
+			if (bodyIndex >= m_bodies.size() || !m_bodies[bodyIndex] || !m_bodies[bodyIndex]->GetHandle())
+			{
+				NazaraError("physics state references body #" + std::to_string(bodyIndex) + " which doesn't exist");
+				return false;
+			}
+		}
+
+		std::vector<cpBody*> sleepingBodies;
+
+		m_timestepAccumulator = Time::Nanoseconds(timestepAccumulator);
+		m_handle->stamp = stamp;
+		m_handle->curr_dt = currentDt;
+
+		for (UInt32 i = 0; i < bodyCount; ++i)
+		{
+			UInt32 bodyIndex = ReadRawValue<UInt32>(ptr);
+
+			cpVect position;
+			position.x = ReadRawValue<cpFloat>(ptr);
+			position.y = ReadRawValue<cpFloat>(ptr);
+
+			cpVect velocity;
+			velocity.x = ReadRawValue<cpFloat>(ptr);
+			velocity.y = ReadRawValue<cpFloat>(ptr);
+
+			cpVect force;
+			force.x = ReadRawValue<cpFloat>(ptr);
+			force.y = ReadRawValue<cpFloat>(ptr);
+
+			cpFloat angle = ReadRawValue<cpFloat>(ptr);
+			cpFloat angularVelocity = ReadRawValue<cpFloat>(ptr);
+			cpFloat torque = ReadRawValue<cpFloat>(ptr);
+			cpFloat idleTime = ReadRawValue<cpFloat>(ptr);
+			bool isSleeping = ReadRawValue<UInt8>(ptr) != 0;
+
+			cpBody* body = m_bodies[bodyIndex]->GetHandle();
+			cpBodySetAngle(body, angle);
+			cpBodySetAngularVelocity(body, angularVelocity);
+			cpBodySetForce(body, force);
+			cpBodySetPosition(body, position);
+			cpBodySetTorque(body, torque);
+			cpBodySetVelocity(body, velocity);
+			body->sleeping.idleTime = idleTime;
+
+			// Bodies are put back to sleep once their shapes are back in the world
+			if (isSleeping && !m_isDeterministic)
+				sleepingBodies.push_back(body);
+		}
+
+		m_persistentContacts.resize(contactCount);
+		for (ContactPair& contact : m_persistentContacts)
+		{
+			contact.firstShape = ReadRawValue<UInt64>(ptr);
+			contact.secondShape = ReadRawValue<UInt64>(ptr);
+			contact.isIgnored = ReadRawValue<UInt8>(ptr) != 0;
+		}
+
+		ResetCollisionState();
+
+		for (cpBody* body : sleepingBodies)
+		{
+			if (cpBodyGetType(body) == CP_BODY_TYPE_DYNAMIC && cpSpaceContainsBody(m_handle, body))
+				cpBodySleep(body);
+		}
+
+		// Every restored body may have moved
+		for (UInt32 i = 0; i < bodyCount; ++i)
+		{
+			const UInt8* bodyPtr = bodyData + i * StateBodySize;
+			m_activeBodies.Set(ReadRawValue<UInt32>(bodyPtr));
+		}
+
+		OnPhysWorld2DStateRestored(this);
+
+		return true;
+	}
+
+	void PhysWorld2D::SaveState(ByteArray& state)
+	{
+		NazaraAssert(!cpSpaceIsLocked(m_handle), "State cannot be saved while the world is being stepped");
+
+		CollectContacts(m_persistentContacts);
+
+		std::size_t bodyCount = 0;
+		for (RigidBody2D* rigidBody : m_bodies)
+		{
+			if (rigidBody && rigidBody->GetHandle())
+				bodyCount++;
+		}
+
+		state.Clear(true);
+		state.Resize(StateHeaderSize + bodyCount * StateBodySize + m_persistentContacts.size() * StateContactSize);
+
+		UInt8* ptr = state.GetBuffer();
+		WriteRawValue(ptr, StateMagic);
+		WriteRawValue(ptr, StateVersion);
+		WriteRawValue(ptr, UInt8(sizeof(cpFloat)));
+		WriteRawValue(ptr, UInt32(bodyCount));
+		WriteRawValue(ptr, UInt32(m_persistentContacts.size()));
+		WriteRawValue(ptr, m_timestepAccumulator.AsNanoseconds());
+		WriteRawValue(ptr, m_handle->stamp);
+		WriteRawValue(ptr, m_handle->curr_dt);
+
+		// Bodies are saved in body index order, which doesn't depend on memory addresses
+		for (RigidBody2D* rigidBody : m_bodies)
+		{
+			if (!rigidBody || !rigidBody->GetHandle())
+				continue;
+
+			cpBody* body = rigidBody->GetHandle();
+			cpVect position = cpBodyGetPosition(body);
+			cpVect velocity = cpBodyGetVelocity(body);
+			cpVect force = cpBodyGetForce(body);
+
+			WriteRawValue(ptr, UInt32(rigidBody->GetBodyIndex()));
+			WriteRawValue(ptr, position.x);
+			WriteRawValue(ptr, position.y);
+			WriteRawValue(ptr, velocity.x);
+			WriteRawValue(ptr, velocity.y);
+			WriteRawValue(ptr, force.x);
+			WriteRawValue(ptr, force.y);
+			WriteRawValue(ptr, cpBodyGetAngle(body));
+			WriteRawValue(ptr, cpBodyGetAngularVelocity(body));
+			WriteRawValue(ptr, cpBodyGetTorque(body));
+			WriteRawValue(ptr, body->sleeping.idleTime);
+			WriteRawValue(ptr, UInt8((cpBodyIsSleeping(body)) ? 1 : 0));
+		}
+
+		for (const ContactPair& contact : m_persistentContacts)
+		{
+			WriteRawValue(ptr, contact.firstShape);
+			WriteRawValue(ptr, contact.secondShape);
+			WriteRawValue(ptr, UInt8((contact.isIgnored) ? 1 : 0));
+		}
+
+		// A restored world starts from a reset collision state, do the same here so both continue identically
+		if (m_isDeterministic)
+			ResetCollisionState();
+		else
+			m_persistentContacts.clear();
+	}
+
+	void PhysWorld2D::SetCollisionBias(float collisionBias)
+	{
+		cpSpaceSetCollisionBias(m_handle, collisionBias);
+	}
+
+	void PhysWorld2D::SetCollisionSlop(float collisionSlop)
+	{
+		cpSpaceSetCollisionSlop(m_handle, collisionSlop);
+	}
+
 	void PhysWorld2D::SetDamping(float dampingValue)
 	{
 		cpSpaceSetDamping(m_handle, dampingValue);
@@ -338,6 +814,12 @@ namespace Nz
 
 	void PhysWorld2D::SetSleepTime(Time sleepTime)
 	{
+		m_sleepTime = sleepTime;
+
+		// Sleeping is disabled in deterministic mode, it will be applied if it gets disabled
+		if (m_isDeterministic)
+			return;
+
 		if (sleepTime > Time::Zero())
 			cpSpaceSetSleepTimeThreshold(m_handle, sleepTime.AsSeconds<cpFloat>());
 		else
@@ -349,6 +831,17 @@ namespace Nz
 		m_stepSize = stepSize;
 	}
 
+	void PhysWorld2D::SetThreadCount(unsigned int threadCount)
+	{
+		if (!m_isThreaded)
+		{
+			NazaraError("Physics world was not constructed with a multithreaded solver");
+			return;
+		}
+
+		cpHastySpaceSetThreads(m_handle, threadCount);
+	}
+
 	void PhysWorld2D::Step(Time timestep)
 	{
 		m_timestepAccumulator += timestep;
@@ -361,19 +854,21 @@ namespace Nz
 		{
 			OnPhysWorld2DPreStep(this, invStepCount);
 
-			cpSpaceStep(m_handle, dt);
+			// Bodies mark themselves as active when integrated
+			m_activeBodies.Reset();
+
+			// The hasty solver doesn't process constraints in a fixed order
+			if (m_isThreaded && !m_isDeterministic)
+				cpHastySpaceStep(m_handle, dt);
+			else
+				cpSpaceStep(m_handle, dt);
+
+			// Pairs touching when the collision state was reset have been found again (or have separated)
+			m_persistentContacts.clear();
 
 			OnPhysWorld2DPostStep(this, invStepCount);
 			if (!m_rigidPostSteps.empty())
-			{
-				for (const auto& pair : m_rigidPostSteps)
-				{
-					for (const auto& step : pair.second.funcs)
-						step(pair.first);
-				}
-
-				m_rigidPostSteps.clear();
-			}
+				RunPostSteps();
 
 			m_timestepAccumulator -= m_stepSize;
 		}
@@ -382,6 +877,63 @@ namespace Nz
 	void PhysWorld2D::UseSpatialHash(float cellSize, std::size_t entityCount)
 	{
 		cpSpaceUseSpatialHash(m_handle, cpFloat(cellSize), int(entityCount));
+		m_isUsingSpatialHash = true;
+	}
+
+	void PhysWorld2D::CollectContacts(std::vector<ContactPair>& contacts)
+	{
+		// Contacts of a reset collision state which haven't been found again yet
+		if (&contacts != &m_persistentContacts)
+			contacts = m_persistentContacts;
+
+		auto CollectContact = [](void* element, void* data)
+		{
+			cpArbiter* arbiter = static_cast<cpArbiter*>(element);
+			if (arbiter->state == CP_ARBITER_STATE_CACHED)
+				return;
+
+			UInt64 firstShape = GetShapeKey(arbiter->a);
+			UInt64 secondShape = GetShapeKey(arbiter->b);
+
+			ContactPair& contact = static_cast<std::vector<ContactPair>*>(data)->emplace_back();
+			contact.firstShape = std::min(firstShape, secondShape);
+			contact.secondShape = std::max(firstShape, secondShape);
+			contact.isIgnored = (arbiter->state == CP_ARBITER_STATE_IGNORE);
+		};
+
+		cpHashSetEach(m_handle->cachedArbiters, CollectContact, &contacts);
+
+		std::sort(contacts.begin(), contacts.end(), [](const ContactPair& lhs, const ContactPair& rhs)
+		{
+			return std::tie(lhs.firstShape, lhs.secondShape) < std::tie(rhs.firstShape, rhs.secondShape);
+		});
+	}
+
+	bool PhysWorld2D::FindPersistentContact(const cpArbiter* arbiter, bool* isIgnored) const
+	{
+		UInt64 firstShape = GetShapeKey(arbiter->a);
+		UInt64 secondShape = GetShapeKey(arbiter->b);
+
+		ContactPair key;
+		key.firstShape = std::min(firstShape, secondShape);
+		key.secondShape = std::max(firstShape, secondShape);
+
+		auto it = std::lower_bound(m_persistentContacts.begin(), m_persistentContacts.end(), key, [](const ContactPair& lhs, const ContactPair& rhs)
+		{
+			return std::tie(lhs.firstShape, lhs.secondShape) < std::tie(rhs.firstShape, rhs.secondShape);
+		});
+
+		if (it == m_persistentContacts.end() || it->firstShape != key.firstShape || it->secondShape != key.secondShape)
+			return false;
+
+		*isIgnored = it->isIgnored;
+		return true;
+	}
+
+	unsigned int PhysWorld2D::GetQueryThreadCount() const
+	{
+		// Spatial hash queries update an internal stamp and can't run concurrently, bounding volume trees can (0 means one thread per core)
+		return (m_isUsingSpatialHash) ? 1 : 0;
 	}
 
 	void PhysWorld2D::InitCallbacks(cpCollisionHandler* handler, Callback callbacks)
@@ -399,11 +951,17 @@ namespace Nz
 		{
 			handler->beginFunc = [](cpArbiter* arb, cpSpace* space, void* data) -> cpBool
 			{
+				PhysWorld2D* world = static_cast<PhysWorld2D*>(cpSpaceGetUserData(space));
+
+				// Don't report contacts which were already there before the collision state was reset
+				bool isIgnored;
+				if (!world->m_persistentContacts.empty() && world->FindPersistentContact(arb, &isIgnored))
+					return (isIgnored) ? cpFalse : cpTrue;
+
 				cpBody* firstBody;
 				cpBody* secondBody;
 				cpArbiterGetBodies(arb, &firstBody, &secondBody);
 
-				PhysWorld2D* world = static_cast<PhysWorld2D*>(cpSpaceGetUserData(space));
 				RigidBody2D* firstRigidBody = static_cast<RigidBody2D*>(cpBodyGetUserData(firstBody));
 				RigidBody2D* secondRigidBody = static_cast<RigidBody2D*>(cpBodyGetUserData(secondBody));
 
@@ -428,11 +986,14 @@ namespace Nz
 		{
 			handler->separateFunc = [](cpArbiter* arb, cpSpace* space, void* data)
 			{
+				PhysWorld2D* world = static_cast<PhysWorld2D*>(cpSpaceGetUserData(space));
+				if (world->m_isResettingCollisionState)
+					return;
+
 				cpBody* firstBody;
 				cpBody* secondBody;
 				cpArbiterGetBodies(arb, &firstBody, &secondBody);
 
-				PhysWorld2D* world = static_cast<PhysWorld2D*>(cpSpaceGetUserData(space));
 				RigidBody2D* firstRigidBody = static_cast<RigidBody2D*>(cpBodyGetUserData(firstBody));
 				RigidBody2D* secondRigidBody = static_cast<RigidBody2D*>(cpBodyGetUserData(secondBody));
 
@@ -519,6 +1080,24 @@ namespace Nz
 		m_rigidPostSteps.erase(rigidBody);
 	}
 
+	std::size_t PhysWorld2D::RegisterBody(RigidBody2D* rigidBody)
+	{
+		std::size_t bodyIndex = m_freeBodyIndices.FindFirst();
+		if (bodyIndex != m_freeBodyIndices.npos)
+			m_freeBodyIndices.Reset(bodyIndex);
+		else
+		{
+			bodyIndex = m_freeBodyIndices.GetSize();
+			m_freeBodyIndices.Resize(bodyIndex + 1);
+			m_activeBodies.Resize(bodyIndex + 1);
+			m_bodies.resize(bodyIndex + 1);
+		}
+
+		m_bodies[bodyIndex] = rigidBody;
+
+		return bodyIndex;
+	}
+
 	void PhysWorld2D::RegisterPostStep(RigidBody2D* rigidBody, PostStep&& func)
 	{
 		// If space isn't locked, no need to wait
@@ -540,4 +1119,78 @@ namespace Nz
 
 		it->second.funcs.emplace_back(std::move(func));
 	}
+
+	void PhysWorld2D::ResetCollisionState()
+	{
+		// Remove every shape and add them back in body order, this drops the contact cache and rebuilds spatial indices
+		// so they only depend on body states (contacts ending that way aren't reported)
+		m_isResettingCollisionState = true;
+
+		m_shapeBuffer.clear();
+		for (RigidBody2D* rigidBody : m_bodies)
+		{
+			if (!rigidBody)
+				continue;
+
+			cpBodyEachShape(rigidBody->GetHandle(), [](cpBody* /*body*/, cpShape* shape, void* data)
+			{
+				static_cast<std::vector<cpShape*>*>(data)->push_back(shape);
+			}, &m_shapeBuffer);
+		}
+
+		// Bodies with simulation disabled have their shapes out of the world
+		m_shapeBuffer.erase(std::remove_if(m_shapeBuffer.begin(), m_shapeBuffer.end(), [&](cpShape* shape) { return !cpSpaceContainsShape(m_handle, shape); }), m_shapeBuffer.end());
+		for (cpShape* shape : m_shapeBuffer)
+			cpSpaceRemoveShape(m_handle, shape);
+
+		// Shape ids are used as hashes by spatial indices and the contact cache
+		m_handle->shapeIDCounter = 0;
+		for (cpShape* shape : m_shapeBuffer)
+			cpSpaceAddShape(m_handle, shape);
+
+		m_isResettingCollisionState = false;
+	}
+
+	void PhysWorld2D::RunPostSteps()
+	{
+		if (m_isDeterministic)
+		{
+			// Run post-steps in body order instead of the map order (which depends on addresses)
+			m_postStepBodies.clear();
+			for (const auto& pair : m_rigidPostSteps)
+				m_postStepBodies.push_back(pair.first);
+
+			std::sort(m_postStepBodies.begin(), m_postStepBodies.end(), [](const RigidBody2D* lhs, const RigidBody2D* rhs)
+			{
+				return lhs->GetBodyIndex() < rhs->GetBodyIndex();
+			});
+
+			for (RigidBody2D* rigidBody : m_postStepBodies)
+			{
+				auto it = m_rigidPostSteps.find(rigidBody);
+				if (it == m_rigidPostSteps.end())
+					continue;
+
+				for (const auto& step : it->second.funcs)
+					step(rigidBody);
+			}
+		}
+		else
+		{
+			for (const auto& pair : m_rigidPostSteps)
+			{
+				for (const auto& step : pair.second.funcs)
+					step(pair.first);
+			}
+		}
+
+		m_rigidPostSteps.clear();
+	}
+
+	void PhysWorld2D::UnregisterBody(std::size_t bodyIndex)
+	{
+		m_bodies[bodyIndex] = nullptr;
+		m_activeBodies.Reset(bodyIndex);
+		m_freeBodyIndices.Set(bodyIndex);
+	}
 }
@@ -31,6 +31,7 @@ namespace Nz
 	{
 		NazaraAssert(m_world, "Invalid world");
 
+		m_bodyIndex = m_world->RegisterBody(this);
 		m_handle = Create(mass);
 		SetGeom(std::move(geom));
 	}
@@ -49,6 +50,7 @@ namespace Nz
 		NazaraAssert(m_world, "Invalid world");
 		NazaraAssert(m_geom, "Invalid geometry");
 
+		m_bodyIndex = m_world->RegisterBody(this);
 		m_handle = Create(m_mass, object.GetMomentOfInertia());
 		SetGeom(object.GetGeom(), false, false);
 
@@ -67,6 +69,7 @@ namespace Nz
 	m_positionOffset(std::move(object.m_positionOffset)),
 	m_shapes(std::move(object.m_shapes)),
 	m_geom(std::move(object.m_geom)),
+	m_bodyIndex(object.m_bodyIndex),
 	m_handle(object.m_handle),
 	m_userData(object.m_userData),
 	m_world(object.m_world),
@@ -80,6 +83,10 @@ namespace Nz
 		for (cpShape* shape : m_shapes)
 			cpShapeSetUserData(shape, this);
 
+		if (m_bodyIndex != InvalidBodyIndex)
+			m_world->m_bodies[m_bodyIndex] = this;
+
+		object.m_bodyIndex = InvalidBodyIndex;
 		object.m_handle = nullptr;
 
 		OnRigidBody2DMove(&object, this);
@@ -387,7 +394,7 @@ namespace Nz
 
 			CopyBodyData(m_handle, newHandle);
 
-			Destroy();
+			DestroyHandle();
 
 			m_handle = newHandle;
 		}
@@ -596,6 +603,7 @@ namespace Nz
 		OnRigidBody2DMove    = std::move(object.OnRigidBody2DMove);
 		OnRigidBody2DRelease = std::move(object.OnRigidBody2DRelease);
 
+		m_bodyIndex           = object.m_bodyIndex;
 		m_handle              = object.m_handle;
 		m_isRegistered        = object.m_isRegistered;
 		m_isSimulationEnabled = object.m_isSimulationEnabled;
@@ -616,6 +624,10 @@ namespace Nz
 				cpShapeSetUserData(shape, this);
 		}
 
+		if (m_bodyIndex != InvalidBodyIndex)
+			m_world->m_bodies[m_bodyIndex] = this;
+
+		object.m_bodyIndex = InvalidBodyIndex;
 		object.m_handle = nullptr;
 
 		OnRigidBody2DMove(&object, this);
@@ -625,18 +637,13 @@ namespace Nz
 
 	void RigidBody2D::Destroy()
 	{
-		UnregisterFromSpace();
-
-		for (cpShape* shape : m_shapes)
-			cpShapeFree(shape);
+		DestroyHandle();
 
-		if (m_handle)
+		if (m_bodyIndex != InvalidBodyIndex)
 		{
-			cpBodyFree(m_handle);
-			m_handle = nullptr;
+			m_world->UnregisterBody(m_bodyIndex);
+			m_bodyIndex = InvalidBodyIndex;
 		}
-
-		m_shapes.clear();
 	}
 
 	cpBody* RigidBody2D::Create(float mass, float moment)
@@ -654,9 +661,34 @@ namespace Nz
 
 		cpBodySetUserData(handle, this);
 
+		// Position integration is only done for awake bodies, use it to track bodies moved by a step
+		cpBodySetPositionUpdateFunc(handle, [](cpBody* body, cpFloat dt)
+		{
+			cpBodyUpdatePosition(body, dt);
+
+			RigidBody2D* rigidBody = static_cast<RigidBody2D*>(cpBodyGetUserData(body));
+			rigidBody->m_world->m_activeBodies.Set(rigidBody->m_bodyIndex);
+		});
+
 		return handle;
 	}
 
+	void RigidBody2D::DestroyHandle()
+	{
+		UnregisterFromSpace();
+
+		for (cpShape* shape : m_shapes)
+			cpShapeFree(shape);
+
+		if (m_handle)
+		{
+			cpBodyFree(m_handle);
+			m_handle = nullptr;
+		}
+
+		m_shapes.clear();
+	}
+
 	void RigidBody2D::RegisterToSpace()
 	{
 		if (!m_isRegistered)
@@ -3,26 +3,27 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Physics2D/Systems/Physics2DSystem.hpp>
+#include <Nazara/Core/ParallelFor.hpp>
 #include <Nazara/Utility/Components/NodeComponent.hpp>
 #include <Nazara/Physics2D/Debug.hpp>
 
 namespace Nz
 {
-	namespace
+	Physics2DSystem::Physics2DSystem(entt::registry& registry) :
+	Physics2DSystem(registry, 1)
 	{
-		inline Nz::RadianAnglef AngleFromQuaternion(const Nz::Quaternionf& quat)
-		{
-			float siny_cosp = 2.f * (quat.w * quat.z + quat.x * quat.y);
-			float cosy_cosp = 1.f - 2.f * (quat.y * quat.y + quat.z * quat.z);
-
-			return std::atan2(siny_cosp, cosy_cosp); //<FIXME: not very efficient
-		}
 	}
 
-	Physics2DSystem::Physics2DSystem(entt::registry& registry) :
-	m_registry(registry)
+	Physics2DSystem::Physics2DSystem(entt::registry& registry, unsigned int solverThreadCount) :
+	m_registry(registry),
+	m_physWorld(solverThreadCount),
+	m_stepThreadCount(0),
+	m_isInterpolationEnabled(false)
 	{
-		m_constructConnection = registry.on_construct<RigidBody2DComponent>().connect<OnConstruct>();
+		RegisterRegion(m_physWorld);
+
+		m_constructConnection = registry.on_construct<RigidBody2DComponent>().connect<&Physics2DSystem::OnBodyConstruct>(this);
+		m_destroyConnection = registry.on_destroy<RigidBody2DComponent>().connect<&Physics2DSystem::OnBodyDestroy>(this);
 	}
 
 	Physics2DSystem::~Physics2DSystem()
@@ -33,31 +34,243 @@ namespace Nz
 			rigidBodyComponent.Destroy();
 	}
 
+	PhysWorld2D& Physics2DSystem::AddRegion(unsigned int solverThreadCount)
+	{
+		std::unique_ptr<PhysWorld2D> world = std::make_unique<PhysWorld2D>(solverThreadCount);
+		world->SetDamping(m_physWorld.GetDamping());
+		world->SetGravity(m_physWorld.GetGravity());
+		world->SetIterationCount(m_physWorld.GetIterationCount());
+		world->SetMaxStepCount(m_physWorld.GetMaxStepCount());
+		world->SetStepSize(m_physWorld.GetStepSize());
+
+		Region& region = RegisterRegion(*world);
+		region.ownedWorld = std::move(world);
+
+		return *region.world;
+	}
+
+	void Physics2DSystem::EnableInterpolation(bool enable)
+	{
+		if (m_isInterpolationEnabled == enable)
+			return;
+
+		m_isInterpolationEnabled = enable;
+
+		// Snap bodies back to their last simulated pose (or start interpolating from it)
+		for (auto& regionPtr : m_regions)
+		{
+			Region& region = *regionPtr;
+			for (std::size_t bodyIndex = region.interpolatedBodies.FindFirst(); bodyIndex != region.interpolatedBodies.npos; bodyIndex = region.interpolatedBodies.FindNext(bodyIndex))
+				region.movedBodies.Set(bodyIndex);
+
+			region.interpolatedBodies.Reset();
+
+			for (BodyEntry& entry : region.bodies)
+			{
+				entry.previousPosition = entry.position;
+				entry.previousRotation = entry.rotation;
+			}
+		}
+	}
+
 	void Physics2DSystem::Update(Time elapsedTime)
 	{
-		m_physWorld.Step(elapsedTime);
+		if (m_regions.size() <= 1 || m_stepThreadCount == 1)
+		{
+			for (auto& regionPtr : m_regions)
+				regionPtr->world->Step(elapsedTime);
+		}
+		else
+		{
+			// Regions are independent spaces which can be stepped concurrently (on the persistent ParallelFor threads), their callbacks may be called from any thread
+			ParallelFor(GetRegionCount(), 1, m_stepThreadCount, [&](std::size_t begin, std::size_t end)
+			{
+				for (std::size_t i = begin; i < end; ++i)
+					GetRegion(i).Step(elapsedTime);
+			});
+		}
 
-		// Replicate rigid body position to their node components
-		auto view = m_registry.view<NodeComponent, const RigidBody2DComponent>();
-		for (auto [entity, nodeComponent, rigidBodyComponent] : view.each())
+		// Replicate rigid body position to their node components, only for bodies which moved
+		for (auto& regionPtr : m_regions)
 		{
-			if (rigidBodyComponent.IsSleeping())
-				continue;
+			Region& region = *regionPtr;
+			if (m_isInterpolationEnabled)
+			{
+				float interpolation = region.world->GetInterpolationFactor();
+				for (std::size_t bodyIndex = region.interpolatedBodies.FindFirst(); bodyIndex != region.interpolatedBodies.npos; bodyIndex = region.interpolatedBodies.FindNext(bodyIndex))
+					UpdateNode(region.bodies[bodyIndex], interpolation);
+
+				for (std::size_t bodyIndex = region.movedBodies.FindFirst(); bodyIndex != region.movedBodies.npos; bodyIndex = region.movedBodies.FindNext(bodyIndex))
+				{
+					if (!region.interpolatedBodies.Test(bodyIndex))
+						UpdateNode(region.bodies[bodyIndex], 1.f);
+				}
+			}
+			else
+			{
+				for (std::size_t bodyIndex = region.movedBodies.FindFirst(); bodyIndex != region.movedBodies.npos; bodyIndex = region.movedBodies.FindNext(bodyIndex))
+					UpdateNode(region.bodies[bodyIndex], 1.f);
+			}
 
-			nodeComponent.SetPosition(rigidBodyComponent.GetPosition(), CoordSys::Global);
-			nodeComponent.SetRotation(rigidBodyComponent.GetRotation(), CoordSys::Global);
+			region.movedBodies.Reset();
+		}
+	}
+
+	auto Physics2DSystem::FindRegion(const PhysWorld2D* world) -> Region*
+	{
+		for (auto& regionPtr : m_regions)
+		{
+			if (regionPtr->world == world)
+				return regionPtr.get();
 		}
+
+		return nullptr;
 	}
 
-	void Physics2DSystem::OnConstruct(entt::registry& registry, entt::entity entity)
+	void Physics2DSystem::OnBodyConstruct(entt::registry& registry, entt::entity entity)
 	{
+		RigidBody2DComponent& rigidBody = registry.get<RigidBody2DComponent>(entity);
+
 		// If our entity already has a node component when adding a rigid body, initialize it with its position/rotation
 		NodeComponent* node = registry.try_get<NodeComponent>(entity);
 		if (node)
 		{
-			RigidBody2DComponent& rigidBody = registry.get<RigidBody2DComponent>(entity);
 			rigidBody.SetPosition(Vector2f(node->GetPosition()));
-			rigidBody.SetRotation(AngleFromQuaternion(node->GetRotation()));
+			rigidBody.SetRotation(node->GetRotation().To2DAngle());
+		}
+
+		// Bodies from a world not handled by this system are not synchronized
+		Region* region = FindRegion(rigidBody.GetWorld());
+		std::size_t bodyIndex = rigidBody.GetBodyIndex();
+		if (!region || bodyIndex == RigidBody2D::InvalidBodyIndex)
+			return;
+
+		if (bodyIndex >= region->bodies.size())
+		{
+			region->bodies.resize(bodyIndex + 1);
+			region->interpolatedBodies.Resize(bodyIndex + 1, false);
+			region->movedBodies.Resize(bodyIndex + 1, false);
+		}
+
+		BodyEntry& entry = region->bodies[bodyIndex];
+		entry.entity = entity;
+		entry.position = rigidBody.GetPosition();
+		entry.previousPosition = entry.position;
+		entry.rotation = rigidBody.GetRotation().value;
+		entry.previousRotation = entry.rotation;
+	}
+
+	void Physics2DSystem::OnBodyDestroy(entt::registry& registry, entt::entity entity)
+	{
+		RigidBody2DComponent& rigidBody = registry.get<RigidBody2DComponent>(entity);
+
+		Region* region = FindRegion(rigidBody.GetWorld());
+		std::size_t bodyIndex = rigidBody.GetBodyIndex();
+		if (!region || bodyIndex >= region->bodies.size() || region->bodies[bodyIndex].entity != entity)
+			return;
+
+		region->bodies[bodyIndex].entity = entt::null;
+		region->interpolatedBodies.Reset(bodyIndex);
+		region->movedBodies.Reset(bodyIndex);
+	}
+
+	void Physics2DSystem::OnPostStep(Region& region)
+	{
+		// Called once per substep, possibly from a region thread (only touching this region data)
+		if (m_isInterpolationEnabled)
+		{
+			// Bodies which stopped moving since last substep must stop interpolating from their previous pose
+			const Bitset<UInt64>& activeBodies = region.world->GetActiveBodies();
+			for (std::size_t bodyIndex = region.interpolatedBodies.FindFirst(); bodyIndex != region.interpolatedBodies.npos; bodyIndex = region.interpolatedBodies.FindNext(bodyIndex))
+			{
+				if (bodyIndex < activeBodies.GetSize() && activeBodies.Test(bodyIndex))
+					continue;
+
+				BodyEntry& entry = region.bodies[bodyIndex];
+				entry.previousPosition = entry.position;
+				entry.previousRotation = entry.rotation;
+
+				region.interpolatedBodies.Reset(bodyIndex);
+				region.movedBodies.Set(bodyIndex);
+			}
 		}
+
+		const Bitset<UInt64>& activeBodies = region.world->GetActiveBodies();
+		for (std::size_t bodyIndex = activeBodies.FindFirst(); bodyIndex != activeBodies.npos; bodyIndex = activeBodies.FindNext(bodyIndex))
+		{
+			if (bodyIndex >= region.bodies.size())
+				break;
+
+			BodyEntry& entry = region.bodies[bodyIndex];
+			if (entry.entity == entt::null)
+				continue;
+
+			// Body indices may be reused by rigid bodies not owned by a component, check the body is the one we know
+			const RigidBody2DComponent* rigidBody = m_registry.try_get<RigidBody2DComponent>(entry.entity);
+			if (!rigidBody || rigidBody->GetWorld() != region.world || rigidBody->GetBodyIndex() != bodyIndex)
+				continue;
+
+			entry.previousPosition = entry.position;
+			entry.previousRotation = entry.rotation;
+			entry.position = rigidBody->GetPosition();
+			entry.rotation = rigidBody->GetRotation().value;
+
+			region.movedBodies.Set(bodyIndex);
+			if (m_isInterpolationEnabled)
+				region.interpolatedBodies.Set(bodyIndex);
+		}
+	}
+
+	void Physics2DSystem::OnStateRestored(Region& region)
+	{
+		// Bodies teleported to their restored pose, don't interpolate from their pre-restore pose
+		for (std::size_t bodyIndex = 0; bodyIndex < region.bodies.size(); ++bodyIndex)
+		{
+			BodyEntry& entry = region.bodies[bodyIndex];
+			if (entry.entity == entt::null)
+				continue;
+
+			const RigidBody2DComponent* rigidBody = m_registry.try_get<RigidBody2DComponent>(entry.entity);
+			if (!rigidBody || rigidBody->GetWorld() != region.world || rigidBody->GetBodyIndex() != bodyIndex)
+				continue;
+
+			entry.position = rigidBody->GetPosition();
+			entry.previousPosition = entry.position;
+			entry.rotation = rigidBody->GetRotation().value;
+			entry.previousRotation = entry.rotation;
+
+			region.movedBodies.Set(bodyIndex);
+		}
+
+		region.interpolatedBodies.Reset();
+	}
+
+	auto Physics2DSystem::RegisterRegion(PhysWorld2D& world) -> Region&
+	{
+		std::unique_ptr<Region>& region = m_regions.emplace_back(std::make_unique<Region>());
+		region->world = &world;
+		region->onPostStep.Connect(world.OnPhysWorld2DPostStep, [this, regionPtr = region.get()](const PhysWorld2D* /*physWorld*/, float /*invStepCount*/)
+		{
+			OnPostStep(*regionPtr);
+		});
+
+		region->onStateRestored.Connect(world.OnPhysWorld2DStateRestored, [this, regionPtr = region.get()](const PhysWorld2D* /*physWorld*/)
+		{
+			OnStateRestored(*regionPtr);
+		});
+
+		return *region;
+	}
+
+	void Physics2DSystem::UpdateNode(const BodyEntry& entry, float interpolation)
+	{
+		NodeComponent* node = m_registry.try_get<NodeComponent>(entry.entity);
+		if (!node)
+			return;
+
+		Vector2f position = Vector2f::Lerp(entry.previousPosition, entry.position, interpolation);
+		RadianAnglef rotation(entry.previousRotation + (entry.rotation - entry.previousRotation) * interpolation);
+
+		node->SetTransform(position, rotation.ToQuaternion(), CoordSys::Global);
 	}
 }
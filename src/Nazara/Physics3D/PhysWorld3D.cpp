@@ -3,33 +3,106 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Physics3D/PhysWorld3D.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ParallelFor.hpp>
+#include <Nazara/Physics3D/Collider3D.hpp>
+#include <Nazara/Physics3D/RigidBody3D.hpp>
 #include <Nazara/Utils/StackVector.hpp>
 #include <newton/Newton.h>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <Nazara/Physics3D/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		constexpr std::size_t BatchQueryGrainSize = 64;
+
+		struct RegionQueryContext
+		{
+			RigidBody3D** bodies;
+			std::size_t bodyCount;
+			std::size_t maxBodyCount;
+		};
+
+		template<typename F>
+		void ForEachQueryChunk(std::size_t queryCount, unsigned int threadCount, F&& func)
+		{
+			// Newton queries use per-thread data, ParallelFor worker indices are below threadCount and never shared by concurrent chunks
+			threadCount = std::max(threadCount, 1U);
+
+			ParallelFor(queryCount, BatchQueryGrainSize, threadCount, [&](std::size_t begin, std::size_t end, unsigned int workerIndex)
+			{
+				func(begin, end, static_cast<int>(workerIndex));
+			});
+		}
+
+		float RaycastFirstFilter(const NewtonBody* const body, const NewtonCollision* const /*shapeHit*/, const float* const hitContact, const float* const hitNormal, dLong /*collisionID*/, void* const userData, float intersectParam)
+		{
+			PhysWorld3D::RaycastHit& hitInfo = *static_cast<PhysWorld3D::RaycastHit*>(userData);
+			if (intersectParam < hitInfo.fraction)
+			{
+				hitInfo.fraction = intersectParam;
+				hitInfo.hitBody = static_cast<RigidBody3D*>(NewtonBodyGetUserData(body));
+				hitInfo.hitNormal.Set(hitNormal[0], hitNormal[1], hitNormal[2]);
+				hitInfo.hitPosition.Set(hitContact[0], hitContact[1], hitContact[2]);
+			}
+
+			// Returning the intersection parameter clips the ray, only closer hits are reported afterwards
+			return intersectParam;
+		}
+
+		bool RaycastFirst(NewtonWorld* world, const Vector3f& from, const Vector3f& to, PhysWorld3D::RaycastHit& hitInfo, int threadIndex)
+		{
+			hitInfo.fraction = 1.f;
+			hitInfo.hitBody = nullptr;
+			hitInfo.hitNormal = Vector3f::Zero();
+			hitInfo.hitPosition = to;
+
+			NewtonWorldRayCast(world, &from.x, &to.x, &RaycastFirstFilter, &hitInfo, nullptr, threadIndex);
+
+			return hitInfo.hitBody != nullptr;
+		}
+
+		// Saved states are raw native values so a restored world continues exactly like the saved one
+		constexpr UInt32 StateMagic = 0x4E503344; //< "NP3D"
+		constexpr UInt8 StateVersion = 2;
+		constexpr std::size_t StateHeaderSize = sizeof(UInt32) + sizeof(UInt8) + sizeof(UInt32) + sizeof(Int64);
+		constexpr std::size_t StateBodySize = sizeof(UInt32) + (16 + 3 + 3 + 3 + 3) * sizeof(float) + sizeof(UInt8);
+	}
+
 	PhysWorld3D::PhysWorld3D() :
 	m_maxStepCount(50),
 	m_gravity(Vector3f::Zero()),
 	m_stepSize(Time::TickDuration(120)),
-	m_timestepAccumulator(Time::Zero())
+	m_timestepAccumulator(Time::Zero()),
+	m_isDeterministic(false)
 	{
 		m_world = NewtonCreate();
 		NewtonWorldSetUserData(m_world, this);
 
+		m_threadActiveBodies.resize(1);
+
 		m_materialIds.emplace("default", NewtonMaterialGetDefaultGroupID(m_world));
 	}
 
 	PhysWorld3D::PhysWorld3D(PhysWorld3D&& physWorld) noexcept :
 	m_callbacks(std::move(physWorld.m_callbacks)),
+	m_threadActiveBodies(std::move(physWorld.m_threadActiveBodies)),
+	m_bodies(std::move(physWorld.m_bodies)),
 	m_materialIds(std::move(physWorld.m_materialIds)),
 	m_maxStepCount(std::move(physWorld.m_maxStepCount)),
+	m_activeBodies(std::move(physWorld.m_activeBodies)),
+	m_freeBodyIndices(std::move(physWorld.m_freeBodyIndices)),
 	m_world(std::move(physWorld.m_world)),
 	m_gravity(std::move(physWorld.m_gravity)),
 	m_stepSize(std::move(physWorld.m_stepSize)),
-	m_timestepAccumulator(std::move(physWorld.m_timestepAccumulator))
+	m_timestepAccumulator(std::move(physWorld.m_timestepAccumulator)),
+	m_isDeterministic(physWorld.m_isDeterministic)
 	{
 		NewtonWorldSetUserData(m_world, this);
 	}
@@ -40,6 +113,116 @@ namespace Nz
 			NewtonDestroy(m_world);
 	}
 
+	std::size_t PhysWorld3D::BatchRaycastQueryFirst(const RaycastRequest* requests, std::size_t requestCount, RaycastHit* hitInfos)
+	{
+		NazaraAssert(requestCount == 0 || (requests && hitInfos), "Invalid requests or results");
+
+		std::atomic_size_t hitCount(0);
+		ForEachQueryChunk(requestCount, GetThreadCount(), [&](std::size_t begin, std::size_t end, int threadIndex)
+		{
+			std::size_t localHitCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				if (RaycastFirst(m_world, requests[i].from, requests[i].to, hitInfos[i], threadIndex))
+					localHitCount++;
+			}
+
+			hitCount += localHitCount;
+		});
+
+		return hitCount;
+	}
+
+	std::size_t PhysWorld3D::BatchRegionQuery(const Boxf* boxes, std::size_t boxCount, RigidBody3D** bodies, std::size_t maxBodyPerBox, std::size_t* bodyCounts)
+	{
+		NazaraAssert(boxCount == 0 || (boxes && bodies && bodyCounts), "Invalid boxes or results");
+
+		auto NewtonCallback = [](const NewtonBody* const body, void* const userdata) -> int
+		{
+			RegionQueryContext& context = *static_cast<RegionQueryContext*>(userdata);
+			if (context.bodyCount >= context.maxBodyCount)
+				return 0;
+
+			context.bodies[context.bodyCount++] = static_cast<RigidBody3D*>(NewtonBodyGetUserData(body));
+			return 1;
+		};
+
+		std::atomic_size_t totalBodyCount(0);
+		ForEachQueryChunk(boxCount, GetThreadCount(), [&](std::size_t begin, std::size_t end, int /*threadIndex*/)
+		{
+			std::size_t localBodyCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				// Bodies are written in a fixed-size slice per box, the ones which don't fit are ignored
+				RegionQueryContext context;
+				context.bodies = &bodies[i * maxBodyPerBox];
+				context.bodyCount = 0;
+				context.maxBodyCount = maxBodyPerBox;
+
+				Vector3f min = boxes[i].GetMinimum();
+				Vector3f max = boxes[i].GetMaximum();
+				NewtonWorldForEachBodyInAABBDo(m_world, &min.x, &max.x, NewtonCallback, &context);
+
+				bodyCounts[i] = context.bodyCount;
+				localBodyCount += context.bodyCount;
+			}
+
+			totalBodyCount += localBodyCount;
+		});
+
+		return totalBodyCount;
+	}
+
+	std::size_t PhysWorld3D::BatchSweepQueryFirst(const SweepRequest* requests, std::size_t requestCount, RaycastHit* hitInfos)
+	{
+		NazaraAssert(requestCount == 0 || (requests && hitInfos), "Invalid requests or results");
+
+		// Collision handles are lazily created per world, resolve them before going wide
+		std::vector<NewtonCollision*> collisions;
+		collisions.reserve(requestCount);
+		for (std::size_t i = 0; i < requestCount; ++i)
+		{
+			NazaraAssert(requests[i].collider, "Invalid collider");
+			collisions.push_back(requests[i].collider->GetHandle(this));
+		}
+
+		std::atomic_size_t hitCount(0);
+		ForEachQueryChunk(requestCount, GetThreadCount(), [&](std::size_t begin, std::size_t end, int threadIndex)
+		{
+			std::size_t localHitCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const SweepRequest& request = requests[i];
+				RaycastHit& hitInfo = hitInfos[i];
+
+				Matrix4f matrix = Matrix4f::Transform(request.from, request.rotation);
+
+				float param;
+				NewtonWorldConvexCastReturnInfo contact;
+				if (NewtonWorldConvexCast(m_world, &matrix.m11, &request.to.x, collisions[i], &param, nullptr, nullptr, &contact, 1, threadIndex) > 0)
+				{
+					hitInfo.fraction = param;
+					hitInfo.hitBody = static_cast<RigidBody3D*>(NewtonBodyGetUserData(contact.m_hitBody));
+					hitInfo.hitNormal.Set(contact.m_normal[0], contact.m_normal[1], contact.m_normal[2]);
+					hitInfo.hitPosition.Set(contact.m_point[0], contact.m_point[1], contact.m_point[2]);
+
+					localHitCount++;
+				}
+				else
+				{
+					hitInfo.fraction = 1.f;
+					hitInfo.hitBody = nullptr;
+					hitInfo.hitNormal = Vector3f::Zero();
+					hitInfo.hitPosition = request.to;
+				}
+			}
+
+			hitCount += localHitCount;
+		});
+
+		return hitCount;
+	}
+
 	int PhysWorld3D::CreateMaterial(std::string name)
 	{
 		NazaraAssert(m_materialIds.find(name) == m_materialIds.end(), "Material \"" + name + "\" already exists");
@@ -50,6 +233,11 @@ namespace Nz
 		return materialId;
 	}
 
+	void PhysWorld3D::EnableDeterminism(bool enable)
+	{
+		m_isDeterministic = enable;
+	}
+
 	void PhysWorld3D::ForEachBodyInAABB(const Boxf& box, const BodyIterator& iterator)
 	{
 		auto NewtonCallback = [](const NewtonBody* const body, void* const userdata) -> int
@@ -63,6 +251,11 @@ namespace Nz
 		NewtonWorldForEachBodyInAABBDo(m_world, &min.x, &max.x, NewtonCallback, const_cast<void*>(static_cast<const void*>(&iterator)));
 	}
 
+	const Bitset<UInt64>& PhysWorld3D::GetActiveBodies() const
+	{
+		return m_activeBodies;
+	}
+
 	Vector3f PhysWorld3D::GetGravity() const
 	{
 		return m_gravity;
@@ -73,6 +266,11 @@ namespace Nz
 		return m_world;
 	}
 
+	float PhysWorld3D::GetInterpolationFactor() const
+	{
+		return std::min(m_timestepAccumulator.AsSeconds<float>() / m_stepSize.AsSeconds<float>(), 1.f);
+	}
+
 	int PhysWorld3D::GetMaterial(const std::string& name)
 	{
 		auto it = m_materialIds.find(name);
@@ -96,6 +294,138 @@ namespace Nz
 		return NewtonGetThreadsCount(m_world);
 	}
 
+	bool PhysWorld3D::IsDeterminismEnabled() const
+	{
+		return m_isDeterministic;
+	}
+
+	bool PhysWorld3D::RaycastQueryFirst(const Vector3f& from, const Vector3f& to, RaycastHit* hitInfo)
+	{
+		RaycastHit localHitInfo;
+		return RaycastFirst(m_world, from, to, (hitInfo) ? *hitInfo : localHitInfo, 0);
+	}
+
+	bool PhysWorld3D::RestoreState(const ByteArray& state)
+	{
+		const UInt8* ptr = state.GetConstBuffer();
+		if (state.GetSize() < StateHeaderSize || ReadRawValue<UInt32>(ptr) != StateMagic)
+		{
+			NazaraError("invalid physics state");
+			return false;
+		}
+
+		UInt8 version = ReadRawValue<UInt8>(ptr);
+		if (version != StateVersion)
+		{
+			NazaraError("unsupported physics state version (" + std::to_string(version) + ")");
+			return false;
+		}
+
+		UInt32 bodyCount = ReadRawValue<UInt32>(ptr);
+		if (state.GetSize() != StateHeaderSize + bodyCount * StateBodySize)
+		{
+			NazaraError("corrupted physics state");
+			return false;
+		}
+
+		Int64 timestepAccumulator = ReadRawValue<Int64>(ptr);
+
+		// Check every body still exists before touching the world
+		const UInt8* bodyData = ptr;
+		for (UInt32 i = 0; i < bodyCount; ++i)
+		{
+			const UInt8* bodyPtr = bodyData + i * StateBodySize;
+			UInt32 bodyIndex = ReadRawValue<UInt32>(bodyPtr);
+			if (bodyIndex >= m_bodies.size() || !m_bodies[bodyIndex])
+			{
+				NazaraError("physics state references body #" + std::to_string(bodyIndex) + " which doesn't exist");
+				return false;
+			}
+		}
+
+		m_timestepAccumulator = Time::Nanoseconds(timestepAccumulator);
+
+		for (UInt32 i = 0; i < bodyCount; ++i)
+		{
+			UInt32 bodyIndex = ReadRawValue<UInt32>(ptr);
+
+			float matrix[16];
+			float velocity[3];
+			float omega[3];
+			ReadRawValues(ptr, matrix, 16);
+			ReadRawValues(ptr, velocity, 3);
+			ReadRawValues(ptr, omega, 3);
+
+			RigidBody3D* rigidBody = m_bodies[bodyIndex];
+			ReadRawValues(ptr, &rigidBody->m_forceAccumulator.x, 3);
+			ReadRawValues(ptr, &rigidBody->m_torqueAccumulator.x, 3);
+
+			bool isSleeping = ReadRawValue<UInt8>(ptr) != 0;
+
+			NewtonBody* body = rigidBody->GetHandle();
+			NewtonBodySetMatrix(body, matrix);
+			NewtonBodySetVelocity(body, velocity);
+			NewtonBodySetOmega(body, omega);
+			NewtonBodySetSleepState(body, (isSleeping) ? 1 : 0);
+
+			m_activeBodies.Set(bodyIndex);
+		}
+
+		// Drop contacts and cached solver data, they would otherwise depend on what happened since the save
+		NewtonInvalidateCache(m_world);
+
+		OnPhysWorld3DStateRestored(this);
+
+		return true;
+	}
+
+	void PhysWorld3D::SaveState(ByteArray& state)
+	{
+		std::size_t bodyCount = 0;
+		for (RigidBody3D* rigidBody : m_bodies)
+		{
+			if (rigidBody)
+				bodyCount++;
+		}
+
+		state.Clear(true);
+		state.Resize(StateHeaderSize + bodyCount * StateBodySize);
+
+		UInt8* ptr = state.GetBuffer();
+		WriteRawValue(ptr, StateMagic);
+		WriteRawValue(ptr, StateVersion);
+		WriteRawValue(ptr, UInt32(bodyCount));
+		WriteRawValue(ptr, m_timestepAccumulator.AsNanoseconds());
+
+		// Bodies are saved in body index order, which doesn't depend on memory addresses
+		for (RigidBody3D* rigidBody : m_bodies)
+		{
+			if (!rigidBody)
+				continue;
+
+			NewtonBody* body = rigidBody->GetHandle();
+
+			float matrix[16];
+			float velocity[3];
+			float omega[3];
+			NewtonBodyGetMatrix(body, matrix);
+			NewtonBodyGetVelocity(body, velocity);
+			NewtonBodyGetOmega(body, omega);
+
+			WriteRawValue(ptr, UInt32(rigidBody->GetBodyIndex()));
+			WriteRawValues(ptr, matrix, 16);
+			WriteRawValues(ptr, velocity, 3);
+			WriteRawValues(ptr, omega, 3);
+			WriteRawValues(ptr, &rigidBody->m_forceAccumulator.x, 3);
+			WriteRawValues(ptr, &rigidBody->m_torqueAccumulator.x, 3);
+			WriteRawValue(ptr, UInt8((NewtonBodyGetSleepState(body) != 0) ? 1 : 0));
+		}
+
+		// A restored world starts with an empty cache, do the same here so both continue identically
+		if (m_isDeterministic)
+			NewtonInvalidateCache(m_world);
+	}
+
 	void PhysWorld3D::SetGravity(const Vector3f& gravity)
 	{
 		m_gravity = gravity;
@@ -163,14 +493,33 @@ namespace Nz
 	{
 		m_timestepAccumulator += timestep;
 
-		std::size_t stepCount = 0;
-		float dt = m_stepSize.AsSeconds<float>();
+		std::size_t stepCount = std::min(static_cast<std::size_t>(static_cast<Int64>(m_timestepAccumulator / m_stepSize)), m_maxStepCount);
+		float invStepCount = 1.f / stepCount;
 
-		while (m_timestepAccumulator >= m_stepSize && stepCount < m_maxStepCount)
+		// Transform callbacks can be called from any Newton thread, each one tracks the bodies it moved in its own list
+		m_threadActiveBodies.resize(std::max(GetThreadCount(), 1U));
+
+		float dt = m_stepSize.AsSeconds<float>();
+		for (std::size_t i = 0; i < stepCount; ++i)
 		{
 			NewtonUpdate(m_world, dt);
+
+			m_activeBodies.Reset();
+			for (std::vector<std::size_t>& activeBodies : m_threadActiveBodies)
+			{
+				for (std::size_t bodyIndex : activeBodies)
+				{
+					// Body may have been destroyed during the step
+					if (!m_freeBodyIndices.Test(bodyIndex))
+						m_activeBodies.Set(bodyIndex);
+				}
+
+				activeBodies.clear();
+			}
+
+			OnPhysWorld3DPostStep(this, invStepCount);
+
 			m_timestepAccumulator -= m_stepSize;
-			stepCount++;
 		}
 	}
 
@@ -180,18 +529,54 @@ namespace Nz
 			NewtonDestroy(m_world);
 
 		m_callbacks = std::move(physWorld.m_callbacks);
+		m_threadActiveBodies = std::move(physWorld.m_threadActiveBodies);
+		m_bodies = std::move(physWorld.m_bodies);
 		m_materialIds = std::move(physWorld.m_materialIds);
 		m_maxStepCount = std::move(physWorld.m_maxStepCount);
+		m_activeBodies = std::move(physWorld.m_activeBodies);
+		m_freeBodyIndices = std::move(physWorld.m_freeBodyIndices);
 		m_world = std::move(physWorld.m_world);
 		m_gravity = std::move(physWorld.m_gravity);
 		m_stepSize = std::move(physWorld.m_stepSize);
 		m_timestepAccumulator = std::move(physWorld.m_timestepAccumulator);
+		m_isDeterministic = physWorld.m_isDeterministic;
 
 		NewtonWorldSetUserData(m_world, this);
 
 		return *this;
 	}
 
+	void PhysWorld3D::MarkBodyAsActive(std::size_t bodyIndex, int threadIndex)
+	{
+		assert(threadIndex >= 0 && static_cast<std::size_t>(threadIndex) < m_threadActiveBodies.size());
+		m_threadActiveBodies[threadIndex].push_back(bodyIndex);
+	}
+
+	std::size_t PhysWorld3D::RegisterBody(RigidBody3D* rigidBody)
+	{
+		std::size_t bodyIndex = m_freeBodyIndices.FindFirst();
+		if (bodyIndex != m_freeBodyIndices.npos)
+			m_freeBodyIndices.Reset(bodyIndex);
+		else
+		{
+			bodyIndex = m_freeBodyIndices.GetSize();
+			m_freeBodyIndices.Resize(bodyIndex + 1);
+			m_activeBodies.Resize(bodyIndex + 1);
+			m_bodies.resize(bodyIndex + 1);
+		}
+
+		m_bodies[bodyIndex] = rigidBody;
+
+		return bodyIndex;
+	}
+
+	void PhysWorld3D::UnregisterBody(std::size_t bodyIndex)
+	{
+		m_bodies[bodyIndex] = nullptr;
+		m_activeBodies.Reset(bodyIndex);
+		m_freeBodyIndices.Set(bodyIndex);
+	}
+
 	int PhysWorld3D::OnAABBOverlap(const NewtonJoint* const contactJoint, float /*timestep*/, int /*threadIndex*/)
 	{
 		RigidBody3D* bodyA = static_cast<RigidBody3D*>(NewtonBodyGetUserData(NewtonJointGetBody0(contactJoint)));
@@ -30,8 +30,10 @@ namespace Nz
 		if (!m_geom)
 			m_geom = std::make_shared<NullCollider3D>();
 
+		m_bodyIndex = m_world->RegisterBody(this);
 		m_body = NewtonCreateDynamicBody(m_world->GetHandle(), m_geom->GetHandle(m_world), &mat.m11);
 		NewtonBodySetUserData(m_body, this);
+		NewtonBodySetTransformCallback(m_body, &TransformCallback);
 	}
 
 	RigidBody3D::RigidBody3D(const RigidBody3D& object) :
@@ -48,8 +50,10 @@ namespace Nz
 		std::array<float, 16> transformMatrix;
 		NewtonBodyGetMatrix(object.GetHandle(), transformMatrix.data());
 
+		m_bodyIndex = m_world->RegisterBody(this);
 		m_body = NewtonCreateDynamicBody(m_world->GetHandle(), m_geom->GetHandle(m_world), transformMatrix.data());
 		NewtonBodySetUserData(m_body, this);
+		NewtonBodySetTransformCallback(m_body, &TransformCallback);
 
 		SetMass(object.m_mass);
 		SetAngularDamping(object.GetAngularDamping());
@@ -63,6 +67,7 @@ namespace Nz
 
 	RigidBody3D::RigidBody3D(RigidBody3D&& object) noexcept :
 	m_geom(std::move(object.m_geom)),
+	m_bodyIndex(object.m_bodyIndex),
 	m_body(std::move(object.m_body)),
 	m_forceAccumulator(std::move(object.m_forceAccumulator)),
 	m_torqueAccumulator(std::move(object.m_torqueAccumulator)),
@@ -70,6 +75,11 @@ namespace Nz
 	m_gravityFactor(object.m_gravityFactor),
 	m_mass(object.m_mass)
 	{
+		if (m_bodyIndex != InvalidBodyIndex)
+			m_world->m_bodies[m_bodyIndex] = this;
+
+		object.m_bodyIndex = InvalidBodyIndex;
+
 		if (m_body)
 			NewtonBodySetUserData(m_body, this);
 	}
@@ -168,6 +178,11 @@ namespace Nz
 		return angularVelocity;
 	}
 
+	std::size_t RigidBody3D::GetBodyIndex() const
+	{
+		return m_bodyIndex;
+	}
+
 	const std::shared_ptr<Collider3D>& RigidBody3D::GetGeom() const
 	{
 		return m_geom;
@@ -400,10 +415,10 @@ namespace Nz
 
 	RigidBody3D& RigidBody3D::operator=(RigidBody3D&& object) noexcept
 	{
-		if (m_body)
-			NewtonDestroyBody(m_body);
+		Destroy();
 
 		m_body               = std::move(object.m_body);
+		m_bodyIndex          = object.m_bodyIndex;
 		m_forceAccumulator   = std::move(object.m_forceAccumulator);
 		m_geom               = std::move(object.m_geom);
 		m_gravityFactor      = object.m_gravityFactor;
@@ -411,6 +426,11 @@ namespace Nz
 		m_torqueAccumulator  = std::move(object.m_torqueAccumulator);
 		m_world              = object.m_world;
 
+		if (m_bodyIndex != InvalidBodyIndex)
+			m_world->m_bodies[m_bodyIndex] = this;
+
+		object.m_bodyIndex = InvalidBodyIndex;
+
 		if (m_body)
 			NewtonBodySetUserData(m_body, this);
 
@@ -425,6 +445,12 @@ namespace Nz
 			m_body = nullptr;
 		}
 
+		if (m_bodyIndex != InvalidBodyIndex)
+		{
+			m_world->UnregisterBody(m_bodyIndex);
+			m_bodyIndex = InvalidBodyIndex;
+		}
+
 		m_geom.reset();
 	}
 
@@ -467,4 +493,13 @@ namespace Nz
 
 		///TODO: Implement gyroscopic force?
 	}
+
+	void RigidBody3D::TransformCallback(const NewtonBody* body, const float* matrix, int threadIndex)
+	{
+		NazaraUnused(matrix);
+
+		// Only called for bodies moved by the simulation, possibly from a worker thread
+		RigidBody3D* me = static_cast<RigidBody3D*>(NewtonBodyGetUserData(body));
+		me->m_world->MarkBodyAsActive(me->m_bodyIndex, threadIndex);
+	}
 }
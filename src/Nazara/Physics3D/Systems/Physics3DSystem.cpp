@@ -9,9 +9,21 @@
 namespace Nz
 {
 	Physics3DSystem::Physics3DSystem(entt::registry& registry) :
-	m_registry(registry)
+	m_registry(registry),
+	m_isInterpolationEnabled(false)
 	{
-		m_constructConnection = registry.on_construct<RigidBody3DComponent>().connect<OnConstruct>();
+		m_constructConnection = registry.on_construct<RigidBody3DComponent>().connect<&Physics3DSystem::OnBodyConstruct>(this);
+		m_destroyConnection = registry.on_destroy<RigidBody3DComponent>().connect<&Physics3DSystem::OnBodyDestroy>(this);
+
+		m_onPostStep.Connect(m_physWorld.OnPhysWorld3DPostStep, [this](const PhysWorld3D* /*physWorld*/, float /*invStepCount*/)
+		{
+			OnPostStep();
+		});
+
+		m_onStateRestored.Connect(m_physWorld.OnPhysWorld3DStateRestored, [this](const PhysWorld3D* /*physWorld*/)
+		{
+			OnStateRestored();
+		});
 	}
 
 	Physics3DSystem::~Physics3DSystem()
@@ -22,31 +34,176 @@ namespace Nz
 			rigidBodyComponent.Destroy();
 	}
 
+	void Physics3DSystem::EnableInterpolation(bool enable)
+	{
+		if (m_isInterpolationEnabled == enable)
+			return;
+
+		m_isInterpolationEnabled = enable;
+
+		// Snap bodies back to their last simulated pose (or start interpolating from it)
+		for (std::size_t bodyIndex = m_interpolatedBodies.FindFirst(); bodyIndex != m_interpolatedBodies.npos; bodyIndex = m_interpolatedBodies.FindNext(bodyIndex))
+			m_movedBodies.Set(bodyIndex);
+
+		m_interpolatedBodies.Reset();
+
+		for (BodyEntry& entry : m_bodies)
+		{
+			entry.previousPosition = entry.position;
+			entry.previousRotation = entry.rotation;
+		}
+	}
+
 	void Physics3DSystem::Update(Time elapsedTime)
 	{
 		m_physWorld.Step(elapsedTime);
 
-		// Replicate rigid body position to their node components
-		auto view = m_registry.view<NodeComponent, const RigidBody3DComponent>();
-		for (auto [entity, nodeComponent, rigidBodyComponent] : view.each())
+		// Replicate rigid body position to their node components, only for bodies which moved
+		if (m_isInterpolationEnabled)
 		{
-			if (rigidBodyComponent.IsSleeping())
-				continue;
+			float interpolation = m_physWorld.GetInterpolationFactor();
+			for (std::size_t bodyIndex = m_interpolatedBodies.FindFirst(); bodyIndex != m_interpolatedBodies.npos; bodyIndex = m_interpolatedBodies.FindNext(bodyIndex))
+				UpdateNode(m_bodies[bodyIndex], interpolation);
 
-			nodeComponent.SetPosition(rigidBodyComponent.GetPosition(), CoordSys::Global);
-			nodeComponent.SetRotation(rigidBodyComponent.GetRotation(), CoordSys::Global);
+			for (std::size_t bodyIndex = m_movedBodies.FindFirst(); bodyIndex != m_movedBodies.npos; bodyIndex = m_movedBodies.FindNext(bodyIndex))
+			{
+				if (!m_interpolatedBodies.Test(bodyIndex))
+					UpdateNode(m_bodies[bodyIndex], 1.f);
+			}
+		}
+		else
+		{
+			for (std::size_t bodyIndex = m_movedBodies.FindFirst(); bodyIndex != m_movedBodies.npos; bodyIndex = m_movedBodies.FindNext(bodyIndex))
+				UpdateNode(m_bodies[bodyIndex], 1.f);
 		}
+
+		m_movedBodies.Reset();
 	}
 
-	void Physics3DSystem::OnConstruct(entt::registry& registry, entt::entity entity)
+	void Physics3DSystem::OnBodyConstruct(entt::registry& registry, entt::entity entity)
 	{
+		RigidBody3DComponent& rigidBody = registry.get<RigidBody3DComponent>(entity);
+
 		// If our entity already has a node component when adding a rigid body, initialize it with its position/rotation
 		NodeComponent* node = registry.try_get<NodeComponent>(entity);
 		if (node)
 		{
-			RigidBody3DComponent& rigidBody = registry.get<RigidBody3DComponent>(entity);
 			rigidBody.SetPosition(node->GetPosition());
 			rigidBody.SetRotation(node->GetRotation());
 		}
+
+		// Bodies from another world are not synchronized
+		std::size_t bodyIndex = rigidBody.GetBodyIndex();
+		if (rigidBody.GetWorld() != &m_physWorld || bodyIndex == RigidBody3D::InvalidBodyIndex)
+			return;
+
+		if (bodyIndex >= m_bodies.size())
+		{
+			m_bodies.resize(bodyIndex + 1);
+			m_interpolatedBodies.Resize(bodyIndex + 1, false);
+			m_movedBodies.Resize(bodyIndex + 1, false);
+		}
+
+		BodyEntry& entry = m_bodies[bodyIndex];
+		entry.entity = entity;
+		entry.position = rigidBody.GetPosition();
+		entry.previousPosition = entry.position;
+		entry.rotation = rigidBody.GetRotation();
+		entry.previousRotation = entry.rotation;
+	}
+
+	void Physics3DSystem::OnBodyDestroy(entt::registry& registry, entt::entity entity)
+	{
+		RigidBody3DComponent& rigidBody = registry.get<RigidBody3DComponent>(entity);
+
+		std::size_t bodyIndex = rigidBody.GetBodyIndex();
+		if (rigidBody.GetWorld() != &m_physWorld || bodyIndex >= m_bodies.size() || m_bodies[bodyIndex].entity != entity)
+			return;
+
+		m_bodies[bodyIndex].entity = entt::null;
+		m_interpolatedBodies.Reset(bodyIndex);
+		m_movedBodies.Reset(bodyIndex);
+	}
+
+	void Physics3DSystem::OnPostStep()
+	{
+		const Bitset<UInt64>& activeBodies = m_physWorld.GetActiveBodies();
+
+		if (m_isInterpolationEnabled)
+		{
+			// Bodies which stopped moving since last substep must stop interpolating from their previous pose
+			for (std::size_t bodyIndex = m_interpolatedBodies.FindFirst(); bodyIndex != m_interpolatedBodies.npos; bodyIndex = m_interpolatedBodies.FindNext(bodyIndex))
+			{
+				if (bodyIndex < activeBodies.GetSize() && activeBodies.Test(bodyIndex))
+					continue;
+
+				BodyEntry& entry = m_bodies[bodyIndex];
+				entry.previousPosition = entry.position;
+				entry.previousRotation = entry.rotation;
+
+				m_interpolatedBodies.Reset(bodyIndex);
+				m_movedBodies.Set(bodyIndex);
+			}
+		}
+
+		for (std::size_t bodyIndex = activeBodies.FindFirst(); bodyIndex != activeBodies.npos; bodyIndex = activeBodies.FindNext(bodyIndex))
+		{
+			if (bodyIndex >= m_bodies.size())
+				break;
+
+			BodyEntry& entry = m_bodies[bodyIndex];
+			if (entry.entity == entt::null)
+				continue;
+
+			// Body indices may be reused by rigid bodies not owned by a component, check the body is the one we know
+			const RigidBody3DComponent* rigidBody = m_registry.try_get<RigidBody3DComponent>(entry.entity);
+			if (!rigidBody || rigidBody->GetWorld() != &m_physWorld || rigidBody->GetBodyIndex() != bodyIndex)
+				continue;
+
+			entry.previousPosition = entry.position;
+			entry.previousRotation = entry.rotation;
+			entry.position = rigidBody->GetPosition();
+			entry.rotation = rigidBody->GetRotation();
+
+			m_movedBodies.Set(bodyIndex);
+			if (m_isInterpolationEnabled)
+				m_interpolatedBodies.Set(bodyIndex);
+		}
+	}
+
+	void Physics3DSystem::OnStateRestored()
+	{
+		// Bodies teleported to their restored pose, don't interpolate from their pre-restore pose
+		for (std::size_t bodyIndex = 0; bodyIndex < m_bodies.size(); ++bodyIndex)
+		{
+			BodyEntry& entry = m_bodies[bodyIndex];
+			if (entry.entity == entt::null)
+				continue;
+
+			const RigidBody3DComponent* rigidBody = m_registry.try_get<RigidBody3DComponent>(entry.entity);
+			if (!rigidBody || rigidBody->GetWorld() != &m_physWorld || rigidBody->GetBodyIndex() != bodyIndex)
+				continue;
+
+			entry.position = rigidBody->GetPosition();
+			entry.previousPosition = entry.position;
+			entry.rotation = rigidBody->GetRotation();
+			entry.previousRotation = entry.rotation;
+
+			m_movedBodies.Set(bodyIndex);
+		}
+
+		m_interpolatedBodies.Reset();
+	}
+
+	void Physics3DSystem::UpdateNode(const BodyEntry& entry, float interpolation)
+	{
+		NodeComponent* node = m_registry.try_get<NodeComponent>(entry.entity);
+		if (!node)
+			return;
+
+		Vector3f position = Vector3f::Lerp(entry.previousPosition, entry.position, interpolation);
+		Quaternionf rotation = Quaternionf::Slerp(entry.previousRotation, entry.rotation, interpolation);
+
+		node->SetTransform(position, rotation, CoordSys::Global);
 	}
 }
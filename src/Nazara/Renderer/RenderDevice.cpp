@@ -11,6 +11,18 @@ namespace Nz
 {
 	RenderDevice::~RenderDevice() = default;
 
+	bool RenderDevice::GetPipelineCacheData(ByteArray& /*data*/) const
+	{
+		// Backend doesn't support retrieving compiled pipelines
+		return false;
+	}
+
+	std::optional<ShaderLanguage> RenderDevice::GetShaderBinaryLanguage() const
+	{
+		// Backend compiles shaders when building pipelines, shader modules can't be cached
+		return std::nullopt;
+	}
+
 	std::shared_ptr<ShaderModule> RenderDevice::InstantiateShaderModule(nzsl::ShaderStageTypeFlags shaderStages, ShaderLanguage lang, const std::filesystem::path& sourcePath, const nzsl::ShaderWriter::States& states)
 	{
 		File file(sourcePath);
@@ -32,6 +44,11 @@ namespace Nz
 		return InstantiateShaderModule(shaderStages, lang, source.data(), source.size(), states);
 	}
 
+	bool RenderDevice::LoadPipelineCacheData(const void* /*data*/, std::size_t /*size*/)
+	{
+		return false;
+	}
+
 	void RenderDevice::ValidateFeatures(const RenderDeviceFeatures& supportedFeatures, RenderDeviceFeatures& enabledFeatures)
 	{
 #define NzValidateFeature(field, name) \
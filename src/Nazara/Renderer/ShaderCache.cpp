@@ -0,0 +1,312 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Renderer/ShaderCache.hpp>
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Utils/TypeTraits.hpp>
+#include <NZSL/Serializer.hpp>
+#include <NZSL/SpirvWriter.hpp>
+#include <NZSL/Ast/AstSerializer.hpp>
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <vector>
+#include <Nazara/Renderer/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr UInt32 CacheMagic = 0x4E5A5343; //< "NZSC"
+
+#ifdef NAZARA_RENDERER_NZSL_VERSION
+		constexpr std::string_view CompilerVersion = NAZARA_RENDERER_NZSL_VERSION;
+#else
+		// Version is unknown, use the build date so binaries compiled by an older build are never reused
+		constexpr std::string_view CompilerVersion = __DATE__ " " __TIME__;
+#endif
+
+		class KeyBuilder
+		{
+			public:
+				KeyBuilder() :
+				m_hash(AbstractHash::Get(HashType::SHA256))
+				{
+					m_hash->Begin();
+				}
+
+				void Append(const void* data, std::size_t size)
+				{
+					m_hash->Append(static_cast<const UInt8*>(data), size);
+				}
+
+				template<typename T>
+				void Append(const T& value)
+				{
+					static_assert(std::is_trivially_copyable_v<T>);
+					Append(&value, sizeof(T));
+				}
+
+				UInt64 End()
+				{
+					ByteArray digest = m_hash->End();
+
+					UInt64 key;
+					std::memcpy(&key, digest.GetConstBuffer(), sizeof(key));
+
+					return key;
+				}
+
+			private:
+				std::unique_ptr<AbstractHash> m_hash;
+		};
+	}
+
+	void ShaderCache::Clear()
+	{
+		std::unique_lock lock(m_mutex);
+
+		m_entries.clear();
+		m_isModified = true;
+	}
+
+	bool ShaderCache::Find(UInt64 key, ByteArray* data) const
+	{
+		std::shared_lock lock(m_mutex);
+
+		auto it = m_entries.find(key);
+		if (it == m_entries.end())
+			return false;
+
+		if (data)
+			*data = it->second;
+
+		return true;
+	}
+
+	std::size_t ShaderCache::GetEntryCount() const
+	{
+		std::shared_lock lock(m_mutex);
+		return m_entries.size();
+	}
+
+	void ShaderCache::Insert(UInt64 key, ByteArray data)
+	{
+		std::unique_lock lock(m_mutex);
+
+		m_entries[key] = std::move(data);
+		m_isModified = true;
+	}
+
+	bool ShaderCache::IsModified() const
+	{
+		std::shared_lock lock(m_mutex);
+		return m_isModified;
+	}
+
+	bool ShaderCache::Load(const std::filesystem::path& filePath)
+	{
+		File file(filePath);
+		if (!file.Open(OpenMode::ReadOnly))
+		{
+			NazaraError("failed to open shader cache " + filePath.generic_u8string());
+			return false;
+		}
+
+		std::vector<UInt8> content(static_cast<std::size_t>(file.GetSize()));
+		if (file.Read(content.data(), content.size()) != content.size())
+		{
+			NazaraError("failed to read shader cache " + filePath.generic_u8string());
+			return false;
+		}
+
+		const UInt8* ptr = content.data();
+		const UInt8* end = content.data() + content.size();
+		auto Read = [&](void* data, std::size_t size)
+		{
+			if (std::size_t(end - ptr) < size)
+				return false;
+
+			std::memcpy(data, ptr, size);
+			ptr += size;
+			return true;
+		};
+
+		UInt32 magic;
+		UInt32 version;
+		UInt32 entryCount;
+		if (!Read(&magic, sizeof(magic)) || magic != CacheMagic || !Read(&version, sizeof(version)) || !Read(&entryCount, sizeof(entryCount)))
+		{
+			NazaraError(filePath.generic_u8string() + " is not a shader cache");
+			return false;
+		}
+
+		// Entries produced by another version may not be valid anymore, start from scratch
+		if (version != FormatVersion)
+		{
+			NazaraWarning("ignoring shader cache " + filePath.generic_u8string() + " (version " + std::to_string(version) + " is outdated)");
+			return false;
+		}
+
+		std::unordered_map<UInt64, ByteArray> entries;
+		entries.reserve(entryCount);
+		for (UInt32 i = 0; i < entryCount; ++i)
+		{
+			UInt64 key;
+			UInt32 size;
+			if (!Read(&key, sizeof(key)) || !Read(&size, sizeof(size)) || std::size_t(end - ptr) < size)
+			{
+				NazaraError("shader cache " + filePath.generic_u8string() + " is corrupted");
+				return false;
+			}
+
+			entries[key] = ByteArray(ptr, size);
+			ptr += size;
+		}
+
+		std::unique_lock lock(m_mutex);
+		for (auto&& [key, data] : entries)
+			m_entries.insert_or_assign(key, std::move(data));
+
+		return true;
+	}
+
+	bool ShaderCache::Save(const std::filesystem::path& filePath)
+	{
+		std::unique_lock lock(m_mutex);
+
+		File file(filePath);
+		if (!file.Open(OpenMode::WriteOnly | OpenMode::Truncate))
+		{
+			NazaraError("failed to open shader cache " + filePath.generic_u8string() + " for writing");
+			return false;
+		}
+
+		auto Write = [&](const void* data, std::size_t size)
+		{
+			return file.Write(data, size) == size;
+		};
+
+		UInt32 entryCount = static_cast<UInt32>(m_entries.size());
+		bool success = Write(&CacheMagic, sizeof(CacheMagic)) && Write(&FormatVersion, sizeof(FormatVersion)) && Write(&entryCount, sizeof(entryCount));
+		for (auto it = m_entries.begin(); success && it != m_entries.end(); ++it)
+		{
+			UInt32 size = static_cast<UInt32>(it->second.GetSize());
+			success = Write(&it->first, sizeof(it->first)) && Write(&size, sizeof(size)) && Write(it->second.GetConstBuffer(), size);
+		}
+
+		if (!success)
+		{
+			NazaraError("failed to write shader cache " + filePath.generic_u8string());
+			return false;
+		}
+
+		m_isModified = false;
+		return true;
+	}
+
+	bool ShaderCache::CompileShader(nzsl::ShaderStageTypeFlags shaderStages, const nzsl::Ast::Module& shaderModule, const nzsl::ShaderWriter::States& states, ShaderLanguage language, ByteArray* binary)
+	{
+		NazaraAssert(binary, "Invalid binary");
+
+		// Other languages are generated by backends using pipeline informations (binding remapping, context version, ...)
+		if (language != ShaderLanguage::SpirV)
+			return false;
+
+		NazaraUnused(shaderStages);
+
+		try
+		{
+			nzsl::SpirvWriter writer;
+			writer.SetEnv(nzsl::SpirvWriter::Environment{});
+
+			std::vector<UInt32> code = writer.Generate(shaderModule, states);
+			binary->Clear(true);
+			binary->Append(code.data(), code.size() * sizeof(UInt32));
+		}
+		catch (const std::exception& e)
+		{
+			NazaraError(std::string("failed to compile shader: ") + e.what());
+			return false;
+		}
+
+		return true;
+	}
+
+	UInt64 ShaderCache::ComputeKey(std::string_view identifier)
+	{
+		KeyBuilder keyBuilder;
+		keyBuilder.Append(FormatVersion);
+		keyBuilder.Append(identifier.data(), identifier.size());
+
+		return keyBuilder.End();
+	}
+
+	UInt64 ShaderCache::ComputeModuleKey(const nzsl::Ast::Module& shaderModule)
+	{
+		KeyBuilder keyBuilder;
+		keyBuilder.Append(FormatVersion);
+		keyBuilder.Append(CompilerVersion.data(), CompilerVersion.size());
+
+		// Imported modules are not resolved here, the module is expected to have been (partially) sanitized with them already
+		nzsl::Serializer serializer;
+		nzsl::Ast::SerializeShader(serializer, shaderModule);
+
+		const std::vector<std::uint8_t>& moduleData = serializer.GetData();
+		keyBuilder.Append(moduleData.data(), moduleData.size());
+
+		return keyBuilder.End();
+	}
+
+	UInt64 ShaderCache::ComputeShaderKey(nzsl::ShaderStageTypeFlags shaderStages, const nzsl::Ast::Module& shaderModule, const nzsl::ShaderWriter::States& states, ShaderLanguage language)
+	{
+		return ComputeShaderKey(shaderStages, ComputeModuleKey(shaderModule), states, language);
+	}
+
+	UInt64 ShaderCache::ComputeShaderKey(nzsl::ShaderStageTypeFlags shaderStages, UInt64 moduleKey, const nzsl::ShaderWriter::States& states, ShaderLanguage language)
+	{
+		KeyBuilder keyBuilder;
+		keyBuilder.Append(moduleKey);
+		keyBuilder.Append(language);
+
+		for (std::size_t i = 0; i < nzsl::ShaderStageTypeCount; ++i)
+			keyBuilder.Append(shaderStages.Test(static_cast<nzsl::ShaderStageType>(i)));
+
+		keyBuilder.Append(states.optimize);
+		keyBuilder.Append(states.sanitized);
+
+		// Option values are stored in a hash map, sort them so the key doesn't depend on its iteration order
+		std::vector<UInt32> optionHashes;
+		optionHashes.reserve(states.optionValues.size());
+		for (const auto& [optionHash, optionValue] : states.optionValues)
+			optionHashes.push_back(optionHash);
+
+		std::sort(optionHashes.begin(), optionHashes.end());
+
+		for (UInt32 optionHash : optionHashes)
+		{
+			const auto& optionValue = states.optionValues.at(optionHash);
+
+			keyBuilder.Append(optionHash);
+			keyBuilder.Append(static_cast<UInt32>(optionValue.index()));
+
+			std::visit([&](auto&& arg)
+			{
+				using T = std::decay_t<decltype(arg)>;
+				if constexpr (std::is_same_v<T, std::string>)
+					keyBuilder.Append(arg.data(), arg.size());
+				else if constexpr (std::is_empty_v<T>)
+					return;
+				else if constexpr (std::is_trivially_copyable_v<T>)
+					keyBuilder.Append(arg);
+				else
+					static_assert(AlwaysFalse<T>::value, "non-exhaustive visitor");
+			}, optionValue);
+		}
+
+		return keyBuilder.End();
+	}
+}
@@ -0,0 +1,799 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/BlockCompressor.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ParallelFor.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr std::size_t CompressionGrainSize = 256; //< Minimum number of blocks compressed per thread
+
+		constexpr std::array<UInt8, 16> BC7Weights = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+		template<std::size_t N>
+		struct Endpoints
+		{
+			std::array<float, N> start;
+			std::array<float, N> end;
+		};
+
+		template<std::size_t N>
+		float ComputeSquaredDistance(const float* lhs, const float* rhs)
+		{
+			float distance = 0.f;
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				float diff = lhs[i] - rhs[i];
+				distance += diff * diff;
+			}
+
+			return distance;
+		}
+
+		// Finds the line best fitting the weighted points, either from their bounding box or from their principal axis
+		template<std::size_t N>
+		Endpoints<N> FitEndpoints(const float (*points)[N], const bool* mask, BlockCompressionQuality quality)
+		{
+			Endpoints<N> endpoints;
+			endpoints.start.fill(std::numeric_limits<float>::max());
+			endpoints.end.fill(std::numeric_limits<float>::lowest());
+
+			if (quality == BlockCompressionQuality::Fast)
+			{
+				for (std::size_t i = 0; i < 16; ++i)
+				{
+					if (!mask[i])
+						continue;
+
+					for (std::size_t c = 0; c < N; ++c)
+					{
+						endpoints.start[c] = std::min(endpoints.start[c], points[i][c]);
+						endpoints.end[c] = std::max(endpoints.end[c], points[i][c]);
+					}
+				}
+
+				// Inset the box a bit, extremes are rarely worth an endpoint on their own
+				for (std::size_t c = 0; c < N; ++c)
+				{
+					float inset = (endpoints.end[c] - endpoints.start[c]) / 16.f;
+					endpoints.start[c] += inset;
+					endpoints.end[c] -= inset;
+				}
+
+				return endpoints;
+			}
+
+			std::array<float, N> mean = {};
+			unsigned int count = 0;
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				if (!mask[i])
+					continue;
+
+				for (std::size_t c = 0; c < N; ++c)
+					mean[c] += points[i][c];
+
+				count++;
+			}
+
+			for (std::size_t c = 0; c < N; ++c)
+				mean[c] /= count;
+
+			float covariance[N][N] = {};
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				if (!mask[i])
+					continue;
+
+				for (std::size_t a = 0; a < N; ++a)
+				{
+					for (std::size_t b = a; b < N; ++b)
+						covariance[a][b] += (points[i][a] - mean[a]) * (points[i][b] - mean[b]);
+				}
+			}
+
+			for (std::size_t a = 0; a < N; ++a)
+			{
+				for (std::size_t b = 0; b < a; ++b)
+					covariance[a][b] = covariance[b][a];
+			}
+
+			// Power iteration, starting from the axis with the largest variance
+			std::array<float, N> axis = {};
+			std::size_t largestAxis = 0;
+			for (std::size_t c = 1; c < N; ++c)
+			{
+				if (covariance[c][c] > covariance[largestAxis][largestAxis])
+					largestAxis = c;
+			}
+			axis[largestAxis] = 1.f;
+
+			for (unsigned int iteration = 0; iteration < 8; ++iteration)
+			{
+				std::array<float, N> next = {};
+				for (std::size_t a = 0; a < N; ++a)
+				{
+					for (std::size_t b = 0; b < N; ++b)
+						next[a] += covariance[a][b] * axis[b];
+				}
+
+				float length = 0.f;
+				for (std::size_t c = 0; c < N; ++c)
+					length += next[c] * next[c];
+
+				if (length < 1e-12f)
+					break;
+
+				length = std::sqrt(length);
+				for (std::size_t c = 0; c < N; ++c)
+					axis[c] = next[c] / length;
+			}
+
+			float minProjection = std::numeric_limits<float>::max();
+			float maxProjection = std::numeric_limits<float>::lowest();
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				if (!mask[i])
+					continue;
+
+				float projection = 0.f;
+				for (std::size_t c = 0; c < N; ++c)
+					projection += (points[i][c] - mean[c]) * axis[c];
+
+				minProjection = std::min(minProjection, projection);
+				maxProjection = std::max(maxProjection, projection);
+			}
+
+			for (std::size_t c = 0; c < N; ++c)
+			{
+				endpoints.start[c] = mean[c] + axis[c] * minProjection;
+				endpoints.end[c] = mean[c] + axis[c] * maxProjection;
+			}
+
+			return endpoints;
+		}
+
+		// Solves the least-squares problem giving the endpoints best matching the points for fixed interpolation factors (weight of the end endpoint)
+		template<std::size_t N>
+		bool RefineEndpoints(const float (*points)[N], const bool* mask, const float* factors, Endpoints<N>& endpoints)
+		{
+			float aa = 0.f;
+			float ab = 0.f;
+			float bb = 0.f;
+			std::array<float, N> ax = {};
+			std::array<float, N> bx = {};
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				if (!mask[i])
+					continue;
+
+				float b = factors[i];
+				float a = 1.f - b;
+
+				aa += a * a;
+				ab += a * b;
+				bb += b * b;
+				for (std::size_t c = 0; c < N; ++c)
+				{
+					ax[c] += a * points[i][c];
+					bx[c] += b * points[i][c];
+				}
+			}
+
+			float determinant = aa * bb - ab * ab;
+			if (std::abs(determinant) < 1e-6f)
+				return false;
+
+			float invDeterminant = 1.f / determinant;
+			for (std::size_t c = 0; c < N; ++c)
+			{
+				endpoints.start[c] = (ax[c] * bb - bx[c] * ab) * invDeterminant;
+				endpoints.end[c] = (bx[c] * aa - ax[c] * ab) * invDeterminant;
+			}
+
+			return true;
+		}
+
+		/**********************************BC1************************************/
+		struct ColorBlock
+		{
+			UInt16 color0;
+			UInt16 color1;
+			std::array<UInt8, 16> indices;
+			float error;
+		};
+
+		inline UInt16 QuantizeRGB565(const std::array<float, 3>& color)
+		{
+			auto Quantize = [](float value, float maxValue)
+			{
+				return static_cast<UInt16>(std::clamp(value * maxValue / 255.f + 0.5f, 0.f, maxValue));
+			};
+
+			return static_cast<UInt16>((Quantize(color[0], 31.f) << 11) | (Quantize(color[1], 63.f) << 5) | Quantize(color[2], 31.f));
+		}
+
+		inline void ExpandRGB565(UInt16 color, int* rgb)
+		{
+			int r = (color >> 11) & 0x1F;
+			int g = (color >> 5) & 0x3F;
+			int b = color & 0x1F;
+
+			rgb[0] = (r << 3) | (r >> 2);
+			rgb[1] = (g << 2) | (g >> 4);
+			rgb[2] = (b << 3) | (b >> 2);
+		}
+
+		// Picks the best indices for two quantized endpoints, using the same palette as the decoder
+		void EvaluateColorBlock(const float (*colors)[3], const bool* opaque, bool threeColorMode, ColorBlock& block)
+		{
+			int endpoints[2][3];
+			ExpandRGB565(block.color0, endpoints[0]);
+			ExpandRGB565(block.color1, endpoints[1]);
+
+			float palette[4][3];
+			unsigned int paletteSize = (threeColorMode) ? 3 : 4;
+			for (unsigned int c = 0; c < 3; ++c)
+			{
+				palette[0][c] = float(endpoints[0][c]);
+				palette[1][c] = float(endpoints[1][c]);
+				if (threeColorMode)
+					palette[2][c] = float((endpoints[0][c] + endpoints[1][c]) / 2);
+				else
+				{
+					palette[2][c] = float((2 * endpoints[0][c] + endpoints[1][c] + 1) / 3);
+					palette[3][c] = float((endpoints[0][c] + 2 * endpoints[1][c] + 1) / 3);
+				}
+			}
+
+			block.error = 0.f;
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				if (!opaque[i])
+				{
+					block.indices[i] = 3; //< transparent black, only reachable in three color mode
+					continue;
+				}
+
+				float bestDistance = std::numeric_limits<float>::max();
+				for (unsigned int j = 0; j < paletteSize; ++j)
+				{
+					float distance = ComputeSquaredDistance<3>(colors[i], palette[j]);
+					if (distance < bestDistance)
+					{
+						bestDistance = distance;
+						block.indices[i] = UInt8(j);
+					}
+				}
+
+				block.error += bestDistance;
+			}
+		}
+
+		void FitColorBlock(const float (*colors)[3], const bool* opaque, bool threeColorMode, BlockCompressionQuality quality, ColorBlock& bestBlock)
+		{
+			Endpoints<3> endpoints = FitEndpoints<3>(colors, opaque, quality);
+
+			ColorBlock block;
+			block.color0 = QuantizeRGB565(endpoints.start);
+			block.color1 = QuantizeRGB565(endpoints.end);
+			EvaluateColorBlock(colors, opaque, threeColorMode, block);
+			if (block.error < bestBlock.error)
+				bestBlock = block;
+
+			static constexpr float FourColorFactors[4] = { 0.f, 1.f, 1.f / 3.f, 2.f / 3.f };
+			static constexpr float ThreeColorFactors[4] = { 0.f, 1.f, 0.5f, 0.f };
+			const float* factorTable = (threeColorMode) ? ThreeColorFactors : FourColorFactors;
+
+			unsigned int refinementCount = (quality == BlockCompressionQuality::High) ? 4 : (quality == BlockCompressionQuality::Normal) ? 1 : 0;
+			for (unsigned int iteration = 0; iteration < refinementCount; ++iteration)
+			{
+				float factors[16];
+				for (std::size_t i = 0; i < 16; ++i)
+					factors[i] = factorTable[block.indices[i]];
+
+				if (!RefineEndpoints<3>(colors, opaque, factors, endpoints))
+					break;
+
+				block.color0 = QuantizeRGB565(endpoints.start);
+				block.color1 = QuantizeRGB565(endpoints.end);
+				EvaluateColorBlock(colors, opaque, threeColorMode, block);
+				if (block.error >= bestBlock.error)
+					break;
+
+				bestBlock = block;
+			}
+		}
+
+		void WriteColorBlock(ColorBlock block, bool threeColorMode, UInt8* dst)
+		{
+			// Endpoint order selects the mode: color0 > color1 for four colors, color0 <= color1 for three colors with transparency
+			if (threeColorMode)
+			{
+				if (block.color0 > block.color1)
+				{
+					std::swap(block.color0, block.color1);
+					for (UInt8& index : block.indices)
+					{
+						if (index < 2)
+							index ^= 1;
+					}
+				}
+			}
+			else if (block.color0 < block.color1)
+			{
+				std::swap(block.color0, block.color1);
+				for (UInt8& index : block.indices)
+					index ^= 1;
+			}
+			else if (block.color0 == block.color1)
+				block.indices.fill(0);
+
+			UInt32 indices = 0;
+			for (std::size_t i = 0; i < 16; ++i)
+				indices |= UInt32(block.indices[i]) << (2 * i);
+
+			dst[0] = UInt8(block.color0 & 0xFF);
+			dst[1] = UInt8(block.color0 >> 8);
+			dst[2] = UInt8(block.color1 & 0xFF);
+			dst[3] = UInt8(block.color1 >> 8);
+			dst[4] = UInt8(indices & 0xFF);
+			dst[5] = UInt8((indices >> 8) & 0xFF);
+			dst[6] = UInt8((indices >> 16) & 0xFF);
+			dst[7] = UInt8(indices >> 24);
+		}
+
+		void EncodeBC1Colors(const UInt8* pixels, UInt8* dst, bool allowTransparency, BlockCompressionQuality quality)
+		{
+			float colors[16][3];
+			bool opaque[16];
+			bool hasTransparency = false;
+			bool hasOpaque = false;
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				for (std::size_t c = 0; c < 3; ++c)
+					colors[i][c] = pixels[i * 4 + c];
+
+				opaque[i] = !allowTransparency || pixels[i * 4 + 3] >= 128;
+				hasOpaque = hasOpaque || opaque[i];
+				hasTransparency = hasTransparency || !opaque[i];
+			}
+
+			if (!hasOpaque)
+			{
+				// Fully transparent block, three color mode with every index set to transparent black
+				std::memset(dst, 0, 4);
+				std::memset(dst + 4, 0xFF, 4);
+				return;
+			}
+
+			ColorBlock bestBlock;
+			bestBlock.error = std::numeric_limits<float>::max();
+
+			FitColorBlock(colors, opaque, hasTransparency, quality, bestBlock);
+			bool threeColorMode = hasTransparency;
+
+			// The three color mode sometimes fits opaque blocks better
+			if (allowTransparency && !hasTransparency && quality == BlockCompressionQuality::High)
+			{
+				float fourColorError = bestBlock.error;
+				FitColorBlock(colors, opaque, true, quality, bestBlock);
+				threeColorMode = bestBlock.error < fourColorError;
+			}
+
+			WriteColorBlock(bestBlock, threeColorMode, dst);
+		}
+
+		/*****************************BC2/BC3/BC4*********************************/
+		void EncodeBC2Alpha(const UInt8* pixels, UInt8* dst)
+		{
+			for (std::size_t i = 0; i < 8; ++i)
+			{
+				UInt8 alpha0 = UInt8((pixels[(i * 2 + 0) * 4 + 3] * 15 + 127) / 255);
+				UInt8 alpha1 = UInt8((pixels[(i * 2 + 1) * 4 + 3] * 15 + 127) / 255);
+				dst[i] = UInt8(alpha0 | (alpha1 << 4));
+			}
+		}
+
+		// Computes the best indices of an interpolated channel for a pair of endpoints, using the same palette as the decoder
+		unsigned int EvaluateChannelBlock(const UInt8* values, UInt8 endpoint0, UInt8 endpoint1, std::array<UInt8, 16>& indices)
+		{
+			int palette[8];
+			palette[0] = endpoint0;
+			palette[1] = endpoint1;
+			if (endpoint0 > endpoint1)
+			{
+				for (int i = 1; i < 7; ++i)
+					palette[i + 1] = ((7 - i) * endpoint0 + i * endpoint1 + 3) / 7;
+			}
+			else
+			{
+				for (int i = 1; i < 5; ++i)
+					palette[i + 1] = ((5 - i) * endpoint0 + i * endpoint1 + 2) / 5;
+
+				palette[6] = 0;
+				palette[7] = 0xFF;
+			}
+
+			unsigned int error = 0;
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				int bestDistance = std::numeric_limits<int>::max();
+				for (unsigned int j = 0; j < 8; ++j)
+				{
+					int diff = int(values[i]) - palette[j];
+					int distance = diff * diff;
+					if (distance < bestDistance)
+					{
+						bestDistance = distance;
+						indices[i] = UInt8(j);
+					}
+				}
+
+				error += unsigned(bestDistance);
+			}
+
+			return error;
+		}
+
+		// Encodes sixteen values to an interpolated channel block (BC3 alpha, BC4 and BC5 channels)
+		void EncodeChannelBlock(const UInt8* values, UInt8* dst, BlockCompressionQuality quality)
+		{
+			UInt8 minValue = 0xFF;
+			UInt8 maxValue = 0;
+			UInt8 minInnerValue = 0xFF; //< ignoring 0 and 255 which the six values mode stores explicitly
+			UInt8 maxInnerValue = 0;
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				minValue = std::min(minValue, values[i]);
+				maxValue = std::max(maxValue, values[i]);
+				if (values[i] != 0 && values[i] != 0xFF)
+				{
+					minInnerValue = std::min(minInnerValue, values[i]);
+					maxInnerValue = std::max(maxInnerValue, values[i]);
+				}
+			}
+
+			std::array<UInt8, 16> indices;
+			UInt8 endpoint0 = maxValue;
+			UInt8 endpoint1 = minValue;
+			unsigned int bestError = EvaluateChannelBlock(values, endpoint0, endpoint1, indices);
+
+			if (quality != BlockCompressionQuality::Fast && bestError > 0)
+			{
+				std::array<UInt8, 16> candidateIndices;
+				auto TryEndpoints = [&](UInt8 candidate0, UInt8 candidate1)
+				{
+					unsigned int error = EvaluateChannelBlock(values, candidate0, candidate1, candidateIndices);
+					if (error < bestError)
+					{
+						bestError = error;
+						endpoint0 = candidate0;
+						endpoint1 = candidate1;
+						indices = candidateIndices;
+					}
+				};
+
+				if (minInnerValue <= maxInnerValue)
+					TryEndpoints(minInnerValue, maxInnerValue);
+
+				if (quality == BlockCompressionQuality::High)
+				{
+					// Shrinking the range often lowers the error of the interpolated values
+					int range = std::max((maxValue - minValue) / 8, 1);
+					for (int offset0 = 0; offset0 <= range; ++offset0)
+					{
+						for (int offset1 = 0; offset1 <= range; ++offset1)
+						{
+							int candidate0 = maxValue - offset0;
+							int candidate1 = minValue + offset1;
+							if (candidate0 > candidate1)
+								TryEndpoints(UInt8(candidate0), UInt8(candidate1));
+						}
+					}
+				}
+			}
+
+			UInt64 packedIndices = 0;
+			for (std::size_t i = 0; i < 16; ++i)
+				packedIndices |= UInt64(indices[i]) << (3 * i);
+
+			dst[0] = endpoint0;
+			dst[1] = endpoint1;
+			for (std::size_t i = 0; i < 6; ++i)
+				dst[2 + i] = UInt8((packedIndices >> (8 * i)) & 0xFF);
+		}
+
+		void EncodeChannel(const UInt8* pixels, unsigned int channel, UInt8* dst, BlockCompressionQuality quality)
+		{
+			UInt8 values[16];
+			for (std::size_t i = 0; i < 16; ++i)
+				values[i] = pixels[i * 4 + channel];
+
+			EncodeChannelBlock(values, dst, quality);
+		}
+
+		/**********************************BC7************************************/
+		// Only mode 6 (one subset, 7.7.7.7 endpoints with a unique p-bit each, 4bits indices) is used, which handles smooth color and alpha gradients well
+		struct BC7Block
+		{
+			std::array<UInt8, 4> endpoint0; //< 7bits
+			std::array<UInt8, 4> endpoint1; //< 7bits
+			std::array<UInt8, 16> indices;
+			UInt8 pbit0;
+			UInt8 pbit1;
+			float error;
+		};
+
+		void EvaluateBC7Block(const float (*pixels)[4], BC7Block& block)
+		{
+			float palette[16][4];
+			for (unsigned int c = 0; c < 4; ++c)
+			{
+				int e0 = (block.endpoint0[c] << 1) | block.pbit0;
+				int e1 = (block.endpoint1[c] << 1) | block.pbit1;
+				for (unsigned int j = 0; j < 16; ++j)
+					palette[j][c] = float(((64 - BC7Weights[j]) * e0 + BC7Weights[j] * e1 + 32) >> 6);
+			}
+
+			block.error = 0.f;
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				float bestDistance = std::numeric_limits<float>::max();
+				for (unsigned int j = 0; j < 16; ++j)
+				{
+					float distance = ComputeSquaredDistance<4>(pixels[i], palette[j]);
+					if (distance < bestDistance)
+					{
+						bestDistance = distance;
+						block.indices[i] = UInt8(j);
+					}
+				}
+
+				block.error += bestDistance;
+			}
+		}
+
+		void QuantizeBC7Endpoints(const Endpoints<4>& endpoints, const float (*pixels)[4], BC7Block& bestBlock)
+		{
+			// Try every p-bit combination, they act as a shared least significant bit of each endpoint
+			for (UInt8 pbits = 0; pbits < 4; ++pbits)
+			{
+				BC7Block block;
+				block.pbit0 = pbits & 1;
+				block.pbit1 = pbits >> 1;
+				for (unsigned int c = 0; c < 4; ++c)
+				{
+					block.endpoint0[c] = UInt8(std::clamp((endpoints.start[c] - block.pbit0) * 0.5f + 0.5f, 0.f, 127.f));
+					block.endpoint1[c] = UInt8(std::clamp((endpoints.end[c] - block.pbit1) * 0.5f + 0.5f, 0.f, 127.f));
+				}
+
+				EvaluateBC7Block(pixels, block);
+				if (block.error < bestBlock.error)
+					bestBlock = block;
+			}
+		}
+
+		void WriteBC7Block(BC7Block block, UInt8* dst)
+		{
+			// The anchor (first) index is stored without its most significant bit, which must be zero
+			if (block.indices[0] >= 8)
+			{
+				std::swap(block.endpoint0, block.endpoint1);
+				std::swap(block.pbit0, block.pbit1);
+				for (UInt8& index : block.indices)
+					index = UInt8(15 - index);
+			}
+
+			std::memset(dst, 0, 16);
+
+			unsigned int bitOffset = 0;
+			auto WriteBits = [&](UInt32 value, unsigned int bitCount)
+			{
+				for (unsigned int i = 0; i < bitCount; ++i, ++bitOffset)
+				{
+					if (value & (1U << i))
+						dst[bitOffset / 8] |= UInt8(1U << (bitOffset % 8));
+				}
+			};
+
+			WriteBits(1U << 6, 7); //< mode 6
+			for (unsigned int c = 0; c < 4; ++c)
+			{
+				WriteBits(block.endpoint0[c], 7);
+				WriteBits(block.endpoint1[c], 7);
+			}
+
+			WriteBits(block.pbit0, 1);
+			WriteBits(block.pbit1, 1);
+
+			WriteBits(block.indices[0], 3);
+			for (std::size_t i = 1; i < 16; ++i)
+				WriteBits(block.indices[i], 4);
+		}
+
+		void EncodeBC7(const UInt8* rgba, UInt8* dst, BlockCompressionQuality quality)
+		{
+			float pixels[16][4];
+			bool mask[16];
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				for (std::size_t c = 0; c < 4; ++c)
+					pixels[i][c] = rgba[i * 4 + c];
+
+				mask[i] = true;
+			}
+
+			Endpoints<4> endpoints = FitEndpoints<4>(pixels, mask, quality);
+
+			BC7Block bestBlock;
+			bestBlock.error = std::numeric_limits<float>::max();
+			QuantizeBC7Endpoints(endpoints, pixels, bestBlock);
+
+			unsigned int refinementCount = (quality == BlockCompressionQuality::High) ? 4 : (quality == BlockCompressionQuality::Normal) ? 1 : 0;
+			for (unsigned int iteration = 0; iteration < refinementCount && bestBlock.error > 0.f; ++iteration)
+			{
+				float factors[16];
+				for (std::size_t i = 0; i < 16; ++i)
+					factors[i] = BC7Weights[bestBlock.indices[i]] / 64.f;
+
+				if (!RefineEndpoints<4>(pixels, mask, factors, endpoints))
+					break;
+
+				float previousError = bestBlock.error;
+				QuantizeBC7Endpoints(endpoints, pixels, bestBlock);
+				if (bestBlock.error >= previousError)
+					break;
+			}
+
+			WriteBC7Block(bestBlock, dst);
+		}
+
+		std::size_t GetBlockSize(PixelFormat format)
+		{
+			return (format == PixelFormat::DXT1 || format == PixelFormat::BC4) ? 8 : 16;
+		}
+	}
+
+	/*!
+	* \ingroup utility
+	* \class Nz::BlockCompressor
+	* \brief Utility class that encodes RGBA8 pixels to block-compressed formats (BC1 to BC5 and BC7)
+	*/
+
+	/*!
+	* \brief Compresses a RGBA8 surface to a block-compressed format
+	* \return true if the format is supported
+	*
+	* \param dstFormat Block-compressed format (DXT1, DXT3, DXT5, BC4, BC5 or BC7)
+	* \param rgba Pointer to width * height RGBA8 pixels, tightly packed
+	* \param width Width of the surface
+	* \param height Height of the surface
+	* \param dst Destination buffer, must hold PixelFormatInfo::ComputeSize(dstFormat, width, height, 1) bytes
+	* \param quality Trade-off between compression speed and quality
+	*
+	* \remark Blocks crossing the right or bottom border are completed by repeating the last column/row
+	* \remark Rows of blocks are compressed in parallel
+	*/
+	bool BlockCompressor::Compress(PixelFormat dstFormat, const UInt8* rgba, unsigned int width, unsigned int height, UInt8* dst, BlockCompressionQuality quality)
+	{
+		NazaraAssert(rgba, "invalid source");
+		NazaraAssert(dst, "invalid destination");
+
+		if (!IsSupported(dstFormat))
+		{
+			NazaraError("Block compression to " + PixelFormatInfo::GetName(dstFormat) + " is not supported");
+			return false;
+		}
+
+		std::size_t blockSize = GetBlockSize(dstFormat);
+		std::size_t blockCountX = (width + 3) / 4;
+		std::size_t blockRowCount = (height + 3) / 4;
+
+		ParallelFor(blockRowCount, std::max<std::size_t>(CompressionGrainSize / blockCountX, 1), [&](std::size_t begin, std::size_t end)
+		{
+			UInt8 block[16 * 4];
+			for (std::size_t blockY = begin; blockY < end; ++blockY)
+			{
+				for (std::size_t blockX = 0; blockX < blockCountX; ++blockX)
+				{
+					for (unsigned int y = 0; y < 4; ++y)
+					{
+						std::size_t pixelY = std::min<std::size_t>(blockY * 4 + y, height - 1);
+						for (unsigned int x = 0; x < 4; ++x)
+						{
+							std::size_t pixelX = std::min<std::size_t>(blockX * 4 + x, width - 1);
+							std::memcpy(&block[(y * 4 + x) * 4], &rgba[(pixelY * width + pixelX) * 4], 4);
+						}
+					}
+
+					CompressBlock(dstFormat, block, &dst[(blockY * blockCountX + blockX) * blockSize], quality);
+				}
+			}
+		});
+
+		return true;
+	}
+
+	/*!
+	* \brief Compresses a single 4x4 block
+	*
+	* \param dstFormat Block-compressed format (DXT1, DXT3, DXT5, BC4, BC5 or BC7)
+	* \param block Sixteen RGBA8 pixels, row by row
+	* \param dst Destination of the 8 (DXT1, BC4) or 16 bytes (other formats) block
+	* \param quality Trade-off between compression speed and quality
+	*
+	* \remark BC4 and BC5 encode the red (and green) channels, DXT1 encodes pixels with an alpha lower than 128 as transparent black
+	*/
+	void BlockCompressor::CompressBlock(PixelFormat dstFormat, const UInt8* block, UInt8* dst, BlockCompressionQuality quality)
+	{
+		NazaraAssert(IsSupported(dstFormat), "unsupported format");
+
+		switch (dstFormat)
+		{
+			case PixelFormat::BC4:
+				EncodeChannel(block, 0, dst, quality);
+				break;
+
+			case PixelFormat::BC5:
+				EncodeChannel(block, 0, dst, quality);
+				EncodeChannel(block, 1, dst + 8, quality);
+				break;
+
+			case PixelFormat::BC7:
+				EncodeBC7(block, dst, quality);
+				break;
+
+			case PixelFormat::DXT1:
+				EncodeBC1Colors(block, dst, true, quality);
+				break;
+
+			case PixelFormat::DXT3:
+				EncodeBC2Alpha(block, dst);
+				EncodeBC1Colors(block, dst + 8, false, quality);
+				break;
+
+			case PixelFormat::DXT5:
+				EncodeChannel(block, 3, dst, quality);
+				EncodeBC1Colors(block, dst + 8, false, quality);
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	/*!
+	* \brief Checks whether the compressor can produce a format
+	* \return true if it can
+	*
+	* \param dstFormat Pixel format to check
+	*/
+	bool BlockCompressor::IsSupported(PixelFormat dstFormat)
+	{
+		switch (dstFormat)
+		{
+			case PixelFormat::BC4:
+			case PixelFormat::BC5:
+			case PixelFormat::BC7:
+			case PixelFormat::DXT1:
+			case PixelFormat::DXT3:
+			case PixelFormat::DXT5:
+				return true;
+
+			default:
+				return false;
+		}
+	}
+}
@@ -6,6 +6,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Utility/Components/SharedSkeletonComponent.hpp>
 #include <Nazara/Utility/Components/SkeletonComponent.hpp>
+#include <Nazara/Utility/Systems/TransformSystem.hpp>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -45,4 +46,20 @@ namespace Nz
 		NazaraAssert(skeletonComponent, "entity doesn't have a SkeletonComponent nor a SharedSkeletonComponent");
 		Node::SetParent(skeletonComponent->GetAttachedJoint(jointIndex), keepDerived);
 	}
+
+	void NodeComponent::InvalidateNode()
+	{
+		if (m_transformSystem)
+			m_transformSystem->InvalidateTransform(m_transformId);
+
+		Node::InvalidateNode();
+	}
+
+	void NodeComponent::OnParenting(const Node* parent)
+	{
+		if (m_transformSystem)
+			m_transformSystem->InvalidateHierarchy();
+
+		Node::OnParenting(parent);
+	}
 }
@@ -3,12 +3,17 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Font.hpp>
+#include <Nazara/Core/ParallelFor.hpp>
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utility/FontData.hpp>
 #include <Nazara/Utility/FontGlyph.hpp>
 #include <Nazara/Utility/GuillotineImageAtlas.hpp>
 #include <Nazara/Utility/Utility.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -18,6 +23,140 @@ namespace Nz
 		const UInt8 r_sansationRegular[] = {
 			#include <Nazara/Utility/Resources/Fonts/OpenSans-Regular.ttf.h>
 		};
+
+		constexpr unsigned int DefaultDistanceFieldReferenceSize = 64;
+		constexpr unsigned int DefaultDistanceFieldSpread = 8;
+
+		// Stands for "no seed" in distance transforms, large but finite to keep parabola intersections well-defined
+		constexpr float DistanceTransformInfinity = 1e20f;
+
+		// Felzenszwalb & Huttenlocher exact squared euclidean distance transform, on one row or column
+		void DistanceTransform1D(const float* f, float* d, std::size_t* v, float* z, std::size_t n)
+		{
+			std::size_t k = 0;
+			v[0] = 0;
+			z[0] = -std::numeric_limits<float>::infinity();
+			z[1] = std::numeric_limits<float>::infinity();
+
+			for (std::size_t q = 1; q < n; ++q)
+			{
+				float fq = f[q] + float(q * q);
+
+				float s = (fq - (f[v[k]] + float(v[k] * v[k]))) / (2.f * float(q - v[k]));
+				while (s <= z[k])
+				{
+					k--;
+					s = (fq - (f[v[k]] + float(v[k] * v[k]))) / (2.f * float(q - v[k]));
+				}
+
+				k++;
+				v[k] = q;
+				z[k] = s;
+				z[k + 1] = std::numeric_limits<float>::infinity();
+			}
+
+			k = 0;
+			for (std::size_t q = 0; q < n; ++q)
+			{
+				while (z[k + 1] < float(q))
+					k++;
+
+				float offset = float(q) - float(v[k]);
+				d[q] = offset * offset + f[v[k]];
+			}
+		}
+
+		void DistanceTransform2D(std::vector<float>& grid, std::size_t width, std::size_t height)
+		{
+			std::size_t maxSide = std::max(width, height);
+			std::vector<float> f(maxSide);
+			std::vector<float> d(maxSide);
+			std::vector<float> z(maxSide + 1);
+			std::vector<std::size_t> v(maxSide);
+
+			for (std::size_t x = 0; x < width; ++x)
+			{
+				for (std::size_t y = 0; y < height; ++y)
+					f[y] = grid[y * width + x];
+
+				DistanceTransform1D(f.data(), d.data(), v.data(), z.data(), height);
+
+				for (std::size_t y = 0; y < height; ++y)
+					grid[y * width + x] = d[y];
+			}
+
+			for (std::size_t y = 0; y < height; ++y)
+			{
+				float* row = &grid[y * width];
+				std::copy(row, row + width, f.begin());
+				DistanceTransform1D(f.data(), row, v.data(), z.data(), width);
+			}
+		}
+
+		/*!
+		* \brief Builds a signed distance field from a glyph coverage bitmap
+		* \return A8 image padded by spread on each side, where 128 lies on the glyph edge and each unit is spread/128 pixels
+		*
+		* \param coverage Glyph coverage image
+		* \param spread Maximal distance (in pixels) encoded in the field
+		*/
+		Image BuildDistanceField(const Image& coverage, unsigned int spread)
+		{
+			Image alphaCoverage;
+			const Image* source = &coverage;
+			if (coverage.GetFormat() != PixelFormat::A8)
+			{
+				alphaCoverage = coverage;
+				if (!alphaCoverage.Convert(PixelFormat::A8))
+					return Image();
+
+				source = &alphaCoverage;
+			}
+
+			std::size_t sourceWidth = source->GetWidth();
+			std::size_t sourceHeight = source->GetHeight();
+			std::size_t width = sourceWidth + 2 * spread;
+			std::size_t height = sourceHeight + 2 * spread;
+
+			// Gather padded coverage and seed both transforms (distance to inside and distance to outside)
+			std::vector<UInt8> alpha(width * height, 0);
+			const UInt8* sourcePixels = source->GetConstPixels();
+			for (std::size_t y = 0; y < sourceHeight; ++y)
+				std::copy_n(&sourcePixels[y * sourceWidth], sourceWidth, &alpha[(y + spread) * width + spread]);
+
+			std::vector<float> toInside(width * height);
+			std::vector<float> toOutside(width * height);
+			for (std::size_t i = 0; i < alpha.size(); ++i)
+			{
+				bool inside = (alpha[i] >= 128);
+				toInside[i] = (inside) ? 0.f : DistanceTransformInfinity;
+				toOutside[i] = (inside) ? DistanceTransformInfinity : 0.f;
+			}
+
+			DistanceTransform2D(toInside, width, height);
+			DistanceTransform2D(toOutside, width, height);
+
+			Image field(ImageType::E2D, PixelFormat::A8, static_cast<unsigned int>(width), static_cast<unsigned int>(height));
+			UInt8* fieldPixels = field.GetPixels();
+
+			float invRange = 1.f / (2.f * spread);
+			for (std::size_t i = 0; i < alpha.size(); ++i)
+			{
+				// Positive inside the glyph, in pixels
+				float distance;
+				if (alpha[i] > 0 && alpha[i] < 255)
+					distance = alpha[i] / 255.f - 0.5f; //< Antialiased edge pixels already tell us how far the edge is
+				else if (alpha[i] >= 128)
+					distance = std::sqrt(toOutside[i]) - 0.5f;
+				else
+					distance = 0.5f - std::sqrt(toInside[i]);
+
+				float value = std::clamp(0.5f + distance * invRange, 0.f, 1.f);
+				fieldPixels[i] = static_cast<UInt8>(value * 255.f + 0.5f);
+			}
+
+			return field;
+		}
 	}
 
 	bool FontParams::IsValid() const
@@ -26,6 +165,9 @@ namespace Nz
 	}
 
 	Font::Font() :
+	m_glyphRenderMode(s_defaultGlyphRenderMode),
+	m_distanceFieldReferenceSize(DefaultDistanceFieldReferenceSize),
+	m_distanceFieldSpread(DefaultDistanceFieldSpread),
 	m_glyphBorder(s_defaultGlyphBorder),
 	m_minimumStepSize(s_defaultMinimumStepSize)
 	{
@@ -49,7 +191,9 @@ namespace Nz
 			else
 			{
 				// Au moins une autre police utilise cet atlas, on vire nos glyphes un par un
-				for (auto mapIt = m_glyphes.begin(); mapIt != m_glyphes.end(); ++mapIt)
+				// (in distance field mode, sized glyphes only reference the distance field glyphes rectangles)
+				auto& ownedGlyphes = (m_glyphRenderMode == GlyphRenderMode::SignedDistanceField) ? m_distanceFieldGlyphes : m_glyphes;
+				for (auto mapIt = ownedGlyphes.begin(); mapIt != ownedGlyphes.end(); ++mapIt)
 				{
 					GlyphMap& glyphMap = mapIt->second;
 					for (auto glyphIt = glyphMap.begin(); glyphIt != glyphMap.end(); ++glyphIt)
@@ -60,6 +204,7 @@ namespace Nz
 				}
 
 				// Destruction des glyphes mémorisés et notification
+				m_distanceFieldGlyphes.clear();
 				m_glyphes.clear();
 
 				OnFontGlyphCacheCleared(this);
@@ -141,6 +286,16 @@ namespace Nz
 		return count;
 	}
 
+	unsigned int Font::GetDistanceFieldReferenceSize() const
+	{
+		return m_distanceFieldReferenceSize;
+	}
+
+	unsigned int Font::GetDistanceFieldSpread() const
+	{
+		return m_distanceFieldSpread;
+	}
+
 	std::string Font::GetFamilyName() const
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -192,6 +347,11 @@ namespace Nz
 		return m_glyphBorder;
 	}
 
+	GlyphRenderMode Font::GetGlyphRenderMode() const
+	{
+		return m_glyphRenderMode;
+	}
+
 	unsigned int Font::GetMinimumStepSize() const
 	{
 		return m_minimumStepSize;
@@ -266,6 +426,10 @@ namespace Nz
 			return false;
 		}
 
+		// Generate every missing distance field at once, so they can be computed in parallel
+		if (m_glyphRenderMode == GlyphRenderMode::SignedDistanceField && IsValid())
+			PrecacheDistanceFieldGlyphs(ComputeSupportedStyle(style), set);
+
 		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
 		auto& glyphMap = m_glyphes[key];
 		for (char32_t character : set)
@@ -296,6 +460,29 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Sets the parameters of the distance fields used by the SignedDistanceField glyph render mode
+	*
+	* \param referenceSize Character size at which glyphes are rasterized before being turned into distance fields
+	* \param spread Maximal distance (in pixels at reference size) encoded around each glyph, which also bounds outline thickness
+	*
+	* \remark Clears the glyph cache if parameters changed
+	*/
+	void Font::SetDistanceFieldParameters(unsigned int referenceSize, unsigned int spread)
+	{
+		NazaraAssert(referenceSize > 0, "reference size cannot be zero");
+		NazaraAssert(spread > 0, "spread cannot be zero");
+
+		if (m_distanceFieldReferenceSize != referenceSize || m_distanceFieldSpread != spread)
+		{
+			if (m_glyphRenderMode == GlyphRenderMode::SignedDistanceField)
+				ClearGlyphCache();
+
+			m_distanceFieldReferenceSize = referenceSize;
+			m_distanceFieldSpread = spread;
+		}
+	}
+
 	void Font::SetGlyphBorder(unsigned int borderSize)
 	{
 		if (m_glyphBorder != borderSize)
@@ -305,6 +492,25 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Sets how glyphes are rasterized and stored into the atlas
+	*
+	* In SignedDistanceField mode, each glyph is rasterized once (per style) at the distance field reference size and stored as a distance field,
+	* glyphes of every size are then scaled from it and outlines are left to the renderer (reported through fauxOutlineThickness).
+	*
+	* \param renderMode Glyph render mode
+	*
+	* \remark Clears the glyph cache if render mode changed
+	*/
+	void Font::SetGlyphRenderMode(GlyphRenderMode renderMode)
+	{
+		if (m_glyphRenderMode != renderMode)
+		{
+			ClearGlyphCache();
+			m_glyphRenderMode = renderMode;
+		}
+	}
+
 	void Font::SetMinimumStepSize(unsigned int minimumStepSize)
 	{
 		if (m_minimumStepSize != minimumStepSize)
@@ -342,6 +548,11 @@ namespace Nz
 		return s_defaultGlyphBorder;
 	}
 
+	GlyphRenderMode Font::GetDefaultGlyphRenderMode()
+	{
+		return s_defaultGlyphRenderMode;
+	}
+
 	unsigned int Font::GetDefaultMinimumStepSize()
 	{
 		return s_defaultMinimumStepSize;
@@ -381,6 +592,11 @@ namespace Nz
 		s_defaultGlyphBorder = borderSize;
 	}
 
+	void Font::SetDefaultGlyphRenderMode(GlyphRenderMode renderMode)
+	{
+		s_defaultGlyphRenderMode = renderMode;
+	}
+
 	void Font::SetDefaultMinimumStepSize(unsigned int minimumStepSize)
 	{
 		NazaraAssert(minimumStepSize, "minimum step size cannot be zero as it implies a division by zero");
@@ -388,6 +604,19 @@ namespace Nz
 		s_defaultMinimumStepSize = minimumStepSize;
 	}
 
+	UInt64 Font::ComputeDistanceFieldKey(TextStyleFlags style) const
+	{
+		// Distance fields don't depend on size nor outline thickness, only on rasterized style
+		UInt64 key = 0;
+		if (style & TextStyle::Bold)
+			key |= 1 << 0;
+
+		if (style & TextStyle::Italic)
+			key |= 1 << 1;
+
+		return key;
+	}
+
 	UInt64 Font::ComputeKey(unsigned int characterSize, TextStyleFlags style, float outlineThickness) const
 	{
 		// Adjust size to step size
@@ -405,6 +634,18 @@ namespace Nz
 		return (sizeStylePart << 32) | reinterpret_cast<Nz::UInt32&>(outlineThickness);
 	}
 
+	TextStyleFlags Font::ComputeSupportedStyle(TextStyleFlags style) const
+	{
+		TextStyleFlags supportedStyle = style;
+		if (style & TextStyle::Bold && !m_data->SupportsStyle(TextStyle::Bold))
+			supportedStyle &= ~TextStyle::Bold;
+
+		if (style & TextStyle::Italic && !m_data->SupportsStyle(TextStyle::Italic))
+			supportedStyle &= ~TextStyle::Italic;
+
+		return supportedStyle;
+	}
+
 	void Font::OnAtlasCleared(const AbstractAtlas* atlas)
 	{
 		NazaraUnused(atlas);
@@ -419,6 +660,7 @@ namespace Nz
 		#endif
 
 		// Notre atlas vient d'être vidé, détruisons le cache de glyphe
+		m_distanceFieldGlyphes.clear();
 		m_glyphes.clear();
 
 		OnFontGlyphCacheCleared(this);
@@ -443,6 +685,89 @@ namespace Nz
 		OnFontAtlasLayerChanged(this, oldLayer, newLayer);
 	}
 
+	void Font::PrecacheDistanceFieldGlyphs(TextStyleFlags style, const std::u32string_view& characters) const
+	{
+		struct PendingGlyph
+		{
+			Glyph* glyph;
+			FontGlyph fontGlyph;
+			Image field;
+		};
+
+		UInt64 key = ComputeDistanceFieldKey(style);
+		GlyphMap& glyphMap = m_distanceFieldGlyphes[key];
+
+		// Font data isn't thread-safe, rasterize missing glyphes sequentially at reference size
+		std::vector<PendingGlyph> pendingGlyphs;
+		for (char32_t character : characters)
+		{
+			auto [it, inserted] = glyphMap.emplace(character, Glyph{});
+			if (!inserted)
+				continue;
+
+			Glyph& glyph = it->second;
+			glyph.fauxOutlineThickness = 0.f;
+			glyph.requireFauxBold = false;
+			glyph.requireFauxItalic = false;
+			glyph.valid = false;
+
+			PendingGlyph& pendingGlyph = pendingGlyphs.emplace_back();
+			pendingGlyph.glyph = &glyph;
+			if (!ExtractGlyph(m_distanceFieldReferenceSize, character, style, 0.f, &pendingGlyph.fontGlyph))
+			{
+				NazaraWarning("Failed to extract glyph \"" + FromUtf32String(std::u32string_view(&character, 1)) + "\"");
+				pendingGlyphs.pop_back();
+			}
+		}
+
+		// Distance transforms are the expensive part and each only touches its own glyph
+		ParallelFor(pendingGlyphs.size(), 1, [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				PendingGlyph& pendingGlyph = pendingGlyphs[i];
+				if (pendingGlyph.fontGlyph.image.IsValid() && pendingGlyph.fontGlyph.image.GetWidth() > 0 && pendingGlyph.fontGlyph.image.GetHeight() > 0)
+					pendingGlyph.field = BuildDistanceField(pendingGlyph.fontGlyph.image, m_distanceFieldSpread);
+			}
+		});
+
+		int spread = static_cast<int>(m_distanceFieldSpread);
+		for (PendingGlyph& pendingGlyph : pendingGlyphs)
+		{
+			Glyph& glyph = *pendingGlyph.glyph;
+			const FontGlyph& fontGlyph = pendingGlyph.fontGlyph;
+
+			glyph.aabb = fontGlyph.aabb;
+			glyph.advance = fontGlyph.advance;
+			glyph.atlasRect.width = 0;
+			glyph.atlasRect.height = 0;
+
+			if (pendingGlyph.field.IsValid())
+			{
+				glyph.aabb.x -= spread;
+				glyph.aabb.y -= spread;
+				glyph.aabb.width = static_cast<int>(pendingGlyph.field.GetWidth());
+				glyph.aabb.height = static_cast<int>(pendingGlyph.field.GetHeight());
+
+				glyph.atlasRect.width = pendingGlyph.field.GetWidth() + m_glyphBorder*2;
+				glyph.atlasRect.height = pendingGlyph.field.GetHeight() + m_glyphBorder*2;
+
+				if (!m_atlas->Insert(pendingGlyph.field, &glyph.atlasRect, &glyph.flipped, &glyph.layerIndex))
+				{
+					NazaraError("Failed to insert glyph into atlas");
+					continue;
+				}
+
+				glyph.atlasRect.x += m_glyphBorder;
+				glyph.atlasRect.y += m_glyphBorder;
+				glyph.atlasRect.width -= m_glyphBorder*2;
+				glyph.atlasRect.height -= m_glyphBorder*2;
+			}
+
+			glyph.valid = true;
+		}
+	}
+
 	const Font::Glyph& Font::PrecacheGlyph(GlyphMap& glyphMap, unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const
 	{
 		auto it = glyphMap.find(character);
@@ -478,6 +803,38 @@ namespace Nz
 			supportedStyle &= ~TextStyle::Italic;
 		}
 
+		if (m_glyphRenderMode == GlyphRenderMode::SignedDistanceField)
+		{
+			// Scale the glyph from its distance field, outlines are rendered from the same field
+			glyph.fauxOutlineThickness = outlineThickness;
+
+			UInt64 fieldKey = ComputeDistanceFieldKey(supportedStyle);
+			auto fieldIt = m_distanceFieldGlyphes[fieldKey].find(character);
+			if (fieldIt == m_distanceFieldGlyphes[fieldKey].end())
+			{
+				PrecacheDistanceFieldGlyphs(supportedStyle, std::u32string_view(&character, 1));
+				fieldIt = m_distanceFieldGlyphes[fieldKey].find(character);
+			}
+
+			const Glyph& fieldGlyph = fieldIt->second;
+			if (fieldGlyph.valid)
+			{
+				float scale = float(characterSize) / m_distanceFieldReferenceSize;
+
+				glyph.aabb.x = static_cast<int>(std::lround(fieldGlyph.aabb.x * scale));
+				glyph.aabb.y = static_cast<int>(std::lround(fieldGlyph.aabb.y * scale));
+				glyph.aabb.width = static_cast<int>(std::lround(fieldGlyph.aabb.width * scale));
+				glyph.aabb.height = static_cast<int>(std::lround(fieldGlyph.aabb.height * scale));
+				glyph.advance = static_cast<int>(std::lround(fieldGlyph.advance * scale));
+				glyph.atlasRect = fieldGlyph.atlasRect;
+				glyph.flipped = fieldGlyph.flipped;
+				glyph.layerIndex = fieldGlyph.layerIndex;
+				glyph.valid = true;
+			}
+
+			return glyph;
+		}
+
 		float supportedOutlineThickness = outlineThickness;
 		if (outlineThickness > 0.f && !m_data->SupportsOutline(outlineThickness))
 		{
@@ -552,6 +909,7 @@ namespace Nz
 	{
 		s_defaultAtlas = std::make_shared<GuillotineImageAtlas>();
 		s_defaultGlyphBorder = 1;
+		s_defaultGlyphRenderMode = GlyphRenderMode::Bitmap;
 		s_defaultMinimumStepSize = 1;
 
 		return true;
@@ -565,6 +923,7 @@ namespace Nz
 
 	std::shared_ptr<AbstractAtlas> Font::s_defaultAtlas;
 	std::shared_ptr<Font> Font::s_defaultFont;
+	GlyphRenderMode Font::s_defaultGlyphRenderMode;
 	unsigned int Font::s_defaultGlyphBorder;
 	unsigned int Font::s_defaultMinimumStepSize;
 }
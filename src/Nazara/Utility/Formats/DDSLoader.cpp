@@ -60,7 +60,8 @@ namespace Nz
 				if (header.flags & DDSD_DEPTH)
 					depth = std::max(header.depth, 1U);
 
-				unsigned int levelCount = (parameters.levelCount > 0) ? std::min(parameters.levelCount, SafeCast<UInt8>(header.levelCount)) : header.levelCount;
+				UInt8 fileLevelCount = SafeCast<UInt8>(std::max(header.levelCount, 1U));
+				unsigned int levelCount = (parameters.levelCount > 0) ? std::min(parameters.levelCount, fileLevelCount) : fileLevelCount;
 
 				// First, identify the type
 				ImageType type;
@@ -74,6 +75,37 @@ namespace Nz
 
 				std::shared_ptr<Image> image = std::make_shared<Image>(type, format, width, height, depth, levelCount);
 
+				// Cubemaps are stored face by face, each face with its own mip chain
+				if (type == ImageType::Cubemap)
+				{
+					for (unsigned int face = 0; face < 6; ++face)
+					{
+						for (UInt8 level = 0; level < fileLevelCount; ++level)
+						{
+							unsigned int levelSize = std::max(width >> level, 1U);
+							std::size_t byteCount = PixelFormatInfo::ComputeSize(format, levelSize, levelSize, 1);
+
+							if (level < image->GetLevelCount())
+							{
+								// GetPixels doesn't handle block-compressed formats, faces are contiguous and byteCount bytes long
+								UInt8* facePixels = image->GetPixels(0, 0, 0, level) + byteCount * face;
+								if (byteStream.Read(facePixels, byteCount) != byteCount)
+								{
+									NazaraError("Failed to read face #" + NumberToString(face) + " level #" + NumberToString(level));
+									return Nz::Err(ResourceLoadingError::DecodingError);
+								}
+							}
+							else
+								stream.SetCursorPos(stream.GetCursorPos() + byteCount);
+						}
+					}
+
+					if (parameters.loadFormat != PixelFormat::Undefined)
+						image->Convert(parameters.loadFormat);
+
+					return image;
+				}
+
 				// Read all mipmap levels
 				for (UInt8 i = 0; i < image->GetLevelCount(); i++)
 				{
@@ -105,6 +137,48 @@ namespace Nz
 			}
 
 		private:
+			// DDS masks describe little-endian pixels, which doesn't match our masks
+			static bool IdentifyCommonMaskFormat(const DDSPixelFormat& pixelFormat, PixelFormat* format)
+			{
+				struct CommonFormat
+				{
+					PixelFormat format;
+					UInt32 flags;
+					UInt32 bpp;
+					UInt32 redMask;
+					UInt32 greenMask;
+					UInt32 blueMask;
+					UInt32 alphaMask;
+				};
+
+				static constexpr CommonFormat commonFormats[] = {
+					{ PixelFormat::A8,    DDPF_ALPHA,                     8,  0,          0,          0,          0xFF       },
+					{ PixelFormat::BGR8,  DDPF_RGB,                       24, 0xFF0000,   0x00FF00,   0x0000FF,   0          },
+					{ PixelFormat::BGRA8, DDPF_RGB | DDPF_ALPHAPIXELS,    32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000 },
+					{ PixelFormat::L8,    DDPF_LUMINANCE,                 8,  0xFF,       0,          0,          0          },
+					{ PixelFormat::RGB8,  DDPF_RGB,                       24, 0x0000FF,   0x00FF00,   0xFF0000,   0          },
+					{ PixelFormat::RGBA8, DDPF_RGB | DDPF_ALPHAPIXELS,    32, 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000 }
+				};
+
+				constexpr UInt32 relevantFlags = DDPF_ALPHA | DDPF_ALPHAPIXELS | DDPF_LUMINANCE | DDPF_RGB;
+				for (const CommonFormat& commonFormat : commonFormats)
+				{
+					if ((pixelFormat.flags & relevantFlags) != commonFormat.flags || pixelFormat.bpp != commonFormat.bpp)
+						continue;
+
+					if (pixelFormat.redMask != commonFormat.redMask || pixelFormat.alphaMask != commonFormat.alphaMask)
+						continue;
+
+					if ((pixelFormat.flags & DDPF_RGB) && (pixelFormat.greenMask != commonFormat.greenMask || pixelFormat.blueMask != commonFormat.blueMask))
+						continue;
+
+					*format = commonFormat.format;
+					return true;
+				}
+
+				return false;
+			}
+
 			static bool IdentifyImageType(const DDSHeader& header, const DDSHeaderDX10Ext& headerExt, ImageType* type)
 			{
 				if (headerExt.arraySize > 1)
@@ -151,6 +225,9 @@ namespace Nz
 			{
 				if (header.format.flags & (DDPF_RGB | DDPF_ALPHA | DDPF_ALPHAPIXELS | DDPF_LUMINANCE))
 				{
+					if (IdentifyCommonMaskFormat(header.format, format))
+						return true;
+
 					PixelFormatDescription info(PixelFormatContent::ColorRGBA, SafeCast<UInt8>(header.format.bpp), PixelFormatSubType::Unsigned);
 
 					if (header.format.flags & DDPF_RGB)
@@ -183,7 +260,17 @@ namespace Nz
 							break;
 
 						case D3DFMT_DXT5:
-							*format = PixelFormat::DXT3;
+							*format = PixelFormat::DXT5;
+							break;
+
+						case D3DFMT_ATI1:
+						case D3DFMT_BC4U:
+							*format = PixelFormat::BC4;
+							break;
+
+						case D3DFMT_ATI2:
+						case D3DFMT_BC5U:
+							*format = PixelFormat::BC5;
 							break;
 
 						case D3DFMT_DX10:
@@ -216,11 +303,34 @@ namespace Nz
 								case DXGI_FORMAT_R16G16B16A16_UNORM:
 									*format = PixelFormat::RGBA16UI;
 									break;
+								case DXGI_FORMAT_R8G8B8A8_UNORM:
+									*format = PixelFormat::RGBA8;
+									break;
+								case DXGI_FORMAT_B8G8R8A8_UNORM:
+									*format = PixelFormat::BGRA8;
+									break;
+								case DXGI_FORMAT_BC1_UNORM:
+									*format = PixelFormat::DXT1;
+									break;
+								case DXGI_FORMAT_BC2_UNORM:
+									*format = PixelFormat::DXT3;
+									break;
+								case DXGI_FORMAT_BC3_UNORM:
+									*format = PixelFormat::DXT5;
+									break;
+								case DXGI_FORMAT_BC4_UNORM:
+									*format = PixelFormat::BC4;
+									break;
+								case DXGI_FORMAT_BC5_UNORM:
+									*format = PixelFormat::BC5;
+									break;
+								case DXGI_FORMAT_BC7_UNORM:
+									*format = PixelFormat::BC7;
+									break;
 
 								default:
-									//TODO
-									NazaraError("TODO");
-									break;
+									NazaraError("Unhandled DXGI format " + NumberToString(UnderlyingCast(headerExt.dxgiFormat)));
+									return false;
 							}
 							break;
 						}
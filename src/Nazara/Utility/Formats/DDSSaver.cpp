@@ -0,0 +1,262 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/Formats/DDSSaver.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <Nazara/Utility/Formats/DDSConstants.hpp>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		bool IsDDSSupportedSave(const std::string_view& extension)
+		{
+			return (extension == ".dds");
+		}
+
+		// Fills the pixel format part of the header, returns false if the image has to be converted first
+		bool SetupPixelFormat(PixelFormat format, DDSPixelFormat& pixelFormat, DDSHeaderDX10Ext& headerDX10, bool& useDX10)
+		{
+			pixelFormat = {};
+			pixelFormat.size = sizeof(DDSPixelFormat);
+			useDX10 = false;
+
+			auto SetMasks = [&](UInt32 flags, UInt32 bpp, UInt32 redMask, UInt32 greenMask, UInt32 blueMask, UInt32 alphaMask)
+			{
+				pixelFormat.flags = flags;
+				pixelFormat.bpp = bpp;
+				pixelFormat.redMask = redMask;
+				pixelFormat.greenMask = greenMask;
+				pixelFormat.blueMask = blueMask;
+				pixelFormat.alphaMask = alphaMask;
+			};
+
+			auto SetDXGIFormat = [&](DXGI_FORMAT dxgiFormat)
+			{
+				pixelFormat.flags = DDPF_FOURCC;
+				pixelFormat.fourCC = D3DFMT_DX10;
+				headerDX10.dxgiFormat = dxgiFormat;
+				useDX10 = true;
+			};
+
+			switch (format)
+			{
+				// DDS masks describe little-endian pixels
+				case PixelFormat::A8:
+					SetMasks(DDPF_ALPHA, 8, 0, 0, 0, 0xFF);
+					return true;
+
+				case PixelFormat::BGR8:
+					SetMasks(DDPF_RGB, 24, 0xFF0000, 0x00FF00, 0x0000FF, 0);
+					return true;
+
+				case PixelFormat::BGRA8:
+					SetMasks(DDPF_RGB | DDPF_ALPHAPIXELS, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+					return true;
+
+				case PixelFormat::L8:
+					SetMasks(DDPF_LUMINANCE, 8, 0xFF, 0, 0, 0);
+					return true;
+
+				case PixelFormat::RGB8:
+					SetMasks(DDPF_RGB, 24, 0x0000FF, 0x00FF00, 0xFF0000, 0);
+					return true;
+
+				case PixelFormat::RGBA8:
+					SetMasks(DDPF_RGB | DDPF_ALPHAPIXELS, 32, 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000);
+					return true;
+
+				// Compressed formats predating DX10 are still written with their FourCC for compatibility with older tools
+				case PixelFormat::DXT1:
+					pixelFormat.flags = DDPF_FOURCC;
+					pixelFormat.fourCC = D3DFMT_DXT1;
+					return true;
+
+				case PixelFormat::DXT3:
+					pixelFormat.flags = DDPF_FOURCC;
+					pixelFormat.fourCC = D3DFMT_DXT3;
+					return true;
+
+				case PixelFormat::DXT5:
+					pixelFormat.flags = DDPF_FOURCC;
+					pixelFormat.fourCC = D3DFMT_DXT5;
+					return true;
+
+				case PixelFormat::BC4:
+					SetDXGIFormat(DXGI_FORMAT_BC4_UNORM);
+					return true;
+
+				case PixelFormat::BC5:
+					SetDXGIFormat(DXGI_FORMAT_BC5_UNORM);
+					return true;
+
+				case PixelFormat::BC7:
+					SetDXGIFormat(DXGI_FORMAT_BC7_UNORM);
+					return true;
+
+				case PixelFormat::RGBA32F:
+					SetDXGIFormat(DXGI_FORMAT_R32G32B32A32_FLOAT);
+					return true;
+
+				default:
+					return false;
+			}
+		}
+
+		bool SaveDDSToStream(const Image& image, const std::string& format, Stream& stream, const ImageParams& parameters)
+		{
+			NAZARA_USE_ANONYMOUS_NAMESPACE
+
+			NazaraUnused(parameters);
+
+			if (!image.IsValid())
+			{
+				NazaraError("Invalid image");
+				return false;
+			}
+
+			ImageType type = image.GetType();
+			if (type == ImageType::E1D_Array || type == ImageType::E2D_Array)
+			{
+				NazaraError("Array images cannot be saved to " + format + " format");
+				return false;
+			}
+
+			Image tempImage(image); //< We're using COW here to prevent Image copy unless required
+
+			DDSHeader header = {};
+			DDSHeaderDX10Ext headerDX10 = {};
+			bool useDX10;
+			if (!SetupPixelFormat(tempImage.GetFormat(), header.format, headerDX10, useDX10))
+			{
+				// Formats without a DDS equivalent are saved as RGBA8
+				if (!tempImage.Convert(PixelFormat::RGBA8))
+				{
+					NazaraError("Failed to convert image to a suitable format");
+					return false;
+				}
+
+				SetupPixelFormat(tempImage.GetFormat(), header.format, headerDX10, useDX10);
+			}
+
+			PixelFormat pixelFormat = tempImage.GetFormat();
+			bool isCompressed = PixelFormatInfo::IsCompressed(pixelFormat);
+			UInt8 levelCount = tempImage.GetLevelCount();
+
+			header.size = sizeof(DDSHeader);
+			header.flags = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT;
+			header.width = tempImage.GetWidth();
+			header.height = tempImage.GetHeight();
+			header.levelCount = levelCount;
+			header.ddsCaps[0] = DDSCAPS_TEXTURE;
+
+			if (isCompressed)
+			{
+				header.flags |= DDSD_LINEARSIZE;
+				header.pitch = UInt32(PixelFormatInfo::ComputeSize(pixelFormat, header.width, header.height, 1));
+			}
+			else
+			{
+				header.flags |= DDSD_PITCH;
+				header.pitch = header.width * PixelFormatInfo::GetBytesPerPixel(pixelFormat);
+			}
+
+			if (levelCount > 1)
+			{
+				header.flags |= DDSD_MIPMAPCOUNT;
+				header.ddsCaps[0] |= DDSCAPS_COMPLEX | DDSCAPS_MIPMAP;
+			}
+
+			headerDX10.arraySize = 1;
+			headerDX10.resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE2D;
+
+			switch (type)
+			{
+				case ImageType::Cubemap:
+					header.ddsCaps[0] |= DDSCAPS_COMPLEX;
+					header.ddsCaps[1] = DDSCAPS2_CUBEMAP | DDSCAPS2_CUBEMAP_ALLFACES;
+					headerDX10.miscFlag = D3D10_RESOURCE_MISC_TEXTURECUBE;
+					break;
+
+				case ImageType::E1D:
+					headerDX10.resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE1D;
+					break;
+
+				case ImageType::E3D:
+					header.flags |= DDSD_DEPTH;
+					header.depth = tempImage.GetDepth();
+					header.ddsCaps[0] |= DDSCAPS_COMPLEX;
+					header.ddsCaps[1] = DDSCAPS2_VOLUME;
+					headerDX10.resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE3D;
+					break;
+
+				default:
+					break;
+			}
+
+			ByteStream byteStream(&stream);
+			byteStream.SetDataEndianness(Endianness::LittleEndian);
+
+			byteStream << DDS_Magic;
+			byteStream << header;
+			if (useDX10)
+				byteStream << headerDX10;
+
+			// Cubemaps are stored face by face (each with its mip chain), other images level by level
+			auto WriteData = [&](const UInt8* data, std::size_t byteCount)
+			{
+				if (byteStream.Write(data, byteCount) != byteCount)
+				{
+					NazaraError("Failed to write image data");
+					return false;
+				}
+
+				return true;
+			};
+
+			if (type == ImageType::Cubemap)
+			{
+				for (unsigned int face = 0; face < 6; ++face)
+				{
+					for (UInt8 level = 0; level < levelCount; ++level)
+					{
+						std::size_t faceSize = PixelFormatInfo::ComputeSize(pixelFormat, tempImage.GetWidth(level), tempImage.GetHeight(level), 1);
+						// GetConstPixels doesn't handle block-compressed formats, faces are contiguous and faceSize bytes long
+						if (!WriteData(tempImage.GetConstPixels(0, 0, 0, level) + faceSize * face, faceSize))
+							return false;
+					}
+				}
+			}
+			else
+			{
+				for (UInt8 level = 0; level < levelCount; ++level)
+				{
+					if (!WriteData(tempImage.GetConstPixels(0, 0, 0, level), tempImage.GetMemoryUsage(level)))
+						return false;
+				}
+			}
+
+			return true;
+		}
+	}
+
+	namespace Loaders
+	{
+		ImageSaver::Entry GetImageSaver_DDS()
+		{
+			NAZARA_USE_ANONYMOUS_NAMESPACE
+
+			ImageSaver::Entry entry;
+			entry.formatSupport = IsDDSSupportedSave;
+			entry.streamSaver = SaveDDSToStream;
+
+			return entry;
+		}
+	}
+}
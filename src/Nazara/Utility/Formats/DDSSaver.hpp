@@ -0,0 +1,18 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_UTILITY_FORMATS_DDSSAVER_HPP
+#define NAZARA_UTILITY_FORMATS_DDSSAVER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Utility/Image.hpp>
+
+namespace Nz::Loaders
+{
+	ImageSaver::Entry GetImageSaver_DDS();
+}
+
+#endif // NAZARA_UTILITY_FORMATS_DDSSAVER_HPP
@@ -73,8 +73,14 @@ namespace Nz
 			unsigned int width = header.xmax - header.xmin+1;
 			unsigned int height = header.ymax - header.ymin+1;
 
+			UInt8 levelCount = 1;
+			if (parameters.levelCount > 0)
+				levelCount = parameters.levelCount;
+			else if (parameters.generateMipmaps)
+				levelCount = Image::GetMaxLevel(width, height);
+
 			std::shared_ptr<Image> image = std::make_shared<Image>();
-			if (!image->Create(ImageType::E2D, PixelFormat::RGB8, width, height, 1, (parameters.levelCount > 0) ? parameters.levelCount : 1))
+			if (!image->Create(ImageType::E2D, PixelFormat::RGB8, width, height, 1, levelCount))
 			{
 				NazaraError("Failed to create image");
 				return Err(ResourceLoadingError::Internal);
@@ -315,6 +321,12 @@ namespace Nz
 					return Err(ResourceLoadingError::DecodingError);
 			}
 
+			if (parameters.generateMipmaps && !image->GenerateMipmaps(parameters.mipmapParams))
+			{
+				NazaraError("Failed to generate mipmaps");
+				return Err(ResourceLoadingError::Internal);
+			}
+
 			if (parameters.loadFormat != PixelFormat::Undefined)
 				image->Convert(parameters.loadFormat);
 
@@ -70,8 +70,14 @@ namespace Nz
 				stbi_image_free(ptr);
 			});
 
+			UInt8 levelCount = 1;
+			if (parameters.levelCount > 0)
+				levelCount = parameters.levelCount;
+			else if (parameters.generateMipmaps)
+				levelCount = Image::GetMaxLevel(width, height);
+
 			std::shared_ptr<Image> image = std::make_shared<Image>();
-			if (!image->Create(ImageType::E2D, PixelFormat::RGBA8, width, height, 1, (parameters.levelCount > 0) ? parameters.levelCount : 1))
+			if (!image->Create(ImageType::E2D, PixelFormat::RGBA8, width, height, 1, levelCount))
 			{
 				NazaraError("Failed to create image");
 				return Err(ResourceLoadingError::Internal);
@@ -81,6 +87,12 @@ namespace Nz
 
 			freeStbiImage.CallAndReset();
 
+			if (parameters.generateMipmaps && !image->GenerateMipmaps(parameters.mipmapParams))
+			{
+				NazaraError("Failed to generate mipmaps");
+				return Err(ResourceLoadingError::Internal);
+			}
+
 			if (parameters.loadFormat != PixelFormat::Undefined)
 			{
 				if (!image->Convert(parameters.loadFormat))
@@ -5,11 +5,26 @@
 #include <Nazara/Utility/Image.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/ParallelFor.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <Nazara/Utility/BlockCompressor.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utility/PixelFormat.hpp>
 #include <Nazara/Utility/Utility.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstring>
 #include <memory>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NAZARA_UTILITY_IMAGE_SSE2
+	#include <emmintrin.h>
+#endif
+
 #include <Nazara/Utility/Debug.hpp>
 
 ///TODO: Rajouter des warnings (Formats compressés avec les méthodes Copy/Update, tests taille dans Copy)
@@ -20,6 +35,8 @@ namespace Nz
 {
 	namespace
 	{
+		constexpr std::size_t ConversionGrainSize = 64 * 1024; //< Minimum number of pixels converted per thread
+
 		inline unsigned int GetImageLevelSize(unsigned int size, UInt8 level)
 		{
 			if (size == 0) // Possible dans le cas d'une image invalide
@@ -28,6 +45,482 @@ namespace Nz
 			return std::max(size >> level, 1U);
 		}
 
+		bool ConvertFace(PixelFormat srcFormat, PixelFormat dstFormat, const UInt8* src, UInt8* dst, unsigned int width, unsigned int height)
+		{
+			UInt8 dstBpp = PixelFormatInfo::GetBytesPerPixel(dstFormat);
+
+			std::atomic_bool succeeded(true);
+			if (PixelFormatInfo::IsCompressed(srcFormat))
+			{
+				// Rows of 4x4 blocks are independent, each chunk decompresses a horizontal band of the image
+				unsigned int blockCountX = (width + 3) / 4;
+				unsigned int blockRowCount = (height + 3) / 4;
+				std::size_t blockRowSize = PixelFormatInfo::ComputeSize(srcFormat, width, 4, 1);
+				std::size_t dstRowSize = std::size_t(width) * dstBpp;
+
+				ParallelFor(blockRowCount, std::max<std::size_t>(ConversionGrainSize / (blockCountX * 16), 1), [&](std::size_t begin, std::size_t end)
+				{
+					unsigned int firstRow = static_cast<unsigned int>(begin * 4);
+					unsigned int rowCount = std::min(static_cast<unsigned int>(end * 4), height) - firstRow;
+
+					if (!PixelFormatInfo::Decompress(srcFormat, dstFormat, &src[begin * blockRowSize], width, rowCount, &dst[firstRow * dstRowSize]))
+						succeeded = false;
+				});
+			}
+			else
+			{
+				// Conversion functions work pixel per pixel, we can split the work on any pixel boundary
+				const PixelFormatInfo::ConvertFunction& convertFunction = PixelFormatInfo::GetConvertFunction(srcFormat, dstFormat);
+				UInt8 srcBpp = PixelFormatInfo::GetBytesPerPixel(srcFormat);
+				ParallelFor(std::size_t(width) * height, ConversionGrainSize, [&](std::size_t begin, std::size_t end)
+				{
+					if (!convertFunction(&src[begin * srcBpp], &src[end * srcBpp], &dst[begin * dstBpp]))
+						succeeded = false;
+				});
+			}
+
+			return succeeded;
+		}
+
+		constexpr std::size_t ResamplingGrainSize = 16 * 1024; //< Minimum number of pixels resampled per thread
+
+		constexpr float KaiserAlpha = 4.f;
+		constexpr float KaiserRadius = 3.f;
+
+		struct ResamplingAxis
+		{
+			std::vector<float> weights; //< tapCount weights per destination index
+			std::vector<unsigned int> firstSource;
+			unsigned int dstLength;
+			unsigned int srcLength;
+			unsigned int tapCount;
+		};
+
+		float BesselI0(float x)
+		{
+			// Power series of the zeroth order modified Bessel function of the first kind
+			float sum = 1.f;
+			float term = 1.f;
+			float halfX = x * 0.5f;
+			for (unsigned int k = 1; k < 32; ++k)
+			{
+				term *= halfX / k;
+				float squaredTerm = term * term;
+				sum += squaredTerm;
+				if (squaredTerm < sum * 1e-8f)
+					break;
+			}
+
+			return sum;
+		}
+
+		float EvaluateFilter(ImageFilter filter, float x)
+		{
+			x = std::abs(x);
+			switch (filter)
+			{
+				case ImageFilter::Box:
+					return (x <= 0.5f) ? 1.f : 0.f;
+
+				case ImageFilter::Triangle:
+					return std::max(1.f - x, 0.f);
+
+				case ImageFilter::Kaiser:
+				{
+					if (x >= KaiserRadius)
+						return 0.f;
+
+					float sinc = (x > 0.f) ? std::sin(Pi<float> * x) / (Pi<float> * x) : 1.f;
+					float t = x / KaiserRadius;
+					return sinc * BesselI0(KaiserAlpha * std::sqrt(1.f - t * t)) / BesselI0(KaiserAlpha);
+				}
+			}
+
+			return 0.f;
+		}
+
+		float GetFilterRadius(ImageFilter filter)
+		{
+			switch (filter)
+			{
+				case ImageFilter::Box:      return 0.5f;
+				case ImageFilter::Triangle: return 1.f;
+				case ImageFilter::Kaiser:   return KaiserRadius;
+			}
+
+			return 0.5f;
+		}
+
+		ResamplingAxis BuildIdentityAxis(unsigned int srcLength, unsigned int dstLength)
+		{
+			// Used for array layers which are never filtered together, destination layer i comes from source layer i
+			ResamplingAxis axis;
+			axis.dstLength = dstLength;
+			axis.srcLength = srcLength;
+			axis.tapCount = 1;
+			axis.weights.assign(dstLength, 1.f);
+			axis.firstSource.resize(dstLength);
+			for (unsigned int i = 0; i < dstLength; ++i)
+				axis.firstSource[i] = i;
+
+			return axis;
+		}
+
+		ResamplingAxis BuildResamplingAxis(unsigned int srcLength, unsigned int dstLength, ImageFilter filter)
+		{
+			float scale = float(srcLength) / dstLength;
+			float filterScale = std::max(scale, 1.f); //< Widen the filter when downsampling to prevent aliasing
+			float support = GetFilterRadius(filter) * filterScale;
+
+			ResamplingAxis axis;
+			axis.dstLength = dstLength;
+			axis.srcLength = srcLength;
+			axis.tapCount = std::min(static_cast<unsigned int>(std::ceil(support * 2.f)) + 1, srcLength);
+			axis.weights.resize(std::size_t(dstLength) * axis.tapCount, 0.f);
+			axis.firstSource.resize(dstLength);
+
+			int lastSource = int(srcLength) - 1;
+			for (unsigned int i = 0; i < dstLength; ++i)
+			{
+				// Position of the destination pixel center in source pixel coordinates
+				float center = (i + 0.5f) * scale - 0.5f;
+				int first = std::clamp(static_cast<int>(std::floor(center - support + 0.5f)), 0, lastSource);
+				int last = std::clamp(static_cast<int>(std::ceil(center + support - 0.5f)), 0, lastSource);
+				last = std::min(last, first + int(axis.tapCount) - 1);
+
+				float* weights = &axis.weights[std::size_t(i) * axis.tapCount];
+				float weightSum = 0.f;
+				for (int j = static_cast<int>(std::floor(center - support)); j <= static_cast<int>(std::ceil(center + support)); ++j)
+				{
+					float weight;
+					if (filter == ImageFilter::Box)
+					{
+						// Exact coverage of the source pixel by the destination footprint
+						float begin = std::max(j - 0.5f, center - 0.5f * filterScale);
+						float end = std::min(j + 0.5f, center + 0.5f * filterScale);
+						weight = std::max(end - begin, 0.f);
+					}
+					else
+						weight = EvaluateFilter(filter, (j - center) / filterScale);
+
+					if (weight == 0.f)
+						continue;
+
+					// Clamp to edge
+					int source = std::clamp(j, first, last);
+					weights[source - first] += weight;
+					weightSum += weight;
+				}
+
+				if (std::abs(weightSum) > 1e-6f)
+				{
+					for (unsigned int tap = 0; tap < axis.tapCount; ++tap)
+						weights[tap] /= weightSum;
+				}
+				else
+				{
+					first = std::clamp(static_cast<int>(std::lround(center)), 0, lastSource);
+					weights[0] = 1.f;
+				}
+
+				axis.firstSource[i] = static_cast<unsigned int>(first);
+			}
+
+			return axis;
+		}
+
+		void ResampleAxis(const float* src, float* dst, const ResamplingAxis& axis, std::size_t innerPixelCount, std::size_t outerCount)
+		{
+			// Pixels are laid out as [outer][axis][inner], each destination "line" of innerPixelCount pixels is a weighted sum of source lines
+			std::size_t innerSize = innerPixelCount * 4;
+			ParallelFor(outerCount * axis.dstLength, std::max<std::size_t>(ResamplingGrainSize / innerPixelCount, 1), [&](std::size_t begin, std::size_t end)
+			{
+				for (std::size_t line = begin; line < end; ++line)
+				{
+					std::size_t outer = line / axis.dstLength;
+					std::size_t index = line % axis.dstLength;
+
+					const float* weights = &axis.weights[index * axis.tapCount];
+					const float* srcLines = &src[(outer * axis.srcLength + axis.firstSource[index]) * innerSize];
+					float* dstLine = &dst[line * innerSize];
+
+					std::fill(dstLine, dstLine + innerSize, 0.f);
+					for (unsigned int tap = 0; tap < axis.tapCount; ++tap)
+					{
+						float weight = weights[tap];
+						if (weight == 0.f)
+							continue;
+
+						const float* srcLine = &srcLines[tap * innerSize];
+						for (std::size_t i = 0; i < innerSize; ++i)
+							dstLine[i] += weight * srcLine[i];
+					}
+				}
+			});
+		}
+
+		void Resample(std::vector<float>& pixels, const Vector3ui& srcSize, const Vector3ui& dstSize, const ResamplingAxis& xAxis, const ResamplingAxis& yAxis, const ResamplingAxis& zAxis)
+		{
+			// Separable filtering, one axis at a time (starting with the X axis as it usually reduces the most the amount of data)
+			std::vector<float> buffer;
+			auto ProcessAxis = [&](const ResamplingAxis& axis, std::size_t innerPixelCount, std::size_t outerCount)
+			{
+				if (axis.srcLength == axis.dstLength && axis.tapCount == 1)
+					return;
+
+				buffer.resize(innerPixelCount * axis.dstLength * outerCount * 4);
+				ResampleAxis(pixels.data(), buffer.data(), axis, innerPixelCount, outerCount);
+				std::swap(pixels, buffer);
+			};
+
+			ProcessAxis(xAxis, 1, std::size_t(srcSize.y) * srcSize.z);
+			ProcessAxis(yAxis, dstSize.x, srcSize.z);
+			ProcessAxis(zAxis, std::size_t(dstSize.x) * dstSize.y, 1);
+		}
+
+		PixelFormat GetLinearLayout(PixelFormat format, bool* isSRGB)
+		{
+			// sRGB formats share their layout with their linear counterpart, we handle the transfer function ourselves
+			*isSRGB = true;
+			switch (format)
+			{
+				case PixelFormat::BGR8_SRGB:  return PixelFormat::BGR8;
+				case PixelFormat::BGRA8_SRGB: return PixelFormat::BGRA8;
+				case PixelFormat::RGB8_SRGB:  return PixelFormat::RGB8;
+				case PixelFormat::RGBA8_SRGB: return PixelFormat::RGBA8;
+				default:
+					*isSRGB = false;
+					return format;
+			}
+		}
+
+		bool CanResample(PixelFormat layout)
+		{
+			if (PixelFormatInfo::IsCompressed(layout) || PixelFormatInfo::GetContent(layout) != PixelFormatContent::ColorRGBA)
+				return false;
+
+			if (!PixelFormatInfo::IsConversionSupported(layout, PixelFormat::RGBA32F))
+				return false;
+
+			// Formats without a direct conversion from RGBA32F go through RGBA8
+			return PixelFormatInfo::IsConversionSupported(PixelFormat::RGBA32F, layout) || PixelFormatInfo::IsConversionSupported(PixelFormat::RGBA8, layout);
+		}
+
+		const std::array<float, 256>& GetSRGBToLinearTable()
+		{
+			static std::array<float, 256> table = []
+			{
+				std::array<float, 256> values;
+				for (std::size_t i = 0; i < values.size(); ++i)
+				{
+					float c = i / 255.f;
+					values[i] = (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+				}
+
+				return values;
+			}();
+
+			return table;
+		}
+
+		inline float LinearToSRGB(float c)
+		{
+			c = std::clamp(c, 0.f, 1.f);
+			return (c <= 0.0031308f) ? c * 12.92f : 1.055f * std::pow(c, 1.f / 2.4f) - 0.055f;
+		}
+
+		void DecodeToLinear(PixelFormat layout, bool sRGB, const UInt8* src, std::size_t pixelCount, float* dst)
+		{
+			UInt8 bpp = PixelFormatInfo::GetBytesPerPixel(layout);
+			const PixelFormatInfo::ConvertFunction& convertFunction = PixelFormatInfo::GetConvertFunction(layout, PixelFormat::RGBA32F);
+			bool unorm8 = (PixelFormatInfo::GetInfo(layout).redType == PixelFormatSubType::Unsigned && bpp <= 4);
+
+			ParallelFor(pixelCount, ConversionGrainSize, [&](std::size_t begin, std::size_t end)
+			{
+				float* dstPtr = &dst[begin * 4];
+				if (layout == PixelFormat::RGBA32F)
+					std::memcpy(dstPtr, &src[begin * bpp], (end - begin) * 4 * sizeof(float));
+				else
+					convertFunction(&src[begin * bpp], &src[end * bpp], reinterpret_cast<UInt8*>(dstPtr));
+
+				if (sRGB)
+				{
+					const auto& table = GetSRGBToLinearTable();
+					for (std::size_t i = 0; i < (end - begin) * 4; i += 4)
+					{
+						for (std::size_t j = 0; j < 3; ++j)
+						{
+							float& c = dstPtr[i + j];
+							c = (unorm8) ? table[static_cast<std::size_t>(c * 255.f + 0.5f)] : ((c <= 0.04045f) ? c / 12.92f : std::pow((std::max(c, 0.f) + 0.055f) / 1.055f, 2.4f));
+						}
+					}
+				}
+			});
+		}
+
+		void EncodeFromLinear(PixelFormat layout, bool sRGB, float alphaScale, const float* src, std::size_t pixelCount, UInt8* dst)
+		{
+			UInt8 bpp = PixelFormatInfo::GetBytesPerPixel(layout);
+			bool directConversion = (layout == PixelFormat::RGBA32F || PixelFormatInfo::IsConversionSupported(PixelFormat::RGBA32F, layout));
+			const PixelFormatInfo::ConvertFunction& toRGBA8 = PixelFormatInfo::GetConvertFunction(PixelFormat::RGBA32F, PixelFormat::RGBA8);
+			const PixelFormatInfo::ConvertFunction& fromRGBA8 = PixelFormatInfo::GetConvertFunction(PixelFormat::RGBA8, layout);
+
+			ParallelFor(pixelCount, ConversionGrainSize, [&](std::size_t begin, std::size_t end)
+			{
+				std::size_t count = end - begin;
+				const float* srcPtr = &src[begin * 4];
+				UInt8* dstPtr = &dst[begin * bpp];
+
+				std::vector<float> encoded;
+				if (sRGB || alphaScale != 1.f)
+				{
+					encoded.assign(srcPtr, srcPtr + count * 4);
+					for (std::size_t i = 0; i < count * 4; i += 4)
+					{
+						if (sRGB)
+						{
+							encoded[i + 0] = LinearToSRGB(encoded[i + 0]);
+							encoded[i + 1] = LinearToSRGB(encoded[i + 1]);
+							encoded[i + 2] = LinearToSRGB(encoded[i + 2]);
+						}
+
+						encoded[i + 3] = std::min(encoded[i + 3] * alphaScale, 1.f);
+					}
+
+					srcPtr = encoded.data();
+				}
+
+				const UInt8* srcStart = reinterpret_cast<const UInt8*>(srcPtr);
+				const UInt8* srcEnd = reinterpret_cast<const UInt8*>(srcPtr + count * 4);
+				if (layout == PixelFormat::RGBA32F)
+					std::memcpy(dstPtr, srcStart, count * 4 * sizeof(float));
+				else if (directConversion)
+					PixelFormatInfo::GetConvertFunction(PixelFormat::RGBA32F, layout)(srcStart, srcEnd, dstPtr);
+				else
+				{
+					std::vector<UInt8> rgba8(count * 4);
+					toRGBA8(srcStart, srcEnd, rgba8.data());
+					if (layout == PixelFormat::RGBA8)
+						std::memcpy(dstPtr, rgba8.data(), rgba8.size());
+					else
+						fromRGBA8(rgba8.data(), rgba8.data() + rgba8.size(), dstPtr);
+				}
+			});
+		}
+
+		float ComputeAlphaCoverage(const float* pixels, std::size_t pixelCount, float alphaReference, float alphaScale)
+		{
+			std::size_t coveredPixels = 0;
+			for (std::size_t i = 0; i < pixelCount; ++i)
+			{
+				if (pixels[i * 4 + 3] * alphaScale > alphaReference)
+					coveredPixels++;
+			}
+
+			return float(coveredPixels) / pixelCount;
+		}
+
+		float FindAlphaScale(const float* pixels, std::size_t pixelCount, float alphaReference, float targetCoverage)
+		{
+			// Binary search of the alpha scale giving the closest coverage to the first level one
+			float minScale = 0.f;
+			float maxScale = 4.f;
+			float bestScale = 1.f;
+			float bestError = std::abs(ComputeAlphaCoverage(pixels, pixelCount, alphaReference, 1.f) - targetCoverage);
+			for (unsigned int i = 0; i < 10; ++i)
+			{
+				float scale = (minScale + maxScale) * 0.5f;
+				float coverage = ComputeAlphaCoverage(pixels, pixelCount, alphaReference, scale);
+				float error = std::abs(coverage - targetCoverage);
+				if (error < bestError)
+				{
+					bestError = error;
+					bestScale = scale;
+				}
+
+				if (coverage < targetCoverage)
+					minScale = scale;
+				else if (coverage > targetCoverage)
+					maxScale = scale;
+				else
+					break;
+			}
+
+			return bestScale;
+		}
+
+		bool CanDownsampleBox(unsigned int srcLength, unsigned int dstLength)
+		{
+			return srcLength == dstLength * 2 || (srcLength == 1 && dstLength == 1);
+		}
+
+		void DownsampleBox8x4(const UInt8* src, UInt8* dst, unsigned int srcWidth, unsigned int srcHeight, unsigned int dstWidth, unsigned int dstHeight, unsigned int layerCount, bool filterRows)
+		{
+			// Fast path for 4x8 bits formats whose size is exactly halved: each destination pixel is the rounded average of a 2x2 source block
+			std::size_t srcPitch = std::size_t(srcWidth) * 4;
+			std::size_t dstPitch = std::size_t(dstWidth) * 4;
+			std::size_t srcLayerSize = srcPitch * srcHeight;
+			unsigned int xStep = (srcWidth > 1) ? 1 : 0;
+
+			ParallelFor(std::size_t(dstHeight) * layerCount, std::max<std::size_t>(ResamplingGrainSize / dstWidth, 1), [&](std::size_t begin, std::size_t end)
+			{
+				for (std::size_t row = begin; row < end; ++row)
+				{
+					std::size_t layer = row / dstHeight;
+					std::size_t y = row % dstHeight;
+
+					std::size_t srcY0 = (filterRows) ? y * 2 : y;
+					std::size_t srcY1 = (filterRows && srcHeight > 1) ? srcY0 + 1 : srcY0;
+
+					const UInt8* row0 = &src[layer * srcLayerSize + srcY0 * srcPitch];
+					const UInt8* row1 = &src[layer * srcLayerSize + srcY1 * srcPitch];
+					UInt8* dstRow = &dst[row * dstPitch];
+
+					unsigned int x = 0;
+					#ifdef NAZARA_UTILITY_IMAGE_SSE2
+					if (xStep != 0)
+					{
+						const __m128i zero = _mm_setzero_si128();
+						const __m128i bias = _mm_set1_epi16(2);
+						for (; x + 4 <= dstWidth; x += 4)
+						{
+							__m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&row0[x * 8]));
+							__m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&row0[x * 8 + 16]));
+							__m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&row1[x * 8]));
+							__m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&row1[x * 8 + 16]));
+
+							// Vertical sums, two source pixels per register
+							__m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+							__m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+							__m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+							__m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+							// Horizontal sums of neighbor pixels
+							__m128i d01 = _mm_add_epi16(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1));
+							__m128i d23 = _mm_add_epi16(_mm_unpacklo_epi64(s2, s3), _mm_unpackhi_epi64(s2, s3));
+
+							d01 = _mm_srli_epi16(_mm_add_epi16(d01, bias), 2);
+							d23 = _mm_srli_epi16(_mm_add_epi16(d23, bias), 2);
+
+							_mm_storeu_si128(reinterpret_cast<__m128i*>(&dstRow[x * 4]), _mm_packus_epi16(d01, d23));
+						}
+					}
+					#endif
+
+					for (; x < dstWidth; ++x)
+					{
+						const UInt8* p00 = &row0[x * 4 * (1 + xStep)];
+						const UInt8* p01 = &p00[xStep * 4];
+						const UInt8* p10 = &row1[x * 4 * (1 + xStep)];
+						const UInt8* p11 = &p10[xStep * 4];
+
+						for (unsigned int c = 0; c < 4; ++c)
+							dstRow[x * 4 + c] = static_cast<UInt8>((p00[c] + p01[c] + p10[c] + p11[c] + 2) >> 2);
+					}
+				}
+			});
+		}
+
 		inline UInt8* GetPixelPtr(UInt8* base, UInt8 bpp, unsigned int x, unsigned int y, unsigned int z, unsigned int width, unsigned int height)
 		{
 			return &base[(width*(height*z + y) + x)*bpp];
@@ -70,8 +563,11 @@ namespace Nz
 		Destroy();
 	}
 
-	bool Image::Convert(PixelFormat newFormat)
+	bool Image::Convert(PixelFormat newFormat, BlockCompressionQuality quality)
 	{
+		// Block compression is done by the compressor from RGBA8 pixels rather than by a conversion function
+		bool compress = (m_sharedImage->format != newFormat && BlockCompressor::IsSupported(newFormat));
+
 		#if NAZARA_UTILITY_SAFE
 		if (m_sharedImage == &emptyImage)
 		{
@@ -85,7 +581,22 @@ namespace Nz
 			return false;
 		}
 
-		if (!PixelFormatInfo::IsConversionSupported(m_sharedImage->format, newFormat))
+		// Block-compressed images are decoded by decompression functions, which work on whole rows of blocks
+		auto IsSupported = [&](PixelFormat srcFormat, PixelFormat dstFormat)
+		{
+			if (PixelFormatInfo::IsCompressed(srcFormat))
+				return PixelFormatInfo::IsDecompressionSupported(srcFormat, dstFormat);
+			else
+				return srcFormat == dstFormat || PixelFormatInfo::IsConversionSupported(srcFormat, dstFormat);
+		};
+
+		bool conversionSupported;
+		if (compress)
+			conversionSupported = IsSupported(m_sharedImage->format, PixelFormat::RGBA8);
+		else
+			conversionSupported = (m_sharedImage->format == newFormat || IsSupported(m_sharedImage->format, newFormat));
+
+		if (!conversionSupported)
 		{
 			NazaraError("Conversion from " + PixelFormatInfo::GetName(m_sharedImage->format) + " to " + PixelFormatInfo::GetName(newFormat) + " is not supported");
 			return false;
@@ -103,21 +614,64 @@ namespace Nz
 		// Les images 3D et cubemaps sont stockés de la même façon
 		unsigned int depth = (m_sharedImage->type == ImageType::Cubemap) ? 6 : m_sharedImage->depth;
 
+		if (compress)
+		{
+			Image rgbaImage(*this);
+			if (!rgbaImage.Convert(PixelFormat::RGBA8))
+			{
+				NazaraError("Failed to convert image to RGBA8");
+				return false;
+			}
+
+			for (unsigned int i = 0; i < levels.size(); ++i)
+			{
+				levels[i] = std::make_unique<UInt8[]>(PixelFormatInfo::ComputeSize(newFormat, width, height, depth));
+
+				UInt8* dst = levels[i].get();
+				const UInt8* src = rgbaImage.GetConstPixels(0, 0, 0, UInt8(i));
+				std::size_t srcStride = PixelFormatInfo::ComputeSize(PixelFormat::RGBA8, width, height, 1);
+				std::size_t dstStride = PixelFormatInfo::ComputeSize(newFormat, width, height, 1);
+
+				for (unsigned int d = 0; d < depth; ++d)
+				{
+					if (!BlockCompressor::Compress(newFormat, src, width, height, dst, quality))
+					{
+						NazaraError("Failed to compress image to " + PixelFormatInfo::GetName(newFormat));
+						return false;
+					}
+
+					src += srcStride;
+					dst += dstStride;
+				}
+
+				width = std::max(width >> 1, 1U);
+				height = std::max(height >> 1, 1U);
+				if (depth > 1 && m_sharedImage->type != ImageType::Cubemap)
+					depth >>= 1;
+			}
+
+			SharedImage* newImage = new SharedImage(1, m_sharedImage->type, newFormat, std::move(levels), m_sharedImage->width, m_sharedImage->height, m_sharedImage->depth);
+
+			ReleaseImage();
+			m_sharedImage = newImage;
+
+			return true;
+		}
+
 		for (unsigned int i = 0; i < levels.size(); ++i)
 		{
-			unsigned int pixelsPerFace = width * height;
-			levels[i] = std::make_unique<UInt8[]>(pixelsPerFace * depth * PixelFormatInfo::GetBytesPerPixel(newFormat));
+			levels[i] = std::make_unique<UInt8[]>(PixelFormatInfo::ComputeSize(newFormat, width, height, depth));
 
 			UInt8* dst = levels[i].get();
 			UInt8* src = m_sharedImage->levels[i].get();
-			unsigned int srcStride = pixelsPerFace * PixelFormatInfo::GetBytesPerPixel(m_sharedImage->format);
-			unsigned int dstStride = pixelsPerFace * PixelFormatInfo::GetBytesPerPixel(newFormat);
+			std::size_t srcStride = PixelFormatInfo::ComputeSize(m_sharedImage->format, width, height, 1);
+			std::size_t dstStride = PixelFormatInfo::ComputeSize(newFormat, width, height, 1);
 
 			for (unsigned int d = 0; d < depth; ++d)
 			{
-				if (!PixelFormatInfo::Convert(m_sharedImage->format, newFormat, src, &src[srcStride], dst))
+				if (!ConvertFace(m_sharedImage->format, newFormat, src, dst, width, height))
 				{
-					NazaraError("Failed to convert image");
+					NazaraError("Failed to convert image from " + PixelFormatInfo::GetName(m_sharedImage->format) + " to " + PixelFormatInfo::GetName(newFormat));
 					return false;
 				}
 
@@ -560,6 +1114,101 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Fills every mipmap level of the image from its first level
+	* \return true if successful
+	*
+	* \param params Filtering parameters
+	*
+	* \remark Each level is computed from the previous one, the image level count must be set beforehand (see SetLevelCount)
+	* \remark Compressed formats and formats which cannot be converted from and to RGBA32F are not supported
+	*/
+	bool Image::GenerateMipmaps(const MipmapParams& params)
+	{
+		NazaraAssert(IsValid(), "Invalid image");
+
+		bool isSRGB;
+		PixelFormat layout = GetLinearLayout(m_sharedImage->format, &isSRGB);
+		if (!CanResample(layout))
+		{
+			NazaraError("Cannot generate mipmaps for format " + PixelFormatInfo::GetName(m_sharedImage->format));
+			return false;
+		}
+
+		UInt8 levelCount = GetLevelCount();
+		if (levelCount <= 1)
+			return true;
+
+		EnsureOwnership();
+
+		ImageType type = m_sharedImage->type;
+		bool sRGB = isSRGB || params.sRGB;
+		bool alphaCoverage = params.alphaCoverageReference > 0.f;
+		bool fastPath = (params.filter == ImageFilter::Box && !sRGB && !alphaCoverage && type != ImageType::E3D && (layout == PixelFormat::RGBA8 || layout == PixelFormat::BGRA8));
+		bool filterRows = (type != ImageType::E1D_Array);
+
+		auto GetLevelSize = [&](UInt8 level)
+		{
+			return Vector3ui(GetWidth(level), GetHeight(level), (type == ImageType::Cubemap) ? 6 : GetDepth(level));
+		};
+
+		std::vector<float> linearPixels;
+		bool linearPixelsValid = false;
+		float targetCoverage = 0.f;
+
+		auto DecodeLevel = [&](UInt8 level)
+		{
+			Vector3ui size = GetLevelSize(level);
+			std::size_t pixelCount = std::size_t(size.x) * size.y * size.z;
+
+			linearPixels.resize(pixelCount * 4);
+			DecodeToLinear(layout, sRGB, m_sharedImage->levels[level].get(), pixelCount, linearPixels.data());
+			linearPixelsValid = true;
+		};
+
+		if (alphaCoverage)
+		{
+			DecodeLevel(0);
+
+			Vector3ui size = GetLevelSize(0);
+			targetCoverage = ComputeAlphaCoverage(linearPixels.data(), std::size_t(size.x) * size.y * size.z, params.alphaCoverageReference, 1.f);
+		}
+
+		for (UInt8 level = 1; level < levelCount; ++level)
+		{
+			Vector3ui srcSize = GetLevelSize(level - 1);
+			Vector3ui dstSize = GetLevelSize(level);
+
+			if (fastPath && CanDownsampleBox(srcSize.x, dstSize.x) && (!filterRows || CanDownsampleBox(srcSize.y, dstSize.y)))
+			{
+				unsigned int layerCount = (filterRows) ? dstSize.z : dstSize.y * dstSize.z;
+				unsigned int srcHeight = (filterRows) ? srcSize.y : 1;
+				unsigned int dstHeight = (filterRows) ? dstSize.y : 1;
+
+				DownsampleBox8x4(m_sharedImage->levels[level - 1].get(), m_sharedImage->levels[level].get(), srcSize.x, srcHeight, dstSize.x, dstHeight, layerCount, filterRows);
+				linearPixelsValid = false;
+				continue;
+			}
+
+			if (!linearPixelsValid)
+				DecodeLevel(level - 1);
+
+			ResamplingAxis xAxis = BuildResamplingAxis(srcSize.x, dstSize.x, params.filter);
+			ResamplingAxis yAxis = (filterRows) ? BuildResamplingAxis(srcSize.y, dstSize.y, params.filter) : BuildIdentityAxis(srcSize.y, dstSize.y);
+			ResamplingAxis zAxis = (type == ImageType::E3D) ? BuildResamplingAxis(srcSize.z, dstSize.z, params.filter) : BuildIdentityAxis(srcSize.z, dstSize.z);
+
+			Resample(linearPixels, srcSize, dstSize, xAxis, yAxis, zAxis);
+
+			std::size_t pixelCount = std::size_t(dstSize.x) * dstSize.y * dstSize.z;
+			float alphaScale = (alphaCoverage) ? FindAlphaScale(linearPixels.data(), pixelCount, params.alphaCoverageReference, targetCoverage) : 1.f;
+
+			// Unscaled alpha is kept for the next level
+			EncodeFromLinear(layout, sRGB, alphaScale, linearPixels.data(), pixelCount, m_sharedImage->levels[level].get());
+		}
+
+		return true;
+	}
+
 	const UInt8* Image::GetConstPixels(unsigned int x, unsigned int y, unsigned int z, UInt8 level) const
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -647,29 +1296,12 @@ namespace Nz
 
 	std::size_t Image::GetMemoryUsage() const
 	{
-		unsigned int width = m_sharedImage->width;
-		unsigned int height = m_sharedImage->height;
-		unsigned int depth = m_sharedImage->depth;
-
-		unsigned int size = 0;
-		for (unsigned int i = 0; i < m_sharedImage->levels.size(); ++i)
-		{
-			size += width * height * depth;
-
-			if (width > 1)
-				width >>= 1;
-
-			if (height > 1)
-				height >>= 1;
-
-			if (depth > 1)
-				depth >>= 1;
-		}
-
-		if (m_sharedImage->type == ImageType::Cubemap)
-			size *= 6;
+		// Summing levels sizes takes block-compressed formats into account
+		std::size_t size = 0;
+		for (UInt8 i = 0; i < m_sharedImage->levels.size(); ++i)
+			size += GetMemoryUsage(i);
 
-		return size * PixelFormatInfo::GetBytesPerPixel(m_sharedImage->format);
+		return size;
 	}
 
 	std::size_t Image::GetMemoryUsage(UInt8 level) const
@@ -1155,6 +1787,74 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Resamples the first level of the image to a new size
+	* \return true if successful
+	*
+	* \param width New width of the image
+	* \param height New height of the image (or layer count for 1D arrays, which must be left unchanged)
+	* \param filter Filter used to compute the new pixels
+	* \param sRGB Filter color channels in linear space by considering them as sRGB-encoded (always the case with sRGB pixel formats)
+	*
+	* \remark Depth and layer count are kept as-is, the resulting image only has one level
+	* \remark Compressed formats and formats which cannot be converted from and to RGBA32F are not supported
+	*/
+	bool Image::Resize(unsigned int width, unsigned int height, ImageFilter filter, bool sRGB)
+	{
+		NazaraAssert(IsValid(), "Invalid image");
+
+		ImageType type = m_sharedImage->type;
+
+		#if NAZARA_UTILITY_SAFE
+		if (width == 0 || height == 0)
+		{
+			NazaraError("Invalid size (" + NumberToString(width) + 'x' + NumberToString(height) + ')');
+			return false;
+		}
+
+		if (type == ImageType::E1D_Array && height != m_sharedImage->height)
+		{
+			NazaraError("1D array layer count cannot be changed");
+			return false;
+		}
+
+		if (type == ImageType::Cubemap && width != height)
+		{
+			NazaraError("Cubemaps must have square dimensions");
+			return false;
+		}
+		#endif
+
+		bool isSRGB;
+		PixelFormat layout = GetLinearLayout(m_sharedImage->format, &isSRGB);
+		if (!CanResample(layout))
+		{
+			NazaraError("Cannot resize image of format " + PixelFormatInfo::GetName(m_sharedImage->format));
+			return false;
+		}
+
+		sRGB = sRGB || isSRGB;
+
+		Vector3ui srcSize(m_sharedImage->width, m_sharedImage->height, (type == ImageType::Cubemap) ? 6 : m_sharedImage->depth);
+		Vector3ui dstSize(width, height, srcSize.z);
+
+		bool filterRows = (type != ImageType::E1D_Array);
+		ResamplingAxis xAxis = BuildResamplingAxis(srcSize.x, dstSize.x, filter);
+		ResamplingAxis yAxis = (filterRows) ? BuildResamplingAxis(srcSize.y, dstSize.y, filter) : BuildIdentityAxis(srcSize.y, dstSize.y);
+		ResamplingAxis zAxis = BuildIdentityAxis(srcSize.z, dstSize.z);
+
+		std::vector<float> linearPixels(std::size_t(srcSize.x) * srcSize.y * srcSize.z * 4);
+		DecodeToLinear(layout, sRGB, m_sharedImage->levels[0].get(), std::size_t(srcSize.x) * srcSize.y * srcSize.z, linearPixels.data());
+
+		Resample(linearPixels, srcSize, dstSize, xAxis, yAxis, zAxis);
+
+		Image resizedImage(type, m_sharedImage->format, width, height, m_sharedImage->depth, 1);
+		EncodeFromLinear(layout, sRGB, 1.f, linearPixels.data(), std::size_t(dstSize.x) * dstSize.y * dstSize.z, resizedImage.m_sharedImage->levels[0].get());
+
+		*this = std::move(resizedImage);
+		return true;
+	}
+
 	bool Image::SaveToFile(const std::filesystem::path& filePath, const ImageParams& params)
 	{
 		Utility* utility = Utility::Instance();
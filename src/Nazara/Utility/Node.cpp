@@ -596,6 +596,46 @@ namespace Nz
 		SetScale(Vector3f(scaleX, scaleY, scaleZ), coordSys);
 	}
 
+	void Node::SetTransform(const Vector3f& position, const Quaternionf& rotation, CoordSys coordSys)
+	{
+		// Same as SetPosition followed by SetRotation, but invalidates the node (and its childs) only once
+		Quaternionf q(rotation);
+		q.Normalize();
+
+		switch (coordSys)
+		{
+			case CoordSys::Global:
+				if (m_parent && (m_inheritPosition || m_inheritRotation))
+				{
+					if (!m_parent->m_derivedUpdated)
+						m_parent->UpdateDerived();
+				}
+
+				if (m_parent && m_inheritPosition)
+					m_position = (m_parent->m_derivedRotation.GetConjugate()*(position - m_parent->m_derivedPosition))/m_parent->m_derivedScale - m_initialPosition;
+				else
+					m_position = position - m_initialPosition;
+
+				if (m_parent && m_inheritRotation)
+				{
+					Quaternionf rot(m_parent->GetRotation() * m_initialRotation);
+
+					m_rotation = rot.GetConjugate() * q;
+				}
+				else
+					m_rotation = q;
+
+				break;
+
+			case CoordSys::Local:
+				m_position = position;
+				m_rotation = q;
+				break;
+		}
+
+		InvalidateNode();
+	}
+
 	void Node::SetTransformMatrix(const Matrix4f& matrix)
 	{
 		SetPosition(matrix.GetTranslation(), CoordSys::Global);
@@ -6,6 +6,14 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Math/Algorithm.hpp>
 #include <Nazara/Utils/Endianness.hpp>
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NAZARA_UTILITY_PIXELFORMAT_SSE2
+	#include <emmintrin.h>
+#endif
+
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -42,6 +50,384 @@ namespace Nz
 			return static_cast<UInt8>(c * (31.f/255.f));
 		}
 
+		/*********************************Helpers*********************************/
+		// Swaps the first and third bytes of each 4-bytes pixel (RGBA8 <=> BGRA8), both directions are the same operation
+		UInt8* SwizzleRedBlue(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			#ifdef NAZARA_UTILITY_PIXELFORMAT_SSE2
+			const __m128i redBlueMask = _mm_set1_epi32(0x00FF00FF);
+			const __m128i greenAlphaMask = _mm_set1_epi32(static_cast<int>(0xFF00FF00));
+			while (end - start >= 16)
+			{
+				__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+				__m128i redBlue = _mm_and_si128(pixels, redBlueMask);
+				__m128i swapped = _mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_or_si128(_mm_and_si128(pixels, greenAlphaMask), swapped));
+
+				start += 16;
+				dst += 16;
+			}
+			#endif
+
+			while (start < end)
+			{
+				*dst++ = start[2];
+				*dst++ = start[1];
+				*dst++ = start[0];
+				*dst++ = start[3];
+
+				start += 4;
+			}
+
+			return dst;
+		}
+
+		// Converts 4-bytes unsigned normalized pixels to floats, optionally swapping the first and third components
+		template<bool SwapRedBlue>
+		UInt8* ConvertUNorm8x4ToFloat(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			float* ptr = reinterpret_cast<float*>(dst);
+
+			#ifdef NAZARA_UTILITY_PIXELFORMAT_SSE2
+			const __m128 scale = _mm_set1_ps(1.f / 255.f);
+			const __m128i zero = _mm_setzero_si128();
+			while (end - start >= 16)
+			{
+				__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+				if constexpr (SwapRedBlue)
+				{
+					__m128i redBlue = _mm_and_si128(pixels, _mm_set1_epi32(0x00FF00FF));
+					__m128i swapped = _mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16));
+					pixels = _mm_or_si128(_mm_and_si128(pixels, _mm_set1_epi32(static_cast<int>(0xFF00FF00))), swapped);
+				}
+
+				__m128i low = _mm_unpacklo_epi8(pixels, zero);
+				__m128i high = _mm_unpackhi_epi8(pixels, zero);
+
+				_mm_storeu_ps(ptr + 0,  _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), scale));
+				_mm_storeu_ps(ptr + 4,  _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), scale));
+				_mm_storeu_ps(ptr + 8,  _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), scale));
+				_mm_storeu_ps(ptr + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), scale));
+
+				start += 16;
+				ptr += 16;
+			}
+			#endif
+
+			while (start < end)
+			{
+				*ptr++ = start[(SwapRedBlue) ? 2 : 0] / 255.f;
+				*ptr++ = start[1] / 255.f;
+				*ptr++ = start[(SwapRedBlue) ? 0 : 2] / 255.f;
+				*ptr++ = start[3] / 255.f;
+
+				start += 4;
+			}
+
+			return reinterpret_cast<UInt8*>(ptr);
+		}
+
+		// Converts four floats pixels to 4-bytes unsigned normalized pixels (clamped and rounded), optionally swapping the first and third components
+		template<bool SwapRedBlue>
+		UInt8* ConvertFloatToUNorm8x4(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			const float* ptr = reinterpret_cast<const float*>(start);
+			const float* endPtr = reinterpret_cast<const float*>(end);
+
+			#ifdef NAZARA_UTILITY_PIXELFORMAT_SSE2
+			// Rounding is done by adding 0.5 and truncating, the tail goes through the same code so every pixel is rounded the same way
+			auto ConvertPixels = [](const float* input, UInt8* output)
+			{
+				const __m128 scale = _mm_set1_ps(255.f);
+				const __m128 half = _mm_set1_ps(0.5f);
+				const __m128 zero = _mm_setzero_ps();
+				const __m128 one = _mm_set1_ps(1.f);
+
+				__m128i v0 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(input + 0), zero), one), scale), half));
+				__m128i v1 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(input + 4), zero), one), scale), half));
+				__m128i v2 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(input + 8), zero), one), scale), half));
+				__m128i v3 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(input + 12), zero), one), scale), half));
+
+				__m128i pixels = _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3));
+				if constexpr (SwapRedBlue)
+				{
+					__m128i redBlue = _mm_and_si128(pixels, _mm_set1_epi32(0x00FF00FF));
+					__m128i swapped = _mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16));
+					pixels = _mm_or_si128(_mm_and_si128(pixels, _mm_set1_epi32(static_cast<int>(0xFF00FF00))), swapped);
+				}
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(output), pixels);
+			};
+
+			while (endPtr - ptr >= 16)
+			{
+				ConvertPixels(ptr, dst);
+
+				ptr += 16;
+				dst += 16;
+			}
+
+			if (ptr < endPtr)
+			{
+				std::size_t remaining = endPtr - ptr;
+
+				float input[16] = {};
+				std::memcpy(input, ptr, remaining * sizeof(float));
+
+				UInt8 output[16];
+				ConvertPixels(input, output);
+
+				std::memcpy(dst, output, remaining);
+				dst += remaining;
+			}
+			#else
+			auto ToUNorm8 = [](float value) -> UInt8
+			{
+				return static_cast<UInt8>(std::clamp(value, 0.f, 1.f) * 255.f + 0.5f);
+			};
+
+			while (ptr < endPtr)
+			{
+				*dst++ = ToUNorm8(ptr[(SwapRedBlue) ? 2 : 0]);
+				*dst++ = ToUNorm8(ptr[1]);
+				*dst++ = ToUNorm8(ptr[(SwapRedBlue) ? 0 : 2]);
+				*dst++ = ToUNorm8(ptr[3]);
+
+				ptr += 4;
+			}
+			#endif
+
+			return dst;
+		}
+
+		// Expands 3-bytes pixels to 4-bytes pixels with an opaque alpha, optionally swapping the first and third components
+		template<bool SwapRedBlue>
+		UInt8* ExpandRGB8ToRGBA8(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			// Work on four pixels at once (three 32bits words in, four 32bits words out)
+			while (end - start >= 12)
+			{
+				UInt32 words[3];
+				std::memcpy(words, start, 12);
+
+				#ifdef NAZARA_BIG_ENDIAN
+				for (UInt32& word : words)
+					word = SwapBytes(word);
+				#endif
+
+				UInt32 pixels[4] = {
+					(words[0]) | 0xFF000000,
+					(words[0] >> 24) | (words[1] << 8) | 0xFF000000,
+					(words[1] >> 16) | (words[2] << 16) | 0xFF000000,
+					(words[2] >> 8) | 0xFF000000
+				};
+
+				for (UInt32& pixel : pixels)
+				{
+					if constexpr (SwapRedBlue)
+						pixel = (pixel & 0xFF00FF00) | ((pixel & 0x000000FF) << 16) | ((pixel >> 16) & 0x000000FF);
+
+					#ifdef NAZARA_BIG_ENDIAN
+					pixel = SwapBytes(pixel);
+					#endif
+				}
+
+				std::memcpy(dst, pixels, 16);
+
+				start += 12;
+				dst += 16;
+			}
+
+			while (start < end)
+			{
+				*dst++ = start[(SwapRedBlue) ? 2 : 0];
+				*dst++ = start[1];
+				*dst++ = start[(SwapRedBlue) ? 0 : 2];
+				*dst++ = 0xFF;
+
+				start += 3;
+			}
+
+			return dst;
+		}
+
+		/*******************************BC decoding*******************************/
+		inline void DecodeRGB565(UInt16 color, UInt8* rgba)
+		{
+			UInt8 r = static_cast<UInt8>((color >> 11) & 0x1F);
+			UInt8 g = static_cast<UInt8>((color >> 5) & 0x3F);
+			UInt8 b = static_cast<UInt8>(color & 0x1F);
+
+			rgba[0] = static_cast<UInt8>((r << 3) | (r >> 2));
+			rgba[1] = static_cast<UInt8>((g << 2) | (g >> 4));
+			rgba[2] = static_cast<UInt8>((b << 3) | (b >> 2));
+			rgba[3] = 0xFF;
+		}
+
+		// Decodes the color part of a BC1/BC2/BC3 block to 16 RGBA8 pixels
+		void DecodeBC1Colors(const UInt8* block, UInt8* pixels, bool allowTransparency)
+		{
+			UInt16 color0 = static_cast<UInt16>(block[0] | (block[1] << 8));
+			UInt16 color1 = static_cast<UInt16>(block[2] | (block[3] << 8));
+
+			UInt8 palette[4][4];
+			DecodeRGB565(color0, palette[0]);
+			DecodeRGB565(color1, palette[1]);
+
+			if (color0 > color1 || !allowTransparency)
+			{
+				for (unsigned int i = 0; i < 3; ++i)
+				{
+					palette[2][i] = static_cast<UInt8>((2 * palette[0][i] + palette[1][i] + 1) / 3);
+					palette[3][i] = static_cast<UInt8>((palette[0][i] + 2 * palette[1][i] + 1) / 3);
+				}
+
+				palette[2][3] = 0xFF;
+				palette[3][3] = 0xFF;
+			}
+			else
+			{
+				for (unsigned int i = 0; i < 3; ++i)
+					palette[2][i] = static_cast<UInt8>((palette[0][i] + palette[1][i]) / 2);
+
+				palette[2][3] = 0xFF;
+				std::memset(palette[3], 0, 4); //< transparent black
+			}
+
+			UInt32 indices = static_cast<UInt32>(block[4]) | (static_cast<UInt32>(block[5]) << 8) | (static_cast<UInt32>(block[6]) << 16) | (static_cast<UInt32>(block[7]) << 24);
+			for (unsigned int i = 0; i < 16; ++i)
+				std::memcpy(&pixels[i * 4], palette[(indices >> (2 * i)) & 0x3], 4);
+		}
+
+		// Decodes BC2 explicit 4bits alpha to the alpha channel of 16 RGBA8 pixels
+		void DecodeBC2Alpha(const UInt8* block, UInt8* pixels)
+		{
+			for (unsigned int i = 0; i < 8; ++i)
+			{
+				pixels[(i * 2 + 0) * 4 + 3] = static_cast<UInt8>((block[i] & 0x0F) * 17);
+				pixels[(i * 2 + 1) * 4 + 3] = static_cast<UInt8>((block[i] >> 4) * 17);
+			}
+		}
+
+		// Decodes BC3 interpolated alpha (or BC4/BC5 red and green when channel is set) to one channel of 16 RGBA8 pixels
+		void DecodeBC3Alpha(const UInt8* block, UInt8* pixels, unsigned int channel = 3)
+		{
+			UInt8 alpha0 = block[0];
+			UInt8 alpha1 = block[1];
+
+			UInt8 palette[8];
+			palette[0] = alpha0;
+			palette[1] = alpha1;
+			if (alpha0 > alpha1)
+			{
+				for (unsigned int i = 1; i < 7; ++i)
+					palette[i + 1] = static_cast<UInt8>(((7 - i) * alpha0 + i * alpha1 + 3) / 7);
+			}
+			else
+			{
+				for (unsigned int i = 1; i < 5; ++i)
+					palette[i + 1] = static_cast<UInt8>(((5 - i) * alpha0 + i * alpha1 + 2) / 5);
+
+				palette[6] = 0;
+				palette[7] = 0xFF;
+			}
+
+			UInt64 indices = 0;
+			for (unsigned int i = 0; i < 6; ++i)
+				indices |= static_cast<UInt64>(block[2 + i]) << (8 * i);
+
+			for (unsigned int i = 0; i < 16; ++i)
+				pixels[i * 4 + channel] = palette[(indices >> (3 * i)) & 0x7];
+		}
+
+		// Block-compressed formats are decoded one 4x4 block at a time, only the pixels inside the image are written
+		template<std::size_t BlockSize, bool SwapRedBlue, typename F>
+		bool DecodeBlocks(const UInt8* src, unsigned int width, unsigned int height, UInt8* dst, F&& decodeBlock)
+		{
+			std::size_t rowStride = std::size_t(width) * 4;
+
+			UInt8 pixels[16 * 4];
+			for (unsigned int blockY = 0; blockY < height; blockY += 4)
+			{
+				unsigned int rowCount = std::min(height - blockY, 4U);
+				for (unsigned int blockX = 0; blockX < width; blockX += 4)
+				{
+					decodeBlock(src, pixels);
+					if constexpr (SwapRedBlue)
+						SwizzleRedBlue(pixels, pixels + sizeof(pixels), pixels);
+
+					unsigned int columnCount = std::min(width - blockX, 4U);
+					for (unsigned int y = 0; y < rowCount; ++y)
+						std::memcpy(&dst[(blockY + y) * rowStride + blockX * 4], &pixels[y * 4 * 4], columnCount * 4);
+
+					src += BlockSize;
+				}
+			}
+
+			return true;
+		}
+
+		template<bool SwapRedBlue>
+		bool DecodeBC4(const UInt8* src, unsigned int width, unsigned int height, UInt8* dst)
+		{
+			return DecodeBlocks<8, SwapRedBlue>(src, width, height, dst, [](const UInt8* block, UInt8* pixels)
+			{
+				for (unsigned int i = 0; i < 16; ++i)
+				{
+					pixels[i * 4 + 1] = 0;
+					pixels[i * 4 + 2] = 0;
+					pixels[i * 4 + 3] = 0xFF;
+				}
+
+				DecodeBC3Alpha(block, pixels, 0);
+			});
+		}
+
+		template<bool SwapRedBlue>
+		bool DecodeBC5(const UInt8* src, unsigned int width, unsigned int height, UInt8* dst)
+		{
+			return DecodeBlocks<16, SwapRedBlue>(src, width, height, dst, [](const UInt8* block, UInt8* pixels)
+			{
+				for (unsigned int i = 0; i < 16; ++i)
+				{
+					pixels[i * 4 + 2] = 0;
+					pixels[i * 4 + 3] = 0xFF;
+				}
+
+				DecodeBC3Alpha(block, pixels, 0);
+				DecodeBC3Alpha(block + 8, pixels, 1);
+			});
+		}
+
+		template<bool SwapRedBlue>
+		bool DecodeDXT1(const UInt8* src, unsigned int width, unsigned int height, UInt8* dst)
+		{
+			return DecodeBlocks<8, SwapRedBlue>(src, width, height, dst, [](const UInt8* block, UInt8* pixels)
+			{
+				DecodeBC1Colors(block, pixels, true);
+			});
+		}
+
+		template<bool SwapRedBlue>
+		bool DecodeDXT3(const UInt8* src, unsigned int width, unsigned int height, UInt8* dst)
+		{
+			return DecodeBlocks<16, SwapRedBlue>(src, width, height, dst, [](const UInt8* block, UInt8* pixels)
+			{
+				DecodeBC1Colors(block + 8, pixels, false);
+				DecodeBC2Alpha(block, pixels);
+			});
+		}
+
+		template<bool SwapRedBlue>
+		bool DecodeDXT5(const UInt8* src, unsigned int width, unsigned int height, UInt8* dst)
+		{
+			return DecodeBlocks<16, SwapRedBlue>(src, width, height, dst, [](const UInt8* block, UInt8* pixels)
+			{
+				DecodeBC1Colors(block + 8, pixels, false);
+				DecodeBC3Alpha(block, pixels);
+			});
+		}
+
 		template<PixelFormat from, PixelFormat to>
 		UInt8* ConvertPixels(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
@@ -145,17 +531,7 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::BGR8, PixelFormat::BGRA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[0];
-				*dst++ = start[1];
-				*dst++ = start[2];
-				*dst++ = 0xFF;
-
-				start += 3;
-			}
-
-			return dst;
+			return ExpandRGB8ToRGBA8<false>(start, end, dst);
 		}
 
 		template<>
@@ -256,17 +632,7 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::BGR8, PixelFormat::RGBA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[2];
-				*dst++ = start[1];
-				*dst++ = start[0];
-				*dst++ = 0xFF;
-
-				start += 3;
-			}
-
-			return dst;
+			return ExpandRGB8ToRGBA8<true>(start, end, dst);
 		}
 
 		template<>
@@ -413,34 +779,13 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::BGRA8, PixelFormat::RGBA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[2];
-				*dst++ = start[1];
-				*dst++ = start[0];
-				*dst++ = start[3];
-
-				start += 4;
-			}
-
-			return dst;
+			return SwizzleRedBlue(start, end, dst);
 		}
 
 		template<>
 		UInt8* ConvertPixels<PixelFormat::BGRA8, PixelFormat::RGBA32F>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			float* ptr = reinterpret_cast<float*>(dst);
-			while (start < end)
-			{
-				*ptr++ = start[2] / 255.f;
-				*ptr++ = start[1] / 255.f;
-				*ptr++ = start[0] / 255.f;
-				*ptr++ = start[3] / 255.f;
-
-				start += 4;
-			}
-
-			return dst;
+			return ConvertUNorm8x4ToFloat<true>(start, end, dst);
 		}
 
 		/***********************************L8************************************/
@@ -1117,17 +1462,7 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGB8, PixelFormat::BGRA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[2];
-				*dst++ = start[1];
-				*dst++ = start[0];
-				*dst++ = 0xFF;
-
-				start += 3;
-			}
-
-			return dst;
+			return ExpandRGB8ToRGBA8<true>(start, end, dst);
 		}
 
 		template<>
@@ -1213,17 +1548,7 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGB8, PixelFormat::RGBA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[0];
-				*dst++ = start[1];
-				*dst++ = start[2];
-				*dst++ = 0xFF;
-
-				start += 3;
-			}
-
-			return dst;
+			return ExpandRGB8ToRGBA8<false>(start, end, dst);
 		}
 
 		template<>
@@ -1275,17 +1600,7 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGBA8, PixelFormat::BGRA8>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			while (start < end)
-			{
-				*dst++ = start[2];
-				*dst++ = start[1];
-				*dst++ = start[0];
-				*dst++ = start[3];
-
-				start += 4;
-			}
-
-			return dst;
+			return SwizzleRedBlue(start, end, dst);
 		}
 
 		template<>
@@ -1386,18 +1701,20 @@ namespace Nz
 		template<>
 		UInt8* ConvertPixels<PixelFormat::RGBA8, PixelFormat::RGBA32F>(const UInt8* start, const UInt8* end, UInt8* dst)
 		{
-			float* ptr = reinterpret_cast<float*>(dst);
-			while (start < end)
-			{
-				*ptr++ = start[0] / 255.f;
-				*ptr++ = start[1] / 255.f;
-				*ptr++ = start[2] / 255.f;
-				*ptr++ = start[3] / 255.f;
+			return ConvertUNorm8x4ToFloat<false>(start, end, dst);
+		}
 
-				start += 4;
-			}
+		/*********************************RGBA32F*********************************/
+		template<>
+		UInt8* ConvertPixels<PixelFormat::RGBA32F, PixelFormat::BGRA8>(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			return ConvertFloatToUNorm8x4<true>(start, end, dst);
+		}
 
-			return dst;
+		template<>
+		UInt8* ConvertPixels<PixelFormat::RGBA32F, PixelFormat::RGBA8>(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			return ConvertFloatToUNorm8x4<false>(start, end, dst);
 		}
 
 		template<PixelFormat Format1, PixelFormat Format2>
@@ -1528,6 +1845,9 @@ namespace Nz
 
 		// Setup informations about every pixel format
 		SetupPixelFormat(PixelFormat::A8,               PixelFormatDescription("A8",               PixelFormatContent::ColorRGBA,    0,                  0,                  0,                  0xFF,               PixelFormatSubType::Unsigned));
+		SetupPixelFormat(PixelFormat::BC4,              PixelFormatDescription("BC4",              PixelFormatContent::ColorRGBA,    8,                                                                              PixelFormatSubType::Compressed));
+		SetupPixelFormat(PixelFormat::BC5,              PixelFormatDescription("BC5",              PixelFormatContent::ColorRGBA,    16,                                                                             PixelFormatSubType::Compressed));
+		SetupPixelFormat(PixelFormat::BC7,              PixelFormatDescription("BC7",              PixelFormatContent::ColorRGBA,    16,                                                                             PixelFormatSubType::Compressed));
 		SetupPixelFormat(PixelFormat::BGR8,             PixelFormatDescription("BGR8",             PixelFormatContent::ColorRGBA,    0x0000FF,           0x00FF00,           0xFF0000,           0,                  PixelFormatSubType::Unsigned));
 		SetupPixelFormat(PixelFormat::BGR8_SRGB,        PixelFormatDescription("BGR8_SRGB",        PixelFormatContent::ColorRGBA,    0x0000FF,           0x00FF00,           0xFF0000,           0,                  PixelFormatSubType::Unsigned));
 		SetupPixelFormat(PixelFormat::BGRA8,            PixelFormatDescription("BGRA8",            PixelFormatContent::ColorRGBA,    0x0000FF00,         0x00FF0000,         0xFF000000,         0x000000FF,         PixelFormatSubType::Unsigned));
@@ -1599,6 +1919,14 @@ namespace Nz
 		RegisterConverter<PixelFormat::A8, PixelFormat::RGBA4>();
 		RegisterConverter<PixelFormat::A8, PixelFormat::RGBA8>();
 
+		/***********************************BC4***********************************/
+		SetDecompressFunction(PixelFormat::BC4, PixelFormat::BGRA8, &DecodeBC4<true>);
+		SetDecompressFunction(PixelFormat::BC4, PixelFormat::RGBA8, &DecodeBC4<false>);
+
+		/***********************************BC5***********************************/
+		SetDecompressFunction(PixelFormat::BC5, PixelFormat::BGRA8, &DecodeBC5<true>);
+		SetDecompressFunction(PixelFormat::BC5, PixelFormat::RGBA8, &DecodeBC5<false>);
+
 		/**********************************BGR8***********************************/
 		RegisterConverter<PixelFormat::BGR8, PixelFormat::BGR8_SRGB>();
 		RegisterConverter<PixelFormat::BGR8, PixelFormat::BGRA8>();
@@ -1639,10 +1967,10 @@ namespace Nz
 		RegisterConverter<PixelFormat::BGRA8, PixelFormat::RGBA32F>();
 
 		/**********************************DXT1***********************************/
-		///TODO: Décompresseur DXT1
+		SetDecompressFunction(PixelFormat::DXT1, PixelFormat::BGRA8, &DecodeDXT1<true>);
+		SetDecompressFunction(PixelFormat::DXT1, PixelFormat::RGBA8, &DecodeDXT1<false>);
 	/*
 		RegisterConverter<PixelFormat::DXT1, PixelFormat::BGR8>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::BGRA8>();
 		RegisterConverter<PixelFormat::DXT1, PixelFormat::DXT3>();
 		RegisterConverter<PixelFormat::DXT1, PixelFormat::DXT5>();
 		RegisterConverter<PixelFormat::DXT1, PixelFormat::L8>();
@@ -1658,14 +1986,13 @@ namespace Nz
 		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGB5A1>();
 		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGB8>();
 		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGBA4>();
-		RegisterConverter<PixelFormat::DXT1, PixelFormat::RGBA8>();
 	*/
 
 		/**********************************DXT3***********************************/
-		///TODO: Décompresseur DXT3
+		SetDecompressFunction(PixelFormat::DXT3, PixelFormat::BGRA8, &DecodeDXT3<true>);
+		SetDecompressFunction(PixelFormat::DXT3, PixelFormat::RGBA8, &DecodeDXT3<false>);
 	/*
 		RegisterConverter<PixelFormat::DXT3, PixelFormat::BGR8>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::BGRA8>();
 		RegisterConverter<PixelFormat::DXT3, PixelFormat::DXT1>();
 		RegisterConverter<PixelFormat::DXT3, PixelFormat::DXT5>();
 		RegisterConverter<PixelFormat::DXT3, PixelFormat::L8>();
@@ -1681,14 +2008,13 @@ namespace Nz
 		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGB5A1>();
 		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGB8>();
 		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGBA4>();
-		RegisterConverter<PixelFormat::DXT3, PixelFormat::RGBA8>();
 	*/
 
 		/**********************************DXT5***********************************/
-		///TODO: Décompresseur DXT5
+		SetDecompressFunction(PixelFormat::DXT5, PixelFormat::BGRA8, &DecodeDXT5<true>);
+		SetDecompressFunction(PixelFormat::DXT5, PixelFormat::RGBA8, &DecodeDXT5<false>);
 	/*
 		RegisterConverter<PixelFormat::DXT5, PixelFormat::BGR8>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::BGRA8>();
 		RegisterConverter<PixelFormat::DXT5, PixelFormat::DXT1>();
 		RegisterConverter<PixelFormat::DXT5, PixelFormat::DXT3>();
 		RegisterConverter<PixelFormat::DXT5, PixelFormat::L8>();
@@ -1704,7 +2030,6 @@ namespace Nz
 		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGB5A1>();
 		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGB8>();
 		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGBA4>();
-		RegisterConverter<PixelFormat::DXT5, PixelFormat::RGBA8>();
 	*/
 
 		/***********************************L8************************************/
@@ -1819,6 +2144,10 @@ namespace Nz
 		RegisterConverter<PixelFormat::RGBA8, PixelFormat::RGBA8_SRGB>();
 		RegisterConverter<PixelFormat::RGBA8, PixelFormat::RGBA32F>();
 
+		/*********************************RGBA32F*********************************/
+		RegisterConverter<PixelFormat::RGBA32F, PixelFormat::BGRA8>();
+		RegisterConverter<PixelFormat::RGBA32F, PixelFormat::RGBA8>();
+
 		return true;
 	}
 
@@ -1828,7 +2157,10 @@ namespace Nz
 		{
 			s_pixelFormatInfos[i].Clear();
 			for (std::size_t j = 0; j < PixelFormatCount; ++j)
+			{
 				s_convertFunctions[i][j] = nullptr;
+				s_decompressFunctions[i][j] = nullptr;
+			}
 
 			for (std::size_t j = 0; j < PixelFlippingCount; ++j)
 				s_flipFunctions[i][j] = nullptr;
@@ -1836,6 +2168,7 @@ namespace Nz
 	}
 
 	std::array<std::array<PixelFormatInfo::ConvertFunction, PixelFormatCount>, PixelFormatCount> PixelFormatInfo::s_convertFunctions;
+	std::array<std::array<PixelFormatInfo::DecompressFunction, PixelFormatCount>, PixelFormatCount> PixelFormatInfo::s_decompressFunctions;
 	std::array<std::array<PixelFormatInfo::FlipFunction, PixelFlippingCount>, PixelFormatCount> PixelFormatInfo::s_flipFunctions;
 	std::array<PixelFormatDescription, PixelFormatCount> PixelFormatInfo::s_pixelFormatInfos;
 }
@@ -0,0 +1,401 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/Systems/TransformSystem.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ParallelFor.hpp>
+#include <Nazara/Utility/Components/NodeComponent.hpp>
+#include <algorithm>
+#include <unordered_map>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// Updating a transform only takes a few dozen nanoseconds, waking up the ParallelFor workers (and waiting for them
+		// at the end of each level) only pays off for very large levels; smaller ones are updated on the calling thread
+		constexpr std::size_t WorldTransformGrainSize = 8192;
+		constexpr std::size_t WorldTransformParallelThreshold = 4 * WorldTransformGrainSize;
+	}
+
+	TransformSystem::TransformSystem(entt::registry& registry) :
+	m_registry(registry),
+	m_hierarchyInvalidated(false),
+	m_lastLevelIsAppended(false)
+	{
+		NazaraAssert(!Find(registry), "registry already has a transform system");
+		m_registry.ctx().emplace<TransformSystem*>(this);
+
+		m_nodeConstructConnection = registry.on_construct<NodeComponent>().connect<&TransformSystem::OnNodeConstruct>(this);
+		m_nodeDestroyConnection = registry.on_destroy<NodeComponent>().connect<&TransformSystem::OnNodeDestroy>(this);
+
+		for (entt::entity entity : registry.view<NodeComponent>())
+			OnNodeConstruct(registry, entity);
+	}
+
+	TransformSystem::~TransformSystem()
+	{
+		for (auto [entity, node] : m_registry.view<NodeComponent>().each())
+		{
+			NazaraUnused(entity);
+			if (node.m_transformSystem == this)
+				node.m_transformSystem = nullptr;
+		}
+
+		m_registry.ctx().erase<TransformSystem*>();
+	}
+
+	void TransformSystem::Update(Time /*elapsedTime*/)
+	{
+		std::fill(m_worldInvalidated.begin(), m_worldInvalidated.end(), UInt8(0));
+
+		if (m_hierarchyInvalidated)
+			RebuildHierarchy();
+
+		UpdateLocalTransforms();
+		UpdateWorldTransforms();
+
+		// Merge invalidated slots in ranges, consumers can then iterate them instead of receiving a callback per entity
+		m_invalidatedRanges.clear();
+		for (std::size_t slot = 0; slot < m_worldInvalidated.size(); ++slot)
+		{
+			if (!m_worldInvalidated[slot])
+				continue;
+
+			if (!m_invalidatedRanges.empty() && m_invalidatedRanges.back().first + m_invalidatedRanges.back().count == slot)
+				m_invalidatedRanges.back().count++;
+			else
+				m_invalidatedRanges.push_back({ slot, 1 });
+		}
+	}
+
+	TransformSystem* TransformSystem::Find(entt::registry& registry)
+	{
+		TransformSystem** transformSystem = registry.ctx().find<TransformSystem*>();
+		return (transformSystem) ? *transformSystem : nullptr;
+	}
+
+	void TransformSystem::OnNodeConstruct([[maybe_unused]] entt::registry& registry, entt::entity entity)
+	{
+		assert(&m_registry == &registry);
+
+		NodeComponent& node = m_registry.get<NodeComponent>(entity);
+
+		std::size_t transformId;
+		if (!m_freeTransformIds.empty())
+		{
+			transformId = m_freeTransformIds.back();
+			m_freeTransformIds.pop_back();
+		}
+		else
+		{
+			transformId = m_transformIdToSlot.size();
+			m_transformIdToSlot.push_back(InvalidSlot);
+		}
+
+		node.m_transformSystem = this;
+		node.m_transformId = transformId;
+
+		// New transforms are appended as roots, the next hierarchy rebuild will move them at their depth if they have a parent
+		std::size_t slot = m_entities.size();
+		m_transformIdToSlot[transformId] = slot;
+		m_slotToTransformId.push_back(transformId);
+		m_entities.push_back(entity);
+		m_parentSlots.push_back(InvalidSlot);
+		m_inheritFlags.push_back(0);
+		m_worldInvalidated.push_back(0);
+		m_worldMatrices.push_back(Matrix4f::Identity());
+		m_localRotations.push_back(Quaternionf::Identity());
+		m_worldRotations.push_back(Quaternionf::Identity());
+		m_localPositions.push_back(Vector3f::Zero());
+		m_localScales.push_back(Vector3f::Unit());
+		m_worldPositions.push_back(Vector3f::Zero());
+		m_worldScales.push_back(Vector3f::Unit());
+
+		if (m_lastLevelIsAppended)
+			m_levels.back().count++;
+		else
+		{
+			m_levels.push_back({ slot, 1 });
+			m_lastLevelIsAppended = true;
+		}
+
+		InvalidateTransform(transformId);
+
+		// A copied node may already have a parent
+		if (node.GetParent())
+			InvalidateHierarchy();
+	}
+
+	void TransformSystem::OnNodeDestroy([[maybe_unused]] entt::registry& registry, entt::entity entity)
+	{
+		assert(&m_registry == &registry);
+
+		NodeComponent& node = m_registry.get<NodeComponent>(entity);
+		if (node.m_transformSystem != this)
+			return;
+
+		std::size_t transformId = node.m_transformId;
+		std::size_t slot = m_transformIdToSlot[transformId];
+
+		// Keep the slot until next rebuild, so removing a node doesn't reorder everything
+		m_entities[slot] = entt::null;
+		m_slotToTransformId[slot] = InvalidSlot;
+		m_worldInvalidated[slot] = 0;
+
+		m_invalidatedTransforms.UnboundedReset(transformId);
+		m_transformIdToSlot[transformId] = InvalidSlot;
+		m_freeTransformIds.push_back(transformId);
+
+		node.m_transformSystem = nullptr;
+
+		// Compact slots once half of them are unused
+		std::size_t transformCount = m_transformIdToSlot.size() - m_freeTransformIds.size();
+		if ((m_entities.size() - transformCount) * 2 > m_entities.size())
+			InvalidateHierarchy();
+	}
+
+	void TransformSystem::RebuildHierarchy()
+	{
+		std::size_t transformIdCount = m_transformIdToSlot.size();
+
+		// Node addresses may have changed since last rebuild (as components are moved in memory), resolve parents using current ones
+		std::unordered_map<const Node*, std::size_t> nodeToTransformId;
+		std::vector<entt::entity> transformIdToEntity(transformIdCount, entt::null);
+		std::vector<const NodeComponent*> transformIdToNode(transformIdCount, nullptr);
+
+		for (auto [entity, node] : m_registry.view<NodeComponent>().each())
+		{
+			if (node.m_transformSystem != this)
+				continue;
+
+			nodeToTransformId.emplace(&node, node.m_transformId);
+			transformIdToEntity[node.m_transformId] = entity;
+			transformIdToNode[node.m_transformId] = &node;
+		}
+
+		std::vector<std::size_t> parentIds(transformIdCount, InvalidSlot);
+		for (std::size_t transformId = 0; transformId < transformIdCount; ++transformId)
+		{
+			const NodeComponent* node = transformIdToNode[transformId];
+			if (!node || !node->GetParent())
+				continue;
+
+			auto it = nodeToTransformId.find(node->GetParent());
+			parentIds[transformId] = (it != nodeToTransformId.end()) ? it->second : ExternalParent;
+		}
+
+		// Compute depths, external parents are handled as roots
+		std::vector<std::size_t> depths(transformIdCount, InvalidSlot);
+		std::vector<std::size_t> parentStack;
+		std::size_t maxDepth = 0;
+		for (std::size_t transformId = 0; transformId < transformIdCount; ++transformId)
+		{
+			if (!transformIdToNode[transformId] || depths[transformId] != InvalidSlot)
+				continue;
+
+			std::size_t currentId = transformId;
+			while (depths[currentId] == InvalidSlot)
+			{
+				std::size_t parentId = parentIds[currentId];
+				if (parentId == InvalidSlot || parentId == ExternalParent)
+				{
+					depths[currentId] = 0;
+					break;
+				}
+
+				parentStack.push_back(currentId);
+				currentId = parentId;
+			}
+
+			std::size_t depth = depths[currentId];
+			while (!parentStack.empty())
+			{
+				depths[parentStack.back()] = ++depth;
+				parentStack.pop_back();
+			}
+
+			maxDepth = std::max(maxDepth, depth);
+		}
+
+		// Counting sort by depth
+		m_levels.assign(maxDepth + 1, Level{ 0, 0 });
+		for (std::size_t transformId = 0; transformId < transformIdCount; ++transformId)
+		{
+			if (transformIdToNode[transformId])
+				m_levels[depths[transformId]].count++;
+		}
+
+		std::size_t transformCount = 0;
+		for (Level& level : m_levels)
+		{
+			level.first = transformCount;
+			transformCount += level.count;
+		}
+
+		m_slotToTransformId.resize(transformCount);
+		m_entities.resize(transformCount);
+
+		std::vector<std::size_t> levelFill(m_levels.size(), 0);
+		for (std::size_t transformId = 0; transformId < transformIdCount; ++transformId)
+		{
+			if (!transformIdToNode[transformId])
+			{
+				m_transformIdToSlot[transformId] = InvalidSlot;
+				continue;
+			}
+
+			std::size_t depth = depths[transformId];
+			std::size_t slot = m_levels[depth].first + levelFill[depth]++;
+
+			m_transformIdToSlot[transformId] = slot;
+			m_slotToTransformId[slot] = transformId;
+			m_entities[slot] = transformIdToEntity[transformId];
+
+			// Every transform has to be reloaded
+			m_invalidatedTransforms.UnboundedSet(transformId);
+		}
+
+		m_parentSlots.resize(transformCount);
+		for (std::size_t slot = 0; slot < transformCount; ++slot)
+		{
+			std::size_t parentId = parentIds[m_slotToTransformId[slot]];
+			if (parentId == InvalidSlot || parentId == ExternalParent)
+				m_parentSlots[slot] = parentId;
+			else
+				m_parentSlots[slot] = m_transformIdToSlot[parentId];
+		}
+
+		// Transform data will be filled by the update
+		m_inheritFlags.resize(transformCount);
+		m_worldInvalidated.assign(transformCount, 0);
+		m_worldMatrices.resize(transformCount);
+		m_localRotations.resize(transformCount);
+		m_worldRotations.resize(transformCount);
+		m_localPositions.resize(transformCount);
+		m_localScales.resize(transformCount);
+		m_worldPositions.resize(transformCount);
+		m_worldScales.resize(transformCount);
+
+		// Free ids are now only those without slot
+		m_freeTransformIds.clear();
+		for (std::size_t transformId = transformIdCount; transformId > 0; --transformId)
+		{
+			if (!transformIdToNode[transformId - 1])
+				m_freeTransformIds.push_back(transformId - 1);
+		}
+
+		m_hierarchyInvalidated = false;
+		m_lastLevelIsAppended = false;
+	}
+
+	void TransformSystem::UpdateLocalTransforms()
+	{
+		for (std::size_t transformId = m_invalidatedTransforms.FindFirst(); transformId != m_invalidatedTransforms.npos; transformId = m_invalidatedTransforms.FindNext(transformId))
+		{
+			std::size_t slot = m_transformIdToSlot[transformId];
+			if (slot == InvalidSlot)
+				continue;
+
+			const NodeComponent& node = m_registry.get<NodeComponent>(m_entities[slot]);
+
+			// Same as Node::UpdateDerived
+			m_localPositions[slot] = node.GetInitialPosition() + node.GetPosition();
+			m_localRotations[slot] = node.GetInitialRotation() * node.GetRotation();
+			m_localScales[slot] = node.GetInitialScale() * node.GetScale();
+
+			UInt8 inheritFlags = 0;
+			if (node.GetInheritPosition())
+				inheritFlags |= InheritPosition;
+
+			if (node.GetInheritRotation())
+				inheritFlags |= InheritRotation;
+
+			if (node.GetInheritScale())
+				inheritFlags |= InheritScale;
+
+			m_inheritFlags[slot] = inheritFlags;
+
+			if (m_parentSlots[slot] == ExternalParent)
+			{
+				// Parent isn't part of the system (skeleton joints for example), let the node do the work
+				m_worldPositions[slot] = node.GetPosition(CoordSys::Global);
+				m_worldRotations[slot] = node.GetRotation(CoordSys::Global);
+				m_worldScales[slot] = node.GetScale(CoordSys::Global);
+				m_worldMatrices[slot] = node.GetTransformMatrix();
+			}
+
+			m_worldInvalidated[slot] = 1;
+		}
+
+		m_invalidatedTransforms.Reset();
+	}
+
+	void TransformSystem::UpdateWorldTransforms()
+	{
+		// Transforms of a level only depend on the previous levels, each level can be updated in parallel
+		for (const Level& level : m_levels)
+		{
+			auto UpdateLevel = [&](std::size_t begin, std::size_t end)
+			{
+				for (std::size_t slot = level.first + begin; slot < level.first + end; ++slot)
+				{
+					std::size_t parentSlot = m_parentSlots[slot];
+					if (parentSlot == ExternalParent)
+						continue; //< already updated
+
+					if (parentSlot != InvalidSlot && m_worldInvalidated[parentSlot])
+						m_worldInvalidated[slot] = 1;
+
+					if (!m_worldInvalidated[slot])
+						continue;
+
+					if (parentSlot != InvalidSlot)
+					{
+						const Vector3f& parentPosition = m_worldPositions[parentSlot];
+						const Quaternionf& parentRotation = m_worldRotations[parentSlot];
+						const Vector3f& parentScale = m_worldScales[parentSlot];
+
+						UInt8 inheritFlags = m_inheritFlags[slot];
+
+						if (inheritFlags & InheritPosition)
+							m_worldPositions[slot] = parentRotation * (parentScale * m_localPositions[slot]) + parentPosition;
+						else
+							m_worldPositions[slot] = m_localPositions[slot];
+
+						if (inheritFlags & InheritRotation)
+						{
+							Quaternionf rotation = m_localRotations[slot];
+							if (inheritFlags & InheritScale)
+								rotation = Quaternionf::Mirror(rotation, parentScale);
+
+							m_worldRotations[slot] = parentRotation * rotation;
+							m_worldRotations[slot].Normalize();
+						}
+						else
+							m_worldRotations[slot] = m_localRotations[slot];
+
+						m_worldScales[slot] = m_localScales[slot];
+						if (inheritFlags & InheritScale)
+							m_worldScales[slot] *= parentScale;
+					}
+					else
+					{
+						m_worldPositions[slot] = m_localPositions[slot];
+						m_worldRotations[slot] = m_localRotations[slot];
+						m_worldScales[slot] = m_localScales[slot];
+					}
+
+					m_worldMatrices[slot].MakeTransform(m_worldPositions[slot], m_worldRotations[slot], m_worldScales[slot]);
+				}
+			};
+
+			if (level.count >= WorldTransformParallelThreshold)
+				ParallelFor(level.count, WorldTransformGrainSize, UpdateLevel);
+			else
+				UpdateLevel(0, level.count);
+		}
+	}
+}
@@ -15,6 +15,7 @@
 #include <Nazara/Utility/Skeleton.hpp>
 #include <Nazara/Utility/VertexDeclaration.hpp>
 #include <Nazara/Utility/Formats/DDSLoader.hpp>
+#include <Nazara/Utility/Formats/DDSSaver.hpp>
 #include <Nazara/Utility/Formats/FreeTypeLoader.hpp>
 #include <Nazara/Utility/Formats/GIFLoader.hpp>
 #include <Nazara/Utility/Formats/MD2Loader.hpp>
@@ -79,6 +80,7 @@ namespace Nz
 
 		// Image
 		m_imageLoader.RegisterLoader(Loaders::GetImageLoader_DDS()); // DDS Loader (DirectX format)
+		m_imageSaver.RegisterSaver(Loaders::GetImageSaver_DDS()); // DDS Saver (DirectX format)
 		m_imageLoader.RegisterLoader(Loaders::GetImageLoader_PCX()); // .pcx loader (1, 4, 8, 24 bits)
 	}
 
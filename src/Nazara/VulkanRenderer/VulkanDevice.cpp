@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/VulkanRenderer/VulkanDevice.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/VulkanRenderer/VulkanCommandPool.hpp>
 #include <Nazara/VulkanRenderer/VulkanComputePipeline.hpp>
 #include <Nazara/VulkanRenderer/VulkanRenderPass.hpp>
@@ -28,6 +30,36 @@ namespace Nz
 		return m_enabledFeatures;
 	}
 
+	VkPipelineCache VulkanDevice::GetPipelineCache()
+	{
+		// Pipelines can be created from any thread, create the cache on first use
+		std::call_once(m_pipelineCacheFlag, [this]
+		{
+			if (!m_pipelineCache.Create(*this))
+				NazaraWarning("failed to create pipeline cache: " + TranslateVulkanError(m_pipelineCache.GetLastErrorCode()));
+		});
+
+		return m_pipelineCache;
+	}
+
+	bool VulkanDevice::GetPipelineCacheData(ByteArray& data) const
+	{
+		if (!m_pipelineCache.IsValid())
+			return false;
+
+		std::vector<UInt8> cacheData;
+		if (!m_pipelineCache.GetData(&cacheData))
+			return false;
+
+		data = ByteArray(cacheData.data(), cacheData.size());
+		return true;
+	}
+
+	std::optional<ShaderLanguage> VulkanDevice::GetShaderBinaryLanguage() const
+	{
+		return ShaderLanguage::SpirV;
+	}
+
 	std::shared_ptr<RenderBuffer> VulkanDevice::InstantiateBuffer(BufferType type, UInt64 size, BufferUsageFlags usageFlags, const void* initialData)
 	{
 		return std::make_shared<VulkanBuffer>(*this, type, size, usageFlags, initialData);
@@ -95,6 +127,23 @@ namespace Nz
 		return std::make_shared<VulkanTextureSampler>(*this, params);
 	}
 
+	bool VulkanDevice::LoadPipelineCacheData(const void* data, std::size_t size)
+	{
+		if (GetPipelineCache() == VK_NULL_HANDLE)
+			return false;
+
+		// Drivers ignore initial data they don't recognize (other device or driver version), the merge is then a no-op
+		Vk::PipelineCache loadedCache;
+		if (!loadedCache.Create(*this, data, size))
+		{
+			NazaraError("failed to create pipeline cache: " + TranslateVulkanError(loadedCache.GetLastErrorCode()));
+			return false;
+		}
+
+		VkPipelineCache loadedCacheHandle = loadedCache;
+		return m_pipelineCache.Merge(1, &loadedCacheHandle);
+	}
+
 	bool VulkanDevice::IsTextureFormatSupported(PixelFormat format, TextureUsage usage) const
 	{
 		VkFormat vulkanFormat = ToVulkan(format);
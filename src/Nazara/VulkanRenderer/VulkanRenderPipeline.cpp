@@ -48,7 +48,7 @@ namespace Nz
 			m_pipelines.erase(key);
 		});
 
-		if (!pipelineData.pipeline.CreateGraphics(*m_device, pipelineCreateInfo))
+		if (!pipelineData.pipeline.CreateGraphics(*m_device, pipelineCreateInfo, m_device->GetPipelineCache()))
 			return VK_NULL_HANDLE;
 
 		if (!m_debugName.empty())
@@ -0,0 +1,189 @@
+#include <Nazara/Audio/AudioBuffer.hpp>
+#include <Nazara/Audio/AudioSource.hpp>
+#include <Nazara/Audio/SoftwareAudioDevice.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+SCENARIO("SoftwareAudioDevice", "[AUDIO][SOFTWAREAUDIODEVICE]")
+{
+	GIVEN("A software audio device and a constant mono buffer")
+	{
+		std::shared_ptr<Nz::SoftwareAudioDevice> device = std::make_shared<Nz::SoftwareAudioDevice>(44100, 2);
+
+		std::vector<Nz::Int16> samples(100, 16384); //< 0.5
+		std::shared_ptr<Nz::AudioBuffer> buffer = device->CreateBuffer();
+		REQUIRE(buffer->Reset(Nz::AudioFormat::I16_Mono, samples.size(), 44100, samples.data()));
+
+		std::shared_ptr<Nz::AudioSource> source = device->CreateSource();
+		source->SetBuffer(buffer);
+
+		std::vector<float> output(2 * 64);
+
+		WHEN("We render a playing source")
+		{
+			source->Play();
+			device->Render(output.data(), 64);
+
+			THEN("It is mixed on both channels and advances")
+			{
+				CHECK(output[0] == Catch::Approx(0.5f));
+				CHECK(output[1] == Catch::Approx(0.5f));
+				CHECK(output[127] == Catch::Approx(0.5f));
+				CHECK(source->GetSampleOffset() == 64);
+				CHECK(source->GetStatus() == Nz::SoundStatus::Playing);
+			}
+
+			AND_WHEN("We render past its end")
+			{
+				device->Render(output.data(), 64);
+
+				THEN("The remaining frames are silent and the source is stopped")
+				{
+					CHECK(output[2 * 35] == Catch::Approx(0.5f));
+					CHECK(output[2 * 36] == 0.f);
+					CHECK(source->GetStatus() == Nz::SoundStatus::Stopped);
+				}
+			}
+		}
+
+		WHEN("We render a source placed on the right of the listener")
+		{
+			source->SetMinDistance(5.f);
+			source->SetPosition(Nz::Vector3f(5.f, 0.f, 0.f));
+			source->Play();
+			device->Render(output.data(), 8);
+
+			THEN("It is only audible on the right channel")
+			{
+				CHECK(output[0] == Catch::Approx(0.f).margin(0.0001));
+				CHECK(output[1] == Catch::Approx(0.5f));
+			}
+		}
+
+		WHEN("We render a source moving toward the listener")
+		{
+			source->SetPosition(Nz::Vector3f(10.f, 0.f, 0.f));
+			source->SetVelocity(Nz::Vector3f(-34.33f, 0.f, 0.f));
+			source->Play();
+			device->Render(output.data(), 50);
+
+			THEN("Its pitch is raised by the doppler effect")
+			{
+				// 343.3 / (343.3 - 34.33) = 1.111
+				CHECK(source->GetSampleOffset() == 55);
+			}
+		}
+
+		WHEN("We render a source moving away from the listener")
+		{
+			source->SetPosition(Nz::Vector3f(10.f, 0.f, 0.f));
+			source->SetVelocity(Nz::Vector3f(34.33f, 0.f, 0.f));
+			source->Play();
+			device->Render(output.data(), 50);
+
+			THEN("Its pitch is lowered by the doppler effect")
+			{
+				// 343.3 / (343.3 + 34.33) = 0.909
+				CHECK(source->GetSampleOffset() == 45);
+			}
+		}
+
+		WHEN("We render a source while the listener moves toward it")
+		{
+			source->SetPosition(Nz::Vector3f(10.f, 0.f, 0.f));
+			device->SetListenerVelocity(Nz::Vector3f(34.33f, 0.f, 0.f));
+			source->Play();
+			device->Render(output.data(), 45);
+
+			THEN("Its pitch is raised by the doppler effect")
+			{
+				// (343.3 + 34.33) / 343.3 = 1.1
+				CHECK(source->GetSampleOffset() == 49);
+			}
+		}
+
+		WHEN("We render a resampled source across two queued buffers")
+		{
+			std::vector<Nz::Int16> silence(100, 0);
+			std::shared_ptr<Nz::AudioBuffer> silentBuffer = device->CreateBuffer();
+			REQUIRE(silentBuffer->Reset(Nz::AudioFormat::I16_Mono, silence.size(), 44100, silence.data()));
+
+			source->QueueBuffer(silentBuffer);
+			source->SetPitch(0.5f);
+			source->Play();
+
+			std::vector<float> longOutput(2 * 256);
+			device->Render(longOutput.data(), 256);
+
+			THEN("The last frame of the first buffer is interpolated with the first frame of the second one")
+			{
+				CHECK(longOutput[2 * 197] == Catch::Approx(0.5f));
+				CHECK(longOutput[2 * 198] == Catch::Approx(0.5f));
+				CHECK(longOutput[2 * 199] == Catch::Approx(0.25f));
+				CHECK(longOutput[2 * 199 + 1] == Catch::Approx(0.25f));
+				CHECK(longOutput[2 * 200] == Catch::Approx(0.f).margin(0.0001));
+			}
+		}
+
+		WHEN("We render a source with a doubled pitch")
+		{
+			source->SetPitch(2.f);
+			source->Play();
+			device->Render(output.data(), 50);
+
+			THEN("It ends twice as fast")
+			{
+				CHECK(source->GetStatus() == Nz::SoundStatus::Stopped);
+			}
+		}
+
+		WHEN("We render to 16 bits samples")
+		{
+			std::vector<Nz::Int16> output16(2 * 16);
+			source->Play();
+			device->Render(output16.data(), 16);
+
+			THEN("The mix is converted")
+			{
+				CHECK(output16[0] == 16384);
+				CHECK(output16[31] == 16384);
+			}
+
+			AND_WHEN("The frame count isn't a multiple of the SIMD width")
+			{
+				std::vector<Nz::Int16> oddOutput16(2 * 13);
+				device->Render(oddOutput16.data(), 13);
+
+				THEN("Every sample is rounded the same way")
+				{
+					for (Nz::Int16 sample : oddOutput16)
+						CHECK(sample == 16384);
+				}
+			}
+		}
+
+		WHEN("We play more sources than voices")
+		{
+			std::vector<std::shared_ptr<Nz::AudioSource>> sources;
+			for (std::size_t i = 0; i < 4; ++i)
+			{
+				auto& otherSource = sources.emplace_back(device->CreateSource());
+				otherSource->SetBuffer(buffer);
+				otherSource->SetVolume(0.1f * (i + 1));
+				otherSource->Play();
+			}
+
+			device->Render(output.data(), 8);
+
+			THEN("Only the loudest ones are mixed, but all of them advance")
+			{
+				CHECK(device->GetMixedVoiceCount() == 2);
+				CHECK(output[0] == Catch::Approx(0.5f * (0.4f + 0.3f)));
+
+				for (const auto& otherSource : sources)
+					CHECK(otherSource->GetSampleOffset() == 8);
+			}
+		}
+	}
+}
@@ -0,0 +1,94 @@
+#include <Nazara/Core/AsyncLogger.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+SCENARIO("AsyncLogger", "[CORE][ASYNCLOGGER]")
+{
+	GIVEN("An asynchronous logger shared by multiple threads")
+	{
+		std::filesystem::path logPath = "AsyncLoggerTest.log";
+
+		{
+			Nz::AsyncLogger logger(logPath, 64, Nz::LogOverflowPolicy::Block);
+			logger.EnableStdReplication(false);
+			logger.EnableTimeLogging(false);
+
+			REQUIRE(logger.GetCapacity() == 64);
+
+			WHEN("Every thread writes records")
+			{
+				constexpr std::size_t ThreadCount = 4;
+				constexpr std::size_t RecordPerThread = 1000;
+
+				std::vector<std::thread> threads;
+				for (std::size_t i = 0; i < ThreadCount; ++i)
+				{
+					threads.emplace_back([&, i]
+					{
+						for (std::size_t j = 0; j < RecordPerThread; ++j)
+							logger.Write("Thread #" + std::to_string(i) + " record #" + std::to_string(j));
+					});
+				}
+
+				for (std::thread& thread : threads)
+					thread.join();
+
+				logger.WriteError(Nz::ErrorType::Warning, std::string(Nz::AsyncLogger::InlineRecordSize * 2, 'x'), 42, "AsyncLoggerTest.cpp", "Test");
+				logger.Flush();
+
+				THEN("No record should be lost")
+				{
+					Nz::AsyncLogger::Statistics stats = logger.GetStatistics();
+					CHECK(stats.droppedRecords == 0);
+					CHECK(stats.queuedRecords == ThreadCount * RecordPerThread + 1);
+					CHECK(stats.writtenRecords == ThreadCount * RecordPerThread + 1);
+
+					std::ifstream logFile(logPath);
+					std::size_t lineCount = 0;
+					std::string line;
+					std::string lastLine;
+					while (std::getline(logFile, line))
+					{
+						lineCount++;
+						lastLine = std::move(line);
+					}
+
+					CHECK(lineCount == ThreadCount * RecordPerThread + 1);
+					CHECK(lastLine == "Warning: " + std::string(Nz::AsyncLogger::InlineRecordSize * 2, 'x') + " (AsyncLoggerTest.cpp:42: Test)");
+				}
+			}
+		}
+
+		std::filesystem::remove(logPath);
+	}
+
+	GIVEN("An asynchronous logger dropping records when full")
+	{
+		std::filesystem::path logPath = "AsyncLoggerDropTest.log";
+
+		{
+			Nz::AsyncLogger logger(logPath, 8, Nz::LogOverflowPolicy::DropNewest);
+			logger.EnableStdReplication(false);
+
+			WHEN("We write more records than it can hold")
+			{
+				for (std::size_t i = 0; i < 10'000; ++i)
+					logger.Write("Record");
+
+				logger.Flush();
+
+				THEN("Every record is either written or accounted as dropped")
+				{
+					Nz::AsyncLogger::Statistics stats = logger.GetStatistics();
+					CHECK(stats.writtenRecords == stats.queuedRecords);
+					CHECK(stats.writtenRecords + stats.droppedRecords == 10'000);
+				}
+			}
+		}
+
+		std::filesystem::remove(logPath);
+	}
+}
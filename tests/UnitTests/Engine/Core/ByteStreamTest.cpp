@@ -71,4 +71,44 @@ SCENARIO("ByteStream", "[CORE][BYTESTREAM]")
 			}
 		}
 	}
+
+	GIVEN("A bytestream used to pack bits")
+	{
+		Nz::ByteArray byteArray;
+		Nz::ByteStream byteStream(&byteArray, Nz::OpenMode::WriteOnly);
+
+		WHEN("We write values on various bit counts")
+		{
+			byteStream.WriteBits(5, 3);
+			byteStream << true;
+			byteStream.WriteBits(0x1FFFF, 17);
+			byteStream.WriteBits(0xDEADBEEFCAFEBABE, 64);
+			byteStream << false;
+			byteStream.WriteBits(0, 0);
+			byteStream.WriteBits(0xFF, 4); //< only the lowest bits are written
+			byteStream.FlushBits();
+
+			THEN("They take the sum of their bit counts")
+			{
+				CHECK(byteArray.GetSize() == (3 + 1 + 17 + 64 + 1 + 4 + 7) / 8);
+			}
+
+			THEN("We can read them back")
+			{
+				Nz::ByteStream readStream(&byteArray, Nz::OpenMode::ReadOnly);
+
+				bool first, second;
+				CHECK(readStream.ReadBits(3) == 5);
+				readStream >> first;
+				CHECK(readStream.ReadBits(17) == 0x1FFFF);
+				CHECK(readStream.ReadBits(64) == 0xDEADBEEFCAFEBABE);
+				readStream >> second;
+				CHECK(readStream.ReadBits(0) == 0);
+				CHECK(readStream.ReadBits(4) == 0xF);
+
+				CHECK(first);
+				CHECK_FALSE(second);
+			}
+		}
+	}
 }
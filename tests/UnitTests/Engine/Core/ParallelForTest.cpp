@@ -0,0 +1,93 @@
+#include <Nazara/Core/ParallelFor.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+SCENARIO("ParallelFor", "[CORE][PARALLELFOR]")
+{
+	GIVEN("A range of elements")
+	{
+		std::vector<std::atomic_int> values(100'000);
+		for (auto& value : values)
+			value = 0;
+
+		WHEN("We process it in parallel")
+		{
+			std::atomic_uint maxWorkerIndex(0);
+			Nz::ParallelFor(values.size(), 128, [&](std::size_t begin, std::size_t end, unsigned int workerIndex)
+			{
+				for (std::size_t i = begin; i < end; ++i)
+					values[i]++;
+
+				unsigned int previousIndex = maxWorkerIndex.load();
+				while (previousIndex < workerIndex && !maxWorkerIndex.compare_exchange_weak(previousIndex, workerIndex));
+			});
+
+			THEN("Every element is processed exactly once by a valid worker")
+			{
+				for (auto& value : values)
+					CHECK(value == 1);
+
+				CHECK(maxWorkerIndex < Nz::GetParallelForThreadCount());
+			}
+		}
+
+		WHEN("We limit the thread count")
+		{
+			std::atomic_bool invalidWorker(false);
+			Nz::ParallelFor(values.size(), 16, 2, [&](std::size_t begin, std::size_t end, unsigned int workerIndex)
+			{
+				if (workerIndex >= 2)
+					invalidWorker = true;
+
+				for (std::size_t i = begin; i < end; ++i)
+					values[i]++;
+			});
+
+			THEN("Worker indices stay below the limit")
+			{
+				CHECK_FALSE(invalidWorker);
+				for (auto& value : values)
+					CHECK(value == 1);
+			}
+		}
+
+		WHEN("We call it repeatedly, from a nested call")
+		{
+			std::mutex threadMutex;
+			std::set<std::thread::id> threadIds;
+			for (int i = 0; i < 50; ++i)
+			{
+				Nz::ParallelFor(8, 1, [&](std::size_t begin, std::size_t end)
+				{
+					Nz::ParallelFor(end - begin, 1, [&](std::size_t /*nestedBegin*/, std::size_t /*nestedEnd*/)
+					{
+						std::lock_guard<std::mutex> lock(threadMutex);
+						threadIds.insert(std::this_thread::get_id());
+					});
+				});
+			}
+
+			THEN("The same threads are reused")
+			{
+				CHECK(threadIds.size() <= Nz::GetParallelForThreadCount());
+			}
+		}
+
+		WHEN("A chunk throws")
+		{
+			THEN("The exception is rethrown on the calling thread")
+			{
+				CHECK_THROWS(Nz::ParallelFor(values.size(), 1, [&](std::size_t begin, std::size_t /*end*/)
+				{
+					if (begin == 0)
+						throw std::runtime_error("failure");
+				}));
+			}
+		}
+	}
+}
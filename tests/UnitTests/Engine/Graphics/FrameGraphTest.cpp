@@ -0,0 +1,153 @@
+#include <Nazara/Graphics/BakedFrameGraph.hpp>
+#include <Nazara/Graphics/FrameGraph.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+
+namespace
+{
+	Nz::FramePassAttachment ColorAttachment(std::string name)
+	{
+		Nz::FramePassAttachment attachment;
+		attachment.name = std::move(name);
+		attachment.format = Nz::PixelFormat::RGBA8;
+
+		return attachment;
+	}
+
+	std::size_t IndexOf(const std::vector<std::size_t>& passOrder, std::size_t passIndex)
+	{
+		auto it = std::find(passOrder.begin(), passOrder.end(), passIndex);
+		REQUIRE(it != passOrder.end());
+
+		return std::distance(passOrder.begin(), it);
+	}
+}
+
+SCENARIO("FrameGraph", "[GRAPHICS][FRAMEGRAPH]")
+{
+	// Graphics module isn't initialized in unit tests, which means no render pass is created when baking
+
+	GIVEN("A frame graph with a pass not contributing to the backbuffer")
+	{
+		Nz::FrameGraph frameGraph;
+
+		std::size_t color = frameGraph.AddAttachment(ColorAttachment("Color"));
+		std::size_t unused = frameGraph.AddAttachment(ColorAttachment("Unused"));
+
+		Nz::FramePass& mainPass = frameGraph.AddPass("Main");
+		mainPass.AddOutput(color);
+
+		Nz::FramePass& unusedPass = frameGraph.AddPass("Unused");
+		unusedPass.AddOutput(unused);
+
+		frameGraph.AddBackbufferOutput(color);
+
+		WHEN("Baking it")
+		{
+			Nz::BakedFrameGraph bakedGraph = frameGraph.Bake();
+			const auto& stats = bakedGraph.GetStatistics();
+
+			THEN("The unused pass is culled")
+			{
+				CHECK(stats.culledPassCount == 1);
+				CHECK(stats.passOrder == std::vector<std::size_t>{ 0 });
+				CHECK(stats.physicalPassCount == 1);
+				CHECK(stats.textureCount == 1);
+			}
+		}
+	}
+
+	GIVEN("A chain of passes using transient attachments")
+	{
+		Nz::FrameGraph frameGraph;
+
+		std::size_t firstAttachment = frameGraph.AddAttachment(ColorAttachment("First"));
+		std::size_t secondAttachment = frameGraph.AddAttachment(ColorAttachment("Second"));
+		std::size_t thirdAttachment = frameGraph.AddAttachment(ColorAttachment("Third"));
+		std::size_t output = frameGraph.AddAttachment(ColorAttachment("Output"));
+
+		Nz::FramePass& firstPass = frameGraph.AddPass("First");
+		firstPass.AddOutput(firstAttachment);
+
+		Nz::FramePass& secondPass = frameGraph.AddPass("Second");
+		secondPass.AddInput(firstAttachment);
+		secondPass.AddOutput(secondAttachment);
+
+		Nz::FramePass& thirdPass = frameGraph.AddPass("Third");
+		thirdPass.AddInput(secondAttachment);
+		thirdPass.AddOutput(thirdAttachment);
+
+		Nz::FramePass& outputPass = frameGraph.AddPass("Output");
+		outputPass.AddInput(thirdAttachment);
+		outputPass.AddOutput(output);
+
+		frameGraph.AddBackbufferOutput(output);
+
+		WHEN("Baking it")
+		{
+			Nz::BakedFrameGraph bakedGraph = frameGraph.Bake();
+			const auto& stats = bakedGraph.GetStatistics();
+
+			THEN("Attachments with non-overlapping lifetimes share the same textures")
+			{
+				CHECK(stats.culledPassCount == 0);
+				CHECK(stats.passOrder == std::vector<std::size_t>{ 0, 1, 2, 3 });
+				CHECK(stats.textureCount == 2);
+				CHECK(stats.aliasedAttachmentCount == 2);
+				CHECK(stats.layoutTransitionCount <= stats.barrierCount);
+
+				CHECK(bakedGraph.ComputeMemoryUsage(1920, 1080) == 2 * 1920 * 1080 * 4);
+			}
+		}
+	}
+
+	GIVEN("A frame graph with two independent branches")
+	{
+		Nz::FrameGraph frameGraph;
+
+		std::size_t a = frameGraph.AddAttachment(ColorAttachment("A"));
+		std::size_t b = frameGraph.AddAttachment(ColorAttachment("B"));
+		std::size_t c = frameGraph.AddAttachment(ColorAttachment("C"));
+		std::size_t d = frameGraph.AddAttachment(ColorAttachment("D"));
+		std::size_t output = frameGraph.AddAttachment(ColorAttachment("Output"));
+
+		Nz::FramePass& passA = frameGraph.AddPass("A");
+		passA.AddOutput(a);
+
+		Nz::FramePass& passB = frameGraph.AddPass("B");
+		passB.AddInput(a);
+		passB.AddOutput(b);
+
+		Nz::FramePass& passC = frameGraph.AddPass("C");
+		passC.AddOutput(c);
+
+		Nz::FramePass& passD = frameGraph.AddPass("D");
+		passD.AddInput(c);
+		passD.AddOutput(d);
+
+		Nz::FramePass& outputPass = frameGraph.AddPass("Output");
+		outputPass.AddInput(b);
+		outputPass.AddInput(d);
+		outputPass.AddOutput(output);
+
+		frameGraph.AddBackbufferOutput(output);
+
+		WHEN("Baking it")
+		{
+			Nz::BakedFrameGraph bakedGraph = frameGraph.Bake();
+			const auto& stats = bakedGraph.GetStatistics();
+
+			THEN("Passes are interleaved while respecting their dependencies")
+			{
+				REQUIRE(stats.passOrder.size() == 5);
+				CHECK(IndexOf(stats.passOrder, 0) < IndexOf(stats.passOrder, 1));
+				CHECK(IndexOf(stats.passOrder, 2) < IndexOf(stats.passOrder, 3));
+				CHECK(stats.passOrder.back() == 4);
+
+				// No pass directly follows the pass it depends on, except the final one
+				CHECK(IndexOf(stats.passOrder, 1) != IndexOf(stats.passOrder, 0) + 1);
+				CHECK(IndexOf(stats.passOrder, 3) != IndexOf(stats.passOrder, 2) + 1);
+			}
+		}
+	}
+}
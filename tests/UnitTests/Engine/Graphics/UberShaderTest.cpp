@@ -0,0 +1,186 @@
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Graphics/UberShader.hpp>
+#include <Nazara/Renderer/ShaderCache.hpp>
+#include <Nazara/Renderer/ShaderModule.hpp>
+#include <NZSL/Parser.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+	const char s_shaderSource[] = R"(
+[nzsl_version("1.0")]
+module;
+
+option Option0: bool = false;
+option Option1: bool = false;
+option Option2: bool = false;
+option Option3: bool = false;
+option Option4: bool = false;
+option Option5: bool = false;
+option Option6: bool = false;
+
+struct FragOut
+{
+	[location(0)] color: vec4[f32]
+}
+
+[entry(frag)]
+fn main() -> FragOut
+{
+	let color = vec4[f32](0.0, 0.0, 0.0, 1.0);
+	color.x += const_select(Option0, 0.5, 0.0);
+	color.x += const_select(Option1, 0.25, 0.0);
+	color.y += const_select(Option2, 0.5, 0.0);
+	color.y += const_select(Option3, 0.25, 0.0);
+	color.z += const_select(Option4, 0.5, 0.0);
+	color.z += const_select(Option5, 0.25, 0.0);
+	color.w = const_select(Option6, 0.5, 1.0);
+
+	let fragOut: FragOut;
+	fragOut.color = color;
+
+	return fragOut;
+}
+)";
+
+	class SpirvShaderModule : public Nz::ShaderModule
+	{
+		public:
+			SpirvShaderModule(Nz::ByteArray binary) :
+			m_binary(std::move(binary))
+			{
+			}
+
+			const Nz::ByteArray& GetBinary() const
+			{
+				return m_binary;
+			}
+
+			void UpdateDebugName(std::string_view /*name*/) override
+			{
+			}
+
+		private:
+			Nz::ByteArray m_binary;
+	};
+}
+
+SCENARIO("UberShader", "[GRAPHICS][UBERSHADER]")
+{
+	GIVEN("An uber shader with seven boolean options compiled to SPIR-V without a render device")
+	{
+		nzsl::Ast::ModulePtr shaderModule = nzsl::Parse(std::string_view(s_shaderSource, sizeof(s_shaderSource) - 1));
+		REQUIRE(shaderModule);
+
+		Nz::UberShader uberShader(nzsl::ShaderStageType::Fragment, shaderModule);
+
+		std::atomic_size_t compileCount(0);
+		uberShader.UpdateCompileCallback([&](const Nz::UberShader& shader, const Nz::UberShader::Config& config) -> std::shared_ptr<Nz::ShaderModule>
+		{
+			compileCount++;
+
+			nzsl::ShaderWriter::States states;
+			for (const auto& [optionHash, optionValue] : config.optionValues)
+			{
+				Nz::UInt32 hash = optionHash;
+				std::visit([&](auto&& arg)
+				{
+					states.optionValues[hash] = arg;
+				}, optionValue);
+			}
+
+			Nz::ByteArray binary;
+			if (!Nz::ShaderCache::CompileShader(shader.GetSupportedStages(), *shader.GetShaderModule(), states, Nz::ShaderLanguage::SpirV, &binary))
+				throw std::runtime_error("failed to compile permutation");
+
+			return std::make_shared<SpirvShaderModule>(std::move(binary));
+		});
+
+		std::vector<Nz::UberShader::OptionVariations> optionVariations;
+		for (std::size_t i = 0; i < 7; ++i)
+		{
+			auto& variations = optionVariations.emplace_back();
+			variations.hash = Nz::CRC32("Option" + std::to_string(i));
+			variations.values = { false, true };
+		}
+
+		std::vector<Nz::UberShader::Config> configs = Nz::UberShader::EnumerateConfigs({}, optionVariations);
+
+		WHEN("We enumerate the option combinations")
+		{
+			THEN("Every combination is generated once")
+			{
+				REQUIRE(configs.size() == 128);
+
+				Nz::UberShader::ConfigEqual configEqual;
+				for (std::size_t i = 0; i < configs.size(); ++i)
+				{
+					CHECK(configs[i].optionValues.size() == 7);
+					for (std::size_t j = i + 1; j < configs.size(); ++j)
+						REQUIRE_FALSE(configEqual(configs[i], configs[j]));
+				}
+			}
+		}
+
+		WHEN("We precompile every permutation in parallel")
+		{
+			CHECK(uberShader.Precompile(configs, 4) == configs.size());
+			CHECK(uberShader.Precompile(configs, 4) == 0); //< already pending or compiled
+
+			uberShader.WaitForPrecompilation();
+
+			THEN("Every permutation was compiled exactly once")
+			{
+				CHECK(uberShader.GetPendingCount() == 0);
+				CHECK(uberShader.GetCompiledCount() == configs.size());
+				CHECK(compileCount == configs.size());
+			}
+
+			AND_THEN("Permutations are retrieved without recompilation")
+			{
+				for (const auto& config : configs)
+				{
+					std::shared_ptr<Nz::ShaderModule> module = uberShader.TryGet(config);
+					REQUIRE(module);
+					CHECK(module == uberShader.Get(config));
+					CHECK(static_cast<SpirvShaderModule&>(*module).GetBinary().GetSize() > 0);
+				}
+
+				CHECK(compileCount == configs.size());
+			}
+		}
+
+		WHEN("We request a permutation without waiting for it")
+		{
+			std::shared_ptr<Nz::ShaderModule> module = uberShader.TryGet(configs.front());
+			if (!module)
+			{
+				uberShader.WaitForPrecompilation();
+				module = uberShader.TryGet(configs.front());
+			}
+
+			THEN("It gets compiled in the background")
+			{
+				REQUIRE(module);
+				CHECK(uberShader.GetCompiledCount() == 1);
+				CHECK(compileCount == 1);
+			}
+		}
+
+		WHEN("We get a permutation while the others are being precompiled")
+		{
+			uberShader.Precompile(configs);
+			std::shared_ptr<Nz::ShaderModule> module = uberShader.Get(configs.back());
+			uberShader.WaitForPrecompilation();
+
+			THEN("It isn't compiled twice")
+			{
+				REQUIRE(module);
+				CHECK(compileCount == configs.size());
+			}
+		}
+	}
+}
@@ -0,0 +1,216 @@
+#include <Nazara/Math/Fixed.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+	// Runs a small simulation (integration with rotating acceleration and drag) and returns a checksum of every state
+	template<typename T>
+	Nz::UInt64 Simulate(std::size_t stepCount)
+	{
+		Nz::Vector3<T> position(T(0), T(10), T(0));
+		Nz::Vector3<T> velocity(T(1), T(0), T(0.5));
+
+		T deltaTime = T(1) / T(60);
+		T drag = T(99) / T(100);
+		T angle = T(0);
+
+		Nz::UInt64 checksum = 0;
+		for (std::size_t i = 0; i < stepCount; ++i)
+		{
+			angle += deltaTime;
+
+			Nz::Vector3<T> acceleration(Nz::Cos(angle), T(-10), Nz::Sin(angle) * T(3));
+			velocity += acceleration * deltaTime;
+			velocity *= drag;
+			position += velocity * deltaTime;
+
+			T distance = Nz::Sqrt(position.GetSquaredLength());
+
+			for (T value : { position.x, position.y, position.z, distance })
+				checksum = checksum * 31 + static_cast<Nz::UInt64>(value.GetRaw());
+		}
+
+		return checksum;
+	}
+}
+
+SCENARIO("Fixed", "[MATH][FIXED]")
+{
+	// Expected raw values were computed independently with arbitrary precision integer arithmetic,
+	// any compiler or optimization level must produce these exact values
+
+	GIVEN("Q16.16 numbers")
+	{
+		Nz::Fixed16 a(1.5);
+		Nz::Fixed16 b(-2.25);
+
+		WHEN("We convert them")
+		{
+			THEN("Raw values are scaled by 2^16")
+			{
+				CHECK(Nz::Fixed16(3).GetRaw() == 196608);
+				CHECK(a.GetRaw() == 98304);
+				CHECK(b.ToInteger() == -3);
+				CHECK(static_cast<float>(b) == -2.25f);
+				CHECK(Nz::Fixed16::Pi().GetRaw() == 205887);
+			}
+		}
+
+		WHEN("We do arithmetic")
+		{
+			THEN("Results are exact")
+			{
+				CHECK(a + b == Nz::Fixed16(-0.75));
+				CHECK(a - b == Nz::Fixed16(3.75));
+				CHECK(a * b == Nz::Fixed16(-3.375));
+				CHECK(b / a == Nz::Fixed16(-1.5));
+				CHECK(-a == Nz::Fixed16(-1.5));
+				CHECK(Nz::Abs(b) == Nz::Fixed16(2.25));
+			}
+
+			THEN("Rounding is well defined")
+			{
+				CHECK((Nz::Fixed16(1) / Nz::Fixed16(3)).GetRaw() == 21845);
+				CHECK((Nz::Fixed16(-1) / Nz::Fixed16(3)).GetRaw() == -21845);
+				CHECK((Nz::Fixed16::FromRaw(-1) * Nz::Fixed16(0.5)).GetRaw() == -1);
+				CHECK((Nz::Fixed16::FromRaw(12345) * Nz::Fixed16::FromRaw(67890)).GetRaw() == 12788);
+			}
+		}
+
+		WHEN("We use deterministic functions")
+		{
+			THEN("Results match the reference values")
+			{
+				CHECK(Nz::Sqrt(Nz::Fixed16(2)).GetRaw() == 92681);
+				CHECK(Nz::Sqrt(Nz::Fixed16(16)) == Nz::Fixed16(4));
+				CHECK(Nz::Sqrt(b) == Nz::Fixed16(0));
+				CHECK(Nz::Sin(Nz::Fixed16(1)).GetRaw() == 55147);
+				CHECK(Nz::Cos(Nz::Fixed16(1)).GetRaw() == 35409);
+				CHECK(Nz::Sin(Nz::Fixed16::HalfPi()) == Nz::Fixed16(1));
+				CHECK(Nz::Cos(Nz::Fixed16(0)) == Nz::Fixed16(1));
+				CHECK(Nz::Sin(-Nz::Fixed16(1)) == -Nz::Sin(Nz::Fixed16(1)));
+			}
+
+			THEN("Results are close to the floating-point ones")
+			{
+				for (int i = -100; i <= 100; ++i)
+				{
+					Nz::Fixed16 angle = Nz::Fixed16(i) / Nz::Fixed16(10);
+					CHECK(static_cast<double>(Nz::Sin(angle)) == Catch::Approx(std::sin(static_cast<double>(angle))).margin(0.0001));
+					CHECK(static_cast<double>(Nz::Cos(angle)) == Catch::Approx(std::cos(static_cast<double>(angle))).margin(0.0001));
+				}
+			}
+		}
+	}
+
+	GIVEN("Q32.32 numbers")
+	{
+		Nz::Fixed32 a = Nz::Fixed32(123456) + Nz::Fixed32(789) / Nz::Fixed32(1000);
+		Nz::Fixed32 b = -(Nz::Fixed32(987) + Nz::Fixed32(654321) / Nz::Fixed32(1000000));
+
+		WHEN("We do arithmetic")
+		{
+			THEN("Results match the reference values")
+			{
+				CHECK(a.GetRaw() == 530242871224172LL);
+				CHECK(b.GetRaw() == -4241943008448LL);
+				CHECK((a * b).GetRaw() == -523696662943989417LL);
+				CHECK((a / b).GetRaw() == -536870907107LL);
+				CHECK((b / a).GetRaw() == -34359738);
+				CHECK(Nz::Fixed32::Pi().GetRaw() == 13493037705LL);
+			}
+		}
+
+		WHEN("We use deterministic functions")
+		{
+			THEN("Results match the reference values")
+			{
+				CHECK(Nz::Sqrt(Nz::Fixed32(2)).GetRaw() == 6074000999LL);
+				CHECK(Nz::Sqrt(a).GetRaw() == 1509097674388LL);
+				CHECK(Nz::Sin(b).GetRaw() == -3994010776LL);
+				CHECK(Nz::Cos(b).GetRaw() == 1579385928);
+			}
+		}
+	}
+
+	GIVEN("Fixed-point vectors")
+	{
+		Nz::Vector3<Nz::Fixed16> first(Nz::Fixed16(1), Nz::Fixed16(2), Nz::Fixed16(3));
+		Nz::Vector3<Nz::Fixed16> second(Nz::Fixed16(0.5), Nz::Fixed16(-1), Nz::Fixed16(2));
+
+		THEN("Math templates work with them")
+		{
+			CHECK(first.DotProduct(second) == Nz::Fixed16(4.5));
+			CHECK(first.CrossProduct(second) == Nz::Vector3<Nz::Fixed16>(Nz::Fixed16(7), Nz::Fixed16(-0.5), Nz::Fixed16(-2)));
+			CHECK(first + second == Nz::Vector3<Nz::Fixed16>(Nz::Fixed16(1.5), Nz::Fixed16(1), Nz::Fixed16(5)));
+			CHECK(Nz::Vector3<Nz::Fixed16>::UnitX() * Nz::Fixed16(2) == Nz::Vector3<Nz::Fixed16>(Nz::Fixed16(2), Nz::Fixed16(0), Nz::Fixed16(0)));
+		}
+	}
+
+	GIVEN("Arrays of numbers")
+	{
+		constexpr std::size_t count = 103; //< not a multiple of the SIMD width
+
+		std::vector<Nz::Fixed16> lhs16(count);
+		std::vector<Nz::Fixed16> rhs16(count);
+		std::vector<Nz::Fixed32> lhs32(count);
+		std::vector<Nz::Fixed32> rhs32(count);
+
+		Nz::UInt32 seed = 42;
+		auto Random = [&]
+		{
+			seed = seed * 1664525u + 1013904223u;
+			return seed;
+		};
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			lhs16[i] = Nz::Fixed16::FromRaw(static_cast<Nz::Int32>(Random()));
+			rhs16[i] = Nz::Fixed16::FromRaw(static_cast<Nz::Int32>(Random()) >> 12);
+			lhs32[i] = Nz::Fixed32::FromRaw(static_cast<Nz::Int64>((Nz::UInt64(Random()) << 32) | Random()));
+			rhs32[i] = Nz::Fixed32::FromRaw(static_cast<Nz::Int64>((Nz::UInt64(Random()) << 32) | Random()) >> 24);
+		}
+
+		WHEN("We use batch operations")
+		{
+			std::vector<Nz::Fixed16> results16(count);
+			std::vector<Nz::Fixed32> results32(count);
+
+			THEN("They give the same results as scalar operations")
+			{
+				Nz::BatchAdd(lhs16.data(), rhs16.data(), results16.data(), count);
+				for (std::size_t i = 0; i < count; ++i)
+					CHECK(results16[i] == lhs16[i] + rhs16[i]);
+
+				Nz::BatchMultiply(lhs16.data(), rhs16.data(), results16.data(), count);
+				for (std::size_t i = 0; i < count; ++i)
+					CHECK(results16[i] == lhs16[i] * rhs16[i]);
+
+				Nz::BatchMultiply(lhs16.data(), Nz::Fixed16(-1.75), results16.data(), count);
+				for (std::size_t i = 0; i < count; ++i)
+					CHECK(results16[i] == lhs16[i] * Nz::Fixed16(-1.75));
+
+				Nz::BatchAdd(lhs32.data(), rhs32.data(), results32.data(), count);
+				for (std::size_t i = 0; i < count; ++i)
+					CHECK(results32[i] == lhs32[i] + rhs32[i]);
+
+				Nz::BatchMultiply(lhs32.data(), rhs32.data(), results32.data(), count);
+				for (std::size_t i = 0; i < count; ++i)
+					CHECK(results32[i] == lhs32[i] * rhs32[i]);
+			}
+		}
+	}
+
+	GIVEN("A simulation")
+	{
+		THEN("Its state is bit-identical to the reference one")
+		{
+			CHECK(Simulate<Nz::Fixed16>(1000) == 16021173159722589097ULL);
+			CHECK(Simulate<Nz::Fixed32>(1000) == 7257058812607013883ULL);
+		}
+	}
+}
@@ -0,0 +1,268 @@
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetLZCompressor.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <Nazara/Network/NetBuffer.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Looks like a typical game packet: entity ids, quantized positions and a few flags
+	Nz::ByteArray GenerateSnapshotPacket(std::mt19937& rng, std::size_t entityCount)
+	{
+		std::uniform_int_distribution<unsigned int> dis(0, 255);
+
+		Nz::ByteArray packet;
+		packet.Append("SNAP", 4);
+		for (std::size_t i = 0; i < entityCount; ++i)
+		{
+			Nz::UInt8 entity[12] = { Nz::UInt8(i), 0, 0x10, 0x00, Nz::UInt8(dis(rng) & 0x0F), 0x42, 0x00, Nz::UInt8(dis(rng) & 0x0F), 0x43, 0x00, 0x00, 0x01 };
+			packet.Append(entity, sizeof(entity));
+		}
+
+		return packet;
+	}
+
+	bool RoundTrip(Nz::ENetCompressor& compressor, const Nz::ByteArray& data, std::size_t* compressedSize = nullptr)
+	{
+		// Split the data into two buffers, as ENetHost does with protocol commands
+		std::size_t firstPart = data.GetSize() / 3;
+
+		Nz::NetBuffer buffers[2];
+		buffers[0].data = const_cast<Nz::UInt8*>(data.GetConstBuffer());
+		buffers[0].dataLength = firstPart;
+		buffers[1].data = const_cast<Nz::UInt8*>(data.GetConstBuffer() + firstPart);
+		buffers[1].dataLength = data.GetSize() - firstPart;
+
+		std::vector<Nz::UInt8> compressed(data.GetSize() * 2 + 16);
+		std::size_t size = compressor.Compress(nullptr, buffers, 2, data.GetSize(), compressed.data(), compressed.size());
+		if (size == 0)
+			return false;
+
+		if (compressedSize)
+			*compressedSize = size;
+
+		std::vector<Nz::UInt8> decompressed(data.GetSize());
+		if (compressor.Decompress(nullptr, compressed.data(), size, decompressed.data(), decompressed.size()) != data.GetSize())
+			return false;
+
+		return std::equal(decompressed.begin(), decompressed.end(), data.begin());
+	}
+
+	void CheckCompressor(Nz::ENetCompressor& compressor)
+	{
+		std::mt19937 rng(42);
+
+		WHEN("We compress and decompress game-like packets")
+		{
+			THEN("Data is restored and smaller on the wire")
+			{
+				for (unsigned int i = 0; i < 32; ++i)
+				{
+					Nz::ByteArray packet = GenerateSnapshotPacket(rng, 10 + i);
+
+					std::size_t compressedSize;
+					REQUIRE(RoundTrip(compressor, packet, &compressedSize));
+					CHECK(compressedSize < packet.GetSize());
+				}
+			}
+		}
+
+		WHEN("We compress random data")
+		{
+			std::uniform_int_distribution<unsigned int> dis(0, 255);
+
+			Nz::ByteArray data(1000, 0);
+			for (Nz::UInt8& byte : data)
+				byte = Nz::UInt8(dis(rng));
+
+			THEN("Data is restored")
+			{
+				REQUIRE(RoundTrip(compressor, data));
+			}
+		}
+
+		WHEN("Output buffer is too small")
+		{
+			Nz::ByteArray packet = GenerateSnapshotPacket(rng, 20);
+
+			Nz::NetBuffer buffer;
+			buffer.data = packet.GetBuffer();
+			buffer.dataLength = packet.GetSize();
+
+			std::vector<Nz::UInt8> compressed(8);
+
+			THEN("Compression fails instead of overflowing")
+			{
+				CHECK(compressor.Compress(nullptr, &buffer, 1, packet.GetSize(), compressed.data(), compressed.size()) == 0);
+			}
+		}
+	}
+}
+
+SCENARIO("ENetRangeCoderCompressor", "[NETWORK][ENETCOMPRESSOR]")
+{
+	GIVEN("A range coder compressor")
+	{
+		Nz::ENetRangeCoderCompressor compressor;
+		CheckCompressor(compressor);
+	}
+}
+
+SCENARIO("ENetLZCompressor", "[NETWORK][ENETCOMPRESSOR]")
+{
+	GIVEN("A LZ compressor without dictionary")
+	{
+		Nz::ENetLZCompressor compressor;
+		CheckCompressor(compressor);
+	}
+
+	GIVEN("A LZ compressor with a dictionary trained on packet samples")
+	{
+		std::mt19937 rng(1337);
+
+		std::vector<Nz::ByteArray> samples;
+		for (unsigned int i = 0; i < 64; ++i)
+			samples.push_back(GenerateSnapshotPacket(rng, 4));
+
+		Nz::ByteArray dictionary = Nz::ENetLZCompressor::TrainDictionary(samples.data(), samples.size(), 1024);
+		REQUIRE(!dictionary.IsEmpty());
+		CHECK(dictionary.GetSize() <= 1024);
+
+		Nz::ENetLZCompressor compressor(dictionary);
+		CheckCompressor(compressor);
+
+		WHEN("We compress a small packet")
+		{
+			Nz::ByteArray packet = GenerateSnapshotPacket(rng, 4);
+
+			std::size_t withDictionary;
+			REQUIRE(RoundTrip(compressor, packet, &withDictionary));
+
+			Nz::ENetLZCompressor noDictionaryCompressor;
+
+			std::size_t withoutDictionary = packet.GetSize();
+			RoundTrip(noDictionaryCompressor, packet, &withoutDictionary);
+
+			THEN("Dictionary improves compression")
+			{
+				CHECK(withDictionary < withoutDictionary);
+			}
+		}
+	}
+}
+
+SCENARIO("ENetCompressor over loopback", "[.][NETWORK][ENETCOMPRESSOR][BENCHMARK]")
+{
+	constexpr std::size_t PacketCount = 256;
+
+	std::mt19937 rng(42);
+
+	std::vector<Nz::ByteArray> packets;
+	for (std::size_t i = 0; i < PacketCount; ++i)
+		packets.push_back(GenerateSnapshotPacket(rng, 8 + i % 32));
+
+	std::vector<Nz::ByteArray> samples(packets.begin(), packets.begin() + 32);
+	Nz::ByteArray dictionary = Nz::ENetLZCompressor::TrainDictionary(samples.data(), samples.size());
+
+	auto MeasureLoopback = [&](const char* name, const std::function<std::unique_ptr<Nz::ENetCompressor>()>& compressorFactory)
+	{
+		std::uniform_int_distribution<Nz::UInt16> dis(1025, 65535);
+		Nz::UInt16 port = dis(rng);
+
+		Nz::ENetHost server;
+		REQUIRE(server.Create(Nz::NetProtocol::IPv4, port, 1, 1));
+
+		Nz::ENetHost client;
+		REQUIRE(client.Create(Nz::NetProtocol::IPv4, 0, 1, 1));
+
+		if (compressorFactory)
+		{
+			server.SetCompressor(compressorFactory());
+			client.SetCompressor(compressorFactory());
+		}
+
+		Nz::ENetPeer* serverPeer = client.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port), 1);
+		REQUIRE(serverPeer);
+
+		Nz::ENetEvent event;
+		for (unsigned int i = 0; i < 500 && !serverPeer->IsConnected(); ++i)
+		{
+			server.Service(&event, 1);
+			client.Service(&event, 1);
+		}
+		REQUIRE(serverPeer->IsConnected());
+
+		Nz::UInt64 sentData = client.GetTotalSentData();
+		Nz::UInt32 sentPackets = client.GetTotalSentPackets();
+
+		std::size_t received = 0;
+		for (const Nz::ByteArray& data : packets)
+		{
+			Nz::NetPacket packet(1);
+			packet.Write(data.GetConstBuffer(), data.GetSize());
+			serverPeer->Send(0, Nz::ENetPacketFlag_Unsequenced, std::move(packet));
+
+			client.Flush();
+			while (server.Service(&event, 0) > 0)
+			{
+				if (event.type == Nz::ENetEventType::Receive)
+					received++;
+			}
+		}
+
+		Nz::UInt64 wireBytes = client.GetTotalSentData() - sentData;
+		Nz::UInt32 wirePackets = client.GetTotalSentPackets() - sentPackets;
+		WARN(name << ": " << received << "/" << packets.size() << " packets received, " << wireBytes << " bytes sent in " << wirePackets << " datagrams");
+
+		return wireBytes;
+	};
+
+	Nz::UInt64 uncompressed = MeasureLoopback("No compression", nullptr);
+	Nz::UInt64 rangeCoder = MeasureLoopback("Range coder", [] { return std::make_unique<Nz::ENetRangeCoderCompressor>(); });
+	Nz::UInt64 lz = MeasureLoopback("LZ", [] { return std::make_unique<Nz::ENetLZCompressor>(); });
+	Nz::UInt64 lzDictionary = MeasureLoopback("LZ + dictionary", [&] { return std::make_unique<Nz::ENetLZCompressor>(dictionary); });
+
+	WARN("Compression ratio: range coder " << double(rangeCoder) / uncompressed << ", LZ " << double(lz) / uncompressed << ", LZ + dictionary " << double(lzDictionary) / uncompressed);
+
+	auto BenchmarkCompressor = [&](Nz::ENetCompressor& compressor)
+	{
+		std::vector<Nz::UInt8> output(Nz::ENetConstants::ENetProtocol_MaximumMTU);
+
+		std::size_t totalSize = 0;
+		for (const Nz::ByteArray& data : packets)
+		{
+			Nz::NetBuffer buffer;
+			buffer.data = const_cast<Nz::UInt8*>(data.GetConstBuffer());
+			buffer.dataLength = data.GetSize();
+
+			totalSize += compressor.Compress(nullptr, &buffer, 1, data.GetSize(), output.data(), output.size());
+		}
+
+		return totalSize;
+	};
+
+	Nz::ENetRangeCoderCompressor rangeCoderCompressor;
+	BENCHMARK("Range coder, 256 packets")
+	{
+		return BenchmarkCompressor(rangeCoderCompressor);
+	};
+
+	Nz::ENetLZCompressor lzCompressor;
+	BENCHMARK("LZ, 256 packets")
+	{
+		return BenchmarkCompressor(lzCompressor);
+	};
+
+	Nz::ENetLZCompressor lzDictionaryCompressor(dictionary);
+	BENCHMARK("LZ + dictionary, 256 packets")
+	{
+		return BenchmarkCompressor(lzDictionaryCompressor);
+	};
+}
@@ -0,0 +1,94 @@
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+
+namespace
+{
+	void ServiceHosts(Nz::ENetHost& server, Nz::ENetHost& client, std::size_t& receivedCount)
+	{
+		Nz::ENetEvent event;
+		for (unsigned int i = 0; i < 10; ++i)
+		{
+			while (server.Service(&event, 1) > 0)
+			{
+				if (event.type == Nz::ENetEventType::Receive)
+					receivedCount++;
+			}
+
+			while (client.Service(&event, 1) > 0)
+			{
+				if (event.type == Nz::ENetEventType::Receive)
+					receivedCount++;
+			}
+		}
+	}
+}
+
+SCENARIO("ENetHost", "[NETWORK][ENETHOST]")
+{
+	GIVEN("A server and a client connected to it on loopback")
+	{
+		std::random_device rd;
+		std::uniform_int_distribution<Nz::UInt16> dis(1025, 65535);
+
+		Nz::UInt16 port = dis(rd);
+		Nz::ENetHost server;
+		REQUIRE(server.Create(Nz::NetProtocol::IPv4, port, 4, 2));
+
+		Nz::ENetHost client;
+		REQUIRE(client.Create(Nz::NetProtocol::IPv4, 0, 1, 2));
+
+		Nz::ENetPeer* serverPeer = client.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port), 2);
+		REQUIRE(serverPeer);
+
+		std::size_t receivedCount = 0;
+		for (unsigned int i = 0; i < 50 && !serverPeer->IsConnected(); ++i)
+			ServiceHosts(server, client, receivedCount);
+
+		REQUIRE(serverPeer->IsConnected());
+
+		WHEN("We exchange packets for several rounds")
+		{
+			auto SendRound = [&]
+			{
+				for (unsigned int i = 0; i < 16; ++i)
+				{
+					Nz::NetPacket reliablePacket(1);
+					reliablePacket << Nz::UInt32(i);
+					serverPeer->Send(0, Nz::ENetPacketFlag_Reliable, std::move(reliablePacket));
+
+					Nz::NetPacket unreliablePacket(2);
+					unreliablePacket << Nz::UInt32(i);
+					serverPeer->Send(1, Nz::ENetPacketFlag_Unreliable, std::move(unreliablePacket));
+				}
+
+				ServiceHosts(server, client, receivedCount);
+			};
+
+			for (unsigned int i = 0; i < 4; ++i)
+				SendRound();
+
+			Nz::ENetCommandPoolStatistics clientOutgoingStats = client.GetOutgoingCommandPoolStatistics();
+			Nz::ENetCommandPoolStatistics serverIncomingStats = server.GetIncomingCommandPoolStatistics();
+
+			for (unsigned int i = 0; i < 16; ++i)
+				SendRound();
+
+			THEN("Packets are received and command nodes are recycled instead of allocated")
+			{
+				CHECK(receivedCount > 0);
+
+				Nz::ENetCommandPoolStatistics newClientOutgoingStats = client.GetOutgoingCommandPoolStatistics();
+				Nz::ENetCommandPoolStatistics newServerIncomingStats = server.GetIncomingCommandPoolStatistics();
+
+				CHECK(newClientOutgoingStats.acquireCount > clientOutgoingStats.acquireCount);
+				CHECK(newServerIncomingStats.acquireCount > serverIncomingStats.acquireCount);
+
+				// Node count may still grow a bit with traffic bursts, but not with the number of commands queued
+				CHECK(newClientOutgoingStats.allocatedNodeCount - clientOutgoingStats.allocatedNodeCount < newClientOutgoingStats.acquireCount - clientOutgoingStats.acquireCount);
+				CHECK(newServerIncomingStats.allocatedNodeCount - serverIncomingStats.allocatedNodeCount < newServerIncomingStats.acquireCount - serverIncomingStats.acquireCount);
+			}
+		}
+	}
+}
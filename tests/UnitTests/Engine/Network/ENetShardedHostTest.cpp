@@ -0,0 +1,158 @@
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#ifdef NAZARA_PLATFORM_POSIX
+
+SCENARIO("ENetShardedHost", "[NETWORK][ENETSHARDEDHOST]")
+{
+	constexpr std::size_t ClientCount = 8;
+	constexpr std::size_t ShardCount = 2;
+
+	GIVEN("A sharded server and several clients")
+	{
+		Nz::ENetShardedHost server;
+		REQUIRE(server.Create(Nz::NetProtocol::IPv4, 0, ShardCount, ClientCount, 1));
+		CHECK(server.GetShardCount() == ShardCount);
+
+		Nz::UInt16 port = server.GetBoundAddress().GetPort();
+		REQUIRE(port != 0);
+
+		std::atomic_uint connectedCount = 0;
+		std::atomic_uint receivedCount = 0;
+		std::array<std::atomic_uint, ShardCount> shardConnectCount = {};
+		std::mutex peerMutex;
+		std::vector<Nz::ENetShardedPeer> peers;
+
+		server.Start([&](std::size_t shardIndex, Nz::ENetHost& /*host*/, Nz::ENetEvent& event)
+		{
+			switch (event.type)
+			{
+				case Nz::ENetEventType::IncomingConnect:
+				{
+					std::lock_guard<std::mutex> lock(peerMutex);
+					peers.push_back(Nz::ENetShardedHost::GetPeerHandle(shardIndex, *event.peer));
+
+					shardConnectCount[shardIndex]++;
+					connectedCount++;
+					break;
+				}
+
+				case Nz::ENetEventType::Receive:
+					receivedCount++;
+					break;
+
+				default:
+					break;
+			}
+		});
+
+		std::array<Nz::ENetHost, ClientCount> clients;
+		std::array<Nz::ENetPeer*, ClientCount> serverPeers;
+		for (std::size_t i = 0; i < ClientCount; ++i)
+		{
+			REQUIRE(clients[i].Create(Nz::NetProtocol::IPv4, 0, 1, 1));
+
+			serverPeers[i] = clients[i].Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port), 1);
+			REQUIRE(serverPeers[i]);
+		}
+
+		std::array<unsigned int, ClientCount> clientReceived = {};
+		auto ServiceClients = [&](unsigned int iterationCount)
+		{
+			for (unsigned int i = 0; i < iterationCount; ++i)
+			{
+				for (std::size_t clientIndex = 0; clientIndex < ClientCount; ++clientIndex)
+				{
+					Nz::ENetEvent event;
+					while (clients[clientIndex].Service(&event, 1) > 0)
+					{
+						if (event.type == Nz::ENetEventType::Receive)
+							clientReceived[clientIndex]++;
+					}
+				}
+			}
+		};
+
+		for (unsigned int i = 0; i < 100 && connectedCount < ClientCount; ++i)
+			ServiceClients(1);
+
+		REQUIRE(connectedCount == ClientCount);
+		CHECK(shardConnectCount[0] + shardConnectCount[1] == ClientCount);
+
+		WHEN("Clients send packets")
+		{
+			for (std::size_t i = 0; i < ClientCount; ++i)
+			{
+				Nz::NetPacket packet(1);
+				packet << Nz::UInt32(i);
+				serverPeers[i]->Send(0, Nz::ENetPacketFlag_Reliable, std::move(packet));
+			}
+
+			for (unsigned int i = 0; i < 100 && receivedCount < ClientCount; ++i)
+				ServiceClients(1);
+
+			THEN("Every packet is received by the shard owning its peer")
+			{
+				CHECK(receivedCount == ClientCount);
+			}
+		}
+
+		WHEN("We broadcast a packet from another thread")
+		{
+			Nz::NetPacket packet(2);
+			packet << Nz::UInt32(42);
+			server.Broadcast(0, Nz::ENetPacketFlag_Reliable, packet);
+
+			auto AllReceived = [&] { return std::all_of(clientReceived.begin(), clientReceived.end(), [](unsigned int count) { return count >= 1; }); };
+			for (unsigned int i = 0; i < 100 && !AllReceived(); ++i)
+				ServiceClients(1);
+
+			THEN("Every client of every shard receives it")
+			{
+				CHECK(AllReceived());
+			}
+		}
+
+		WHEN("We send a packet to a peer handle and run a task on its shard")
+		{
+			Nz::ENetShardedPeer peer;
+			{
+				std::lock_guard<std::mutex> lock(peerMutex);
+				peer = peers.front();
+			}
+
+			Nz::NetPacket packet(3);
+			packet << Nz::UInt32(1337);
+			server.Send(peer, 0, Nz::ENetPacketFlag_Reliable, std::move(packet));
+
+			std::atomic_bool taskExecuted = false;
+			server.Post(peer.shardIndex, [&](std::size_t shardIndex, Nz::ENetHost& host)
+			{
+				Nz::ENetPeer* enetPeer = host.GetPeer(peer.peerId);
+				if (shardIndex == peer.shardIndex && enetPeer && enetPeer->IsConnected())
+					taskExecuted = true;
+			});
+
+			auto TotalReceived = [&] { unsigned int total = 0; for (unsigned int count : clientReceived) total += count; return total; };
+			for (unsigned int i = 0; i < 100 && (TotalReceived() == 0 || !taskExecuted); ++i)
+				ServiceClients(1);
+
+			THEN("Only this peer receives it")
+			{
+				CHECK(taskExecuted);
+				CHECK(TotalReceived() == 1);
+			}
+		}
+
+		server.Stop();
+	}
+}
+
+#endif
@@ -0,0 +1,98 @@
+#include <Nazara/Network/NetPacket.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+SCENARIO("NetPacket", "[NETWORK][NETPACKET]")
+{
+	GIVEN("A packet")
+	{
+		WHEN("We write and read it back")
+		{
+			Nz::NetPacket packet(42);
+			packet << Nz::UInt32(1337) << std::string("Hello");
+
+			std::size_t size;
+			const void* data = packet.OnSend(&size);
+			REQUIRE(data);
+
+			Nz::UInt32 packetSize;
+			Nz::UInt16 netCode;
+			REQUIRE(Nz::NetPacket::DecodeHeader(data, &packetSize, &netCode));
+			CHECK(packetSize == size);
+			CHECK(netCode == 42);
+
+			Nz::NetPacket received;
+			received.OnReceive(netCode, static_cast<const Nz::UInt8*>(data) + Nz::NetPacket::HeaderSize, size - Nz::NetPacket::HeaderSize);
+
+			THEN("Data is preserved")
+			{
+				Nz::UInt32 value;
+				std::string str;
+				received >> value >> str;
+
+				CHECK(value == 1337);
+				CHECK(str == "Hello");
+			}
+		}
+
+		WHEN("We build many packets on the same thread")
+		{
+			// Warm up the cache
+			{
+				Nz::NetPacket packet(1, 100);
+			}
+
+			Nz::NetPacket::BufferCacheStatistics before = Nz::NetPacket::GetBufferCacheStatistics();
+
+			for (unsigned int i = 0; i < 1000; ++i)
+			{
+				Nz::NetPacket packet(1, 100);
+				packet << Nz::UInt32(i);
+			}
+
+			Nz::NetPacket::BufferCacheStatistics after = Nz::NetPacket::GetBufferCacheStatistics();
+
+			THEN("Buffers are reused from the thread cache")
+			{
+				CHECK(after.threadAcquireCount - before.threadAcquireCount == 1000);
+				CHECK(after.threadReuseCount - before.threadReuseCount == 1000);
+				CHECK(after.threadBufferCount > 0);
+			}
+		}
+
+		WHEN("Packets are built on a thread and released on another")
+		{
+			constexpr std::size_t PacketCount = 500;
+
+			std::vector<Nz::NetPacket> packets;
+			std::thread producer([&]
+			{
+				for (std::size_t i = 0; i < PacketCount; ++i)
+				{
+					Nz::NetPacket& packet = packets.emplace_back(1, 200);
+					packet << Nz::UInt64(i);
+				}
+			});
+			producer.join();
+
+			Nz::NetPacket::BufferCacheStatistics before = Nz::NetPacket::GetBufferCacheStatistics();
+			packets.clear();
+
+			std::thread consumer([]
+			{
+				for (std::size_t i = 0; i < PacketCount; ++i)
+					Nz::NetPacket packet(1, 200);
+			});
+			consumer.join();
+
+			Nz::NetPacket::BufferCacheStatistics after = Nz::NetPacket::GetBufferCacheStatistics();
+
+			THEN("Buffers flow between threads through the global list")
+			{
+				CHECK(after.globalTransferCount > before.globalTransferCount);
+				CHECK(after.allocatedBufferCount - before.allocatedBufferCount < PacketCount);
+			}
+		}
+	}
+}
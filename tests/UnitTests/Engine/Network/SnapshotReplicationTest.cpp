@@ -0,0 +1,487 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Time.hpp>
+#include <Nazara/Network/Components/ReplicationComponent.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/Quantization.hpp>
+#include <Nazara/Network/SnapshotReceiver.hpp>
+#include <Nazara/Network/SnapshotReplicator.hpp>
+#include <Nazara/Utility/Components/NodeComponent.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr float WorldSize = 1024.f;
+	constexpr Nz::UInt8 PositionBits = 20;
+	constexpr Nz::UInt8 RotationBits = 12;
+
+	struct Health
+	{
+		Nz::UInt8 value = 0;
+	};
+
+	Nz::SnapshotSchema BuildSchema()
+	{
+		Nz::SnapshotSchema schema;
+		schema.RegisterComponent<Nz::NodeComponent>(Nz::GetQuantizedVector3BitCount(PositionBits) + Nz::GetQuantizedQuaternionBitCount(RotationBits),
+			[](Nz::ByteStream& stream, const Nz::NodeComponent& node)
+			{
+				Nz::WriteQuantizedVector3(stream, node.GetPosition(), -WorldSize, WorldSize, PositionBits);
+				Nz::WriteQuantizedQuaternion(stream, node.GetRotation(), RotationBits);
+			},
+			[](Nz::ByteStream& stream, Nz::NodeComponent& node)
+			{
+				node.SetPosition(Nz::ReadQuantizedVector3(stream, -WorldSize, WorldSize, PositionBits));
+				node.SetRotation(Nz::ReadQuantizedQuaternion(stream, RotationBits));
+			});
+
+		schema.RegisterComponent<Health>(7,
+			[](Nz::ByteStream& stream, const Health& health)
+			{
+				stream.WriteBits(health.value, 7);
+			},
+			[](Nz::ByteStream& stream, Health& health)
+			{
+				health.value = Nz::UInt8(stream.ReadBits(7));
+			});
+
+		return schema;
+	}
+
+	std::vector<entt::entity> SpawnEntities(entt::registry& registry, std::size_t count, std::mt19937& rand)
+	{
+		std::uniform_real_distribution<float> positionDis(-WorldSize / 2.f, WorldSize / 2.f);
+
+		std::vector<entt::entity> entities;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			entt::entity entity = registry.create();
+			registry.emplace<Nz::ReplicationComponent>(entity);
+			registry.emplace<Nz::NodeComponent>(entity).SetPosition(Nz::Vector3f(positionDis(rand), positionDis(rand), positionDis(rand)));
+			registry.emplace<Health>(entity).value = Nz::UInt8(i % 100);
+
+			entities.push_back(entity);
+		}
+
+		return entities;
+	}
+
+	void MoveEntities(entt::registry& registry, const std::vector<entt::entity>& entities, std::size_t tick)
+	{
+		for (std::size_t i = 0; i < entities.size(); i += 2)
+		{
+			auto& node = registry.get<Nz::NodeComponent>(entities[i]);
+			node.Move(Nz::Vector3f(0.5f, 0.f, -0.25f));
+			node.SetRotation(Nz::EulerAnglesf(0.f, float(tick * 3 % 360), 0.f));
+		}
+	}
+
+	bool IsReplicated(entt::registry& serverRegistry, const std::vector<entt::entity>& entities, entt::registry& clientRegistry, const Nz::SnapshotReceiver& receiver)
+	{
+		for (entt::entity serverEntity : entities)
+		{
+			entt::entity clientEntity = receiver.GetEntity(Nz::UInt32(entt::to_integral(serverEntity)));
+			if (clientEntity == entt::null)
+				return false;
+
+			const auto& serverNode = serverRegistry.get<Nz::NodeComponent>(serverEntity);
+			const auto* clientNode = clientRegistry.try_get<Nz::NodeComponent>(clientEntity);
+			const auto* clientHealth = clientRegistry.try_get<Health>(clientEntity);
+			if (!clientNode || !clientHealth)
+				return false;
+
+			if (serverNode.GetPosition().Distance(clientNode->GetPosition()) > 0.01f)
+				return false;
+
+			if (std::abs(serverNode.GetRotation().DotProduct(clientNode->GetRotation())) < 0.999f)
+				return false;
+
+			if (serverRegistry.get<Health>(serverEntity).value != clientHealth->value)
+				return false;
+		}
+
+		return true;
+	}
+
+	std::size_t Transmit(Nz::SnapshotReplicator& replicator, std::size_t peerIndex, Nz::SnapshotReceiver& receiver, bool acknowledge = true)
+	{
+		Nz::ByteArray buffer;
+		std::size_t snapshotSize;
+		{
+			Nz::ByteStream stream(&buffer, Nz::OpenMode::WriteOnly);
+			snapshotSize = replicator.EncodeSnapshot(peerIndex, stream);
+		}
+
+		CHECK(snapshotSize == buffer.GetSize());
+
+		Nz::ByteStream stream(&buffer, Nz::OpenMode::ReadOnly);
+
+		Nz::UInt16 snapshotId;
+		REQUIRE(receiver.Decode(stream, &snapshotId));
+		CHECK(snapshotId == replicator.GetSnapshotId());
+
+		if (acknowledge)
+			replicator.Acknowledge(peerIndex, snapshotId);
+
+		return snapshotSize;
+	}
+}
+
+SCENARIO("Quantization", "[NETWORK][QUANTIZATION]")
+{
+	GIVEN("Quantized floats")
+	{
+		THEN("Bounds are exact and the error is bounded")
+		{
+			CHECK(Nz::QuantizeFloat(-10.f, -10.f, 10.f, 8) == 0);
+			CHECK(Nz::QuantizeFloat(10.f, -10.f, 10.f, 8) == 255);
+			CHECK(Nz::QuantizeFloat(42.f, -10.f, 10.f, 8) == 255);
+			CHECK(Nz::DequantizeFloat(0, -10.f, 10.f, 8) == -10.f);
+			CHECK(Nz::DequantizeFloat(255, -10.f, 10.f, 8) == 10.f);
+
+			for (float value = -10.f; value <= 10.f; value += 0.37f)
+			{
+				Nz::UInt32 quantized = Nz::QuantizeFloat(value, -10.f, 10.f, 16);
+				float dequantized = Nz::DequantizeFloat(quantized, -10.f, 10.f, 16);
+				CHECK(std::abs(dequantized - value) <= 20.f / 65535.f);
+				CHECK(Nz::QuantizeFloat(dequantized, -10.f, 10.f, 16) == quantized);
+			}
+		}
+	}
+
+	GIVEN("Quantized vectors and quaternions")
+	{
+		Nz::ByteArray byteArray;
+		std::vector<Nz::Quaternionf> rotations = {
+			Nz::Quaternionf::Identity(),
+			Nz::Quaternionf(-1.f, 0.f, 0.f, 0.f),
+			Nz::EulerAnglesf(30.f, -120.f, 75.f),
+			Nz::EulerAnglesf(-90.f, 45.f, 180.f),
+			Nz::EulerAnglesf(0.f, 0.f, -179.f)
+		};
+
+		{
+			Nz::ByteStream stream(&byteArray, Nz::OpenMode::WriteOnly);
+			Nz::WriteQuantizedVector3(stream, Nz::Vector3f(1.f, -2.5f, 100.f), -128.f, 128.f, 18);
+			for (const Nz::Quaternionf& rotation : rotations)
+				Nz::WriteQuantizedQuaternion(stream, rotation, 10);
+		}
+
+		THEN("They take the expected size")
+		{
+			CHECK(byteArray.GetSize() == (Nz::GetQuantizedVector3BitCount(18) + rotations.size() * Nz::GetQuantizedQuaternionBitCount(10) + 7) / 8);
+		}
+
+		THEN("They are read back with a small error")
+		{
+			Nz::ByteStream stream(&byteArray, Nz::OpenMode::ReadOnly);
+
+			Nz::Vector3f vec = Nz::ReadQuantizedVector3(stream, -128.f, 128.f, 18);
+			CHECK(vec.x == Catch::Approx(1.f).margin(0.001f));
+			CHECK(vec.y == Catch::Approx(-2.5f).margin(0.001f));
+			CHECK(vec.z == Catch::Approx(100.f).margin(0.001f));
+
+			for (const Nz::Quaternionf& rotation : rotations)
+			{
+				Nz::Quaternionf readRotation = Nz::ReadQuantizedQuaternion(stream, 10);
+				CHECK(std::abs(readRotation.DotProduct(rotation)) == Catch::Approx(1.f).margin(0.0001f));
+			}
+		}
+	}
+}
+
+SCENARIO("SnapshotReplicator", "[NETWORK][SNAPSHOT]")
+{
+	GIVEN("A server registry replicated to a client registry")
+	{
+		std::mt19937 rand(42);
+
+		entt::registry serverRegistry;
+		std::vector<entt::entity> entities = SpawnEntities(serverRegistry, 100, rand);
+
+		Nz::SnapshotReplicator replicator(serverRegistry, BuildSchema());
+		std::size_t peerIndex = replicator.AddPeer(16 * 1024);
+
+		entt::registry clientRegistry;
+		Nz::SnapshotReceiver receiver(clientRegistry, BuildSchema());
+
+		replicator.CaptureSnapshot();
+		std::size_t fullSnapshotSize = Transmit(replicator, peerIndex, receiver);
+
+		THEN("The first snapshot creates every entity")
+		{
+			CHECK(receiver.GetEntityCount() == entities.size());
+			CHECK(IsReplicated(serverRegistry, entities, clientRegistry, receiver));
+		}
+
+		WHEN("Nothing changes")
+		{
+			replicator.CaptureSnapshot();
+			std::size_t snapshotSize = Transmit(replicator, peerIndex, receiver);
+
+			THEN("The snapshot is empty")
+			{
+				CHECK(snapshotSize == 3); //< snapshot id and end bit
+			}
+		}
+
+		WHEN("Some entities move")
+		{
+			MoveEntities(serverRegistry, entities, 1);
+			replicator.ResetStatistics();
+
+			replicator.CaptureSnapshot();
+			std::size_t snapshotSize = Transmit(replicator, peerIndex, receiver);
+
+			THEN("Only the moved entities are sent, without their unchanged components")
+			{
+				const auto& stats = replicator.GetStatistics();
+				CHECK(stats.sentEntityCount == entities.size() / 2);
+				CHECK(stats.sentComponentCount == entities.size() / 2);
+				CHECK(stats.unchangedComponentCount == entities.size() / 2);
+				CHECK(snapshotSize < fullSnapshotSize * 2 / 3);
+				CHECK(IsReplicated(serverRegistry, entities, clientRegistry, receiver));
+			}
+		}
+
+		WHEN("Snapshots are lost")
+		{
+			for (std::size_t tick = 2; tick < 10; ++tick)
+			{
+				MoveEntities(serverRegistry, entities, tick);
+				serverRegistry.get<Health>(entities[tick]).value = 99;
+
+				replicator.CaptureSnapshot();
+
+				Nz::ByteArray lostSnapshot;
+				Nz::ByteStream stream(&lostSnapshot, Nz::OpenMode::WriteOnly);
+				replicator.EncodeSnapshot(peerIndex, stream);
+			}
+
+			replicator.CaptureSnapshot();
+			Transmit(replicator, peerIndex, receiver);
+
+			THEN("The next received snapshot brings the client up to date")
+			{
+				CHECK(IsReplicated(serverRegistry, entities, clientRegistry, receiver));
+			}
+		}
+
+		WHEN("Acknowledgments are lost")
+		{
+			for (std::size_t tick = 10; tick < 20; ++tick)
+			{
+				MoveEntities(serverRegistry, entities, tick);
+
+				replicator.CaptureSnapshot();
+				Transmit(replicator, peerIndex, receiver, (tick % 3) == 0);
+			}
+
+			THEN("Client stays up to date")
+			{
+				CHECK(IsReplicated(serverRegistry, entities, clientRegistry, receiver));
+			}
+		}
+
+		WHEN("The bandwidth budget is too small for every entity")
+		{
+			constexpr std::size_t BandwidthBudget = 256;
+
+			replicator.UpdateBandwidthBudget(peerIndex, BandwidthBudget);
+			replicator.ResetStatistics();
+
+			entt::entity importantEntity = entities[1];
+			serverRegistry.get<Nz::ReplicationComponent>(importantEntity).UpdatePriority(1000.f);
+
+			for (entt::entity entity : entities)
+				serverRegistry.get<Nz::NodeComponent>(entity).Move(Nz::Vector3f(1.f, 2.f, 3.f));
+
+			replicator.CaptureSnapshot();
+			std::size_t snapshotSize = Transmit(replicator, peerIndex, receiver);
+			Nz::UInt64 deferredEntityCount = replicator.GetStatistics().deferredEntityCount;
+
+			entt::entity clientEntity = receiver.GetEntity(Nz::UInt32(entt::to_integral(importantEntity)));
+			Nz::Vector3f importantPosition = clientRegistry.get<Nz::NodeComponent>(clientEntity).GetPosition();
+
+			std::size_t tickCount = 1;
+			for (; tickCount < 100 && !IsReplicated(serverRegistry, entities, clientRegistry, receiver); ++tickCount)
+			{
+				replicator.CaptureSnapshot();
+				CHECK(Transmit(replicator, peerIndex, receiver) <= BandwidthBudget);
+			}
+
+			THEN("Entities are sent by order of priority, within the budget")
+			{
+				CHECK(snapshotSize <= BandwidthBudget);
+				CHECK(deferredEntityCount > 0);
+				CHECK(importantPosition.Distance(serverRegistry.get<Nz::NodeComponent>(importantEntity).GetPosition()) < 0.01f);
+				CHECK(tickCount > 1);
+				CHECK(IsReplicated(serverRegistry, entities, clientRegistry, receiver));
+			}
+
+			replicator.UpdateBandwidthBudget(peerIndex, 16 * 1024);
+		}
+
+		WHEN("Entities and components are removed")
+		{
+			entt::entity removedEntity = entities.back();
+			entities.pop_back();
+
+			Nz::UInt32 removedEntityId = Nz::UInt32(entt::to_integral(removedEntity));
+			entt::entity clientRemovedEntity = receiver.GetEntity(removedEntityId);
+			serverRegistry.destroy(removedEntity);
+
+			entt::entity strippedEntity = entities.front();
+			serverRegistry.remove<Health>(strippedEntity);
+
+			replicator.CaptureSnapshot();
+			Transmit(replicator, peerIndex, receiver);
+
+			THEN("They are removed on the client")
+			{
+				CHECK(receiver.GetEntity(removedEntityId) == entt::null);
+				CHECK_FALSE(clientRegistry.valid(clientRemovedEntity));
+				CHECK(receiver.GetEntityCount() == entities.size());
+
+				entt::entity clientEntity = receiver.GetEntity(Nz::UInt32(entt::to_integral(strippedEntity)));
+				CHECK(clientRegistry.all_of<Nz::NodeComponent>(clientEntity));
+				CHECK_FALSE(clientRegistry.all_of<Health>(clientEntity));
+			}
+		}
+	}
+}
+
+namespace
+{
+	struct LoopbackResult
+	{
+		Nz::SnapshotReplicator::Statistics statistics;
+		std::size_t maxSnapshotSize = 0;
+		bool isReplicated = false;
+	};
+
+	LoopbackResult RunLoopback(std::size_t entityCount, std::size_t tickCount, std::size_t bandwidthBudget)
+	{
+		LoopbackResult result;
+
+		std::mt19937 rand(42);
+
+		Nz::ENetHost server;
+		REQUIRE(server.Create(Nz::NetProtocol::IPv4, 0, 1, 1));
+		Nz::UInt16 port = server.GetBoundAddress().GetPort();
+
+		Nz::ENetHost client;
+		REQUIRE(client.Create(Nz::NetProtocol::IPv4, 0, 1, 1));
+
+		Nz::ENetPeer* serverPeer = client.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port), 1);
+		REQUIRE(serverPeer);
+
+		Nz::ENetPeer* clientPeer = nullptr;
+		Nz::ENetEvent event;
+		for (unsigned int i = 0; i < 500 && (!clientPeer || !serverPeer->IsConnected()); ++i)
+		{
+			if (server.Service(&event, 1) > 0 && event.type == Nz::ENetEventType::IncomingConnect)
+				clientPeer = event.peer;
+
+			client.Service(&event, 1);
+		}
+		REQUIRE(clientPeer);
+		REQUIRE(serverPeer->IsConnected());
+
+		entt::registry serverRegistry;
+		std::vector<entt::entity> entities = SpawnEntities(serverRegistry, entityCount, rand);
+
+		Nz::SnapshotReplicator replicator(serverRegistry, BuildSchema());
+		std::size_t peerIndex = replicator.AddPeer(bandwidthBudget);
+
+		entt::registry clientRegistry;
+		Nz::SnapshotReceiver receiver(clientRegistry, BuildSchema());
+
+		// Snapshots only go from server to client and acknowledgments from client to server
+		auto ServiceHosts = [&]
+		{
+			while (client.Service(&event, 0) > 0)
+			{
+				if (event.type != Nz::ENetEventType::Receive)
+					continue;
+
+				Nz::UInt16 snapshotId;
+				if (!receiver.Decode(event.packet->data, &snapshotId))
+					continue;
+
+				Nz::NetPacket ack(1);
+				ack << snapshotId;
+				serverPeer->Send(0, Nz::ENetPacketFlag_Unsequenced, std::move(ack));
+			}
+
+			while (server.Service(&event, 0) > 0)
+			{
+				if (event.type != Nz::ENetEventType::Receive)
+					continue;
+
+				Nz::UInt16 snapshotId;
+				event.packet->data >> snapshotId;
+				replicator.Acknowledge(peerIndex, snapshotId);
+			}
+		};
+
+		// Entities move during tickCount ticks, then the replication has a few ticks to catch up
+		for (std::size_t tick = 0; tick < tickCount * 2; ++tick)
+		{
+			if (tick < tickCount)
+				MoveEntities(serverRegistry, entities, tick);
+			else if (IsReplicated(serverRegistry, entities, clientRegistry, receiver))
+				break;
+
+			replicator.CaptureSnapshot();
+
+			Nz::NetPacket snapshot(1);
+			result.maxSnapshotSize = std::max(result.maxSnapshotSize, replicator.EncodeSnapshot(peerIndex, snapshot));
+			clientPeer->Send(0, Nz::ENetPacketFlag_Unsequenced, std::move(snapshot));
+
+			ServiceHosts();
+			ServiceHosts();
+		}
+
+		result.isReplicated = IsReplicated(serverRegistry, entities, clientRegistry, receiver);
+		result.statistics = replicator.GetStatistics();
+
+		return result;
+	}
+}
+
+SCENARIO("SnapshotReplicator over ENet", "[NETWORK][SNAPSHOT]")
+{
+	WHEN("We replicate moving entities over a loopback connection")
+	{
+		LoopbackResult result = RunLoopback(200, 20, 1200);
+
+		THEN("Client ends up with the server state, snapshots never exceed the budget")
+		{
+			CHECK(result.isReplicated);
+			CHECK(result.maxSnapshotSize <= 1200);
+			CHECK(result.statistics.encodedSnapshotCount >= 20);
+			CHECK(result.statistics.unchangedComponentCount > 0);
+		}
+	}
+}
+
+SCENARIO("SnapshotReplicator over ENet (measures)", "[.][NETWORK][SNAPSHOT][BENCHMARK]")
+{
+	for (std::size_t entityCount : { 100, 1000, 5000 })
+	{
+		LoopbackResult result = RunLoopback(entityCount, 60, 1200);
+
+		const auto& stats = result.statistics;
+		WARN(entityCount << " entities: " << stats.encodedSnapshotCount << " snapshots, "
+			<< stats.encodedByteCount / stats.encodedSnapshotCount << " bytes per snapshot on average (max " << result.maxSnapshotSize << "), "
+			<< stats.captureTime.AsMicroseconds() / Nz::Int64(stats.encodedSnapshotCount) << "us capture and "
+			<< stats.encodeTime.AsMicroseconds() / Nz::Int64(stats.encodedSnapshotCount) << "us encode per tick, "
+			<< stats.sentEntityCount << " entity updates sent (" << stats.unchangedComponentCount << " unchanged components skipped), "
+			<< stats.deferredEntityCount << " deferred" << (result.isReplicated ? "" : " (client did not catch up)"));
+	}
+}
@@ -0,0 +1,256 @@
+#include <Nazara/Network/SocketCompletionQueue.hpp>
+#include <Nazara/Network/TcpClient.hpp>
+#include <Nazara/Network/TcpServer.hpp>
+#include <Nazara/Network/UdpSocket.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+
+SCENARIO("SocketCompletionQueue", "[NETWORK][SOCKETCOMPLETIONQUEUE]")
+{
+	if (!Nz::SocketCompletionQueue::IsSupported())
+	{
+		WARN("Socket completion queues are not supported on this system");
+		return;
+	}
+
+	Nz::SocketCompletionQueue queue;
+	REQUIRE(queue.Create(64, 16, 1024));
+
+	auto PollUntil = [&](auto&& predicate)
+	{
+		for (unsigned int i = 0; i < 100 && !predicate(); ++i)
+			queue.Poll(10);
+
+		return predicate();
+	};
+
+	GIVEN("A TCP server accepting clients asynchronously")
+	{
+		Nz::TcpServer server;
+		REQUIRE(server.Listen(Nz::NetProtocol::IPv4, 0) == Nz::SocketState::Bound);
+
+		std::vector<Nz::TcpClient> acceptedClients;
+		REQUIRE(server.AcceptAsync(queue, [&](Nz::SocketError error, Nz::TcpClient&& client)
+		{
+			CHECK(error == Nz::SocketError::NoError);
+			acceptedClients.push_back(std::move(client));
+		}));
+
+		Nz::IpAddress serverIP(Nz::IpAddress::LoopbackIpV4.ToIPv4(), server.GetBoundPort());
+
+		std::vector<Nz::TcpClient> clients(3);
+		for (Nz::TcpClient& client : clients)
+		{
+			client.Connect(serverIP);
+			REQUIRE(client.WaitForConnected(1000) == Nz::SocketState::Connected);
+		}
+
+		REQUIRE(PollUntil([&] { return acceptedClients.size() == clients.size(); }));
+		for (Nz::TcpClient& acceptedClient : acceptedClients)
+		{
+			CHECK(acceptedClient.GetState() == Nz::SocketState::Connected);
+			CHECK(acceptedClient.GetRemoteAddress().IsLoopback());
+		}
+
+		WHEN("Accepted clients echo what they receive")
+		{
+			for (Nz::TcpClient& acceptedClient : acceptedClients)
+			{
+				REQUIRE(acceptedClient.ReceiveAsync(queue, [&](Nz::SocketError error, const void* data, std::size_t size)
+				{
+					if (error == Nz::SocketError::NoError)
+						acceptedClient.SendAsync(queue, data, size);
+				}));
+			}
+
+			std::vector<std::string> echoes(clients.size());
+			for (std::size_t i = 0; i < clients.size(); ++i)
+			{
+				REQUIRE(clients[i].ReceiveAsync(queue, [&echoes, i](Nz::SocketError error, const void* data, std::size_t size)
+				{
+					if (error == Nz::SocketError::NoError)
+						echoes[i].append(static_cast<const char*>(data), size);
+				}));
+
+				std::string message = "Hello from client #" + std::to_string(i);
+				REQUIRE(clients[i].SendAsync(queue, message.data(), message.size()));
+			}
+
+			auto AllEchoed = [&]
+			{
+				for (std::size_t i = 0; i < clients.size(); ++i)
+				{
+					if (echoes[i] != "Hello from client #" + std::to_string(i))
+						return false;
+				}
+
+				return true;
+			};
+
+			THEN("Every client receives its own message back")
+			{
+				CHECK(PollUntil(AllEchoed));
+			}
+		}
+
+		WHEN("We queue sends larger than the receive buffers")
+		{
+			constexpr std::size_t ChunkCount = 64;
+			constexpr std::size_t ChunkSize = 16 * 1024;
+
+			std::vector<Nz::UInt8> received;
+			REQUIRE(clients[0].ReceiveAsync(queue, [&](Nz::SocketError error, const void* data, std::size_t size)
+			{
+				if (error == Nz::SocketError::NoError)
+					received.insert(received.end(), static_cast<const Nz::UInt8*>(data), static_cast<const Nz::UInt8*>(data) + size);
+			}));
+
+			std::size_t sentBytes = 0;
+			std::vector<Nz::UInt8> chunk(ChunkSize);
+			for (std::size_t i = 0; i < ChunkCount; ++i)
+			{
+				for (std::size_t j = 0; j < ChunkSize; ++j)
+					chunk[j] = static_cast<Nz::UInt8>(i + j);
+
+				REQUIRE(acceptedClients[0].SendAsync(queue, chunk.data(), chunk.size(), [&](Nz::SocketError error, std::size_t sent)
+				{
+					CHECK(error == Nz::SocketError::NoError);
+					sentBytes += sent;
+				}));
+			}
+
+			THEN("Data is received in order, reusing the receive buffers")
+			{
+				REQUIRE(PollUntil([&] { return received.size() == ChunkCount * ChunkSize; }));
+				CHECK(sentBytes == ChunkCount * ChunkSize);
+
+				bool isValid = true;
+				for (std::size_t i = 0; i < ChunkCount && isValid; ++i)
+				{
+					for (std::size_t j = 0; j < ChunkSize; ++j)
+					{
+						if (received[i * ChunkSize + j] != static_cast<Nz::UInt8>(i + j))
+						{
+							isValid = false;
+							break;
+						}
+					}
+				}
+				CHECK(isValid);
+
+				// A single receive submission handles every incoming data, and data is batched in few system calls
+				const Nz::SocketCompletionQueue::Statistics& statistics = queue.GetStatistics();
+				CHECK(statistics.completionCount > ChunkCount);
+				CHECK(statistics.syscallCount < statistics.completionCount);
+			}
+		}
+
+		WHEN("A client disconnects")
+		{
+			bool closed = false;
+			REQUIRE(acceptedClients[1].ReceiveAsync(queue, [&](Nz::SocketError error, const void* /*data*/, std::size_t /*size*/)
+			{
+				if (error == Nz::SocketError::ConnectionClosed)
+					closed = true;
+			}));
+
+			clients[1].Close();
+
+			THEN("The server receive operation reports it")
+			{
+				CHECK(PollUntil([&] { return closed; }));
+			}
+		}
+
+		WHEN("We close a socket with a pending receive")
+		{
+			bool called = false;
+			REQUIRE(acceptedClients[2].ReceiveAsync(queue, [&](Nz::SocketError /*error*/, const void* /*data*/, std::size_t /*size*/)
+			{
+				called = true;
+			}));
+			queue.Poll(0);
+
+			acceptedClients[2].Close();
+
+			std::size_t sent;
+			clients[2].Send("data", 4, &sent);
+			clients[2].Close();
+
+			for (unsigned int i = 0; i < 10; ++i)
+				queue.Poll(1);
+
+			THEN("The operation is cancelled without calling its callback")
+			{
+				CHECK_FALSE(called);
+			}
+		}
+	}
+
+	GIVEN("Two UDP sockets")
+	{
+		Nz::UdpSocket server(Nz::NetProtocol::IPv4);
+		REQUIRE(server.Bind(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), 0)) == Nz::SocketState::Bound);
+
+		Nz::UdpSocket client(Nz::NetProtocol::IPv4);
+		REQUIRE(client.Bind(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), 0)) == Nz::SocketState::Bound);
+
+		WHEN("We exchange datagrams asynchronously")
+		{
+			std::vector<std::string> datagrams;
+			Nz::IpAddress lastSender;
+			REQUIRE(server.ReceiveFromAsync(queue, [&](Nz::SocketError error, const Nz::IpAddress& from, const void* data, std::size_t size)
+			{
+				CHECK(error == Nz::SocketError::NoError);
+				datagrams.emplace_back(static_cast<const char*>(data), size);
+				lastSender = from;
+			}));
+
+			std::size_t sentCount = 0;
+			for (unsigned int i = 0; i < 10; ++i)
+			{
+				std::string message = "Datagram #" + std::to_string(i);
+				REQUIRE(client.SendToAsync(queue, server.GetBoundAddress(), message.data(), message.size(), [&](Nz::SocketError error, std::size_t sent)
+				{
+					CHECK(error == Nz::SocketError::NoError);
+					CHECK(sent > 0);
+					sentCount++;
+				}));
+			}
+
+			THEN("Every datagram is received along with its sender address")
+			{
+				REQUIRE(PollUntil([&] { return datagrams.size() == 10 && sentCount == 10; }));
+
+				for (unsigned int i = 0; i < 10; ++i)
+					CHECK(datagrams[i] == "Datagram #" + std::to_string(i));
+
+				CHECK(lastSender == client.GetBoundAddress());
+			}
+		}
+
+		WHEN("We receive a datagram over the buffer size")
+		{
+			Nz::SocketError receiveError = Nz::SocketError::NoError;
+			std::size_t receivedSize = 0;
+			REQUIRE(server.ReceiveFromAsync(queue, [&](Nz::SocketError error, const Nz::IpAddress& /*from*/, const void* /*data*/, std::size_t size)
+			{
+				receiveError = error;
+				receivedSize = size;
+			}));
+
+			std::vector<Nz::UInt8> datagram(2048);
+			std::size_t sent;
+			REQUIRE(client.Send(server.GetBoundAddress(), datagram.data(), datagram.size(), &sent));
+
+			THEN("It is truncated and reported")
+			{
+				REQUIRE(PollUntil([&] { return receivedSize != 0; }));
+				CHECK(receiveError == Nz::SocketError::DatagramSize);
+				CHECK(receivedSize < datagram.size());
+			}
+		}
+	}
+}
@@ -5,6 +5,7 @@
 #include <Nazara/Network/TcpServer.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <array>
 #include <random>
 
 SCENARIO("SocketPoller", "[NETWORK][SOCKETPOLLER]")
@@ -82,4 +83,113 @@ SCENARIO("SocketPoller", "[NETWORK][SOCKETPOLLER]")
 			}
 		}
  	}
+
+	GIVEN("Multiple connected clients registered with userdata")
+	{
+		Nz::TcpServer server;
+		REQUIRE(server.Listen(Nz::NetProtocol::IPv4, 0) == Nz::SocketState::Bound);
+
+		Nz::IpAddress serverIP(Nz::IpAddress::LoopbackIpV4.ToIPv4(), server.GetBoundPort());
+
+		constexpr std::size_t ClientCount = 3;
+
+		std::array<Nz::TcpClient, ClientCount> clients;
+		std::array<Nz::TcpClient, ClientCount> serverToClients;
+		std::array<std::size_t, ClientCount> clientIndices;
+		for (std::size_t i = 0; i < ClientCount; ++i)
+		{
+			clients[i].Connect(serverIP);
+			REQUIRE(clients[i].WaitForConnected(1000) == Nz::SocketState::Connected);
+			REQUIRE(server.AcceptClient(&serverToClients[i]));
+
+			clientIndices[i] = i;
+		}
+
+		Nz::SocketPoller poller;
+
+		std::array<char, 5> buffer = {"Data"};
+		std::size_t sent;
+
+		WHEN("Some clients send data")
+		{
+			for (std::size_t i = 0; i < ClientCount; ++i)
+				REQUIRE(poller.RegisterSocket(serverToClients[i], Nz::SocketPollEvent::Read, &clientIndices[i]));
+
+			REQUIRE(clients[0].Send(buffer.data(), buffer.size(), &sent));
+			REQUIRE(clients[2].Send(buffer.data(), buffer.size(), &sent));
+
+			// Data may not arrive at the same time
+			unsigned int readyCount = 0;
+			for (unsigned int i = 0; i < 10 && readyCount < 2; ++i)
+				readyCount = poller.Wait(100);
+
+			THEN("Only those are in the ready list, along with their userdata")
+			{
+				REQUIRE(readyCount == 2);
+
+				const auto& readySockets = poller.GetReadySockets();
+				REQUIRE(readySockets.size() == 2);
+
+				std::size_t indexSum = 0;
+				for (const Nz::SocketPoller::ReadySocket& readySocket : readySockets)
+				{
+					CHECK(readySocket.events == Nz::SocketPollEvent::Read);
+
+					std::size_t index = *static_cast<const std::size_t*>(readySocket.userdata);
+					CHECK(readySocket.handle == serverToClients[index].GetNativeHandle());
+					CHECK(poller.IsReadyToRead(serverToClients[index]));
+
+					indexSum += index;
+				}
+				CHECK(indexSum == 0 + 2);
+				CHECK_FALSE(poller.IsReadyToRead(serverToClients[1]));
+			}
+
+			AND_WHEN("We unregister them while iterating the ready list")
+			{
+				for (const Nz::SocketPoller::ReadySocket& readySocket : poller.GetReadySockets())
+				{
+					for (Nz::TcpClient& serverToClient : serverToClients)
+					{
+						if (poller.IsRegistered(serverToClient))
+							poller.UnregisterSocket(serverToClient);
+					}
+
+					CHECK_FALSE(readySocket.events);
+				}
+
+				THEN("They are no longer reported")
+				{
+					CHECK(poller.GetReadySockets().size() == 2);
+					CHECK(poller.GetReadySockets()[0].userdata == nullptr);
+					CHECK(poller.GetReadySockets()[1].userdata == nullptr);
+				}
+			}
+		}
+
+		WHEN("A client is registered in edge-triggered mode and receives data")
+		{
+			REQUIRE(poller.RegisterSocket(serverToClients[1], Nz::SocketPollEvent::Read, &clientIndices[1], Nz::SocketPollMode::EdgeTriggered));
+
+			REQUIRE(clients[1].Send(buffer.data(), buffer.size(), &sent));
+			REQUIRE(poller.Wait(1000) == 1);
+			CHECK(poller.IsReadyToRead(serverToClients[1]));
+
+			THEN("It is only reported again once new data arrives")
+			{
+#if defined(NAZARA_PLATFORM_LINUX)
+				// Data was not read but no new data arrived
+				CHECK(poller.Wait(100) == 0);
+				CHECK_FALSE(poller.IsReadyToRead(serverToClients[1]));
+#else
+				// Other platforms fall back to level-triggered mode
+				CHECK(poller.Wait(100) == 1);
+#endif
+
+				REQUIRE(clients[1].Send(buffer.data(), buffer.size(), &sent));
+				REQUIRE(poller.Wait(1000) == 1);
+				CHECK(poller.GetReadySockets()[0].userdata == &clientIndices[1]);
+			}
+		}
+	}
 }
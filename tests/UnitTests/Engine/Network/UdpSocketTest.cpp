@@ -1,8 +1,12 @@
 #include <Nazara/Math/Vector3.hpp>
-#include <Nazara/Network/UdpSocket.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/NetPacket.hpp>
+#include <Nazara/Network/UdpSocket.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <array>
+#include <vector>
 
 SCENARIO("UdpSocket", "[NETWORK][UDPSOCKET]")
 {
@@ -38,5 +42,129 @@ SCENARIO("UdpSocket", "[NETWORK][UDPSOCKET]")
 				REQUIRE(result == vector123);
 			}
 		}
+
+		WHEN("We send a batch of datagrams from client")
+		{
+			constexpr std::size_t DatagramCount = 8;
+
+			std::array<std::array<Nz::UInt8, 64>, DatagramCount> sentData;
+			std::array<Nz::NetBuffer, DatagramCount> sentBuffers;
+			std::array<Nz::NetDatagram, DatagramCount> sentDatagrams;
+			for (std::size_t i = 0; i < DatagramCount; ++i)
+			{
+				sentData[i].fill(static_cast<Nz::UInt8>(i));
+
+				sentBuffers[i].data = sentData[i].data();
+				sentBuffers[i].dataLength = 10 + i;
+
+				sentDatagrams[i].address = serverIP;
+				sentDatagrams[i].buffers = &sentBuffers[i];
+				sentDatagrams[i].bufferCount = 1;
+			}
+
+			std::size_t sentCount;
+			REQUIRE(client.SendDatagrams(sentDatagrams.data(), sentDatagrams.size(), &sentCount));
+			CHECK(sentCount == DatagramCount);
+
+			THEN("We should receive all of them on the server, in order")
+			{
+				std::array<std::array<Nz::UInt8, 64>, DatagramCount * 2> receivedData;
+				std::array<Nz::NetBuffer, DatagramCount * 2> receivedBuffers;
+				std::array<Nz::NetDatagram, DatagramCount * 2> receivedDatagrams;
+				for (std::size_t i = 0; i < receivedDatagrams.size(); ++i)
+				{
+					receivedBuffers[i].data = receivedData[i].data();
+					receivedBuffers[i].dataLength = receivedData[i].size();
+
+					receivedDatagrams[i].buffers = &receivedBuffers[i];
+					receivedDatagrams[i].bufferCount = 1;
+				}
+
+				std::size_t receivedCount = 0;
+				while (receivedCount < DatagramCount)
+				{
+					std::size_t count;
+					REQUIRE(server.ReceiveDatagrams(&receivedDatagrams[receivedCount], receivedDatagrams.size() - receivedCount, &count));
+					REQUIRE(count > 0); //< Server socket is blocking
+					receivedCount += count;
+				}
+
+				CHECK(receivedCount == DatagramCount);
+				for (std::size_t i = 0; i < DatagramCount; ++i)
+				{
+					CHECK(receivedDatagrams[i].dataLength == 10 + i);
+					CHECK(receivedDatagrams[i].address.ToIPv4() == Nz::IpAddress::LoopbackIpV4.ToIPv4());
+					CHECK(receivedData[i][0] == i);
+					CHECK(receivedData[i][receivedDatagrams[i].dataLength - 1] == i);
+				}
+			}
+		}
 	}
 }
+
+SCENARIO("UdpSocket datagram batching", "[.][NETWORK][UDPSOCKET][BENCHMARK]")
+{
+	constexpr std::size_t BatchSize = 32;
+	constexpr std::size_t DatagramSize = 1200;
+
+	Nz::UdpSocket server(Nz::NetProtocol::IPv4);
+	REQUIRE(server.Bind(0) == Nz::SocketState::Bound);
+	server.EnableBlocking(false);
+	server.SetReceiveBufferSize(4 * 1024 * 1024);
+
+	Nz::IpAddress serverIP(Nz::IpAddress::LoopbackIpV4.ToIPv4(), server.GetBoundPort());
+
+	Nz::UdpSocket client(Nz::NetProtocol::IPv4);
+	client.EnableBlocking(false);
+
+	std::vector<Nz::UInt8> data(BatchSize * DatagramSize, 42);
+	std::array<Nz::NetBuffer, BatchSize> buffers;
+	std::array<Nz::NetDatagram, BatchSize> datagrams;
+	for (std::size_t i = 0; i < BatchSize; ++i)
+	{
+		buffers[i].data = &data[i * DatagramSize];
+		buffers[i].dataLength = DatagramSize;
+
+		datagrams[i].address = serverIP;
+		datagrams[i].buffers = &buffers[i];
+		datagrams[i].bufferCount = 1;
+	}
+
+	std::vector<Nz::UInt8> receiveData(BatchSize * DatagramSize);
+	std::array<Nz::NetBuffer, BatchSize> receiveBuffers;
+	std::array<Nz::NetDatagram, BatchSize> receiveDatagrams;
+	for (std::size_t i = 0; i < BatchSize; ++i)
+	{
+		receiveBuffers[i].data = &receiveData[i * DatagramSize];
+		receiveBuffers[i].dataLength = DatagramSize;
+
+		receiveDatagrams[i].buffers = &receiveBuffers[i];
+		receiveDatagrams[i].bufferCount = 1;
+	}
+
+	BENCHMARK("One datagram per call over loopback")
+	{
+		std::size_t received = 0;
+		for (std::size_t i = 0; i < BatchSize; ++i)
+			client.Send(serverIP, buffers[i].data, DatagramSize, nullptr);
+
+		std::size_t receivedLength;
+		Nz::IpAddress from;
+		while (server.Receive(receiveData.data(), DatagramSize, &from, &receivedLength) && receivedLength > 0)
+			received++;
+
+		return received;
+	};
+
+	BENCHMARK("Batched datagrams over loopback")
+	{
+		std::size_t received = 0;
+		client.SendDatagrams(datagrams.data(), datagrams.size(), nullptr);
+
+		std::size_t receivedCount;
+		while (server.ReceiveDatagrams(receiveDatagrams.data(), receiveDatagrams.size(), &receivedCount) && receivedCount > 0)
+			received += receivedCount;
+
+		return received;
+	};
+}
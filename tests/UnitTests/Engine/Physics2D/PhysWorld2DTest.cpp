@@ -1,6 +1,8 @@
+#include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 
 Nz::RigidBody2D CreateBody(Nz::PhysWorld2D& world, const Nz::Vector2f& position, bool isMoving = true, const Nz::Vector2f& lengths = Nz::Vector2f::Unit());
 
@@ -99,6 +101,70 @@ SCENARIO("PhysWorld2D", "[PHYSICS2D][PHYSWORLD2D]")
 				CHECK(results[0] == &bodies[0]);
 			}
 		}
+
+		WHEN("We run batched queries")
+		{
+			std::vector<Nz::PhysWorld2D::NearestBodyRequest> nearestRequests(numberOfBodiesPerLign + 1);
+			std::vector<Nz::PhysWorld2D::RaycastRequest> raycastRequests(numberOfBodiesPerLign + 1);
+			for (int i = 0; i != numberOfBodiesPerLign + 1; ++i)
+			{
+				// Last requests are out of the grid
+				float x = (i != numberOfBodiesPerLign) ? 10.f * i + 0.5f : -20.f;
+
+				nearestRequests[i].from = Nz::Vector2f(x, -1.f);
+				nearestRequests[i].maxDistance = 2.f;
+				nearestRequests[i].collisionGroup = collisionGroup;
+				nearestRequests[i].categoryMask = categoryMask;
+				nearestRequests[i].collisionMask = collisionMask;
+
+				raycastRequests[i].from = Nz::Vector2f(x, -2.f);
+				raycastRequests[i].to = Nz::Vector2f(x, 40.f);
+				raycastRequests[i].collisionGroup = collisionGroup;
+				raycastRequests[i].categoryMask = categoryMask;
+				raycastRequests[i].collisionMask = collisionMask;
+			}
+
+			std::vector<Nz::PhysWorld2D::RegionRequest> regionRequests(2);
+			regionRequests[0].boundingBox = Nz::Rectf(-5.f, -5.f, 5.f, 5.f);
+			regionRequests[1].boundingBox = Nz::Rectf(-5.f, -5.f, 30.f, 30.f);
+			for (Nz::PhysWorld2D::RegionRequest& request : regionRequests)
+			{
+				request.collisionGroup = collisionGroup;
+				request.categoryMask = categoryMask;
+				request.collisionMask = collisionMask;
+			}
+
+			std::vector<Nz::PhysWorld2D::NearestQueryResult> nearestResults(nearestRequests.size());
+			std::vector<Nz::PhysWorld2D::RaycastHit> raycastResults(raycastRequests.size());
+
+			constexpr std::size_t maxBodyPerRequest = 4;
+			std::vector<Nz::RigidBody2D*> regionBodies(regionRequests.size() * maxBodyPerRequest);
+			std::vector<std::size_t> regionBodyCounts(regionRequests.size());
+
+			CHECK(world.BatchNearestBodyQuery(nearestRequests.data(), nearestRequests.size(), nearestResults.data()) == numberOfBodiesPerLign);
+			CHECK(world.BatchRaycastQueryFirst(raycastRequests.data(), raycastRequests.size(), raycastResults.data()) == numberOfBodiesPerLign);
+			CHECK(world.BatchRegionQuery(regionRequests.data(), regionRequests.size(), regionBodies.data(), maxBodyPerRequest, regionBodyCounts.data()) == 1 + maxBodyPerRequest);
+
+			THEN("Results match the single queries")
+			{
+				for (int i = 0; i != numberOfBodiesPerLign; ++i)
+				{
+					CHECK(nearestResults[i].nearestBody == &bodies[i * numberOfBodiesPerLign]);
+					CHECK(nearestResults[i].distance == Catch::Approx(1.f));
+
+					CHECK(raycastResults[i].nearestBody == &bodies[i * numberOfBodiesPerLign]);
+					CHECK(raycastResults[i].hitPos == Nz::Vector2f(10.f * i + 0.5f, 0.f));
+					CHECK(raycastResults[i].hitNormal == -Nz::Vector2f::UnitY());
+				}
+
+				CHECK(nearestResults.back().nearestBody == nullptr);
+				CHECK(raycastResults.back().nearestBody == nullptr);
+
+				REQUIRE(regionBodyCounts[0] == 1);
+				CHECK(regionBodies[0] == &bodies[0]);
+				CHECK(regionBodyCounts[1] == maxBodyPerRequest);
+			}
+		}
 	}
 
 	GIVEN("Three entities, a character, a wall and a trigger zone")
@@ -191,6 +257,246 @@ SCENARIO("PhysWorld2D", "[PHYSICS2D][PHYSWORLD2D]")
 			}
 		}
 	}
+
+	GIVEN("A physic world with a multithreaded solver and a regular one")
+	{
+		Nz::PhysWorld2D threadedWorld(2);
+		CHECK(threadedWorld.IsThreaded());
+		CHECK(threadedWorld.GetThreadCount() >= 1);
+
+		Nz::PhysWorld2D world;
+		CHECK_FALSE(world.IsThreaded());
+		CHECK(world.GetThreadCount() == 1);
+
+		WHEN("We stack boxes on the ground in both worlds")
+		{
+			const int boxCount = 5;
+
+			std::vector<Nz::RigidBody2D> threadedBodies;
+			std::vector<Nz::RigidBody2D> bodies;
+			for (Nz::PhysWorld2D* physWorld : { &threadedWorld, &world })
+			{
+				physWorld->SetGravity(Nz::Vector2f(0.f, -10.f));
+				physWorld->SetIterationCount(20);
+				physWorld->SetCollisionSlop(0.01f);
+
+				std::vector<Nz::RigidBody2D>& worldBodies = (physWorld == &threadedWorld) ? threadedBodies : bodies;
+				worldBodies.push_back(CreateBody(*physWorld, Nz::Vector2f(-5.f, -1.f), false, Nz::Vector2f(10.f, 1.f)));
+				for (int i = 0; i != boxCount; ++i)
+					worldBodies.push_back(CreateBody(*physWorld, Nz::Vector2f(0.f, 1.1f * i)));
+			}
+
+			for (int i = 0; i != 60; ++i)
+			{
+				threadedWorld.Step(Nz::Time::TickDuration(60));
+				world.Step(Nz::Time::TickDuration(60));
+			}
+
+			THEN("Both worlds settle the same stack")
+			{
+				CHECK(threadedWorld.GetCollisionSlop() == Catch::Approx(0.01f));
+
+				for (int i = 1; i <= boxCount; ++i)
+				{
+					CHECK(threadedBodies[i].GetPosition().y == Catch::Approx(float(i - 1)).margin(0.1f));
+					CHECK(threadedBodies[i].GetPosition().x == Catch::Approx(bodies[i].GetPosition().x).margin(0.05f));
+					CHECK(threadedBodies[i].GetPosition().y == Catch::Approx(bodies[i].GetPosition().y).margin(0.05f));
+				}
+			}
+		}
+	}
+
+	GIVEN("A physic world with a falling box above a static ground")
+	{
+		Nz::PhysWorld2D world;
+		world.SetGravity(Nz::Vector2f(0.f, -10.f));
+		world.SetStepSize(Nz::Time::TickDuration(60));
+
+		Nz::RigidBody2D ground = CreateBody(world, Nz::Vector2f(-5.f, -1.f), false, Nz::Vector2f(10.f, 1.f));
+		Nz::RigidBody2D box = CreateBody(world, Nz::Vector2f(0.f, 5.f));
+		CHECK(ground.GetBodyIndex() != box.GetBodyIndex());
+
+		WHEN("We step the world")
+		{
+			world.Step(Nz::Time::TickDuration(60));
+
+			THEN("Only the box is reported as active")
+			{
+				const Nz::Bitset<Nz::UInt64>& activeBodies = world.GetActiveBodies();
+				CHECK(activeBodies.Test(box.GetBodyIndex()));
+				CHECK_FALSE(activeBodies.Test(ground.GetBodyIndex()));
+			}
+		}
+
+		WHEN("We step the world by half a step")
+		{
+			world.Step(Nz::Time::TickDuration(120));
+
+			THEN("Nothing moves and the interpolation factor reflects the remaining time")
+			{
+				CHECK(world.GetActiveBodies().FindFirst() == Nz::Bitset<Nz::UInt64>::npos);
+				CHECK(world.GetInterpolationFactor() == Catch::Approx(0.5f).margin(0.01f));
+			}
+		}
+
+		WHEN("We destroy a body and create another one")
+		{
+			std::size_t bodyIndex;
+			{
+				Nz::RigidBody2D tempBody = CreateBody(world, Nz::Vector2f(5.f, 5.f));
+				bodyIndex = tempBody.GetBodyIndex();
+			}
+
+			Nz::RigidBody2D newBody = CreateBody(world, Nz::Vector2f(5.f, 5.f));
+
+			THEN("Its body index is reused")
+			{
+				CHECK(newBody.GetBodyIndex() == bodyIndex);
+			}
+		}
+	}
+
+	GIVEN("A deterministic physic world with a stack of boxes")
+	{
+		Nz::PhysWorld2D world;
+		world.EnableDeterminism();
+		world.SetGravity(Nz::Vector2f(0.f, -10.f));
+		world.SetStepSize(Nz::Time::TickDuration(60));
+		CHECK(world.IsDeterminismEnabled());
+
+		unsigned int collisionCount = 0;
+
+		Nz::PhysWorld2D::Callback callbacks;
+		callbacks.startCallback = [&](Nz::PhysWorld2D&, Nz::Arbiter2D&, Nz::RigidBody2D&, Nz::RigidBody2D&, void*)
+		{
+			collisionCount++;
+			return true;
+		};
+		world.RegisterCallbacks(0, callbacks);
+
+		std::vector<Nz::RigidBody2D> bodies;
+		bodies.push_back(CreateBody(world, Nz::Vector2f(-5.f, -1.f), false, Nz::Vector2f(10.f, 1.f)));
+		for (int i = 0; i != 5; ++i)
+			bodies.push_back(CreateBody(world, Nz::Vector2f(0.1f * i, 1.1f * i)));
+
+		for (int i = 0; i != 30; ++i)
+			world.Step(Nz::Time::TickDuration(60));
+
+		Nz::ByteArray state;
+		world.SaveState(state);
+
+		auto StepAndRecord = [&]
+		{
+			for (int i = 0; i != 60; ++i)
+				world.Step(Nz::Time::TickDuration(60));
+
+			std::vector<Nz::Vector2f> positions;
+			for (const Nz::RigidBody2D& body : bodies)
+				positions.push_back(body.GetPosition());
+
+			return positions;
+		};
+
+		WHEN("We step the world, restore it and step it again")
+		{
+			std::vector<Nz::Vector2f> positions = StepAndRecord();
+			unsigned int firstCollisionCount = collisionCount;
+
+			REQUIRE(world.RestoreState(state));
+			collisionCount = 0;
+
+			std::vector<Nz::Vector2f> rollbackPositions = StepAndRecord();
+
+			THEN("Bodies end up at the exact same positions and touching pairs aren't reported again")
+			{
+				for (std::size_t i = 0; i < bodies.size(); ++i)
+				{
+					CHECK(rollbackPositions[i].x == positions[i].x);
+					CHECK(rollbackPositions[i].y == positions[i].y);
+				}
+
+				CHECK(collisionCount <= firstCollisionCount);
+			}
+		}
+
+		WHEN("We save the state after a timestep which isn't a whole number of microseconds")
+		{
+			Nz::Time stepSize = world.GetStepSize();
+			Nz::Time partialStep = stepSize - Nz::Time::Nanoseconds(1'500);
+
+			world.Step(partialStep);
+
+			Nz::ByteArray partialState;
+			world.SaveState(partialState);
+
+			float interpolationFactor = world.GetInterpolationFactor();
+
+			std::size_t stepCount = 0;
+			NazaraSlot(Nz::PhysWorld2D, OnPhysWorld2DPostStep, postStepSlot);
+			postStepSlot.Connect(world.OnPhysWorld2DPostStep, [&](const Nz::PhysWorld2D*, float) { stepCount++; });
+
+			world.Step(Nz::Time::Nanoseconds(1'000));
+			world.Step(Nz::Time::Nanoseconds(500));
+			std::size_t firstStepCount = stepCount;
+
+			REQUIRE(world.RestoreState(partialState));
+
+			THEN("The timestep accumulator is restored to the nanosecond")
+			{
+				CHECK(world.GetInterpolationFactor() == interpolationFactor);
+
+				stepCount = 0;
+				world.Step(Nz::Time::Nanoseconds(1'000));
+				CHECK(stepCount == 0);
+				world.Step(Nz::Time::Nanoseconds(500));
+				CHECK(stepCount == 1);
+				CHECK(stepCount == firstStepCount);
+			}
+		}
+
+		WHEN("We restore an invalid state")
+		{
+			Nz::ByteArray invalidState = state;
+			invalidState.Resize(invalidState.GetSize() - 1);
+
+			Nz::Vector2f position = bodies[1].GetPosition();
+
+			THEN("It fails without touching the world")
+			{
+				CHECK_FALSE(world.RestoreState(invalidState));
+				CHECK(bodies[1].GetPosition() == position);
+			}
+		}
+	}
+}
+
+SCENARIO("PhysWorld2D state benchmark", "[.][PHYSICS2D][PHYSWORLD2D][BENCHMARK]")
+{
+	Nz::PhysWorld2D world;
+	world.EnableDeterminism();
+	world.SetGravity(Nz::Vector2f(0.f, -10.f));
+
+	std::vector<Nz::RigidBody2D> bodies;
+	bodies.push_back(CreateBody(world, Nz::Vector2f(-500.f, -1.f), false, Nz::Vector2f(1000.f, 1.f)));
+	for (int i = 0; i != 5000; ++i)
+		bodies.push_back(CreateBody(world, Nz::Vector2f(1.1f * (i % 100 - 50), 1.1f * (i / 100))));
+
+	for (int i = 0; i != 10; ++i)
+		world.Step(Nz::Time::TickDuration(60));
+
+	Nz::ByteArray state;
+	world.SaveState(state);
+
+	BENCHMARK("SaveState")
+	{
+		world.SaveState(state);
+		return state.GetSize();
+	};
+
+	BENCHMARK("RestoreState")
+	{
+		return world.RestoreState(state);
+	};
 }
 
 Nz::RigidBody2D CreateBody(Nz::PhysWorld2D& world, const Nz::Vector2f& position, bool isMoving, const Nz::Vector2f& lengths)
@@ -0,0 +1,120 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Physics3D/Collider3D.hpp>
+#include <Nazara/Physics3D/PhysWorld3D.hpp>
+#include <Nazara/Physics3D/RigidBody3D.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+Nz::RigidBody3D CreateBody(Nz::PhysWorld3D& world, const Nz::Vector3f& position, bool isMoving = true, const Nz::Vector3f& lengths = Nz::Vector3f::Unit());
+
+SCENARIO("PhysWorld3D", "[PHYSICS3D][PHYSWORLD3D]")
+{
+	GIVEN("A deterministic physic world with a stack of boxes")
+	{
+		Nz::PhysWorld3D world;
+		world.EnableDeterminism();
+		world.SetGravity(Nz::Vector3f(0.f, -10.f, 0.f));
+		world.SetStepSize(Nz::Time::TickDuration(60));
+		CHECK(world.IsDeterminismEnabled());
+
+		std::vector<Nz::RigidBody3D> bodies;
+		bodies.push_back(CreateBody(world, Nz::Vector3f(0.f, -0.5f, 0.f), false, Nz::Vector3f(10.f, 1.f, 10.f)));
+		for (int i = 0; i != 5; ++i)
+			bodies.push_back(CreateBody(world, Nz::Vector3f(0.1f * i, 1.1f * i + 0.5f, 0.f)));
+
+		for (int i = 0; i != 30; ++i)
+			world.Step(Nz::Time::TickDuration(60));
+
+		Nz::ByteArray state;
+		world.SaveState(state);
+
+		auto StepAndRecord = [&]
+		{
+			for (int i = 0; i != 60; ++i)
+				world.Step(Nz::Time::TickDuration(60));
+
+			std::vector<Nz::Vector3f> positions;
+			for (const Nz::RigidBody3D& body : bodies)
+				positions.push_back(body.GetPosition());
+
+			return positions;
+		};
+
+		WHEN("We step the world, restore it and step it again")
+		{
+			std::vector<Nz::Vector3f> positions = StepAndRecord();
+
+			REQUIRE(world.RestoreState(state));
+
+			std::vector<Nz::Vector3f> rollbackPositions = StepAndRecord();
+
+			THEN("Bodies end up at the exact same positions")
+			{
+				for (std::size_t i = 0; i < bodies.size(); ++i)
+				{
+					CHECK(rollbackPositions[i].x == positions[i].x);
+					CHECK(rollbackPositions[i].y == positions[i].y);
+					CHECK(rollbackPositions[i].z == positions[i].z);
+				}
+			}
+		}
+
+		WHEN("We save the state after a timestep which isn't a whole number of microseconds")
+		{
+			Nz::Time stepSize = world.GetStepSize();
+			Nz::Time partialStep = stepSize - Nz::Time::Nanoseconds(1'500);
+
+			world.Step(partialStep);
+
+			Nz::ByteArray partialState;
+			world.SaveState(partialState);
+
+			float interpolationFactor = world.GetInterpolationFactor();
+
+			std::size_t stepCount = 0;
+			NazaraSlot(Nz::PhysWorld3D, OnPhysWorld3DPostStep, postStepSlot);
+			postStepSlot.Connect(world.OnPhysWorld3DPostStep, [&](const Nz::PhysWorld3D*, float) { stepCount++; });
+
+			world.Step(Nz::Time::Nanoseconds(1'000));
+			world.Step(Nz::Time::Nanoseconds(500));
+			std::size_t firstStepCount = stepCount;
+
+			REQUIRE(world.RestoreState(partialState));
+
+			THEN("The timestep accumulator is restored to the nanosecond")
+			{
+				CHECK(world.GetInterpolationFactor() == interpolationFactor);
+
+				stepCount = 0;
+				world.Step(Nz::Time::Nanoseconds(1'000));
+				CHECK(stepCount == 0);
+				world.Step(Nz::Time::Nanoseconds(500));
+				CHECK(stepCount == 1);
+				CHECK(stepCount == firstStepCount);
+			}
+		}
+
+		WHEN("We restore an invalid state")
+		{
+			Nz::ByteArray invalidState = state;
+			invalidState.Resize(invalidState.GetSize() - 1);
+
+			Nz::Vector3f position = bodies[1].GetPosition();
+
+			THEN("It fails without touching the world")
+			{
+				CHECK_FALSE(world.RestoreState(invalidState));
+				CHECK(bodies[1].GetPosition() == position);
+			}
+		}
+	}
+}
+
+Nz::RigidBody3D CreateBody(Nz::PhysWorld3D& world, const Nz::Vector3f& position, bool isMoving, const Nz::Vector3f& lengths)
+{
+	std::shared_ptr<Nz::Collider3D> box = std::make_shared<Nz::BoxCollider3D>(lengths);
+	Nz::RigidBody3D rigidBody(&world, box);
+	rigidBody.SetMass(isMoving ? 1.f : 0.f);
+	rigidBody.SetPosition(position);
+	return rigidBody;
+}
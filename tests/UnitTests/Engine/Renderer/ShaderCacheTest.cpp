@@ -0,0 +1,123 @@
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Renderer/ShaderCache.hpp>
+#include <NZSL/Parser.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <filesystem>
+
+namespace
+{
+	const char s_shaderSource[] = R"(
+[nzsl_version("1.0")]
+module;
+
+option red: bool = false;
+
+struct FragOut
+{
+	[location(0)] color: vec4[f32]
+}
+
+[entry(frag)]
+fn main() -> FragOut
+{
+	let fragOut: FragOut;
+	fragOut.color = const_select(red, vec4[f32](1.0, 0.0, 0.0, 1.0), vec4[f32](1.0, 1.0, 1.0, 1.0));
+
+	return fragOut;
+}
+)";
+}
+
+SCENARIO("ShaderCache", "[RENDERER][SHADERCACHE]")
+{
+	GIVEN("A shader module with an option")
+	{
+		nzsl::Ast::ModulePtr shaderModule = nzsl::Parse(std::string_view(s_shaderSource, sizeof(s_shaderSource) - 1));
+		REQUIRE(shaderModule);
+
+		nzsl::ShaderWriter::States states;
+		states.optionValues[Nz::CRC32("red")] = false;
+
+		Nz::UInt64 key = Nz::ShaderCache::ComputeShaderKey(nzsl::ShaderStageType::Fragment, *shaderModule, states, Nz::ShaderLanguage::SpirV);
+
+		WHEN("We compute the key of the same shader again")
+		{
+			nzsl::Ast::ModulePtr otherModule = nzsl::Parse(std::string_view(s_shaderSource, sizeof(s_shaderSource) - 1));
+
+			THEN("Keys are the same")
+			{
+				CHECK(Nz::ShaderCache::ComputeShaderKey(nzsl::ShaderStageType::Fragment, *otherModule, states, Nz::ShaderLanguage::SpirV) == key);
+				CHECK(Nz::ShaderCache::ComputeModuleKey(*otherModule) == Nz::ShaderCache::ComputeModuleKey(*shaderModule));
+				CHECK(Nz::ShaderCache::ComputeShaderKey(nzsl::ShaderStageType::Fragment, Nz::ShaderCache::ComputeModuleKey(*otherModule), states, Nz::ShaderLanguage::SpirV) == key);
+			}
+		}
+
+		WHEN("We change an option value, the stages or the language")
+		{
+			nzsl::ShaderWriter::States redStates = states;
+			redStates.optionValues[Nz::CRC32("red")] = true;
+
+			THEN("Keys are different")
+			{
+				CHECK(Nz::ShaderCache::ComputeShaderKey(nzsl::ShaderStageType::Fragment, *shaderModule, redStates, Nz::ShaderLanguage::SpirV) != key);
+				CHECK(Nz::ShaderCache::ComputeShaderKey(nzsl::ShaderStageType::Vertex, *shaderModule, states, Nz::ShaderLanguage::SpirV) != key);
+				CHECK(Nz::ShaderCache::ComputeShaderKey(nzsl::ShaderStageType::Fragment, *shaderModule, states, Nz::ShaderLanguage::GLSL) != key);
+			}
+		}
+
+		WHEN("We compile it to SPIR-V")
+		{
+			Nz::ByteArray binary;
+			REQUIRE(Nz::ShaderCache::CompileShader(nzsl::ShaderStageType::Fragment, *shaderModule, states, Nz::ShaderLanguage::SpirV, &binary));
+
+			THEN("We get a SPIR-V binary")
+			{
+				REQUIRE(binary.GetSize() >= 5 * sizeof(Nz::UInt32));
+				REQUIRE(binary.GetSize() % sizeof(Nz::UInt32) == 0);
+
+				Nz::UInt32 magic;
+				std::memcpy(&magic, binary.GetConstBuffer(), sizeof(magic));
+				CHECK(magic == 0x07230203);
+			}
+
+			AND_WHEN("We store it in a cache which we save and reload")
+			{
+				std::filesystem::path cachePath = "ShaderCacheTest.nzsc";
+
+				Nz::ShaderCache cache;
+				CHECK_FALSE(cache.IsModified());
+				CHECK_FALSE(cache.Find(key, nullptr));
+
+				cache.Insert(key, binary);
+				CHECK(cache.IsModified());
+				REQUIRE(cache.Save(cachePath));
+				CHECK_FALSE(cache.IsModified());
+
+				Nz::ShaderCache loadedCache;
+				REQUIRE(loadedCache.Load(cachePath));
+				std::filesystem::remove(cachePath);
+
+				THEN("The binary is retrieved from the loaded cache")
+				{
+					CHECK(loadedCache.GetEntryCount() == 1);
+					CHECK_FALSE(loadedCache.IsModified());
+
+					Nz::ByteArray loadedBinary;
+					REQUIRE(loadedCache.Find(key, &loadedBinary));
+					CHECK(loadedBinary == binary);
+				}
+			}
+		}
+
+		WHEN("We compile it to a language generated by backends")
+		{
+			Nz::ByteArray binary;
+
+			THEN("Compilation is refused")
+			{
+				CHECK_FALSE(Nz::ShaderCache::CompileShader(nzsl::ShaderStageType::Fragment, *shaderModule, states, Nz::ShaderLanguage::GLSL, &binary));
+			}
+		}
+	}
+}
@@ -0,0 +1,209 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Utility/BlockCompressor.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+	int ComputeMaxError(const Nz::Image& lhs, const Nz::Image& rhs, unsigned int channelCount)
+	{
+		const Nz::UInt8* lhsPixels = lhs.GetConstPixels();
+		const Nz::UInt8* rhsPixels = rhs.GetConstPixels();
+
+		int maxError = 0;
+		for (std::size_t i = 0; i < std::size_t(lhs.GetWidth()) * lhs.GetHeight(); ++i)
+		{
+			for (unsigned int c = 0; c < channelCount; ++c)
+				maxError = std::max(maxError, std::abs(int(lhsPixels[i * 4 + c]) - int(rhsPixels[i * 4 + c])));
+		}
+
+		return maxError;
+	}
+
+	// Reference BC7 mode 6 decoder written from the specification, independently of the encoder
+	bool DecodeBC7Mode6(const Nz::UInt8* block, Nz::UInt8 (*pixels)[4])
+	{
+		unsigned int bitOffset = 0;
+		auto ReadBits = [&](unsigned int bitCount)
+		{
+			unsigned int value = 0;
+			for (unsigned int i = 0; i < bitCount; ++i, ++bitOffset)
+				value |= ((block[bitOffset / 8] >> (bitOffset % 8)) & 1) << i;
+
+			return value;
+		};
+
+		if (ReadBits(7) != 0x40)
+			return false;
+
+		unsigned int endpoints[2][4];
+		for (unsigned int c = 0; c < 4; ++c)
+		{
+			endpoints[0][c] = ReadBits(7) << 1;
+			endpoints[1][c] = ReadBits(7) << 1;
+		}
+
+		for (unsigned int e = 0; e < 2; ++e)
+		{
+			unsigned int pBit = ReadBits(1);
+			for (unsigned int c = 0; c < 4; ++c)
+				endpoints[e][c] |= pBit;
+		}
+
+		constexpr unsigned int weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+		for (unsigned int i = 0; i < 16; ++i)
+		{
+			unsigned int index = ReadBits((i == 0) ? 3 : 4); //< anchor index has an implicit high bit
+			for (unsigned int c = 0; c < 4; ++c)
+				pixels[i][c] = static_cast<Nz::UInt8>(((64 - weights[index]) * endpoints[0][c] + weights[index] * endpoints[1][c] + 32) >> 6);
+		}
+
+		return bitOffset == 128;
+	}
+}
+
+SCENARIO("Block compression", "[Utility][Image]")
+{
+	GIVEN("A smooth RGBA8 gradient whose size isn't a multiple of four")
+	{
+		constexpr unsigned int Width = 66;
+		constexpr unsigned int Height = 37;
+
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, Width, Height);
+		Nz::UInt8* pixels = image.GetPixels();
+		for (unsigned int y = 0; y < Height; ++y)
+		{
+			for (unsigned int x = 0; x < Width; ++x)
+			{
+				Nz::UInt8* pixel = &pixels[(y * Width + x) * 4];
+				pixel[0] = static_cast<Nz::UInt8>(x * 255 / (Width - 1));
+				pixel[1] = static_cast<Nz::UInt8>(y * 255 / (Height - 1));
+				pixel[2] = 128;
+				pixel[3] = static_cast<Nz::UInt8>(255 - x);
+			}
+		}
+
+		Nz::Image original(image);
+
+		WHEN("We compress it to DXT1 and decompress it")
+		{
+			REQUIRE(image.Convert(Nz::PixelFormat::DXT1));
+			CHECK(image.GetFormat() == Nz::PixelFormat::DXT1);
+			CHECK(image.GetMemoryUsage() == 17 * 10 * 8);
+
+			REQUIRE(image.Convert(Nz::PixelFormat::RGBA8));
+
+			THEN("Colors stay close to the original")
+			{
+				CHECK(ComputeMaxError(image, original, 3) <= 16);
+			}
+		}
+
+		WHEN("We compress it to DXT5 and decompress it")
+		{
+			REQUIRE(image.Convert(Nz::PixelFormat::DXT5, Nz::BlockCompressionQuality::High));
+			REQUIRE(image.Convert(Nz::PixelFormat::RGBA8));
+
+			THEN("Colors and alpha stay close to the original")
+			{
+				CHECK(ComputeMaxError(image, original, 4) <= 16);
+			}
+		}
+
+		WHEN("We compress it to BC4 and BC5 and decompress them")
+		{
+			Nz::Image bc4(image);
+			REQUIRE(bc4.Convert(Nz::PixelFormat::BC4, Nz::BlockCompressionQuality::Fast));
+			REQUIRE(bc4.Convert(Nz::PixelFormat::RGBA8));
+
+			Nz::Image bc5(image);
+			REQUIRE(bc5.Convert(Nz::PixelFormat::BC5));
+			REQUIRE(bc5.Convert(Nz::PixelFormat::RGBA8));
+
+			THEN("Single and dual channel formats are almost lossless on gradients")
+			{
+				CHECK(ComputeMaxError(bc4, original, 1) <= 2);
+				CHECK(ComputeMaxError(bc5, original, 2) <= 2);
+			}
+		}
+
+		WHEN("We compress it to BC7")
+		{
+			REQUIRE(image.Convert(Nz::PixelFormat::BC7));
+			CHECK(image.GetMemoryUsage() == 17 * 10 * 16);
+
+			THEN("Decoding the blocks gives back colors and alpha close to the original")
+			{
+				const Nz::UInt8* blocks = image.GetConstPixels();
+				const Nz::UInt8* originalPixels = original.GetConstPixels();
+
+				int maxError = 0;
+				for (unsigned int blockY = 0; blockY < 10; ++blockY)
+				{
+					for (unsigned int blockX = 0; blockX < 17; ++blockX)
+					{
+						Nz::UInt8 decoded[16][4];
+						REQUIRE(DecodeBC7Mode6(&blocks[(blockY * 17 + blockX) * 16], decoded));
+
+						for (unsigned int i = 0; i < 16; ++i)
+						{
+							unsigned int x = blockX * 4 + i % 4;
+							unsigned int y = blockY * 4 + i / 4;
+							if (x >= Width || y >= Height)
+								continue;
+
+							for (unsigned int c = 0; c < 4; ++c)
+								maxError = std::max(maxError, std::abs(int(decoded[i][c]) - int(originalPixels[(y * Width + x) * 4 + c])));
+						}
+					}
+				}
+
+				CHECK(maxError <= 8);
+			}
+		}
+	}
+
+	GIVEN("A block compressed image with mipmaps")
+	{
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, 32, 32, 1, 6);
+		for (Nz::UInt8 level = 0; level < image.GetLevelCount(); ++level)
+		{
+			Nz::UInt8* pixels = image.GetPixels(0, 0, 0, level);
+			for (std::size_t i = 0; i < image.GetMemoryUsage(level); ++i)
+				pixels[i] = static_cast<Nz::UInt8>(level * 40 + i % 4);
+		}
+
+		REQUIRE(image.Convert(Nz::PixelFormat::BC5));
+
+		WHEN("We save it as DDS and load it back")
+		{
+			Nz::ByteArray data;
+			Nz::MemoryStream stream(&data);
+			REQUIRE(image.SaveToStream(stream, ".dds"));
+
+			std::shared_ptr<Nz::Image> loadedImage = Nz::Image::LoadFromMemory(data.GetConstBuffer(), data.GetSize());
+			REQUIRE(loadedImage);
+
+			THEN("We get the same mip chain")
+			{
+				CHECK(loadedImage->GetFormat() == Nz::PixelFormat::BC5);
+				CHECK(loadedImage->GetWidth() == 32);
+				CHECK(loadedImage->GetHeight() == 32);
+				REQUIRE(loadedImage->GetLevelCount() == image.GetLevelCount());
+				CHECK(loadedImage->GetMemoryUsage() == image.GetMemoryUsage());
+				CHECK(std::memcmp(loadedImage->GetConstPixels(0, 0, 0, 5), image.GetConstPixels(0, 0, 0, 5), image.GetMemoryUsage(5)) == 0);
+			}
+		}
+	}
+
+	GIVEN("A format the compressor doesn't handle")
+	{
+		CHECK_FALSE(Nz::BlockCompressor::IsSupported(Nz::PixelFormat::RGBA8));
+		CHECK(Nz::BlockCompressor::IsSupported(Nz::PixelFormat::BC7));
+	}
+}
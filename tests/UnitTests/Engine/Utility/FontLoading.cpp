@@ -148,5 +148,51 @@ SCENARIO("Fonts", "[Utility][Font]")
 				font->ClearSizeInfoCache();
 			}
 		}
+
+		WHEN("Using signed distance field glyphs")
+		{
+			std::shared_ptr<Nz::GuillotineImageAtlas> distanceFieldAtlas = std::make_shared<Nz::GuillotineImageAtlas>();
+			distanceFieldAtlas->SetMaxLayerSize(1024);
+
+			font->SetAtlas(distanceFieldAtlas);
+			font->SetGlyphRenderMode(Nz::GlyphRenderMode::SignedDistanceField);
+			CHECK(font->GetGlyphRenderMode() == Nz::GlyphRenderMode::SignedDistanceField);
+
+			std::string characterSet;
+			for (char c = 'A'; c <= 'Z'; ++c)
+				characterSet += c;
+
+			for (unsigned int fontSize : {12, 24, 48, 140})
+			{
+				for (float outlineThickness : { 0.f, 2.f })
+					font->Precache(fontSize, Nz::TextStyle_Regular, outlineThickness, characterSet);
+			}
+
+			THEN("Every size and outline share the same rasterization")
+			{
+				const auto& glyph24 = font->GetGlyph(24, Nz::TextStyle_Regular, 0.f, 'L');
+				const auto& glyph140 = font->GetGlyph(140, Nz::TextStyle_Regular, 0.f, 'L');
+				const auto& outlinedGlyph24 = font->GetGlyph(24, Nz::TextStyle_Regular, 2.f, 'L');
+				REQUIRE(glyph24.valid);
+				REQUIRE(glyph140.valid);
+				REQUIRE(outlinedGlyph24.valid);
+
+				CHECK(glyph24.atlasRect.IsValid());
+				CHECK(glyph140.atlasRect == glyph24.atlasRect);
+				CHECK(outlinedGlyph24.atlasRect == glyph24.atlasRect);
+				CHECK(outlinedGlyph24.aabb == glyph24.aabb);
+				CHECK(outlinedGlyph24.fauxOutlineThickness == 2.f);
+				CHECK(glyph24.fauxOutlineThickness == 0.f);
+
+				CHECK(glyph140.aabb.width > glyph24.aabb.width * 5);
+				CHECK(glyph140.advance >= 70);
+				CHECK(glyph140.advance <= 74);
+
+				CHECK(distanceFieldAtlas->GetLayerCount() == 1);
+			}
+
+			font->SetGlyphRenderMode(Nz::GlyphRenderMode::Bitmap);
+			font->SetAtlas(imageAtlas);
+		}
 	}
 }
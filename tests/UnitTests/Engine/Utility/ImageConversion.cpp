@@ -0,0 +1,115 @@
+#include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstring>
+#include <vector>
+
+SCENARIO("Image conversion", "[Utility][Image]")
+{
+	GIVEN("A large RGBA8 image")
+	{
+		constexpr unsigned int Width = 1000;
+		constexpr unsigned int Height = 700;
+
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, Width, Height);
+		Nz::UInt8* pixels = image.GetPixels();
+		for (std::size_t i = 0; i < Width * Height * 4; ++i)
+			pixels[i] = static_cast<Nz::UInt8>(i * 7 + i / 13);
+
+		Nz::Image original(image);
+
+		WHEN("We convert it to BGRA8 and back")
+		{
+			REQUIRE(image.Convert(Nz::PixelFormat::BGRA8));
+			CHECK(image.GetFormat() == Nz::PixelFormat::BGRA8);
+
+			const Nz::UInt8* bgra = image.GetConstPixels();
+			const Nz::UInt8* rgba = original.GetConstPixels();
+			CHECK(bgra[0] == rgba[2]);
+			CHECK(bgra[1] == rgba[1]);
+			CHECK(bgra[2] == rgba[0]);
+			CHECK(bgra[3] == rgba[3]);
+
+			REQUIRE(image.Convert(Nz::PixelFormat::RGBA8));
+
+			THEN("We get the same pixels")
+			{
+				CHECK(std::memcmp(image.GetConstPixels(), original.GetConstPixels(), Width * Height * 4) == 0);
+			}
+		}
+
+		WHEN("We convert it to RGBA32F and back")
+		{
+			REQUIRE(image.Convert(Nz::PixelFormat::RGBA32F));
+			CHECK(image.GetFormat() == Nz::PixelFormat::RGBA32F);
+			REQUIRE(image.Convert(Nz::PixelFormat::RGBA8));
+
+			THEN("We get the same pixels")
+			{
+				CHECK(std::memcmp(image.GetConstPixels(), original.GetConstPixels(), Width * Height * 4) == 0);
+			}
+		}
+	}
+
+	GIVEN("A DXT1 image whose size isn't a multiple of four")
+	{
+		// Two blocks: a red one and a blue one (both using index 0)
+		std::array<Nz::UInt8, 8> redBlock = { 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00 };
+		std::array<Nz::UInt8, 8> blueBlock = { 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00 };
+
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::DXT1, 6, 3);
+		REQUIRE(image.GetMemoryUsage() == 2 * 8);
+
+		Nz::UInt8* blocks = image.GetPixels();
+		std::memcpy(&blocks[0], redBlock.data(), redBlock.size());
+		std::memcpy(&blocks[8], blueBlock.data(), blueBlock.size());
+
+		REQUIRE(Nz::PixelFormatInfo::IsDecompressionSupported(Nz::PixelFormat::DXT1, Nz::PixelFormat::RGBA8));
+		CHECK_FALSE(Nz::PixelFormatInfo::IsConversionSupported(Nz::PixelFormat::DXT1, Nz::PixelFormat::RGBA8));
+
+		WHEN("We decompress it to RGBA8")
+		{
+			REQUIRE(image.Convert(Nz::PixelFormat::RGBA8));
+			CHECK(image.GetFormat() == Nz::PixelFormat::RGBA8);
+			CHECK(image.GetWidth() == 6);
+			CHECK(image.GetHeight() == 3);
+
+			THEN("Each block gives its color to its pixels")
+			{
+				CHECK(image.GetPixelColor(0, 0) == Nz::Color::Red());
+				CHECK(image.GetPixelColor(3, 2) == Nz::Color::Red());
+				CHECK(image.GetPixelColor(4, 0) == Nz::Color::Blue());
+				CHECK(image.GetPixelColor(5, 2) == Nz::Color::Blue());
+			}
+		}
+
+		WHEN("We decompress its blocks directly")
+		{
+			std::vector<Nz::UInt8> pixels(6 * 3 * 4);
+			REQUIRE(Nz::PixelFormatInfo::Decompress(Nz::PixelFormat::DXT1, Nz::PixelFormat::BGRA8, blocks, 6, 3, pixels.data()));
+
+			THEN("Pixels are tightly packed")
+			{
+				for (unsigned int y = 0; y < 3; ++y)
+				{
+					for (unsigned int x = 0; x < 6; ++x)
+					{
+						const Nz::UInt8* pixel = &pixels[(y * 6 + x) * 4];
+						if (x < 4)
+							CHECK((pixel[0] == 0x00 && pixel[2] == 0xFF && pixel[3] == 0xFF));
+						else
+							CHECK((pixel[0] == 0xFF && pixel[2] == 0x00 && pixel[3] == 0xFF));
+					}
+				}
+			}
+
+			THEN("Per pixel conversion refuses block-compressed formats")
+			{
+				Nz::ErrorFlags errFlags(Nz::ErrorMode::Silent);
+				CHECK_FALSE(Nz::PixelFormatInfo::Convert(Nz::PixelFormat::DXT1, Nz::PixelFormat::RGBA8, blocks, blocks + 16, pixels.data()));
+			}
+		}
+	}
+}
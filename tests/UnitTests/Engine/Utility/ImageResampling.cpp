@@ -0,0 +1,97 @@
+#include <Nazara/Utility/Image.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+SCENARIO("Image resampling", "[Utility][Image]")
+{
+	GIVEN("A checkerboard RGBA8 image with mipmaps")
+	{
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, 64, 48, 1, 0xFF);
+		CHECK(image.GetLevelCount() == image.GetMaxLevel());
+
+		for (unsigned int y = 0; y < 48; ++y)
+		{
+			for (unsigned int x = 0; x < 64; ++x)
+				image.SetPixelColor(((x + y) % 2 == 0) ? Nz::Color::White() : Nz::Color::Black(), x, y);
+		}
+
+		WHEN("We generate its mipmaps with a box filter")
+		{
+			REQUIRE(image.GenerateMipmaps());
+
+			THEN("Every level is the average gray")
+			{
+				for (Nz::UInt8 level = 1; level < image.GetLevelCount(); ++level)
+				{
+					const Nz::UInt8* pixels = image.GetConstPixels(0, 0, 0, level);
+					for (std::size_t i = 0; i < image.GetWidth(level) * image.GetHeight(level); ++i)
+					{
+						CHECK(pixels[i * 4 + 0] >= 127);
+						CHECK(pixels[i * 4 + 0] <= 128);
+						CHECK(pixels[i * 4 + 3] == 255);
+					}
+				}
+			}
+		}
+
+		WHEN("We generate its mipmaps in linear space with a Kaiser filter")
+		{
+			Nz::MipmapParams params;
+			params.filter = Nz::ImageFilter::Kaiser;
+			params.sRGB = true;
+
+			REQUIRE(image.GenerateMipmaps(params));
+
+			THEN("The average gray is sRGB-encoded")
+			{
+				// 50% linear intensity is 188 in sRGB (away from the borders)
+				const Nz::UInt8* pixel = image.GetConstPixels(5, 5, 0, 1);
+				CHECK(pixel[0] >= 186);
+				CHECK(pixel[0] <= 190);
+			}
+		}
+	}
+
+	GIVEN("An image with a gradient")
+	{
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA32F, 5, 3);
+		float* pixels = reinterpret_cast<float*>(image.GetPixels());
+		for (unsigned int y = 0; y < 3; ++y)
+		{
+			for (unsigned int x = 0; x < 5; ++x)
+			{
+				float* pixel = &pixels[(y * 5 + x) * 4];
+				pixel[0] = pixel[1] = pixel[2] = x / 4.f;
+				pixel[3] = 1.f;
+			}
+		}
+
+		WHEN("We resize it")
+		{
+			REQUIRE(image.Resize(9, 6, Nz::ImageFilter::Triangle));
+
+			THEN("The image has its new size and keeps its content")
+			{
+				CHECK(image.GetWidth() == 9);
+				CHECK(image.GetHeight() == 6);
+				CHECK(image.GetLevelCount() == 1);
+
+				const float* resizedPixels = reinterpret_cast<const float*>(image.GetConstPixels());
+				for (unsigned int x = 1; x < 9; ++x)
+					CHECK(resizedPixels[x * 4] >= resizedPixels[(x - 1) * 4]);
+
+				CHECK(resizedPixels[3] > 0.999f);
+			}
+		}
+	}
+
+	GIVEN("A compressed image")
+	{
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::DXT1, 16, 16, 1, 2);
+
+		THEN("It cannot be resampled")
+		{
+			CHECK_FALSE(image.GenerateMipmaps());
+			CHECK_FALSE(image.Resize(8, 8));
+		}
+	}
+}
@@ -0,0 +1,96 @@
+#include <Nazara/Utility/Components/NodeComponent.hpp>
+#include <Nazara/Utility/Systems/TransformSystem.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+SCENARIO("TransformSystem", "[UTILITY][TRANSFORMSYSTEM]")
+{
+	GIVEN("A registry with a transform system and a parent/child hierarchy")
+	{
+		entt::registry registry;
+		Nz::TransformSystem transformSystem(registry);
+
+		CHECK(Nz::TransformSystem::Find(registry) == &transformSystem);
+
+		entt::entity parent = registry.create();
+		entt::entity child = registry.create();
+		entt::entity other = registry.create();
+
+		// Child is created before its parent to check slots are sorted by depth
+		Nz::NodeComponent& childNode = registry.emplace<Nz::NodeComponent>(child);
+		Nz::NodeComponent& parentNode = registry.emplace<Nz::NodeComponent>(parent);
+		registry.emplace<Nz::NodeComponent>(other);
+
+		childNode.SetParent(parentNode);
+		childNode.SetPosition(Nz::Vector3f(1.f, 0.f, 0.f));
+		parentNode.SetPosition(Nz::Vector3f(0.f, 2.f, 0.f));
+		parentNode.SetScale(Nz::Vector3f(2.f));
+
+		transformSystem.Update(Nz::Time::Zero());
+
+		std::size_t parentSlot = transformSystem.GetSlot(parentNode);
+		std::size_t childSlot = transformSystem.GetSlot(childNode);
+
+		THEN("World transforms match the node ones and parents come first")
+		{
+			REQUIRE(transformSystem.GetTransformCount() == 3);
+			CHECK(parentSlot < childSlot);
+			CHECK(transformSystem.GetEntity(childSlot) == child);
+
+			const Nz::Vector3f& childPosition = transformSystem.GetWorldPosition(childSlot);
+			CHECK(childPosition.x == Catch::Approx(2.f));
+			CHECK(childPosition.y == Catch::Approx(2.f));
+			CHECK(childPosition.z == Catch::Approx(0.f));
+
+			Nz::Vector3f nodePosition = childNode.GetPosition(Nz::CoordSys::Global);
+			CHECK(childPosition.x == Catch::Approx(nodePosition.x));
+			CHECK(childPosition.y == Catch::Approx(nodePosition.y));
+
+			CHECK(transformSystem.GetWorldScale(childSlot).x == Catch::Approx(2.f));
+			CHECK(transformSystem.GetWorldMatrix(childSlot).GetTranslation().x == Catch::Approx(2.f));
+		}
+
+		WHEN("Updating without changes")
+		{
+			transformSystem.Update(Nz::Time::Zero());
+
+			THEN("Nothing is invalidated")
+			{
+				CHECK(transformSystem.GetInvalidatedRanges().empty());
+			}
+		}
+
+		WHEN("Moving the parent")
+		{
+			parentNode.Move(Nz::Vector3f(0.f, 0.f, 1.f));
+			transformSystem.Update(Nz::Time::Zero());
+
+			THEN("The parent and its child are invalidated but not the other node")
+			{
+				CHECK(transformSystem.IsInvalidated(parentSlot));
+				CHECK(transformSystem.IsInvalidated(childSlot));
+				CHECK(!transformSystem.IsInvalidated(transformSystem.GetSlot(registry.get<Nz::NodeComponent>(other))));
+
+				std::size_t invalidatedCount = 0;
+				for (const auto& range : transformSystem.GetInvalidatedRanges())
+					invalidatedCount += range.count;
+
+				CHECK(invalidatedCount == 2);
+				CHECK(transformSystem.GetWorldPosition(childSlot).z == Catch::Approx(1.f));
+			}
+		}
+
+		WHEN("Destroying the parent")
+		{
+			registry.destroy(parent);
+			transformSystem.Update(Nz::Time::Zero());
+
+			THEN("The child becomes a root")
+			{
+				const Nz::Vector3f& childPosition = transformSystem.GetWorldPosition(transformSystem.GetSlot(childNode));
+				CHECK(childPosition.x == Catch::Approx(1.f));
+				CHECK(childPosition.y == Catch::Approx(0.f));
+			}
+		}
+	}
+}
@@ -5,7 +5,7 @@ if is_mode("asan") then
     add_defines("CATCH_CONFIG_NO_POSIX_SIGNALS")
 end
 
-add_deps("NazaraAudio", "NazaraCore", "NazaraNetwork", "NazaraPhysics2D")
+add_deps("NazaraAudio", "NazaraCore", "NazaraNetwork", "NazaraGraphics", "NazaraPhysics2D", "NazaraPhysics3D", "NazaraRenderer")
 add_packages("catch2", "entt")
 add_headerfiles("Engine/**.hpp", { prefixdir = "private", install = false })
 add_files("resources.cpp")
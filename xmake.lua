@@ -87,6 +87,7 @@ local modules = {
 	},
 	Network = {
 		Deps = {"NazaraCore"},
+		Packages = {"entt"},
 		Custom = function()
 			if is_plat("windows", "mingw") then 
 				add_syslinks("ws2_32")
@@ -125,6 +126,14 @@ local modules = {
 		Deps = {"NazaraPlatform"},
 		PublicPackages = { "nazarautils", "nzsl" },
 		Custom = function ()
+			-- Shaders stored in the shader cache depend on the nzsl version which compiled them
+			on_config(function (target)
+				local nzsl = target:pkg("nzsl")
+				if nzsl and nzsl:version_str() then
+					target:add("defines", "NAZARA_RENDERER_NZSL_VERSION=\"" .. nzsl:version_str() .. "\"")
+				end
+			end)
+
 			if has_config("embed_rendererbackends") then
 				-- Embed backends code inside our own modules
 				add_defines("NAZARA_RENDERER_EMBEDDEDBACKENDS")